@@ -283,6 +283,10 @@ class BaseCppFile(BaseFile.BaseFile):
 
             self.update_attribute_dictionary(att_type, mydict, attrib_name)
 
+        for mydict in attributes:
+            if mydict['isArray'] and 'element_type_from' in mydict:
+                self.update_dict_with_array_storage(mydict, attributes)
+
         return attributes
 
     def update_attribute_dictionary(self, att_type, mydict, attrib_name):
@@ -465,6 +469,60 @@ class BaseCppFile(BaseFile.BaseFile):
         mydict.update({'attType': 'array', 'isNumber': False,
                        'default': 'NULL'})
 
+    @staticmethod
+    def update_dict_with_array_storage(mydict, attributes):
+        """
+        Update the dictionary (representing an array <attribute> node) whose
+        values are stored in the type given by the value of an enum
+        attribute, rather than in its element type.
+
+        :param mydict: the dictionary we are updating
+        :param attributes: the dictionaries of all the attributes of the
+            class, one of which is the enum attribute
+        :return: nothing
+
+        The storage is described by mydict['storage']: the member naming
+        the type of the stored values ('typeMember'), the member of the enum
+        attribute ('typeFrom'), the enum type ('enumType'), its invalid value
+        ('invalid'), the [enum value, C type] pairs of the values naming a
+        number type ('types'), the enum value storing bytes, if any
+        ('byteType') and the enum value storing doubles, if any ('realType').
+        Values of any other type are stored in the element type.
+        """
+        type_from = None
+        for attrib in attributes:
+            if attrib['name'] == mydict['element_type_from'] \
+                    and attrib['isEnum']:
+                type_from = attrib
+        if type_from is None or 'root' not in type_from \
+                or not type_from['root']:
+            return
+        types = []
+        byte_type = None
+        real_type = None
+        for enum in type_from['root']['enums']:
+            if enum['name'] != type_from['element']:
+                continue
+            for value in enum['values']:
+                c_type = query.get_array_storage_type(value['value'])
+                if c_type is None:
+                    continue
+                types.append([value['name'], c_type])
+                if c_type == 'unsigned char':
+                    byte_type = value['name']
+                elif c_type == 'double':
+                    real_type = value['name']
+        if len(types) == 0:
+            return
+        mydict['storage'] = dict({'typeMember': '{0}StorageType'
+                                                .format(mydict['memberName']),
+                                  'typeFrom': type_from['memberName'],
+                                  'enumType': type_from['attTypeCode'],
+                                  'invalid': type_from['default'],
+                                  'types': types,
+                                  'byteType': byte_type,
+                                  'realType': real_type})
+
     def update_dict_with_vector_att_type(self, mydict):
         """
         Update the dictionary (representing an <attribute> node) when the
@@ -949,8 +1007,11 @@ class BaseCppFile(BaseFile.BaseFile):
                         arguments = code['args_no_defaults']
                     else:
                         arguments = code['arguments']
+                return_type = code['return_type']
+                if 'static' in code and code['static']:
+                    return_type = 'static ' + return_type
                 self.write_function_header(code['function'], arguments,
-                                           code['return_type'],
+                                           return_type,
                                            code['constant'], code['virtual'])
             if exclude:
                 self.write_doxygen_end()
@@ -1243,6 +1304,8 @@ class BaseCppFile(BaseFile.BaseFile):
             self.write_block('while', code, True)
         elif code_type == 'try':
             self.write_try_block(code)
+        elif code_type == 'switch':
+            self.write_switch_block(code)
 
     def write_nested_implementation(self, implementation):
         """
@@ -1355,6 +1418,41 @@ class BaseCppFile(BaseFile.BaseFile):
         self.write_block('try', try_code, False)
         self.write_block('catch', code[i + 1: len(code)], True)
 
+    def write_switch_block(self, code):
+        """
+        Write a C/C++ switch block.
+
+        :param code: list whose first entry is the expression switched on,
+            followed by labels ('case X' or 'default') each followed by
+            the code fragments for that label
+        :returns: nothing
+        """
+        self.write_line('switch ({0})'.format(code[0]))
+        self.write_line('{')
+        i = 1
+        num = len(code)
+        while i < num:
+            self.write_line('{0}:'.format(code[i]))
+            i += 1
+            label_code = []
+            while i < num and not self.is_switch_label(code[i]):
+                label_code.append(code[i])
+                i += 1
+            self.write_nested_implementation(label_code)
+        self.write_line('}')
+
+    @staticmethod
+    def is_switch_label(code):
+        """
+        Check whether a code fragment is a label of a switch block.
+
+        :param code: the code fragment
+        :returns: `True` if the fragment is 'default' or starts with 'case '
+        """
+        if not isinstance(code, str):
+            return False
+        return code == 'default' or code.startswith('case ')
+
     def write_block(self, block_start, code, condition):
         """
         Generic function for writing a block of code.
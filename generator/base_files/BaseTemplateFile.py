@@ -146,9 +146,8 @@ class BaseTemplateFile:
             elif line.startswith('<add_specific_errors/>'):
                 self.print_error_enum(fileout)
                 i += 1
-            elif line.startswith('<add_specific_error_table/>'):
-                self.print_error_table(fileout)
-                i += 1
+            elif line.startswith('<add_specific_error_table>'):
+                i = self.print_error_table(fileout, lines, i)
             elif line.startswith('<insert_document_errors/>'):
                 self.print_document_errors(fileout)
                 i += 1
@@ -190,6 +190,14 @@ LIBSBML_CPP_NAMESPACE_USE
 %ignore XMLOutputStream::writeAttribute(const std::string&, const unsigned int&);
 %ignore XMLOutputStream::writeAttribute(const XMLTriple&,   const unsigned int&);
 
+/**
+ * Let SBMLReader::readSBMLFromBuffer take a string (Python) or a byte
+ * array (Java) in place of its data and length arguments.
+ */
+#if defined(SWIGPYTHON) || defined(SWIGJAVA)
+%apply (char *STRING, size_t LENGTH) { (const char *data, size_t length) };
+#endif
+
 /**
  * The following methods will create new objects.  To prevent memory
  * leaks we must inform SWIG of this.
@@ -200,10 +208,12 @@ LIBSBML_CPP_NAMESPACE_USE
 %newobject *::clone;
 %newobject SBase::toSBML;
 %newobject SBMLReader::readSBMLFromString;
+%newobject SBMLReader::readSBMLFromBuffer;
 %newobject SBMLReader::readSBMLFromFile;
 %newobject SBMLReader::readSBML;
 %newobject readSBML(const char *);
 %newobject readSBMLFromString(const char *);
+%newobject readSBMLFromBuffer(const char *, size_t);
 %newobject readSBMLFromFile(const char *);
 %newobject SBMLWriter::writeToString;
 %newobject writeSBMLToString;
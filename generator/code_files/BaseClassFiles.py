@@ -40,7 +40,7 @@
 
 # NB issue 45 - consider moving this file to base_files directory.
 
-# import re
+import re
 # import os
 
 from . import CppHeaderFile
@@ -79,6 +79,8 @@ class BaseClassFiles(BaseTemplateFile.BaseTemplateFile):
         self.write_all_files('Reader')
         self.write_all_files('Writer')
         self.write_all_files('ErrorLog')
+        self.write_all_files('ElementIndex')
+        self.write_all_files('Arena')
         self.write_all_files('Namespaces')
         self.write_all_files('Error')
         self.write_all_files('Visitor')
@@ -389,11 +391,17 @@ class BaseClassFiles(BaseTemplateFile.BaseTemplateFile):
                 fileout.copy_line_verbatim(', {0}      = {1}\n'
                                            ''.format(name, error['number']))
 
-    def print_error_table(self, fileout):
+    def print_error_table(self, fileout, lines, i):
         """
-        ????
+        Write out the error table: the fixed entries given in the template
+        between the <add_specific_error_table> anchors merged with the
+        entries for the validation rules, all in order of error code so
+        that the table can be searched by bisection.
 
         :param fileout: object representing output file we are writing.
+        :param lines: the lines of the template.
+        :param i: index of the opening anchor in lines.
+        :return: index of the line following the closing anchor.
         """
         # create a dummy object so we can use the validation files code
         lib_object = dict({'name': '',
@@ -408,10 +416,38 @@ class BaseClassFiles(BaseTemplateFile.BaseTemplateFile):
                            'enums': None})
         valid = ValidationFiles.ValidationFiles(lib_object, True)
         valid.set_error_file(fileout)
-        for error in gv.class_rules:
-            name = error['typecode']
-            if not name.endswith('Unknown'):
-                valid.write_table_entry(error)
+
+        # each fixed entry is a run of lines starting with its '// code'
+        entries = []
+        i += 1
+        while not lines[i].startswith('</add_specific_error_table>'):
+            if lines[i].strip() == '':
+                i += 1
+                continue
+            match = re.match(r'\s*//\s*(\d+)', lines[i])
+            if match is None:
+                raise Exception('Error table entry without a code: '
+                                '{0}'.format(lines[i]))
+            block = []
+            while lines[i].strip() != '' and \
+                    not lines[i].startswith('</add_specific_error_table>'):
+                block.append(lines[i])
+                i += 1
+            entries.append([int(match.group(1)), block, None])
+        i += 1
+
+        for error in valid.get_table_rules():
+            if not error['typecode'].endswith('Unknown'):
+                entries.append([int(error['number']), None, error])
+
+        for entry in sorted(entries, key=lambda entry: entry[0]):
+            if entry[1] is None:
+                valid.write_table_entry(entry[2])
+            else:
+                for line in entry[1]:
+                    fileout.copy_line_verbatim(self.adjust_line(line))
+                fileout.skip_line()
+        return i
 
     def print_document_errors(self, fileout):
         """
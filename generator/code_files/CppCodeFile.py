@@ -212,6 +212,17 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         if write_math:
             self.write_line_verbatim('#include <sbml/math/MathML.h>')
 
+        # the C locale number conversions used for arrays of reals, and the
+        # limits of the types arrays are stored in
+        for attrib in self.attributes:
+            if attrib['isArray'] and (attrib['element'] in ['double', 'float']
+                                      or 'storage' in attrib):
+                self.write_line_verbatim('#include <sbml/util/util.h>')
+                if 'storage' in attrib:
+                    self.write_line_verbatim('#include <climits>')
+                    self.write_line_verbatim('#include <cfloat>')
+                break
+
         if len(concrete_classes) > 0:
             self.skip_line()
         for element in concrete_classes:
@@ -275,6 +286,18 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = constructor.write_assignment_operator()
         self.write_function_implementation(code)
 
+        code = constructor.write_move_constructor()
+        if code is not None:
+            macro = '{0}_HAS_MOVE_SEMANTICS'.format(
+                global_variables.library_name.upper())
+            self.write_line_verbatim('#ifdef {0}'.format(macro))
+            self.write_function_implementation(code)
+
+            code = constructor.write_move_assignment_operator()
+            self.write_function_implementation(code)
+            self.write_line_verbatim('#endif  /* {0} */'.format(macro))
+            self.skip_line(2)
+
         code = constructor.write_clone()
         self.write_function_implementation(code)
 
@@ -301,6 +324,12 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_get_string_for_enum(True, i)
             self.write_function_implementation(code)
 
+            code = attrib_functions.write_get_array_storage(i, False)
+            self.write_function_implementation(code)
+
+            code = attrib_functions.write_get_array_storage(i, True)
+            self.write_function_implementation(code)
+
         for i in range(0, num_attributes):
             code = attrib_functions.write_is_set(True, i)
             self.write_function_implementation(code)
@@ -315,6 +344,9 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_set_string_for_enum(True, i)
             self.write_function_implementation(code)
 
+            code = attrib_functions.write_set_array_storage(i)
+            self.write_function_implementation(code)
+
             code = attrib_functions.write_add_element_for_vector(True, i)
             self.write_function_implementation(code)
 
@@ -542,6 +574,21 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = gen_functions.write_get_all_elements()
         self.write_function_implementation(code)
 
+        code = gen_functions.write_get_referrers()
+        self.write_function_implementation(code)
+
+        code = gen_functions.write_rename_sid()
+        self.write_function_implementation(code)
+
+        code = gen_functions.write_remove_with_referrers()
+        self.write_function_implementation(code)
+
+        code = gen_functions.write_get_element_index()
+        self.write_function_implementation(code, exclude=True)
+
+        code = gen_functions.write_get_arena()
+        self.write_function_implementation(code, exclude=True)
+
         if self.is_plugin:
             code = gen_functions.write_append_from()
             self.write_function_implementation(code, True)
@@ -649,6 +696,9 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = protect_functions.write_add_expected_attributes()
         self.write_function_implementation(code, exclude)
 
+        code = protect_functions.write_add_reference_attributes()
+        self.write_function_implementation(code, exclude)
+
         code = protect_functions.write_read_attributes()
         self.write_function_implementation(code, exclude)
         if 'num_versions' in self.class_object \
@@ -677,6 +727,10 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = protect_functions.write_set_element_text()
         self.write_function_implementation(code, exclude)
 
+        for kind in ['size', 'get', 'set', 'type']:
+            code = protect_functions.write_array_storage_helper(kind)
+            self.write_function_implementation(code, exclude)
+
     ########################################################################
 
     # Functions for writing functions for the main ListOf class
@@ -733,6 +787,10 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
                                                              const=False)
                 self.write_function_implementation(code)
 
+                code = lo_functions.write_get_all_elements_by_sidref(
+                    self.sid_refs[i])
+                self.write_function_implementation(code)
+
     # main function to write the functions dealing with a child listOf element
     def write_child_lo_element_functions(self):
         num_elements = len(self.child_lo_elements)
@@ -279,6 +279,8 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         # if we are the document class for another library
         if not global_variables.is_package and self.document:
             include_lines += ['<{0}/{1}ErrorLog.h>'.format(self.language, global_variables.prefix)]
+            include_lines += ['<{0}/{1}ElementIndex.h>'.format(self.language, global_variables.prefix)]
+            include_lines += ['<{0}/{1}Arena.h>'.format(self.language, global_variables.prefix)]
 
         # if we another library we need the libsbml ns qualifier
         if not global_variables.is_package:
@@ -303,7 +305,12 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
             name = attributes[i]['memberName']
             return_type = attributes[i]['attTypeCode']
             if name not in names_written:
-                if attributes[i]['attType'] != 'string':
+                if 'storage' in attributes[i]:
+                    storage = attributes[i]['storage']
+                    self.write_line('void* {0};'.format(name))
+                    self.write_line('{0} {1};'.format(storage['enumType'],
+                                                      storage['typeMember']))
+                elif attributes[i]['attType'] != 'string':
                     self.write_line('{0} {1};'.format(return_type, name))
                 else:
                     self.write_line('std::string {0};'.format(name))
@@ -316,6 +323,9 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
             self.write_line('std::string mElementName;')
         if self.document:
             self.write_line('{0}ErrorLog mErrorLog;'.format(global_variables.prefix))
+            if not global_variables.is_package:
+                self.write_line('{0}ElementIndex mElementIndex;'.format(global_variables.prefix))
+                self.write_line('{0}Arena mArena;'.format(global_variables.prefix))
 
     ########################################################################
 
@@ -347,6 +357,18 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = constructor.write_assignment_operator()
         self.write_function_declaration(code)
 
+        code = constructor.write_move_constructor()
+        if code is not None:
+            macro = '{0}_HAS_MOVE_SEMANTICS'.format(
+                global_variables.library_name.upper())
+            self.file_out.write('#ifdef {0}\n'.format(macro))
+            self.write_function_declaration(code)
+
+            code = constructor.write_move_assignment_operator()
+            self.write_function_declaration(code)
+            self.file_out.write('#endif  /* {0} */\n'.format(macro))
+            self.skip_line(2)
+
         code = constructor.write_clone()
         self.write_function_declaration(code)
 
@@ -375,6 +397,12 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_get_string_for_enum(True, i)
             self.write_function_declaration(code)
 
+            code = attrib_functions.write_get_array_storage(i, False)
+            self.write_function_declaration(code)
+
+            code = attrib_functions.write_get_array_storage(i, True)
+            self.write_function_declaration(code)
+
         for i in range(0, num_attributes):
             code = attrib_functions.write_is_set(True, i)
             self.write_function_declaration(code)
@@ -389,6 +417,9 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_set_string_for_enum(True, i)
             self.write_function_declaration(code)
 
+            code = attrib_functions.write_set_array_storage(i)
+            self.write_function_declaration(code)
+
             code = attrib_functions.write_add_element_for_vector(True, i)
             self.write_function_declaration(code)
 
@@ -619,6 +650,21 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = gen_functions.write_get_all_elements()
         self.write_function_declaration(code)
 
+        code = gen_functions.write_get_referrers()
+        self.write_function_declaration(code)
+
+        code = gen_functions.write_rename_sid()
+        self.write_function_declaration(code)
+
+        code = gen_functions.write_remove_with_referrers()
+        self.write_function_declaration(code)
+
+        code = gen_functions.write_get_element_index()
+        self.write_function_declaration(code, exclude=True)
+
+        code = gen_functions.write_get_arena()
+        self.write_function_declaration(code, exclude=True)
+
         if self.is_plugin:
             code = gen_functions.write_append_from()
             self.write_function_declaration(code, True)
@@ -736,6 +782,9 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = protect_functions.write_add_expected_attributes()
         self.write_function_declaration(code, exclude)
 
+        code = protect_functions.write_add_reference_attributes()
+        self.write_function_declaration(code, exclude)
+
         code = protect_functions.write_read_attributes()
         self.write_function_declaration(code, exclude)
         if 'num_versions' in self.class_object \
@@ -764,6 +813,10 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = protect_functions.write_set_element_text()
         self.write_function_declaration(code, exclude)
 
+        for kind in ['size', 'get', 'set', 'type']:
+            code = protect_functions.write_array_storage_helper(kind)
+            self.write_function_declaration(code, exclude)
+
     ########################################################################
 
     # Functions for writing functions for the main ListOf class
@@ -817,6 +870,10 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
                                                              const=False)
                 self.write_function_declaration(code)
 
+                code = lo_functions.write_get_all_elements_by_sidref(
+                    self.sid_refs[i])
+                self.write_function_declaration(code)
+
     # main function to write the functions dealing with a child listOf element
     def write_child_lo_element_functions(self):
         num_elements = len(self.child_lo_elements)
@@ -142,6 +142,9 @@ class ExtensionCodeFile(BaseCppFile.BaseCppFile):
                                                self.package,
                                                self.up_package,
                                                self.plugins[i]['sbase']))
+        if len(self.enums) > 0:
+            self.skip_line()
+            self.write_line_verbatim('#include <cstring>')
 
         self.skip_line(2)
         self.write_line('using namespace std;')
@@ -348,6 +351,7 @@ class ExtensionCodeFile(BaseCppFile.BaseCppFile):
     def write_ext_enum_code(self):
         BaseCppFile.BaseCppFile.write_file(self)
         self.write_line_verbatim('#include <string>')
+        self.write_line_verbatim('#include <cstring>')
         self.write_line_verbatim('#include <{0}/common/{1}.h>'
                                  ''.format(self.language,
                                            self.name))
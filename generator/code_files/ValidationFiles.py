@@ -176,7 +176,8 @@ class ValidationFiles():
             fileout = ValidatorHeaderFile.ValidatorHeaderFile(self.language,
                                                               self.package,
                                                               'main',
-                                                              valid_type)
+                                                              valid_type,
+                                                              self.sbml_classes)
             if self.verbose:
                 print('Writing file {0}'.format(fileout.filename))
             fileout.write_main_file()
@@ -256,11 +257,8 @@ class ValidationFiles():
                                    '{0}ErrorTable[] '
                                    '='.format(self.package.lower()))
         self.error_file.write_line('{')
-        done = []
-        for rule in self.class_rules:
-            if rule['typecode'] not in done:
-                self.write_table_entry(rule)
-                done.append(rule['typecode'])
+        for rule in self.get_table_rules():
+            self.write_table_entry(rule)
         self.error_file.write_line('};')
         self.error_file.write_doxygen_end()
         self.error_file.write_cppns_end()
@@ -298,16 +296,27 @@ class ValidationFiles():
                                    '{0}ErrorTable[] '
                                    '='.format(global_variables.language.lower()))
         self.error_file.write_line('{')
-        done = []
-        for rule in self.class_rules:
-            if rule['typecode'] not in done:
-                self.write_table_entry(rule)
-                done.append(rule['typecode'])
+        for rule in self.get_table_rules():
+            self.write_table_entry(rule)
         self.error_file.write_line('};')
         self.error_file.write_doxygen_end()
         self.error_file.write_cppns_end()
         self.error_file.write_defn_end()
 
+    def get_table_rules(self):
+        """
+        Return the rules to be written to the error table, one per
+        typecode and sorted by error number so that the table can be
+        searched by bisection.
+        """
+        done = []
+        rules = []
+        for rule in self.class_rules:
+            if rule['typecode'] not in done:
+                rules.append(rule)
+                done.append(rule['typecode'])
+        return sorted(rules, key=lambda rule: int(rule['number']))
+
     def write_table_entry(self, rule):
         format_rule = self.format_text(rule['text'])
         self.error_file.up_indent()
@@ -187,6 +187,12 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         code = constructor.write_add_constraint_function()
         self.write_function_implementation(code)
 
+        classes = ValidatorClassFunctions.ValidatorClassFunctions.\
+            get_constrained_classes(self.elements)
+        for name in classes:
+            code = constructor.write_add_typed_constraint_function(name)
+            self.write_function_implementation(code)
+
         code = constructor.write_validate_function('doc')
         self.write_function_implementation(code)
 
@@ -264,7 +270,7 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         self.write_line('protected:')
         self.up_indent()
         self.skip_line()
-        self.write_line('std::list< TConstraint<T>* > constraints;')
+        self.write_line('std::vector< TConstraint<T>* > constraints;')
         self.down_indent()
         self.write_line('};')
         self.skip_line(2)
@@ -295,7 +301,7 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
             for element in self.elements:
                 self.write_constraint_set_member(element['name'])
         self.skip_line()
-        self.write_line('map<VConstraint*, bool> ptrMap;')
+        self.write_line('vector<VConstraint*> constraints;')
         self.skip_line()
         self.write_line('~{0}ValidatorConstraints();'.format(self.up_package))
         self.skip_line()
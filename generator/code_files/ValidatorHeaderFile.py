@@ -45,7 +45,8 @@ from . cpp_functions import *
 class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
     """Class for all Validator Header files"""
 
-    def __init__(self, language, package, filetype='', valid_type=''):
+    def __init__(self, language, package, filetype='', valid_type='',
+                 elements=None):
         self.language = language
         self.cap_language = language.upper()
 
@@ -73,6 +74,7 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
         self.package = package
         if filetype == 'consistency':
             self.baseClass = '{0}Validator'.format(self.up_package)
+        self.elements = elements
 
     ########################################################################
 
@@ -116,10 +118,13 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
 
     def write_forward_decls(self):
         self.write_line_verbatim('class VConstraint;')
+        self.write_line_verbatim('template <typename T> class TConstraint;')
         self.write_line_verbatim('struct {0}Validator'
                                  'Constraints;'.format(self.up_package))
-        self.write_line_verbatim('class {0}'
-                                 ';'.format(global_variables.document_class))
+        classes = ValidatorClassFunctions.ValidatorClassFunctions.\
+            get_constrained_classes(self.elements)
+        for name in classes:
+            self.write_line_verbatim('class {0};'.format(name))
 
     def write_members(self):
         self.write_line('{0}ValidatorConstraints* m{0}'
@@ -182,6 +187,12 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
         code = constructor.write_add_constraint_function()
         self.write_function_declaration(code)
 
+        classes = ValidatorClassFunctions.ValidatorClassFunctions.\
+            get_constrained_classes(self.elements)
+        for name in classes:
+            code = constructor.write_add_typed_constraint_function(name)
+            self.write_function_declaration(code)
+
         code = constructor.write_validate_function('doc')
         self.write_function_declaration(code)
 
@@ -230,6 +241,7 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
         self.write_doxygen_start()
         self.write_line_verbatim('#include <list>')
         self.write_line_verbatim('#include <string>')
+        self.write_line_verbatim('#include <vector>')
         self.write_doxygen_end()
         self.write_includes()
         self.write_cppns_begin()
@@ -642,6 +642,106 @@ class Constructors():
                      'object_name': self.object_name,
                      'implementation': code})
 
+    # function to write move constructor
+    def write_move_constructor(self):
+        if not self.writes_move_functions():
+            return
+        # create doc string header
+        title_line = 'Move constructor for {0}.'.format(self.object_name)
+        params = ['@param orig the {0} instance to move; it is left as an '
+                  'empty {0} in the place it had.'.format(self.object_name)]
+        return_lines = []
+        additional = []
+        # create function decl
+        function = '{0}'.format(self.object_name)
+        return_type = ''
+        arguments = ['{0}&& orig'.format(self.object_name)]
+        # create the function implementation
+        constructor_args = self.write_move_constructor_args()
+        code = []
+        implementation = ['orig.{0} = NULL'.format(member)
+                          for member in self.get_owned_pointers()]
+        if len(implementation) > 0:
+            code.append(self.create_code_block('line', implementation))
+        if self.document:
+            # the children are reconnected below, so there is no need to
+            # walk them as set{0}(this) would
+            implementation = ['{0}::set{1}(this)'.format(
+                self.base_class, global_variables.document_class)]
+            code.append(dict({'code_type': 'line', 'code': implementation}))
+        if self.has_children:
+            implementation = ['connectToChild()']
+            code.append(dict({'code_type': 'line', 'code': implementation}))
+        elif len(code) == 0:
+            implementation = ['']
+            code.append(dict({'code_type': 'blank', 'code': implementation}))
+
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.object_name,
+                     'implementation': code,
+                     'constructor_args': constructor_args})
+
+    # function to write move assignment operator
+    def write_move_assignment_operator(self):
+        if not self.writes_move_functions():
+            return
+        # create doc string header
+        title_line = 'Move assignment operator for {0}.'.format(
+            self.object_name)
+        params = ['@param rhs the {0} object whose values are to be moved '
+                  'into this one; it is left as an empty {0} in the place '
+                  'it had.'.format(self.object_name)]
+        return_lines = []
+        additional = []
+        function = 'operator='
+        return_type = '{0}&'.format(self.object_name)
+        arguments = ['{0}&& rhs'.format(self.object_name)]
+        # create the function implementation
+        implementation = ['&rhs != this'] + self.write_move_assignment_args()
+        for member in self.get_owned_pointers():
+            attrib = self.get_array_attribute(member)
+            if attrib is None:
+                release = 'delete {0}'
+            elif 'storage' in attrib:
+                release = 'free({0})'
+            else:
+                release = 'delete [] {0}'
+            implementation += [release.format(member),
+                               '{0} = rhs.{0}'.format(member),
+                               'rhs.{0} = NULL'.format(member)]
+            if attrib is not None and 'storage' in attrib:
+                implementation.append('{0} = rhs.{0}'.format(
+                    attrib['storage']['typeMember']))
+        if self.has_children:
+            implementation.append('connectToChild()')
+        if self.document:
+            implementation.append('{0}::set{1}(this)'.format(
+                self.base_class, global_variables.document_class))
+
+        implementation2 = ['return *this']
+        code = [dict({'code_type': 'if', 'code': implementation}),
+                dict({'code_type': 'line', 'code': implementation2})]
+
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.object_name,
+                     'implementation': code})
+
     # function to write clone
     def write_clone(self):
         abbrev_object = strFunctions.abbrev_name(self.class_name)
@@ -717,12 +817,19 @@ class Constructors():
         if self.is_cpp_api:
             implementation = []
             code = []
+            if self.document and not global_variables.is_package:
+                # elements destroyed along with the document must not
+                # update its element index
+                code.append(self.create_code_block(
+                    'line', ['mHasBeenDeleted = true']))
             for attrib in self.attributes:
                 if attrib['isArray']:
                     member = attrib['memberName']
+                    release = 'free({0})' if 'storage' in attrib \
+                        else 'delete [] {0}'
                     code.append(self.create_code_block(
                         'if', ['{0} != NULL'.format(member),
-                               'delete [] {0}'.format(member)]))
+                               release.format(member)]))
                     code.append(self.create_code_block(
                         'line', ['{0} = NULL'.format(member)]))
             for i in range(0, len(self.child_elements)):
@@ -814,6 +921,10 @@ class Constructors():
                                         '({2})'.format(sep, attrib['memberName'],
                                                       attrib['default']))
                 sep = ','
+            if 'storage' in attrib:
+                constructor_args.append(', {0} ({1})'.format(
+                    attrib['storage']['typeMember'],
+                    attrib['storage']['invalid']))
             if attrib['isNumber'] or attrib['attType'] == 'boolean':
                 constructor_args.append(', mIsSet{0} (false)'
                                         .format(attrib['capAttName']))
@@ -845,6 +956,10 @@ class Constructors():
                 constructor_args.append('{0} {1} ( NULL )'
                                         .format(sep, attrib['memberName']))
                 sep = ','
+                if 'storage' in attrib:
+                    constructor_args.append(', {0} ( {1} )'.format(
+                        attrib['storage']['typeMember'],
+                        attrib['storage']['invalid']))
             elif not use_null:
                 constructor_args.append('{1} {0} ( orig.{0} )'
                                         .format(attrib['memberName'], sep))
@@ -878,8 +993,15 @@ class Constructors():
                 member = attrib['memberName']
                 length = strFunctions.upper_first(attrib['name'])
                 constructor_args.append('{0} = NULL'.format(member))
-                constructor_args.append('set{0}(rhs.{1}, '
-                                        'rhs.{1}Length)'.format(length, member))
+                if 'storage' in attrib:
+                    constructor_args.append(
+                        'set{0}(rhs.{1}, rhs.{2}, rhs.{1}Length)'
+                        ''.format(length, member,
+                                  attrib['storage']['typeMember']))
+                else:
+                    constructor_args.append('set{0}(rhs.{1}, '
+                                            'rhs.{1}Length)'.format(length,
+                                                                    member))
             # straight forward assign to rhs value list ofs that are not recursive
             elif self.assign_direct(attrib):  ## attrib['type'] != 'element':
                 constructor_args.append('{0} = rhs.{0}'
@@ -891,6 +1013,107 @@ class Constructors():
             constructor_args.append('mElementName = rhs.mElementName')
         return constructor_args
 
+    # move functions are only written for classes built on the SBase and
+    # ListOf templates; those of libSBML packages cannot be moved
+    def writes_move_functions(self):
+        return self.is_cpp_api and not self.is_plugin \
+            and not global_variables.is_package
+
+    # the attributes that can be skipped as they are held by the base class
+    def is_base_attribute(self, attrib):
+        if not self.is_plugin and global_variables.language == 'sbml' \
+                and attrib['memberName'] in ['mId', 'mName']:
+            return True
+        return global_variables.language != 'sbml' \
+            and attrib['memberName'] == 'mId'
+
+    # the attributes whose value owns heap memory that a move can steal
+    @staticmethod
+    def is_movable(attrib):
+        if attrib['type'] == 'lo_element' \
+                or attrib['type'] == 'inline_lo_element':
+            return not ('recursive_child' in attrib
+                        and attrib['recursive_child'])
+        return attrib['attType'] == 'string' \
+            or ('isVector' in attrib and attrib['isVector'])
+
+    # the members that are raw pointers owned by the object (arrays, child
+    # elements and recursive lists)
+    def get_owned_pointers(self):
+        members = []
+        for attrib in self.attributes:
+            if self.is_base_attribute(attrib):
+                continue
+            elif attrib['isArray'] or self.is_owned_pointer(attrib):
+                members.append(attrib['memberName'])
+        return members
+
+    def get_array_attribute(self, member):
+        for attrib in self.attributes:
+            if attrib['memberName'] == member and attrib['isArray']:
+                return attrib
+        return None
+
+    @staticmethod
+    def is_owned_pointer(attrib):
+        if 'recursive_child' in attrib and attrib['recursive_child']:
+            return True
+        return attrib['type'] == 'element' or attrib['element'] == 'ASTNode'
+
+    def write_move_constructor_args(self):
+        sep = ':'
+        if self.base_class:
+            constructor_args = ['{0} {1}( std::move(orig) )'
+                                .format(sep, self.base_class)]
+            sep = ','
+        else:
+            constructor_args = []
+        for attrib in self.attributes:
+            member = attrib['memberName']
+            if self.is_base_attribute(attrib):
+                continue
+            elif self.is_movable(attrib):
+                constructor_args.append('{1} {0} ( std::move(orig.{0}) )'
+                                        .format(member, sep))
+            else:
+                constructor_args.append('{1} {0} ( orig.{0} )'
+                                        .format(member, sep))
+            sep = ','
+            if 'storage' in attrib:
+                constructor_args.append('{1} {0} ( orig.{0} )'.format(
+                    attrib['storage']['typeMember'], sep))
+            if attrib['isNumber'] or attrib['attType'] == 'boolean':
+                constructor_args.append('{1} mIsSet{0} ( orig.mIsSet{0} )'
+                                        .format(attrib['capAttName'], sep))
+        if self.overwrites_children:
+            constructor_args.append('{0} mElementName '
+                                    '( std::move(orig.mElementName) )'
+                                    .format(sep))
+
+        return constructor_args
+
+    def write_move_assignment_args(self):
+        if self.base_class:
+            args = ['{0}::operator=(std::move(rhs))'.format(self.base_class)]
+        else:
+            args = []
+        for attrib in self.attributes:
+            member = attrib['memberName']
+            if self.is_base_attribute(attrib):
+                continue
+            elif attrib['isArray'] or self.is_owned_pointer(attrib):
+                continue
+            elif self.is_movable(attrib):
+                args.append('{0} = std::move(rhs.{0})'.format(member))
+            else:
+                args.append('{0} = rhs.{0}'.format(member))
+            if attrib['isNumber'] or attrib['attType'] == 'boolean':
+                args.append('mIsSet{0} = rhs.mIsSet{0}'
+                            .format(attrib['capAttName']))
+        if self.overwrites_children:
+            args.append('mElementName = std::move(rhs.mElementName)')
+        return args
+
     def assign_direct(self, attrib):
         if attrib['type'] == 'lo_element' or attrib['type'] == 'inline_lo_element':
             if 'recursive_child' in attrib and attrib['recursive_child']:
@@ -907,7 +1130,12 @@ class Constructors():
         name = self.attributes[index]['capAttName']
         member = self.attributes[index]['memberName']
         length = member + 'Length'
-        line = ['set{0}(orig.{1}, orig.{2})'.format(name, member, length)]
+        if 'storage' in self.attributes[index]:
+            line = ['set{0}(orig.{1}, orig.{2}, orig.{3})'.format(
+                name, member, self.attributes[index]['storage']['typeMember'],
+                length)]
+        else:
+            line = ['set{0}(orig.{1}, orig.{2})'.format(name, member, length)]
         return line
 
     @staticmethod
@@ -375,17 +375,29 @@ class ExtensionFunctions():
         return_type = 'unsigned int'
 
         # create the function implementation
+        # the table is written in order of error code so can be bisected
         implementation = ['unsigned int tableSize = sizeof({0}ErrorTable)/'
                           'sizeof({0}ErrorTable[0])'.format(self.package),
-                          'unsigned int index = 0']
+                          'unsigned int lower = 0',
+                          'unsigned int upper = tableSize']
         code = [dict({'code_type': 'line', 'code': implementation})]
-        if_code = self.create_code_block('if', ['errorId == {0}ErrorTable[i]'
-                                                '.code'.format(self.package),
-                                                'index = i', 'break'])
-        code.append(self.create_code_block('for', ['unsigned int i = 0; '
-                                                   'i < tableSize; i++',
-                                                   if_code]))
-        code.append(self.create_code_block('line', ['return index']))
+        if_code = self.create_code_block('if_else',
+                                         ['{0}ErrorTable[middle].code < '
+                                          'errorId'.format(self.package),
+                                          'lower = middle + 1', 'else',
+                                          'upper = middle'])
+        code.append(self.create_code_block('while',
+                                           ['lower < upper',
+                                            'unsigned int middle = lower + '
+                                            '(upper - lower) / 2',
+                                            if_code]))
+        if_code = self.create_code_block('if',
+                                         ['lower < tableSize && '
+                                          '{0}ErrorTable[lower].code == '
+                                          'errorId'.format(self.package),
+                                          'return lower'])
+        code.append(if_code)
+        code.append(self.create_code_block('line', ['return 0']))
 
         # return the parts
         return dict({'title_line': title_line,
@@ -245,17 +245,33 @@ class ExtensionInitFunctions():
         return_type = '{0}_t'.format(name)
 
         # create the function implementation
+        # the strings are told apart by their length first so that only
+        # those of the right length are compared, without copying the code
         if values:
-            implementation = ['static int size = sizeof({0})/sizeof'
-                              '({0}[0])'.format(str_name),
-                              'std::string type(code)']
-            code = [dict({'code_type': 'line', 'code': implementation})]
-            if_code = self.create_code_block('if', ['type == {0}'
-                                                    '[i]'.format(str_name),
-                                                    'return ({0}_t)'
-                                                    '(i)'.format(name)])
-            code.append(self.create_code_block('for', ['int i = 0; i < size; '
-                                                       'i++', if_code]))
+            code = [self.create_code_block('if', ['code == NULL',
+                                                  'return {0}'.format(values[-1])])]
+            lengths = []
+            by_length = dict()
+            for i in range(0, len(values) - 1):
+                length = len(enum['values'][i]['value'].encode('utf-8'))
+                if length not in by_length:
+                    lengths.append(length)
+                    by_length[length] = []
+                by_length[length].append(i)
+            switch = ['strlen(code)']
+            for length in sorted(lengths):
+                matches = []
+                for i in by_length[length]:
+                    if len(matches) > 0:
+                        matches.append('else if')
+                    matches.append('strcmp(code, {0}[{1}]) == 0'.format(str_name, i))
+                    matches.append('return {0}'.format(values[i]))
+                block_type = 'if' if len(by_length[length]) == 1 else 'else_if'
+                switch += ['case {0}'.format(length),
+                           self.create_code_block(block_type, matches),
+                           'break']
+            switch += ['default', 'break']
+            code.append(self.create_code_block('switch', switch))
             code.append(self.create_code_block
                         ('line', ['return {0}'.format(values[-1])]))
         else:
@@ -927,22 +927,72 @@ class GeneralFunctions():
         name = ''
         member = ''
         array_type = ''
+        value = None
         for attrib in self.attributes:
             if attrib['isArray']:
                 name = attrib['capAttName']
                 member = attrib['memberName']
                 array_type = attrib['element']
+                if 'storage' in attrib:
+                    # the values are written as reals, which prints those
+                    # that are integers without a decimal point
+                    array_type = 'double'
+                    value = 'get{0}Value({1}, {2}, i)'.format(
+                        name, member, attrib['storage']['typeMember'])
             if array_type == 'int':
                 array_type = 'long'
         code = [self.create_code_block('line',
                                        ['stream.startElement(getElementName(), '
                                         'getPrefix())',
                                         'writeAttributes(stream)'])]
-        nested_for = self.create_code_block(
-            'for', ['int i = 0; i < m{0}Length; ++i'.format(name),
-                    'stream << ({0}){1}[i] << \" \"'
-                    ''.format(array_type, member)])
-        implementation = ['isSet{0}()'.format(name), nested_for]
+        codec = query.get_array_text_codec(array_type)
+        if codec is None:
+            nested_for = self.create_code_block(
+                'for', ['int i = 0; i < m{0}Length; ++i'.format(name),
+                        'stream << ({0}){1}[i] << \" \"'
+                        ''.format(array_type, member)])
+            implementation = ['isSet{0}()'.format(name), nested_for]
+        else:
+            # the values are formatted into a buffer which is written out
+            # a chunk at a time
+            [convert, value_type, printf, value_format, special] = codec
+            if value is None:
+                value = '({0}){1}[i]'.format(value_type, member)
+            nested_if = self.create_code_block('if',
+                                               ['chunk.size() > 4000',
+                                                'stream << chunk',
+                                                'chunk.clear()'])
+            if special:
+                # XML Schema spells infinities and NaN differently from printf
+                append = [self.create_code_block(
+                    'else_if', ['util_isNaN(number)',
+                                'chunk.append(\"NaN \")',
+                                'else if',
+                                'util_isInf(number) > 0',
+                                'chunk.append(\"INF \")',
+                                'else if',
+                                'util_isInf(number) < 0',
+                                'chunk.append(\"-INF \")',
+                                'else',
+                                'int numChars = {0}(value, sizeof(value), '
+                                '\"{1}\", number)'.format(printf,
+                                                          value_format),
+                                'chunk.append(value, numChars)'])]
+                append.insert(0, self.create_code_block(
+                    'line', ['{0} number = {1}'.format(value_type, value)]))
+            else:
+                append = ['int numChars = {0}(value, sizeof(value), '
+                          '\"{1}\", {2})'.format(printf, value_format, value),
+                          'chunk.append(value, numChars)']
+            nested_for = self.create_code_block(
+                'for', ['int i = 0; i < m{0}Length; ++i'.format(name)] +
+                append + [nested_if])
+            implementation = ['isSet{0}()'.format(name),
+                              'std::string chunk',
+                              'char value[32]',
+                              'chunk.reserve(4096)',
+                              nested_for,
+                              'stream << chunk']
         code.append(self.create_code_block('if', implementation))
         code.append(self.create_code_block(
             'line', ['stream.endElement(getElementName(), getPrefix())']))
@@ -162,28 +162,18 @@ class GenericAttributeFunctions():
         first_line = ['int return_value = {0}::getAttribute(attributeName, value)'.format(self.base_class)]
         first_if = ['return_value == {0}'.format(global_variables.ret_success), 'return return_value']
         last_line = ['return return_value']
-        first = True
-        block = []
+        cases = []
         for attrib in attributes:
-            name = attrib['name']
-            if 'xml_name' in attrib and attrib['xml_name'] != '':
-                name = attrib['xml_name']
-            if not first:
-                block.append('else if')
-            else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
             if attrib['attType'] == 'enum':
                 lines = ['value = get{0}AsString{1}'.format(attrib['capAttName'],end_get),
                          'return_value = {0}'.format(global_variables.ret_success)]
             else:
                 lines = ['value = get{0}{1}'.format(attrib['capAttName'],end_get),
                          'return_value = {0}'.format(global_variables.ret_success)]
-            block.append(self.create_code_block('line', lines))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
-            else:
-                if_block = self.create_code_block('if', block)
+            cases.append([self.get_xml_name(attrib),
+                          self.create_code_block('line', lines)])
+        if len(attributes) > 0:
+            if_block = self.create_attribute_dispatch(cases)
         code = []
         if len(attributes) == 0:
             code = [self.create_code_block('line', first_line),
@@ -240,25 +230,15 @@ class GenericAttributeFunctions():
         # create the function implementation
         first_line = ['bool value = {0}::isSetAttribute(attributeName)'.format(self.base_class)]
         last_line = ['return value']
-        first = True
-        block = []
+        cases = []
         for attrib in attributes:
-            name = attrib['name']
-            if 'xml_name' in attrib and attrib['xml_name'] != '':
-                name = attrib['xml_name']
-            if not first:
-                block.append('else if')
-            else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
             if 'isVector' in attrib and attrib['isVector']:
-                block.append('value = has{0}()'.format(strFunctions.upper_first(attrib['pluralName'])))
-            else:
-                block.append('value = isSet{0}()'.format(attrib['capAttName']))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
+                line = 'value = has{0}()'.format(strFunctions.upper_first(attrib['pluralName']))
             else:
-                if_block = self.create_code_block('if', block)
+                line = 'value = isSet{0}()'.format(attrib['capAttName'])
+            cases.append([self.get_xml_name(attrib), line])
+        if len(attributes) > 0:
+            if_block = self.create_attribute_dispatch(cases)
         code = []
         if len(attributes) == 0:
             code = [self.create_code_block('line', first_line),
@@ -320,22 +300,12 @@ class GenericAttributeFunctions():
         # create the function implementation
         first_line = ['int return_value = {0}::setAttribute(attributeName, value)'.format(self.base_class)]
         last_line = ['return return_value']
-        first = True
-        block = []
+        cases = []
         for attrib in attributes:
-            name = attrib['name']
-            if 'xml_name' in attrib and attrib['xml_name'] != '':
-                name = attrib['xml_name']
-            if not first:
-                block.append('else if')
-            else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
-            block.append('return_value = set{0}(value)'.format(attrib['capAttName']))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
-            else:
-                if_block = self.create_code_block('if', block)
+            cases.append([self.get_xml_name(attrib),
+                          'return_value = set{0}(value)'.format(attrib['capAttName'])])
+        if len(attributes) > 0:
+            if_block = self.create_attribute_dispatch(cases)
         if len(attributes) == 0:
             code = [self.create_code_block('line', first_line),
                     self.create_code_block('line', last_line)]
@@ -395,25 +365,15 @@ class GenericAttributeFunctions():
         # create the function implementation
         first_line = ['int value = {0}::unsetAttribute(attributeName)'.format(self.base_class)]
         last_line = ['return value']
-        first = True
-        block = []
+        cases = []
         for attrib in attributes:
-            name = attrib['name']
-            if 'xml_name' in attrib and attrib['xml_name'] != '':
-                name = attrib['xml_name']
-            if not first:
-                block.append('else if')
-            else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
             if attrib['attType'] == 'vector':
-                block.append('value = clear{0}()'.format(strFunctions.upper_first(attrib['pluralName'])))
+                line = 'value = clear{0}()'.format(strFunctions.upper_first(attrib['pluralName']))
             else:
-                block.append('value = unset{0}()'.format(attrib['capAttName']))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
-            else:
-                if_block = self.create_code_block('if', block)
+                line = 'value = unset{0}()'.format(attrib['capAttName'])
+            cases.append([self.get_xml_name(attrib), line])
+        if len(attributes) > 0:
+            if_block = self.create_attribute_dispatch(cases)
         code = []
         if len(attributes) == 0:
             code = [self.create_code_block('line', first_line),
@@ -438,6 +398,54 @@ class GenericAttributeFunctions():
 
     ########################################################################
 
+    # HELPER FUNCTIONS for dispatching on the attribute name
+
+    @staticmethod
+    def get_xml_name(attrib):
+        if 'xml_name' in attrib and attrib['xml_name'] != '':
+            return attrib['xml_name']
+        return attrib['name']
+
+    def create_attribute_dispatch(self, cases):
+        """
+        Create the code choosing between the given cases by attribute name.
+
+        :param cases: list of [xml name, code fragment...] lists
+        :returns: an if/else if chain or, for classes with more than a few
+            attributes, a switch on the length of the name so that only the
+            names of that length are compared
+        """
+        if len(cases) <= 3:
+            return self.create_if_chain(cases)
+        lengths = []
+        by_length = dict()
+        for case in cases:
+            length = len(case[0].encode('utf-8'))
+            if length not in by_length:
+                lengths.append(length)
+                by_length[length] = []
+            by_length[length].append(case)
+        switch = ['attributeName.size()']
+        for length in sorted(lengths):
+            switch += ['case {0}'.format(length),
+                       self.create_if_chain(by_length[length]),
+                       'break']
+        switch += ['default', 'break']
+        return self.create_code_block('switch', switch)
+
+    def create_if_chain(self, cases):
+        block = []
+        for case in cases:
+            if len(block) > 0:
+                block.append('else if')
+            block.append('attributeName == \"{0}\"'.format(case[0]))
+            block += case[1:]
+        if len(cases) > 1:
+            return self.create_code_block('else_if', block)
+        return self.create_code_block('if', block)
+
+    ########################################################################
+
     # Functions for manipulating object functions
 
     # function to write create functions
@@ -54,6 +54,9 @@ class GlobalQueryFunctions():
         if 'is_plugin' in class_object:
             self.is_plugin = class_object['is_plugin']
         self.is_header = class_object['is_header']
+        self.document = False
+        if 'document' in class_object:
+            self.document = class_object['document']
         if is_list_of:
             self.child_name = class_object['lo_child']
         else:
@@ -94,6 +97,15 @@ class GlobalQueryFunctions():
             self.true = '@c true'
             self.false = '@c false'
 
+        self.open_br = '{'
+        self.close_br = '}'
+
+        self.success = global_variables.ret_success
+        self.failed = global_variables.ret_failed
+        self.invalid_att = global_variables.ret_invalid_att
+        self.invalid_obj = global_variables.ret_invalid_obj
+        self.dup_id = global_variables.ret_dup_id
+
     ########################################################################
 
     # Function for writing function to retrieve elements
@@ -122,7 +134,9 @@ class GlobalQueryFunctions():
         arguments = ['const std::string& id']
 
         code = []
-        if not self.is_header:
+        if not self.is_header and self.uses_element_index():
+            code = self.write_element_index_lookup('id', 'getElementBySId')
+        elif not self.is_header:
             implementation = ['id.empty()', 'return NULL']
             code = [self.create_code_block('if', implementation),
                     self.create_code_block('line',
@@ -184,7 +198,7 @@ class GlobalQueryFunctions():
 
     # function to write get by metaid
     def write_get_by_metaid(self):
-        if not global_variables.is_package:
+        if not global_variables.is_package and not self.document:
             return
         # only write for elements with  base derived children in cpp
         if not self.is_cpp_api or self.num_children == 0:
@@ -208,7 +222,10 @@ class GlobalQueryFunctions():
         arguments = ['const std::string& metaid']
 
         code = []
-        if not self.is_header:
+        if not self.is_header and self.uses_element_index():
+            code = self.write_element_index_lookup('metaid',
+                                                   'getElementByMetaId')
+        elif not self.is_header:
             code = [self.create_code_block('if',
                                            ['metaid.empty()', 'return NULL']),
                     self.create_code_block('line', ['{0}* obj = NUL'
@@ -271,6 +288,217 @@ class GlobalQueryFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # function to write get referrers on a document
+    def write_get_referrers(self):
+        if not self.is_cpp_api or not self.uses_element_index():
+            return
+
+        # create comment parts
+        title_line = 'Returns the elements of this {0} that refer to the ' \
+                     'given @p id through one of their SIdRef ' \
+                     'attributes.'.format(self.class_name)
+        params = ['@param id a string representing the identifier referred '
+                  'to.']
+        return_lines = ['@return a List of the {0} elements referring to '
+                        '@p id, each listed once.'.format(self.std_base)]
+        additional = ['The references are looked up in an index of the '
+                      'document, so the cost depends on the number of '
+                      'referrers rather than on the size of the document.',
+                      ' ',
+                      'The caller owns the returned List (but not the '
+                      'elements in it) and is responsible for deleting it.']
+
+        # create the function declaration
+        function = 'getReferrers'
+        return_type = 'List*'
+        arguments = ['const std::string& id']
+
+        code = []
+        if not self.is_header:
+            code = self.write_element_index_call('getReferrers(id)')
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write rename sid on a document
+    def write_rename_sid(self):
+        if not self.is_cpp_api or not self.uses_element_index():
+            return
+
+        # create comment parts
+        title_line = 'Changes the identifier of the element of this {0} ' \
+                     'with the identifier @p oldId to @p newId, and ' \
+                     'redirects every SIdRef attribute referring to ' \
+                     '@p oldId to @p newId.'.format(self.class_name)
+        params = ['@param oldId a string representing the current '
+                  'identifier.',
+                  '@param newId a string representing the new identifier.']
+        return_lines = ['@copydetails doc_returns_success_code',
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br, self.success,
+                                  self.close_br),
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br,
+                                  self.invalid_att,
+                                  self.close_br),
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br,
+                                  self.dup_id,
+                                  self.close_br)]
+        additional = ['Nothing is changed if another element already has '
+                      'the identifier @p newId.']
+
+        # create the function declaration
+        function = 'renameSId'
+        return_type = 'int'
+        arguments = ['const std::string& oldId', 'const std::string& newId']
+
+        code = []
+        if not self.is_header:
+            code = self.write_element_index_call('renameSId(oldId, newId)')
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write remove with referrers on a document
+    def write_remove_with_referrers(self):
+        if not self.is_cpp_api or not self.uses_element_index():
+            return
+
+        # create comment parts
+        title_line = 'Removes the element of this {0} with the given ' \
+                     '@p id and deletes it, together with every element ' \
+                     'that refers to it and, in turn, every element that ' \
+                     'refers to one of those.'.format(self.class_name)
+        params = ['@param id a string representing the identifier of the '
+                  'element to remove.']
+        return_lines = ['@copydetails doc_returns_success_code',
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br, self.success,
+                                  self.close_br),
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br,
+                                  self.invalid_obj,
+                                  self.close_br),
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br,
+                                  self.failed,
+                                  self.close_br)]
+        additional = ['Only the identifiers of the removed elements '
+                      'themselves are followed; elements referring to an '
+                      'element nested inside a removed one are left in '
+                      'place.']
+
+        # create the function declaration
+        function = 'removeWithReferrers'
+        return_type = 'int'
+        arguments = ['const std::string& id']
+
+        code = []
+        if not self.is_header:
+            code = self.write_element_index_call('removeWithReferrers(id)')
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write the accessor for the element index of a document
+    def write_get_element_index(self):
+        if not self.is_cpp_api or not self.uses_element_index():
+            return
+
+        # create comment parts
+        title_line = 'Returns the index of the identifiers and metaids of ' \
+                     'the elements of this {0}.'.format(self.class_name)
+        params = []
+        return_lines = ['@return a pointer to the {0}ElementIndex of this '
+                        '{1}.'.format(global_variables.prefix,
+                                      self.class_name)]
+        additional = []
+
+        # create the function declaration
+        function = 'getElementIndex'
+        return_type = '{0}ElementIndex*'.format(global_variables.prefix)
+        arguments = []
+
+        code = [self.create_code_block('line', ['return &mElementIndex'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write the accessor for the arena of a document
+    def write_get_arena(self):
+        if not self.is_cpp_api or not self.uses_element_index():
+            return
+
+        # create comment parts
+        title_line = 'Returns the arena the elements of this {0} are ' \
+                     'allocated from.'.format(self.class_name)
+        params = []
+        return_lines = ['@return a pointer to the {0}Arena of this '
+                        '{1}.'.format(global_variables.prefix,
+                                      self.class_name)]
+        additional = []
+
+        # create the function declaration
+        function = 'getArena'
+        return_type = '{0}Arena*'.format(global_variables.prefix)
+        arguments = []
+
+        code = [self.create_code_block('line', ['return &mArena'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
     # function to write get all elements
     def write_get_all_elements(self):
         if not global_variables.is_package:
@@ -414,6 +642,27 @@ class GlobalQueryFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # the document of another library keeps an index of the identifiers
+    # of its elements rather than searching its children recursively
+    def uses_element_index(self):
+        return self.document and not global_variables.is_package
+
+    # create the implementation of a lookup by identifier on a document
+    def write_element_index_lookup(self, name, lookup):
+        return [self.create_code_block('if',
+                                       ['{0}.empty()'.format(name),
+                                        'return NULL'])] + \
+            self.write_element_index_call('{0}({1})'.format(lookup, name))
+
+    # create the implementation of a call to the (built) element index
+    @staticmethod
+    def write_element_index_call(call):
+        return [GlobalQueryFunctions.create_code_block(
+                    'if', ['!mElementIndex.isBuilt()',
+                           'mElementIndex.build(this)']),
+                GlobalQueryFunctions.create_code_block(
+                    'line', ['return mElementIndex.{0}'.format(call)])]
+
     @staticmethod
     def create_code_block(code_type, lines):
         code = dict({'code_type': code_type, 'code': lines})
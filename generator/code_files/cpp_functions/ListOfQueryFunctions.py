@@ -395,7 +395,13 @@ class ListOfQueryFunctions():
                      'implementation': code})
 
     def cpp_list_write_get_element_by_id(self, const):
-        if const:
+        if const and not global_variables.is_package:
+            implementation = ['return static_cast<const {0}*>'
+                              '(getItemById(sid))'.format(self.object_child_name)]
+        elif not global_variables.is_package:
+            implementation = ['return static_cast<{0}*>'
+                              '(getItemById(sid))'.format(self.object_child_name)]
+        elif const:
             implementation = ['vector<{0}*>::const_iterator '
                               'result'.format(self.std_base),
                               'result = find_if(mItems.begin(), mItems.end(), '
@@ -500,7 +506,12 @@ class ListOfQueryFunctions():
         else:
             return_type = '{0}*'.format(self.object_child_name)
         up_name = strFunctions.abbrev_name(element).upper()
-        if const and self.is_cpp_api and self.is_list_of:
+        if const and self.is_cpp_api and self.is_list_of \
+                and not global_variables.is_package:
+            implementation = ['return static_cast<const {0}*>(getItemByReference('
+                              '\"{1}\", sid))'.format(self.object_child_name,
+                                                     self.get_xml_name(sid_ref))]
+        elif const and self.is_cpp_api and self.is_list_of:
             implementation = ['vector<{0}*>::const_iterator '
                               'result'.format(self.std_base),
                               'result = find_if(mItems.begin(), mItems.end(), '
@@ -508,6 +519,11 @@ class ListOfQueryFunctions():
                               'return (result == mItems.end()) ? 0 : '
                               'static_cast  <const {0}*> '
                               '(*result)'.format(self.object_child_name)]
+        elif self.is_cpp_api and self.is_list_of \
+                and not global_variables.is_package:
+            implementation = ['return static_cast<{0}*>(getItemByReference('
+                              '\"{1}\", sid))'.format(self.object_child_name,
+                                                     self.get_xml_name(sid_ref))]
         elif self.is_cpp_api and not self.is_list_of:
             implementation = ['return {0}.getBy{1}'
                               '(sid)'.format(self.class_object['memberName'],
@@ -537,10 +553,68 @@ class ListOfQueryFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # function to write get all by sidref from a listOf
+    def write_get_all_elements_by_sidref(self, sid_ref):
+        # only the other libraries keep indices of their references
+        if not self.is_cpp_api or not self.is_list_of \
+                or global_variables.is_package:
+            return
+
+        # useful variables
+        element = strFunctions.upper_first(sid_ref['name'])
+        elemType = sid_ref['element'] if 'element' in sid_ref else 'element'
+        att_name = sid_ref['name']
+        match = [element, 'all']
+        if match in self.used_sidrefs:
+            return
+        else:
+            self.used_sidrefs.append(match)
+
+        # create comment
+        if elemType == 'SBase':
+            title_line = 'Get all the {0} objects in the {1} that refer to ' \
+                         'a given element.'.format(self.object_child_name,
+                                                   self.object_name)
+        else:
+            title_line = 'Get all the {0} objects in the {1} that refer to ' \
+                         'a given {2}.'.format(self.object_child_name,
+                                               self.object_name, element)
+        params = ['@param sid a string representing the \"{0}\" attribute '
+                  'of the {1} objects to '
+                  'retrieve.'.format(att_name, self.object_child_name)]
+        return_lines = ['@return a List of the {0} objects in this {1} with '
+                        'the given {2} attribute, in the order in which they '
+                        'appear.'.format(self.object_child_name,
+                                         self.object_name, att_name)]
+        additional = ['The caller owns the returned List (but not the '
+                      '{0} objects in it) and is responsible for deleting '
+                      'it.'.format(self.object_child_name)]
+
+        # create function declaration
+        function = 'getAllBy{0}'.format(element)
+        arguments = ['const std::string& sid']
+        return_type = 'List*'
+        implementation = ['return getItemsByReference(\"{0}\", '
+                          'sid)'.format(self.get_xml_name(sid_ref))]
+        code = [self.create_code_block('line', implementation)]
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
     # function to write lookup by sidref from a listOf
     def write_lookup(self, sid_ref):
-        # c api does not need it
-        if not self.is_cpp_api:
+        # c api does not need it, and the other libraries look references
+        # up through the indices of their ListOf (see getItemByReference)
+        if not self.is_cpp_api or not global_variables.is_package:
             return
 
         # useful variables
@@ -735,7 +809,11 @@ class ListOfQueryFunctions():
 
         code = []
         if not self.is_header:
-            if self.status == 'cpp_list':
+            if self.status == 'cpp_list' and not global_variables.is_package:
+                implementation = ['return static_cast<{0}*>'
+                                  '(removeItemById(sid))'.format(self.object_child_name)]
+                code = [self.create_code_block('line', implementation)]
+            elif self.status == 'cpp_list':
                implementation = ['{0}* item = NULL'.format(self.std_base),
                                   'vector<{0}*>::iterator '
                                   'result'.format(self.std_base)]
@@ -1025,7 +1103,7 @@ class ListOfQueryFunctions():
                                   'delete {0}ns'.format(pack_low),
                                   'catch', '...', '']
             else:
-                implementation = ['{0} = new {1}(get{2}Namespaces())'
+                implementation = ['{0} = new (getDocumentArena()) {1}(getShared{2}Namespaces())'
                                   ''.format(self.abbrev_child,
                                             self.child_name,
                                             global_variables.prefix),
@@ -1069,7 +1147,7 @@ class ListOfQueryFunctions():
                                   'delete {0}ns'.format(pack_low),
                                   'catch', '...', '']
             else:
-                implementation = ['{0} = new {1}(get{2}Namespaces())'
+                implementation = ['{0} = new (getDocumentArena()) {1}(getShared{2}Namespaces())'
                                   ''.format(abbrev_child,
                                             child,
                                             global_variables.prefix),
@@ -1259,6 +1337,12 @@ class ListOfQueryFunctions():
 
     # HELPER FUNCTIONS
 
+    @staticmethod
+    def get_xml_name(attribute):
+        if 'xml_name' in attribute and attribute['xml_name'] != '':
+            return attribute['xml_name']
+        return attribute['name']
+
     @staticmethod
     def create_code_block(code_type, lines):
         code = dict({'code_type': code_type, 'code': lines})
@@ -408,14 +408,18 @@ class ProtectedFunctions():
                               'stream.peek().getName()',
                               '{0}* object = NULL'.format(self.std_base)]
         code = [dict({'code_type': 'line', 'code': implementation})]
-        implementation = self.write_create_object_class(self.child_name,
-                                                        ns)
-        code.append(self.create_code_block('if', implementation))
+        # a list used more than once matches its own element name, so the
+        # concrete classes, whose names are fixed, must be tried first
+        blocks = []
         for i in range(0, len(self.concretes)):
-            implementation = \
-                self.write_create_object_class(
-                    self.concretes[i]['element'], ns)
-            code.append(self.create_code_block('if', implementation))
+            blocks.append(self.write_create_object_class(
+                self.concretes[i]['element'], ns, concrete=True))
+        base_block = self.write_create_object_class(self.child_name, ns)
+        if self.lo_used_more_than_once:
+            blocks.append(base_block)
+        else:
+            blocks.insert(0, base_block)
+        code.append(self.create_chained_if_block(blocks))
         if global_variables.is_package:
             code.append(self.create_code_block('line',
                                                ['delete {0}'.format(ns),
@@ -441,14 +445,11 @@ class ProtectedFunctions():
                               '{0}* object = NULL'.format(self.std_base)]
 
         code = [dict({'code_type': 'line', 'code': implementation})]
-        implementation = self.write_create_object_class(self.child_name,
-                                                        ns)
-        code.append(self.create_code_block('if', implementation))
+        blocks = [self.write_create_object_class(self.child_name, ns)]
         for i in range(0, len(self.child_elements)):
-            implementation = \
-                self.write_create_object_class(
-                    self.child_elements[i]['element'], ns, True)
-            code.append(self.create_code_block('if', implementation))
+            blocks.append(self.write_create_object_class(
+                self.child_elements[i]['element'], ns, True))
+        code.append(self.create_chained_if_block(blocks))
         if global_variables.is_package:
             code.append(self.create_code_block('line',
                                                ['delete {0}'.format(ns),
@@ -459,28 +460,42 @@ class ProtectedFunctions():
 
         return code
 
-    def write_create_object_class(self, name, ns, create=False):
+    def create_chained_if_block(self, blocks):
+        # only the first matching block is run
+        if len(blocks) == 1:
+            return self.create_code_block('if', blocks[0])
+        implementation = list(blocks[0])
+        for block in blocks[1:]:
+            implementation.append('else if')
+            implementation += block
+        return self.create_code_block('else_if', implementation)
+
+    def write_create_object_class(self, name, ns, create=False, concrete=False):
         if global_variables.is_package:
             use_ns = ns
+            allocate = 'new'
         else:
-            use_ns = 'get{0}Namespaces()'.format(global_variables.prefix)
+            use_ns = 'getShared{0}Namespaces()'.format(global_variables.prefix)
+            allocate = 'new (getDocumentArena())'
         xmlname = strFunctions.lower_first(name)
         if not global_variables.is_package:
             temp = strFunctions.remove_prefix(name)
             xmlname = strFunctions.lower_first(temp)
 
         if not create:
-            if self.is_list_of and self.lo_used_more_than_once:
+            if self.is_list_of and self.lo_used_more_than_once and not concrete:
                 nest = ['object', 'dynamic_cast<{0}*>(object)->setElementName(name)'.format(self.child_name)]
                 nested_if = self.create_code_block('if', nest)
                 implementation = ['name == mElementName',
-                                  'object = new {0}({1})'.format(name, use_ns),
+                                  'object = {0} {1}({2})'.format(allocate, name,
+                                                                 use_ns),
                                   nested_if,
                                   'appendAndOwn(object)']
             else:
                 implementation = ['name == '
                                   '\"{0}\"'.format(xmlname),
-                                  'object = new {0}({1})'.format(name, use_ns),
+                                  'object = {0} {1}({2})'.format(allocate, name,
+                                                                 use_ns),
                                   'appendAndOwn(object)']
         else:
             abbrev = strFunctions.abbrev_name(name)
@@ -551,8 +566,10 @@ class ProtectedFunctions():
     def get_obj_block(self, name, xmlname, error_line, over_write, element, ns, concrete_name=''):
         implementation = []
         used_ns = ns
+        allocate = 'new'
         if not global_variables.is_package:
-            used_ns = 'get{0}Namespaces()'.format(global_variables.prefix)
+            used_ns = 'getShared{0}Namespaces()'.format(global_variables.prefix)
+            allocate = 'new (getDocumentArena())'
         if len(concrete_name) > 0:
             name_to_use = concrete_name
         else:
@@ -583,8 +600,8 @@ class ProtectedFunctions():
         implementation.append('name == \"{0}\"'.format(xmlname))
         implementation.append(nested_if)
         implementation.append('delete {0}'.format(name))
-        implementation.append('{0} = new {1}'
-                              '({2})'.format(name,
+        implementation.append('{0} = {1} {2}'
+                              '({3})'.format(name, allocate,
                                              element, used_ns))
         if over_write:
             implementation.append('{0}->setElementName'
@@ -664,6 +681,52 @@ class ProtectedFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # function to write addReferenceAttributes
+    def write_add_reference_attributes(self):
+        if global_variables.is_package or not self.is_cpp_api:
+            return
+        sid_refs = [attribute for attribute in self.attributes
+                    if attribute['type'] == 'SIdRef'
+                    and not attribute['isArray']]
+        if len(sid_refs) == 0:
+            return
+
+        # create comment parts
+        title_line = 'Adds the names of the SIdRef attributes of this element'
+        params = []
+        return_lines = []
+        additional = []
+
+        # create the function declaration
+        function = 'addReferenceAttributes'
+        return_type = 'void'
+        arguments = ['std::vector<std::string>& attributes']
+
+        # create the function implementation
+        if self.base_class:
+            implementation = ['{0}::addReferenceAttributes'
+                              '(attributes)'.format(self.base_class)]
+            code = [dict({'code_type': 'line', 'code': implementation})]
+        else:
+            code = []
+        for attribute in sid_refs:
+            implementation = ['attributes.push_back(\"{0}\")'
+                              ''.format(attribute['xml_name'])]
+            code.append(dict({'code_type': 'line', 'code': implementation}))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
     # function to write readAttributes
     def write_read_attributes(self):
         if self.has_std_base and len(self.attributes) == 0:
@@ -705,11 +768,16 @@ class ProtectedFunctions():
             line = ['{0}::readAttributes(attributes, '
                     'expectedAttributes)'.format(self.base_class),
                     ]
+            if not global_variables.is_package:
+                # only the errors logged while reading this element need
+                # to be looked at
+                line.insert(0, 'numErrs = log ? log->getNumErrors() : 0')
             code.append(self.create_code_block('line', line))
 
             ifblock = ['log']
-            line = ['numErrs = log->getNumErrors()']
-            ifblock.append(self.create_code_block('line', line))
+            if global_variables.is_package:
+                line = ['numErrs = log->getNumErrors()']
+                ifblock.append(self.create_code_block('line', line))
             line = self.get_error_from_base_class()
             ifblock.append(self.create_code_block('for', line))
             code.append(self.create_code_block('if', ifblock))
@@ -1122,11 +1190,43 @@ class ProtectedFunctions():
         # find the array attribute
         name = ''
         array_type = ''
+        member = ''
+        is_set_l = ''
+        storage = None
         for attrib in self.attributes:
             if attrib['isArray']:
                 name = attrib['capAttName']
                 array_type = attrib['element']
-        # create the function implementation
+                member = attrib['memberName']
+                is_set_l = 'mIsSet' + \
+                    strFunctions.upper_first(attrib['name']) + 'Length'
+                if 'storage' in attrib:
+                    storage = attrib['storage']
+        codec = query.get_array_text_codec(array_type)
+        if storage is not None:
+            code = self.write_stored_element_text(name, member, is_set_l,
+                                                  storage)
+        elif codec is None:
+            code = self.write_stream_element_text(name, array_type)
+        else:
+            code = self.write_scanned_element_text(member, is_set_l,
+                                                   array_type, codec)
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # the values are read with a stream when they are not numbers
+    def write_stream_element_text(self, name, array_type):
         implementation = ['stringstream strStream(text)',
                           '{0} val'.format(array_type),
                           'vector<{0}> valuesVector'.format(array_type)]
@@ -1148,6 +1248,183 @@ class ProtectedFunctions():
                                             for_loop,
                                             'set{0}(data, length)'.format(name),
                                             'delete[] data']))
+        return code
+
+    # the code counting the values in the text
+    def write_count_element_text(self):
+        implementation = ['const char* current = text.c_str()',
+                          'char* next = NULL',
+                          'unsigned int length = 0',
+                          'bool inValue = false']
+        code = [self.create_code_block('line', implementation)]
+        code.append(self.create_code_block(
+            'for', ['const char* c = current; *c != \'\\0\'; ++c',
+                    'bool isSpace = (isspace((unsigned char)*c) != 0)',
+                    self.create_code_block('if', ['!isSpace && !inValue',
+                                                  '++length']),
+                    'inValue = !isSpace']))
+        return code
+
+    # numbers are counted and then converted straight into the array
+    def write_scanned_element_text(self, member, is_set_l, array_type, codec):
+        convert = codec[0]
+        value_type = codec[1]
+        length = member + 'Length'
+        code = self.write_count_element_text()
+        convert_line = '{0} value = {1}'.format(value_type,
+                                                convert.format('current',
+                                                               'next'))
+        read_loop = self.create_code_block(
+            'while', ['numValues < length',
+                      convert_line,
+                      self.create_code_block('if', ['next == current',
+                                                    'break']),
+                      'data[numValues++] = ({0})value'.format(array_type),
+                      'current = next'])
+        store = self.create_code_block(
+            'if_else', ['numValues > 0',
+                        'delete[] {0}'.format(member),
+                        '{0} = data'.format(member),
+                        '{0} = (int)numValues'.format(length),
+                        '{0} = true'.format(is_set_l),
+                        'else',
+                        'delete[] data'])
+        code.append(self.create_code_block(
+            'if', ['length > 0',
+                   '{0}* data = new {0}[length]'.format(array_type),
+                   'unsigned int numValues = 0',
+                   read_loop,
+                   store]))
+        return code
+
+    # numbers are counted and then converted straight into an array stored
+    # in the type given by an enum attribute; they are kept in the narrowest
+    # type holding them all, those read so far being widened when one does
+    # not fit
+    def write_stored_element_text(self, name, member, is_set_l, storage):
+        [convert, value_type, unused, unused, unused] = \
+            query.get_array_text_codec('double')
+        code = self.write_count_element_text()
+        convert_line = '{0} value = {1}'.format(value_type,
+                                                convert.format('current',
+                                                               'next'))
+        if storage['byteType'] is None:
+            start = storage['invalid']
+        else:
+            start = storage['byteType']
+        widen = self.create_code_block(
+            'for', ['unsigned int i = 0; i < numValues; ++i',
+                    'set{0}Value(wider, valueType, i, get{0}Value(data, type, '
+                    'i))'.format(name)])
+        read = [convert_line,
+                self.create_code_block('if', ['next == current', 'break']),
+                '{0} valueType = get{1}ValueType(type, value)'.format(
+                    storage['enumType'], name),
+                self.create_code_block(
+                    'if', ['valueType != type',
+                           'void* wider = malloc(get{0}ValueSize(valueType)*'
+                           'length)'.format(name),
+                           widen,
+                           'free(data)',
+                           'data = wider',
+                           'type = valueType']),
+                'set{0}Value(data, type, numValues++, value)'.format(name),
+                'current = next']
+        read_loop = self.create_code_block('while',
+                                           ['numValues < length'] + read)
+        store = self.create_code_block(
+            'if_else', ['numValues > 0',
+                        'free({0})'.format(member),
+                        '{0} = data'.format(member),
+                        '{0} = type'.format(storage['typeMember']),
+                        '{0}Length = (int)numValues'.format(member),
+                        '{0} = true'.format(is_set_l),
+                        'else',
+                        'free(data)'])
+        code.append(self.create_code_block(
+            'if', ['length > 0',
+                   '{0} type = {1}'.format(storage['enumType'], start),
+                   'void* data = malloc(get{0}ValueSize(type)*'
+                   'length)'.format(name),
+                   'unsigned int numValues = 0',
+                   read_loop,
+                   store]))
+        return code
+
+    ########################################################################
+
+    # Functions for writing the helpers of arrays stored in the type given
+    # by an enum attribute
+
+    def write_array_storage_helper(self, kind):
+        if not self.is_cpp_api:
+            return
+        attribute = None
+        for attrib in self.attributes:
+            if attrib['isArray'] and 'storage' in attrib:
+                attribute = attrib
+        if attribute is None:
+            return
+        storage = attribute['storage']
+        name = attribute['capAttName']
+        enum_type = storage['enumType']
+        element = attribute['element']
+        params = []
+        return_lines = []
+        additional = []
+        if kind == 'size':
+            title_line = 'Returns the number of bytes taken by one value ' \
+                         'of the given type'
+            function = 'get{0}ValueSize'.format(name)
+            return_type = 'size_t'
+            arguments = ['{0} type'.format(enum_type)]
+        elif kind == 'get':
+            title_line = 'Returns a value of an array of the given type'
+            function = 'get{0}Value'.format(name)
+            return_type = 'double'
+            arguments = ['const void* data', '{0} type'.format(enum_type),
+                         'int index']
+        elif kind == 'type':
+            title_line = 'Returns the type in which values of the given type ' \
+                         'are stored together with the given value: the ' \
+                         'first of bytes, the element type and doubles that ' \
+                         'holds them all exactly'
+            function = 'get{0}ValueType'.format(name)
+            return_type = enum_type
+            arguments = ['{0} type'.format(enum_type), 'double value']
+            return self.write_array_storage_type_helper(
+                storage, element, title_line, function, return_type,
+                arguments)
+        else:
+            title_line = 'Sets a value of an array of the given type'
+            function = 'set{0}Value'.format(name)
+            return_type = 'void'
+            arguments = ['void* data', '{0} type'.format(enum_type),
+                         'int index', 'double value']
+
+        switch = ['type']
+        for [value, c_type] in storage['types'] + [['default', element]]:
+            if value == 'default':
+                switch.append('default')
+            else:
+                switch.append('case {0}'.format(value))
+            if kind == 'size':
+                switch.append('return sizeof({0})'.format(c_type))
+            elif kind == 'get':
+                switch.append('return ((const {0}*)data)[index]'
+                              ''.format(c_type))
+            else:
+                # values out of the range of the type are clamped to it, as
+                # converting them is undefined
+                limits = query.get_array_storage_limits(c_type)
+                if limits is None:
+                    switch.append('(({0}*)data)[index] = value'.format(c_type))
+                else:
+                    switch.append('(({0}*)data)[index] = ({0})(value > {1} ? '
+                                  '(value < {2} ? value : {2}) : {1})'.format(
+                                      c_type, limits[0], limits[1]))
+                switch.append('break')
+        code = [self.create_code_block('switch', switch)]
 
         # return the parts
         return dict({'title_line': title_line,
@@ -1158,7 +1435,48 @@ class ProtectedFunctions():
                      'return_type': return_type,
                      'arguments': arguments,
                      'constant': False,
-                     'virtual': True,
+                     'virtual': False,
+                     'static': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # the helper choosing the type in which values are stored: bytes while
+    # they are integers from 0 to 255, the element type while they are held
+    # by it, and doubles otherwise
+    def write_array_storage_type_helper(self, storage, element, title_line,
+                                        function, return_type, arguments):
+        code = []
+        if storage['byteType'] is not None:
+            code.append(self.create_code_block(
+                'if', ['type == {0} && value >= 0 && value <= UCHAR_MAX && '
+                       'value == (unsigned char)value'.format(
+                           storage['byteType']),
+                       'return {0}'.format(storage['byteType'])]))
+        limits = query.get_array_storage_limits(element)
+        if limits is None or storage['realType'] is None:
+            code.append(self.create_code_block(
+                'line', ['return {0}'.format(storage['invalid'])]))
+        else:
+            code.append(self.create_code_block(
+                'if', ['type != {0} && value >= {1} && value <= {2} && '
+                       'value == ({3})value'.format(storage['realType'],
+                                                    limits[0], limits[1],
+                                                    element),
+                       'return {0}'.format(storage['invalid'])]))
+            code.append(self.create_code_block(
+                'line', ['return {0}'.format(storage['realType'])]))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': [],
+                     'return_lines': [],
+                     'additional': [],
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'static': True,
                      'object_name': self.struct_name,
                      'implementation': code})
 
@@ -1251,7 +1569,7 @@ class ProtectedFunctions():
         else:
             line = ['log->getError(n)->getErrorId() == {0}'.format(unknown_error_att),
                     'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove({0})'.format(unknown_error_att),
+                    'log->remove({0}, n)'.format(unknown_error_att),
                     'log->{0}{1}, {2}, details, getLine(), getColumn())'.format(self.error, c_err,
                                                         self.given_args)]
             if_err = self.create_code_block('if', line)
@@ -1332,15 +1650,34 @@ class ProtectedFunctions():
         else:
             line = ['log->getError(n)->getErrorId() == {0}'.format(unknown_error_att),
                     'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove({0})'.format(unknown_error_att),
+                    'log->remove({0}, n)'.format(unknown_error_att),
                     'log->{0}{1}, {2}, details, getLine(), getColumn())'
                     ''.format(self.error, error, self.given_args)]
             if_err = self.create_code_block('if', line)
 
-
-        line = ['int n = numErrs-1; n >= 0; n--', if_err]
+        if global_variables.is_package:
+            line = ['int n = numErrs-1; n >= 0; n--', if_err]
+        else:
+            line = ['int n = log->getNumErrors()-1; n >= (int)numErrs; n--',
+                    if_err]
         return line
 
+    # the log of other libraries can be searched from the point at which
+    # the attribute was read rather than from the start
+    @staticmethod
+    def get_type_mismatch_check():
+        if global_variables.is_package:
+            return 'log->contains(XMLAttributeTypeMismatch)'
+        else:
+            return 'log->contains(XMLAttributeTypeMismatch, numErrs)'
+
+    @staticmethod
+    def get_type_mismatch_removal():
+        if global_variables.is_package:
+            return 'log->remove(XMLAttributeTypeMismatch)'
+        else:
+            return 'log->remove(XMLAttributeTypeMismatch, numErrs)'
+
     def write_write_att(self, attributes, index, code):
         if attributes[index]['isArray']:
             return
@@ -1405,8 +1742,9 @@ class ProtectedFunctions():
 
         # sort error names to be used
         [error_bool, error] = self.sort_error_names(strFunctions.upper_first(attribute['name']), 'Boolean')
-        line = ['log && log->getNumErrors() == numErrs + 1 && log->contains(XMLAttributeTypeMismatch)',
-                'log->remove(XMLAttributeTypeMismatch)',
+        line = ['log && log->getNumErrors() == numErrs + 1 && '
+                '{0}'.format(self.get_type_mismatch_check()),
+                self.get_type_mismatch_removal(),
                 'log->{0}{1}, {2})'.format(self.error, error_bool, self.given_args)]
         if attribute['reqd']:
             line += ['else',
@@ -1735,8 +2073,8 @@ class ProtectedFunctions():
         code.append(self.create_code_block('line', line))
 
         line = ['log && log->getNumErrors() == numErrs + 1 && '
-                'log->contains(XMLAttributeTypeMismatch)',
-                'log->remove(XMLAttributeTypeMismatch)',
+                '{0}'.format(self.get_type_mismatch_check()),
+                self.get_type_mismatch_removal(),
                 'std::string message = \"{0} attribute \'{1}\' '
                 'from the <{2}> element must be an '
                 'integer.\"'.format(self.package, attribute['xml_name'], self.class_name),
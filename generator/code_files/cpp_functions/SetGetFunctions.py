@@ -245,7 +245,8 @@ class SetGetFunctions():
             if not self.document:
                 implementation = ['return {0}'.format(attribute['memberName'])]
             else:
-                implementation = self.write_get_for_doc_functions(attribute)
+                implementation = self.write_get_for_doc_functions(attribute,
+                                                                    const)
             code = [self.create_code_block('line', implementation)]
         else:
             code = self.get_c_attribute(attribute)
@@ -274,12 +275,18 @@ class SetGetFunctions():
 
 
     # function to write the correct get for doc elements in other libraries
-    def write_get_for_doc_functions(self, attribute):
+    def write_get_for_doc_functions(self, attribute, const=True):
         if attribute['memberName'] == 'mErrorLog':
             implementation = ['return &{0}'.format(attribute['memberName'])]
         elif attribute['name'] == 'Namespaces':
             implementation = ['return {0}->getNamespaces()'
                               ''.format(attribute['memberName'])]
+            # the namespaces may be shared, so copy them before they
+            # can be modified
+            if not const:
+                implementation.insert(0, '{0} = {1}Namespaces::unshare({0})'
+                                      ''.format(attribute['memberName'],
+                                                global_variables.prefix))
         else:
             implementation = ['return {0}'.format(attribute['memberName'])]
 
@@ -410,9 +417,24 @@ class SetGetFunctions():
             'if',
             ['outArray == NULL || {0} == NULL'.format(attribute['memberName']),
              'return'])]
-        line = ['memcpy(outArray, {0}, sizeof({1})*{0}'
-                'Length)'.format(attribute['memberName'], attribute['element'])]
-        code.append(self.create_code_block('line', line))
+        if 'storage' in attribute:
+            additional.append('@note the values are converted from the type '
+                              'they are stored in; see get{0}StorageType().'
+                              ''.format(attribute['capAttName']))
+            # values of no type are of the element type
+            code.append(self.create_code_block(
+                'for', ['int i = 0; i < {0}Length; ++i'.format(
+                            attribute['memberName']),
+                        'set{0}Value(outArray, {1}, i, get{0}Value({2}, {3}, '
+                        'i))'.format(attribute['capAttName'],
+                                     attribute['storage']['invalid'],
+                                     attribute['memberName'],
+                                     attribute['storage']['typeMember'])]))
+        else:
+            line = ['memcpy(outArray, {0}, sizeof({1})*{0}'
+                    'Length)'.format(attribute['memberName'],
+                                     attribute['element'])]
+            code.append(self.create_code_block('line', line))
 
         # return the parts
         return dict({'title_line': title_line,
@@ -838,7 +860,7 @@ class SetGetFunctions():
 
         # create the function implementation
         if self.is_cpp_api:
-            code = self.set_cpp_attribute(attribute)
+            code = self.prepares_for_change(self.set_cpp_attribute(attribute))
         else:
             if not self.is_list_of:
                 use_name = self.abbrev_parent
@@ -988,6 +1010,7 @@ class SetGetFunctions():
                 implementation = topif + this_code + ['else'] + \
                                  ['return {0}'.format(global_variables.ret_att_unex)]
                 code.append(self.create_code_block('if_else', implementation))
+            code = self.prepares_for_change(code)
 
         else:
             implementation = ['return ({0} != NULL) ? {0}->set{1}({2}): '
@@ -1053,20 +1076,149 @@ class SetGetFunctions():
         ar_type = attribute['element']
         is_set_l = 'mIsSet' + strFunctions.upper_first(attribute['name']) \
                    + 'Length'
+        if 'storage' in attribute:
+            additional.append('@note the values are converted to the type '
+                              'they are stored in; see get{0}StorageType().'
+                              ''.format(attribute['capAttName']))
+            code = self.write_set_array_storage_code(attribute)
+        else:
+            code = [self.create_code_block(
+                        'if', ['inArray == NULL',
+                               'return {0}'.format(self.invalid_att)]),
+                    self.create_code_block('if',
+                                           ['{0} != NULL'.format(member),
+                                            'delete[] {0}'.format(member)])]
+            implementation = ['{0} = new {1}[arrayLength]'.format(member,
+                                                                  ar_type),
+                              'memcpy({0}, inArray, sizeof('
+                              '{1})*arrayLength)'.format(member, ar_type),
+                              '{0} = true'.format(is_set_l),
+                              '{0} = arrayLength'.format(length)]
+            code.append(self.create_code_block('line', implementation))
+        code.append(self.create_code_block(
+            'line', ['return {0}'.format(self.success)]))
+        code = self.prepares_for_change(code)
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # the implementation of the set function for an array stored in the type
+    # given by an enum attribute: the values are kept in the narrowest type
+    # holding them all
+    def write_set_array_storage_code(self, attribute):
+        storage = attribute['storage']
+        name = attribute['capAttName']
+        member = attribute['memberName']
+        is_set_l = 'mIsSet' + strFunctions.upper_first(attribute['name']) \
+                   + 'Length'
+        if storage['byteType'] is None:
+            start = storage['invalid']
+        else:
+            start = storage['byteType']
         code = [self.create_code_block('if',
                                        ['inArray == NULL',
                                         'return {0}'.format(self.invalid_att)]),
+                self.create_code_block(
+                    'line', ['{0} type = {1}'.format(storage['enumType'],
+                                                     start)]),
+                self.create_code_block(
+                    'for', ['int i = 0; i < arrayLength; ++i',
+                            'type = get{0}ValueType(type, inArray[i])'
+                            ''.format(name)])]
+        code.append(self.create_code_block(
+            'line', ['void* data = malloc(get{0}ValueSize(type)*'
+                     '(arrayLength > 0 ? arrayLength : 1))'.format(name)]))
+        code.append(self.create_code_block(
+            'for', ['int i = 0; i < arrayLength; ++i',
+                    'set{0}Value(data, type, i, inArray[i])'.format(name)]))
+        code.append(self.create_code_block(
+            'if', ['{0} != NULL'.format(member), 'free({0})'.format(member)]))
+        code.append(self.create_code_block(
+            'line', ['{0} = data'.format(member),
+                     '{0} = type'.format(storage['typeMember']),
+                     '{0} = true'.format(is_set_l),
+                     '{0}Length = arrayLength'.format(member)]))
+        return code
+
+    # function to write the set function copying the values of an array
+    # stored in the type given by an enum attribute
+    def write_set_array_storage(self, index):
+        if not self.is_cpp_api or index >= len(self.attributes):
+            return None
+        attribute = self.attributes[index]
+        if 'storage' not in attribute:
+            return None
+        storage = attribute['storage']
+        name = attribute['name']
+        if 'xml_name' in attribute and attribute['xml_name'] != '':
+            name = attribute['xml_name']
+        member = attribute['memberName']
+        # create comment parts
+        title_line = 'Sets the value of the \"{0}\" attribute of this {1} ' \
+                     'from values of the given type.'.format(name,
+                                                             self.class_name)
+        params = ['@param inArray the values of the \"{0}\" attribute to be '
+                  'set, which are copied without being '
+                  'converted.'.format(name),
+                  '@param type {0} value giving the type of the values in '
+                  'inArray.'.format(storage['enumType']),
+                  '@param arrayLength int value for the number of values in '
+                  'inArray.']
+        return_lines = ["@copydetails doc_returns_success_code",
+                        '@li @{0}constant{1}{2}, '
+                        'OperationReturnValues_t{3}'.format(self.language,
+                                                            self.open_br,
+                                                            self.success,
+                                                            self.close_br),
+                        '@li @{0}constant{1}{2},'
+                        ' OperationReturnValues_t{3}'.format(self.language,
+                                                             self.open_br,
+                                                             self.invalid_att,
+                                                             self.close_br)]
+        additional = ['@note values of type @{0}constant{1}{2}, {3}{4} are '
+                      'taken to be of type {5}.'.format(
+                          self.language, self.open_br, storage['invalid'],
+                          storage['enumType'], self.close_br,
+                          attribute['element'])]
+
+        # create the function declaration
+        function = 'set{0}'.format(attribute['capAttName'])
+        return_type = 'int'
+        arguments = ['const void* inArray',
+                     '{0} type'.format(storage['enumType']),
+                     'int arrayLength']
+        is_set_l = 'mIsSet' + strFunctions.upper_first(attribute['name']) \
+                   + 'Length'
+        code = [self.create_code_block('if',
+                                       ['inArray == NULL',
+                                        'return {0}'.format(self.invalid_att)]),
+                self.create_code_block(
+                    'line', ['size_t numBytes = get{0}ValueSize(type)*'
+                             '(arrayLength > 0 ? arrayLength : 1)'.format(
+                                 attribute['capAttName']),
+                             'void* data = malloc(numBytes)',
+                             'memcpy(data, inArray, numBytes)']),
                 self.create_code_block('if',
                                        ['{0} != NULL'.format(member),
-                                        'delete[] {0}'.format(member)])]
-        implementation = ['{0} = new {1}[arrayLength]'.format(member, ar_type),
-                          'memcpy({0}, inArray, sizeof('
-                          '{1})*arrayLength)'.format(member, ar_type),
-                          '{0} = true'.format(is_set_l),
-                          '{0} = arrayLength'.format(length)]
-        code.append(self.create_code_block('line', implementation))
-        code.append(self.create_code_block(
-            'line', ['return {0}'.format(self.success)]))
+                                        'free({0})'.format(member)]),
+                self.create_code_block(
+                    'line', ['{0} = data'.format(member),
+                             '{0} = type'.format(storage['typeMember']),
+                             '{0} = true'.format(is_set_l),
+                             '{0}Length = arrayLength'.format(member)]),
+                self.create_code_block(
+                    'line', ['return {0}'.format(self.success)])]
+        code = self.prepares_for_change(code)
 
         # return the parts
         return dict({'title_line': title_line,
@@ -1081,6 +1233,81 @@ class SetGetFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # function to write the functions giving the values of an array stored
+    # in the type given by an enum attribute without converting them
+    def write_get_array_storage(self, index, get_type):
+        if not self.is_cpp_api or index >= len(self.attributes):
+            return None
+        attribute = self.attributes[index]
+        if 'storage' not in attribute:
+            return None
+        storage = attribute['storage']
+        name = attribute['name']
+        if 'xml_name' in attribute and attribute['xml_name'] != '':
+            name = attribute['xml_name']
+        params = []
+        additional = []
+        if get_type:
+            title_line = 'Returns the type in which the values of the ' \
+                         '\"{0}\" attribute of this {1} are ' \
+                         'stored.'.format(name, self.class_name)
+            return_lines = ['@return the type of the values returned by '
+                            'get{0}Storage().'.format(attribute['capAttName'])]
+            kinds = []
+            for [kind, value] in [['bytes', storage['byteType']],
+                                  ['values of type {0}'.format(
+                                      attribute['element']),
+                                   storage['invalid']],
+                                  ['doubles', storage['realType']]]:
+                if value is not None:
+                    kinds.append('{0} (@{1}constant{2}{3}, {4}{5})'.format(
+                        kind, self.language, self.open_br, value,
+                        storage['enumType'], self.close_br))
+            if len(kinds) > 1:
+                kinds = [', '.join(kinds[:-1]) + ' and ' + kinds[-1]]
+            additional = ['Values set from integers or read from text are '
+                          'stored in the first of {0} that holds them all '
+                          'exactly, whatever the \"{1}\" attribute.'.format(
+                              kinds[0], strFunctions.lower_first(
+                                  storage['typeFrom'][1:]))]
+            if storage['realType'] is None:
+                additional.append('Values that none of them holds are '
+                                  'clamped to the range of {0}.'.format(
+                                      attribute['element']))
+            function = 'get{0}StorageType'.format(attribute['capAttName'])
+            return_type = storage['enumType']
+            code = [self.create_code_block(
+                'line', ['return {0}'.format(storage['typeMember'])])]
+        else:
+            title_line = 'Returns the values of the \"{0}\" attribute of ' \
+                         'this {1} without converting them.'.format(
+                             name, self.class_name)
+            return_lines = ['@return the get{0}Length() values of the '
+                            '\"{1}\" attribute of this {2}, of the type '
+                            'returned by get{0}StorageType(), or @c NULL if '
+                            'it is not set.'.format(attribute['capAttName'],
+                                                    name, self.class_name)]
+            additional = ['@note the values are owned by this {0} and are '
+                          'invalidated when the \"{1}\" attribute is set or '
+                          'unset.'.format(self.class_name, name)]
+            function = 'get{0}Storage'.format(attribute['capAttName'])
+            return_type = 'const void*'
+            code = [self.create_code_block(
+                'line', ['return {0}'.format(attribute['memberName'])])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': [],
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
     # function to write set function for an array
     # specialised c function
     def write_c_set_array(self, index):
@@ -1184,7 +1411,7 @@ class SetGetFunctions():
 
         implementation = ['{0}.push_back({1})'.format(attribute['memberName'], attribute['name']),
                           'return {0}'.format(self.success)]
-        code = [dict({'code_type': 'line', 'code': implementation})]
+        code = self.prepares_for_change([dict({'code_type': 'line', 'code': implementation})])
 
         # return the parts
         return dict({'title_line': title_line,
@@ -1296,7 +1523,7 @@ class SetGetFunctions():
 
         # create the function implementation
         if self.is_cpp_api:
-            code = self.unset_cpp_attribute(attribute)
+            code = self.prepares_for_change(self.unset_cpp_attribute(attribute))
         else:
             if not self.is_list_of:
                 use_name = self.abbrev_parent
@@ -1354,7 +1581,7 @@ class SetGetFunctions():
         # create the function implementation
         implementation = ['{0}.clear()'.format(attribute['memberName']),
                           'return {0}'.format(self.success)]
-        code = [self.create_code_block('line', implementation)]
+        code = self.prepares_for_change([self.create_code_block('line', implementation)])
         # return the parts
         return dict({'title_line': title_line,
                      'params': params,
@@ -1440,7 +1667,7 @@ class SetGetFunctions():
                                   '{0} = new {1}'
                                   '({2}ns)'.format(member, att_name, this_low_pack)]
             else:
-                implementation = ['{0} = new {1}(get{2}Namespaces())'.format(member, att_name, global_variables.prefix)]
+                implementation = ['{0} = new (getDocumentArena()) {1}(getShared{2}Namespaces())'.format(member, att_name, global_variables.prefix)]
             code.append(self.create_code_block('line', implementation))
             if attribute['children_overwrite']:
                 line = ['{0}->setElementName(\"{1}\")'
@@ -1457,6 +1684,7 @@ class SetGetFunctions():
             code.append(self.create_code_block('line', ['connectToChild()']))
             code.append((self.create_code_block('line',
                                                 ['return {0}'.format(member)])))
+            code = self.prepares_for_change(code)
         elif not self.is_header:
             implementation = ['{0} == NULL'.format(self.abbrev_parent),
                               'return NULL']
@@ -1532,7 +1760,7 @@ class SetGetFunctions():
                                   '{0} = new {1}'
                                   '({2}ns)'.format(member, att_name, low_pack)]
             else:
-                implementation = ['{0} = new {1}(get{2}Namespaces())'.format(member, att_name, global_variables.prefix)]
+                implementation = ['{0} = new (getDocumentArena()) {1}(getShared{2}Namespaces())'.format(member, att_name, global_variables.prefix)]
 
             code.append(self.create_code_block('line', implementation))
             if global_variables.is_package:
@@ -1544,6 +1772,7 @@ class SetGetFunctions():
                                                 ['return static_cast<{0}*>'
                                                  '({1})'.format(att_name,
                                                                 member)])))
+            code = self.prepares_for_change(code)
         else:
             implementation = ['return ({0} != NULL) ? {0}->create{1}() : '
                               'NULL'.format(self.abbrev_parent,
@@ -1635,6 +1864,9 @@ class SetGetFunctions():
             else:
                 implementation = ['{0} = {1}'.format(member, name),
                                   'return {0}'.format(self.success)]
+                if self.updates_id_indices(attribute):
+                    implementation.insert(0, 'updateIdIndices({0}, {1})'
+                                             ''.format(member, name))
             if not deal_with_versions:
                 code = [dict({'code_type': 'line', 'code': implementation})]
             else:
@@ -1647,6 +1879,10 @@ class SetGetFunctions():
                               'return {0}'.format(self.invalid_att), 'else',
                               '{0} = {1}'.format(member, codename),
                               'return {0}'.format(self.success)]
+            if self.updates_reference_indices(attribute):
+                implementation.insert(3, 'updateReferenceIndices(\"{0}\", '
+                                         '{1}, {2})'.format(name1, member,
+                                                            codename))
             if not deal_with_versions:
                 code = [dict({'code_type': 'if_else', 'code': implementation})]
             else:
@@ -1904,6 +2140,17 @@ class SetGetFunctions():
     def unset_cpp_attribute(self, attribute):
         if attribute['attType'] == 'string':
             implementation = ['{0}.erase()'.format(attribute['memberName'])]
+            if self.updates_id_indices(attribute):
+                implementation.insert(0, 'updateIdIndices({0}, \"\")'
+                                         ''.format(attribute['memberName']))
+            elif self.updates_reference_indices(attribute):
+                xml_name = attribute['name']
+                if 'xml_name' in attribute and attribute['xml_name'] != '':
+                    xml_name = attribute['xml_name']
+                implementation.insert(0, 'updateReferenceIndices(\"{0}\", '
+                                         '{1}, \"\")'.format(
+                                             xml_name,
+                                             attribute['memberName']))
             implementation2 = ['{0}.empty() == '
                                'true'.format(attribute['memberName']),
                                'return {0}'.format(self.success), 'else',
@@ -1932,11 +2179,17 @@ class SetGetFunctions():
                               'return {0}'.format(self.success)]
             code = [dict({'code_type': 'line', 'code': implementation})]
         elif attribute['isArray']:
+            release = 'free({0})' if 'storage' in attribute \
+                else 'delete[] {0}'
+            reset = ['{0} = NULL'.format(attribute['memberName'])]
+            if 'storage' in attribute:
+                reset.append('{0} = {1}'.format(
+                    attribute['storage']['typeMember'],
+                    attribute['storage']['invalid']))
             code = [self.create_code_block(
                 'if', ['{0} != NULL'.format(attribute['memberName']),
-                       'delete[] {0}'.format(attribute['memberName'])]),
-                    self.create_code_block('line', [
-                        '{0} = NULL'.format(attribute['memberName'])]),
+                       release.format(attribute['memberName'])]),
+                    self.create_code_block('line', reset),
                     self.create_code_block('line', [
                         'return unset{0}Length()'.format(
                             strFunctions.upper_first(attribute['name']))])]
@@ -1945,6 +2198,47 @@ class SetGetFunctions():
             code = [dict({'code_type': 'line', 'code': implementation})]
         return code
 
+    @staticmethod
+    def updates_id_indices(attribute):
+        """
+        Return True if changing this attribute must keep the identifier
+        indices of the other library (see SBase::updateIdIndices) current.
+
+        :param attribute: the attribute being set/unset
+        :return: True for the "id" of a class outside an SBML package.
+        """
+        return not global_variables.is_package \
+            and attribute['type'] == 'SId' \
+            and attribute['memberName'] == 'mId'
+
+    @staticmethod
+    def updates_reference_indices(attribute):
+        """
+        Return True if changing this attribute must keep the index the
+        parent ListOf keeps of it (see SBase::updateReferenceIndices) current.
+
+        :param attribute: the attribute being set/unset
+        :return: True for an SIdRef of a class outside an SBML package.
+        """
+        return not global_variables.is_package \
+            and attribute['type'] == 'SIdRef'
+
+    def prepares_for_change(self, code):
+        """
+        Start the implementation of a function that changes an object of
+        the other library with a call to SBase::prepareForChange.
+
+        :param code: the code blocks of the function
+        :return: the code blocks, calling prepareForChange() first if needed.
+        """
+        if global_variables.is_package or not self.is_cpp_api:
+            return code
+        if len(code) > 0 and code[0]['code_type'] == 'line':
+            code[0]['code'].insert(0, 'prepareForChange()')
+        else:
+            code.insert(0, self.create_code_block('line', ['prepareForChange()']))
+        return code
+
     @staticmethod
     def create_code_block(code_type, lines):
         code = dict({'code_type': code_type, 'code': lines})
@@ -125,13 +125,11 @@ class ValidatorClassFunctions():
         code = []
         if not self.is_header:
             if constraints:
-                line = 'map<VConstraint*, bool>::iterator it = ptrMap.begin()'
+                line = 'vector<VConstraint*>::iterator it = constraints.begin()'
                 code.append(self.create_code_block('line', [line]))
-                nested_if = self.create_code_block('if', ['it->second',
-                                                          'delete it->first'])
                 code.append(self.create_code_block('while',
-                                                   ['it != ptrMap.end()',
-                                                    nested_if, '++it']))
+                                                   ['it != constraints.end()',
+                                                    'delete *it', '++it']))
             else:
                 line = ['delete m{0}Constraints'.format(self.up_package)]
                 code = [self.create_code_block('line', line)]
@@ -216,6 +214,51 @@ class ValidatorClassFunctions():
                      'object_name': self.class_name,
                      'implementation': code})
 
+    @staticmethod
+    def get_constrained_classes(elements):
+        # the classes with a ConstraintSet of their own
+        names = [global_variables.document_class, 'Model']
+        if elements:
+            for element in elements:
+                names.append(element['name'])
+        return names
+
+    def write_add_typed_constraint_function(self, name):
+        # create comment parts
+        title_line = 'Adds the given constraint on {0} objects to this ' \
+                     '{1}.'.format(name, self.class_name)
+        params = ['@param c the TConstraint object to add.']
+        return_lines = []
+        additional = ['The constraints declared for a validator are added '
+                      'through this overload where their type is known, so '
+                      'that they are filed without testing their type '
+                      'against each ConstraintSet.']
+
+        # create the function declaration
+        function = 'addConstraint'
+        return_type = 'void'
+        arguments = ['TConstraint<{0}>* c'.format(name)]
+        code = []
+        if not self.is_header:
+            line = ['if (c == NULL) return']
+            code = [self.create_code_block('line', line)]
+            line = ['m{0}Constraints->constraints.push_back(c)'.format(self.up_package),
+                    'm{0}Constraints->m{1}.add(c)'.format(self.up_package, name)]
+            code.append(self.create_code_block('line', line))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
     ########################################################################
 
     # Function for writing init/addConstraints functions
@@ -457,7 +500,7 @@ class ValidatorClassFunctions():
         arguments = ['VConstraint* c']
         line = ['if (c == NULL) return']
         code = [self.create_code_block('line', line)]
-        line = 'ptrMap.insert(pair<VConstraint*, bool>(c, true))'
+        line = 'constraints.push_back(c)'
         code.append(self.create_code_block('line', [line]))
         name = '{0}'.format(global_variables.document_class)
         block = self.create_if_add_constraint_block(name)
@@ -535,32 +578,15 @@ class ValidatorClassFunctions():
         std_return = 'return {0}Visitor::visit(x)'.format(self.cap_language)
         line = ['x.getPackageName() != \"{0}\"'.format(self.package),
                 std_return]
-        code = [self.create_code_block('if', line),
-                self.create_code_block('line',
-                                       ['int code = x.getTypeCode()']),
-                self.create_code_block('line',
-                                       ['const ListOf* list = dynamic_cast'
-                                        '<const ListOf*>(&x)'])]
-        no_elements = len(self.elements)
-        element = self.elements[0]
-        lines = ['code == {0}'.format(element['typecode']),
-                 'return visit((const {0}&)x)'.format(element['name'])]
-        index = 1
-        code_type = 'if_else'
-        while index < no_elements:
-            code_type = 'else_if'
-            element = self.elements[index]
-            lines.append('else if')
-            lines.append('code == {0}'.format(element['typecode']))
-            lines.append('return visit((const {0}&)x)'.format(element['name']))
-            index += 1
-        lines.append('else')
-        lines.append(std_return)
-        nested_if = self.create_code_block(code_type, lines)
-
-        code.append(self.create_code_block('if_else', ['list != NULL',
-                                                       std_return, 'else',
-                                                       nested_if]))
+        code = [self.create_code_block('if', line)]
+        # lists, whose type code is that of any ListOf, fall to the default
+        switch = ['x.getTypeCode()']
+        for element in self.elements:
+            switch.append('case {0}'.format(element['typecode']))
+            switch.append('return visit((const {0}&)x)'.format(element['name']))
+        switch.append('default')
+        switch.append(std_return)
+        code.append(self.create_code_block('switch', switch))
 
         # return the parts
         return dict({'title_line': title_line,
@@ -0,0 +1,206 @@
+#include <sbml/SBMLArena.h>
+
+#include <new>
+#include <vector>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#  include <atomic>
+#  define LIBSBML_HAS_ARENA 1
+#endif
+
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Every allocation is preceded by a header recording the pool it came
+ * from (NULL for the heap), so that deallocate() knows where it belongs
+ * without searching for it.  The header is a whole number of alignment
+ * units long so that the object following it stays aligned.
+ */
+union SBMLArenaHeader
+{
+  SBMLArenaPool* pool;
+  void*          pointer;
+  double         number;
+  long           integer;
+};
+
+
+#ifdef LIBSBML_HAS_ARENA
+
+/*
+ * The blocks of an arena.  The arena holds one reference to its pool and
+ * every live allocation another, so the pool outlives the SBMLArena that
+ * created it for as long as any allocation made from it is live, and the
+ * last of them to go frees all the blocks at once.
+ */
+struct SBMLArenaPool
+{
+  static const size_t BLOCK_SIZE = 64 * 1024;
+
+  std::vector<char*>  mBlocks;
+  char*               mNext;
+  char*               mEnd;
+  std::atomic<size_t> mNumReferences;
+
+  SBMLArenaPool ()
+    : mBlocks()
+    , mNext (NULL)
+    , mEnd (NULL)
+    , mNumReferences (1)
+  {
+  }
+
+  ~SBMLArenaPool ()
+  {
+    for (std::vector<char*>::iterator it = mBlocks.begin();
+         it != mBlocks.end(); ++it)
+    {
+      ::operator delete(*it);
+    }
+  }
+
+  char* allocate (size_t size)
+  {
+    char* memory;
+
+    if (size > BLOCK_SIZE / 4)
+    {
+      // large allocations get a block of their own so that the space left
+      // in the current block is not wasted
+      memory = static_cast<char*>(::operator new(size));
+      mBlocks.push_back(memory);
+    }
+    else
+    {
+      if (mNext == NULL || (size_t)(mEnd - mNext) < size)
+      {
+        mNext = static_cast<char*>(::operator new(BLOCK_SIZE));
+        mEnd = mNext + BLOCK_SIZE;
+        mBlocks.push_back(mNext);
+      }
+
+      memory = mNext;
+      mNext += size;
+    }
+
+    ++mNumReferences;
+    return memory;
+  }
+
+  // gives up one reference; the pool goes once none is left
+  void release ()
+  {
+    if (--mNumReferences == 0)
+    {
+      delete this;
+    }
+  }
+};
+
+#endif  /* LIBSBML_HAS_ARENA */
+
+
+SBMLArena::SBMLArena ()
+  : mPool (NULL)
+{
+}
+
+
+SBMLArena::SBMLArena (const SBMLArena&)
+  : mPool (NULL)
+{
+}
+
+
+SBMLArena&
+SBMLArena::operator=(const SBMLArena&)
+{
+  return *this;
+}
+
+
+SBMLArena::~SBMLArena ()
+{
+  setEnabled(false);
+}
+
+
+void
+SBMLArena::setEnabled (bool enabled)
+{
+#ifdef LIBSBML_HAS_ARENA
+  if (enabled && mPool == NULL)
+  {
+    mPool = new SBMLArenaPool();
+  }
+  else if (!enabled && mPool != NULL)
+  {
+    mPool->release();
+    mPool = NULL;
+  }
+#endif
+}
+
+
+bool
+SBMLArena::isEnabled () const
+{
+  return mPool != NULL;
+}
+
+
+void*
+SBMLArena::allocate (SBMLArena* arena, size_t size)
+{
+  const size_t headerSize = sizeof(SBMLArenaHeader);
+  size_t total = headerSize + ((size + headerSize - 1) / headerSize) * headerSize;
+  SBMLArenaHeader* header;
+
+#ifdef LIBSBML_HAS_ARENA
+  if (arena != NULL && arena->mPool != NULL)
+  {
+    header = reinterpret_cast<SBMLArenaHeader*>(arena->mPool->allocate(total));
+    header->pool = arena->mPool;
+    return header + 1;
+  }
+#endif
+
+  header = static_cast<SBMLArenaHeader*>(::operator new(total));
+  header->pool = NULL;
+  return header + 1;
+}
+
+
+void
+SBMLArena::deallocate (void* p)
+{
+  if (p == NULL) return;
+
+  SBMLArenaHeader* header = static_cast<SBMLArenaHeader*>(p) - 1;
+
+#ifdef LIBSBML_HAS_ARENA
+  if (header->pool != NULL)
+  {
+    // the memory itself goes back with the rest of the blocks
+    header->pool->release();
+    return;
+  }
+#endif
+
+  ::operator delete(header);
+}
+
+/** @endcond */
+
+#endif  /* __cplusplus */
+
+LIBSBML_CPP_NAMESPACE_END
@@ -0,0 +1,111 @@
+#ifndef SBMLArena_h
+#define SBMLArena_h
+
+
+#include <sbml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+#include <cstddef>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+struct SBMLArenaPool;
+
+/** @cond doxygenLibsbmlInternal */
+
+/**
+ * Arena from which the elements of an SBMLDocument can be allocated.
+ *
+ * When enabled, elements created for the document (most notably while it
+ * is being read) are carved out of a few large blocks instead of being
+ * allocated one by one.  Deleting such an element only records that it has
+ * gone; the blocks themselves are handed back in one go once the document
+ * has been destroyed and no element allocated from them is left, so an
+ * element removed from the document may safely outlive it.
+ *
+ * Every element, from an arena or from the heap, is preceded by a
+ * one-word header naming the pool it came from, so deleting it needs no
+ * lookup and no lock.  Deleting an element of an arena only drops a
+ * reference to its blocks, which are all freed together when the last
+ * element goes; normally that is while the document is destroyed.
+ *
+ * An arena must not be used from several threads at once, like the
+ * document it belongs to, but elements of different documents may be
+ * created and deleted concurrently.  Arenas need C++11 (or MSVC 2012 and
+ * later); without it setEnabled() has no effect and every element is
+ * allocated from the heap.
+ */
+class LIBSBML_EXTERN SBMLArena
+{
+public:
+
+  /**
+   * Creates a new, disabled, SBMLArena.
+   */
+  SBMLArena ();
+
+
+  /**
+   * Copy constructor; the copy starts out disabled and shares nothing
+   * with the original.
+   */
+  SBMLArena (const SBMLArena& orig);
+
+
+  /**
+   * Assignment operator; the arena is left unchanged.
+   */
+  SBMLArena& operator=(const SBMLArena& rhs);
+
+
+  /**
+   * Destroys this SBMLArena.  Its blocks are freed as soon as the last
+   * element allocated from them has been deleted.
+   */
+  ~SBMLArena ();
+
+
+  /**
+   * Enables or disables allocation from this arena.  Disabling it does not
+   * affect the elements already allocated.
+   *
+   * @param enabled @c true to allocate new elements from the arena.
+   */
+  void setEnabled (bool enabled);
+
+
+  /**
+   * Predicate returning @c true if new elements are allocated from this
+   * arena.
+   */
+  bool isEnabled () const;
+
+
+  /**
+   * Allocates @p size bytes from the given arena, or from the heap if
+   * @p arena is @c NULL or disabled.
+   *
+   * @return the allocated memory; throws std::bad_alloc on failure.
+   */
+  static void* allocate (SBMLArena* arena, size_t size);
+
+
+  /**
+   * Frees memory obtained from allocate().
+   */
+  static void deallocate (void* p);
+
+
+protected:
+
+  SBMLArenaPool* mPool;
+};
+
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* SBMLArena_h */
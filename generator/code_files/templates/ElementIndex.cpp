@@ -0,0 +1,622 @@
+#include <sbml/SBMLElementIndex.h>
+#include <sbml/SBMLDocument.h>
+#include <sbml/SBase.h>
+
+#include <algorithm>
+#include <set>
+
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibsbmlInternal */
+
+SBMLCounter SBMLElementIndex::mNumDestroyed(0);
+
+/*
+ * Creates a new, not yet built, SBMLElementIndex.
+ */
+SBMLElementIndex::SBMLElementIndex ()
+  : mIds()
+  , mMetaIds()
+  , mReferrers()
+  , mReferences()
+  , mBuilt (false)
+  , mBuilding (false)
+  , mAdding (false)
+  , mRemoving (false)
+  , mNumDuplicates (0)
+  , mEpoch (0)
+{
+}
+
+
+/*
+ * Copy constructor; the index refers to the elements of the original
+ * document so it is left to be rebuilt.
+ */
+SBMLElementIndex::SBMLElementIndex (const SBMLElementIndex& orig)
+  : mIds()
+  , mMetaIds()
+  , mReferrers()
+  , mReferences()
+  , mBuilt (false)
+  , mBuilding (false)
+  , mAdding (false)
+  , mRemoving (false)
+  , mNumDuplicates (0)
+  , mEpoch (0)
+{
+}
+
+
+/*
+ * Assignment operator
+ */
+SBMLElementIndex&
+SBMLElementIndex::operator=(const SBMLElementIndex& rhs)
+{
+  if (&rhs != this)
+  {
+    clear();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Destroys this SBMLElementIndex.
+ */
+SBMLElementIndex::~SBMLElementIndex ()
+{
+  ++mNumDestroyed;
+}
+
+
+/*
+ * @return true if the index can be used for lookups.
+ */
+bool
+SBMLElementIndex::isBuilt () const
+{
+  return mBuilt;
+}
+
+
+/*
+ * @return true while build() is populating the index.
+ */
+bool
+SBMLElementIndex::isBuilding () const
+{
+  return mBuilding;
+}
+
+
+/*
+ * Populates the index by walking the document once; every element
+ * reached by setSBMLDocument visits the index.
+ */
+void
+SBMLElementIndex::build (SBMLDocument* d)
+{
+  clear();
+
+  if (d == NULL) return;
+
+  mBuilt = true;
+  mBuilding = true;
+  d->setSBMLDocument(d);
+  mBuilding = false;
+}
+
+
+/*
+ * Empties the index and marks it as needing to be rebuilt.
+ */
+void
+SBMLElementIndex::clear ()
+{
+  mIds.clear();
+  mMetaIds.clear();
+  mReferrers.clear();
+  mReferences.clear();
+  mBuilt = false;
+  mBuilding = false;
+  mAdding = false;
+  mRemoving = false;
+  mNumDuplicates = 0;
+}
+
+
+/*
+ * Adds the identifier and metaid of the element.
+ */
+void
+SBMLElementIndex::add (SBase* element)
+{
+  if (element == NULL) return;
+
+  insertEntry(mIds, element->getId(), element);
+  insertEntry(mMetaIds, element->getMetaId(), element);
+  addReferences(element);
+}
+
+
+/*
+ * Removes the identifier and metaid of the element.
+ */
+void
+SBMLElementIndex::remove (SBase* element)
+{
+  if (element == NULL) return;
+
+  eraseEntry(mIds, element->getId(), element);
+  eraseEntry(mMetaIds, element->getMetaId(), element);
+  removeReferences(element);
+}
+
+
+/*
+ * Walks the subtree with setSBMLDocument so that each element adds itself.
+ * Unlike build() a clash with an element already indexed invalidates the
+ * index, as the order of the two in the document is not known.
+ */
+void
+SBMLElementIndex::addSubtree (SBase* element)
+{
+  if (!mBuilt || element == NULL) return;
+
+  mAdding = true;
+  element->setSBMLDocument(element->getSBMLDocument());
+  mAdding = false;
+}
+
+
+/*
+ * Walks the subtree with setSBMLDocument so that each element removes
+ * itself.
+ */
+void
+SBMLElementIndex::removeSubtree (SBase* element)
+{
+  if (!mBuilt || element == NULL) return;
+
+  mRemoving = true;
+  element->setSBMLDocument(element->getSBMLDocument());
+  mRemoving = false;
+}
+
+
+/*
+ * Adds or removes the element reached by the current walk, if any.
+ */
+void
+SBMLElementIndex::visit (SBase* element)
+{
+  if (mBuilding || mAdding)
+  {
+    add(element);
+  }
+  else if (mRemoving)
+  {
+    remove(element);
+  }
+}
+
+
+/*
+ * Returns the epoch of the document.
+ */
+unsigned long
+SBMLElementIndex::getEpoch () const
+{
+  return mEpoch;
+}
+
+
+/*
+ * Advances the epoch of the document.
+ */
+void
+SBMLElementIndex::advanceEpoch ()
+{
+  ++mEpoch;
+}
+
+
+/*
+ * Returns the number of indices destroyed so far.
+ */
+unsigned long
+SBMLElementIndex::getNumDestroyed ()
+{
+  return mNumDestroyed;
+}
+
+
+/*
+ * Moves the element from its old identifier to the new one.
+ */
+void
+SBMLElementIndex::updateId (SBase* element, const std::string& oldId,
+                            const std::string& newId)
+{
+  if (oldId == newId) return;
+
+  eraseEntry(mIds, oldId, element);
+  insertEntry(mIds, newId, element);
+}
+
+
+/*
+ * Moves the element from its old metaid to the new one.
+ */
+void
+SBMLElementIndex::updateMetaId (SBase* element, const std::string& oldMetaId,
+                                const std::string& newMetaId)
+{
+  if (oldMetaId == newMetaId) return;
+
+  eraseEntry(mMetaIds, oldMetaId, element);
+  insertEntry(mMetaIds, newMetaId, element);
+}
+
+
+/*
+ * Moves the element from the referrers of its old reference to those of
+ * the new one.
+ */
+void
+SBMLElementIndex::updateReference (SBase* element,
+                                   const std::string& attributeName,
+                                   const std::string& oldRef,
+                                   const std::string& newRef)
+{
+  if (oldRef == newRef) return;
+
+  eraseReference(element, attributeName, oldRef);
+  addReference(element, attributeName, newRef);
+}
+
+
+/*
+ * Records the references made by the SIdRef attributes of the element.
+ */
+void
+SBMLElementIndex::addReferences (SBase* element)
+{
+  if (!mBuilt || element == NULL) return;
+
+  std::vector<std::string> attributes;
+  element->addReferenceAttributes(attributes);
+
+  std::string ref;
+  for (std::vector<std::string>::const_iterator it = attributes.begin();
+       it != attributes.end(); ++it)
+  {
+    if (element->getAttribute(*it, ref) == LIBSBML_OPERATION_SUCCESS)
+    {
+      addReference(element, *it, ref);
+    }
+  }
+}
+
+
+/*
+ * @return the element with the given identifier or NULL.
+ */
+SBase*
+SBMLElementIndex::getElementBySId (const std::string& id) const
+{
+  if (!mBuilt || id.empty()) return NULL;
+
+  ElementMap::const_iterator found = mIds.find(id);
+
+  return (found == mIds.end()) ? NULL : found->second;
+}
+
+
+/*
+ * @return the element with the given metaid or NULL.
+ */
+SBase*
+SBMLElementIndex::getElementByMetaId (const std::string& metaid) const
+{
+  if (!mBuilt || metaid.empty()) return NULL;
+
+  ElementMap::const_iterator found = mMetaIds.find(metaid);
+
+  return (found == mMetaIds.end()) ? NULL : found->second;
+}
+
+
+/*
+ * @return the elements referring to the identifier; the caller owns the
+ * List.
+ */
+List*
+SBMLElementIndex::getReferrers (const std::string& id) const
+{
+  List* ret = new List();
+  if (!mBuilt || id.empty()) return ret;
+
+  ReferrerMap::const_iterator found = mReferrers.find(id);
+  if (found == mReferrers.end()) return ret;
+
+  // an element referring to the identifier through several attributes is
+  // only listed once
+  std::set<const SBase*> listed;
+  for (std::vector<Referrer>::const_iterator it = found->second.begin();
+       it != found->second.end(); ++it)
+  {
+    if (listed.insert(it->first).second)
+    {
+      ret->add(it->first);
+    }
+  }
+
+  return ret;
+}
+
+
+/*
+ * Renames the element and redirects the references to it.  The referrers
+ * are copied first: setting the identifier may invalidate the index, and
+ * setting their attributes updates it.
+ */
+int
+SBMLElementIndex::renameSId (const std::string& oldId,
+                             const std::string& newId)
+{
+  if (oldId.empty() || newId.empty())
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+  else if (oldId == newId)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else if (getElementBySId(newId) != NULL)
+  {
+    return LIBSBML_DUPLICATE_OBJECT_ID;
+  }
+
+  std::vector<Referrer> referrers;
+  ReferrerMap::const_iterator found = mReferrers.find(oldId);
+  if (found != mReferrers.end())
+  {
+    referrers = found->second;
+  }
+
+  SBase* element = getElementBySId(oldId);
+  if (element != NULL)
+  {
+    int success = element->setId(newId);
+    if (success != LIBSBML_OPERATION_SUCCESS) return success;
+  }
+
+  int success = LIBSBML_OPERATION_SUCCESS;
+  for (std::vector<Referrer>::const_iterator it = referrers.begin();
+       it != referrers.end(); ++it)
+  {
+    if (it->first->setAttribute(it->second, newId) != LIBSBML_OPERATION_SUCCESS)
+    {
+      success = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return success;
+}
+
+
+/*
+ * Removes the element and, transitively, the elements referring to it.
+ */
+int
+SBMLElementIndex::removeWithReferrers (const std::string& id)
+{
+  SBase* element = getElementBySId(id);
+  if (element == NULL) return LIBSBML_INVALID_OBJECT;
+
+  std::vector<SBase*> doomed(1, element);
+  std::set<SBase*> seen;
+  seen.insert(element);
+
+  for (size_t i = 0; i < doomed.size(); ++i)
+  {
+    const std::string& doomedId = doomed[i]->getId();
+    if (doomedId.empty()) continue;
+
+    ReferrerMap::const_iterator found = mReferrers.find(doomedId);
+    if (found == mReferrers.end()) continue;
+
+    for (std::vector<Referrer>::const_iterator it = found->second.begin();
+         it != found->second.end(); ++it)
+    {
+      if (seen.insert(it->first).second)
+      {
+        doomed.push_back(it->first);
+      }
+    }
+  }
+
+  // an element inside another one that is removed goes along with it
+  std::vector<SBase*> removed;
+  for (std::vector<SBase*>::const_iterator it = doomed.begin();
+       it != doomed.end(); ++it)
+  {
+    bool nested = false;
+    for (SBase* parent = (*it)->getParentSBMLObject();
+         parent != NULL && !nested; parent = parent->getParentSBMLObject())
+    {
+      nested = (seen.find(parent) != seen.end());
+    }
+
+    if (!nested)
+    {
+      removed.push_back(*it);
+    }
+  }
+
+  int success = LIBSBML_OPERATION_SUCCESS;
+  for (std::vector<SBase*>::const_iterator it = removed.begin();
+       it != removed.end(); ++it)
+  {
+    if ((*it)->removeFromParentAndDelete() != LIBSBML_OPERATION_SUCCESS)
+    {
+      success = LIBSBML_OPERATION_FAILED;
+    }
+  }
+
+  return success;
+}
+
+
+/*
+ * Records the element against the key.  While building, the first element
+ * in document order keeps the key; afterwards a clash means the order can
+ * no longer be relied upon and the index is invalidated.
+ */
+void
+SBMLElementIndex::insertEntry (ElementMap& map, const std::string& key,
+                               SBase* element)
+{
+  if (!mBuilt || key.empty()) return;
+
+  ElementMap::iterator found = map.find(key);
+
+  if (found == map.end())
+  {
+    map[key] = element;
+  }
+  else if (found->second != element)
+  {
+    if (mBuilding)
+    {
+      ++mNumDuplicates;
+    }
+    else
+    {
+      clear();
+    }
+  }
+}
+
+
+/*
+ * Removes the key if it refers to the element.  If duplicates were seen
+ * another element may be entitled to the key, so the index is invalidated.
+ */
+void
+SBMLElementIndex::eraseEntry (ElementMap& map, const std::string& key,
+                              SBase* element)
+{
+  if (!mBuilt || key.empty()) return;
+
+  ElementMap::iterator found = map.find(key);
+
+  if (found == map.end() || found->second != element) return;
+
+  if (mNumDuplicates > 0)
+  {
+    clear();
+  }
+  else
+  {
+    map.erase(found);
+  }
+}
+
+
+/*
+ * Records that the attribute of the element refers to the identifier.
+ */
+void
+SBMLElementIndex::addReference (SBase* element,
+                                const std::string& attributeName,
+                                const std::string& ref)
+{
+  if (!mBuilt || ref.empty()) return;
+
+  mReferrers[ref].push_back(Referrer(element, attributeName));
+  mReferences[element].push_back(Reference(attributeName, ref));
+}
+
+
+/*
+ * Forgets that the attribute of the element refers to the identifier.
+ */
+void
+SBMLElementIndex::eraseReference (SBase* element,
+                                  const std::string& attributeName,
+                                  const std::string& ref)
+{
+  if (!mBuilt || ref.empty()) return;
+
+  ReferrerMap::iterator referrers = mReferrers.find(ref);
+  if (referrers != mReferrers.end())
+  {
+    std::vector<Referrer>::iterator found =
+      std::find(referrers->second.begin(), referrers->second.end(),
+                Referrer(element, attributeName));
+    if (found != referrers->second.end())
+    {
+      referrers->second.erase(found);
+    }
+    if (referrers->second.empty())
+    {
+      mReferrers.erase(referrers);
+    }
+  }
+
+  ReferenceMap::iterator references = mReferences.find(element);
+  if (references != mReferences.end())
+  {
+    std::vector<Reference>::iterator found =
+      std::find(references->second.begin(), references->second.end(),
+                Reference(attributeName, ref));
+    if (found != references->second.end())
+    {
+      references->second.erase(found);
+    }
+    if (references->second.empty())
+    {
+      mReferences.erase(references);
+    }
+  }
+}
+
+
+/*
+ * Forgets all the references made by the element.  They are taken from
+ * the index rather than from the element as this is also called while the
+ * element is being destroyed.
+ */
+void
+SBMLElementIndex::removeReferences (SBase* element)
+{
+  if (!mBuilt) return;
+
+  ReferenceMap::iterator references = mReferences.find(element);
+  if (references == mReferences.end()) return;
+
+  std::vector<Reference> made = references->second;
+  for (std::vector<Reference>::const_iterator it = made.begin();
+       it != made.end(); ++it)
+  {
+    eraseReference(element, it->first, it->second);
+  }
+}
+
+/** @endcond */
+
+#endif  /* __cplusplus */
+
+LIBSBML_CPP_NAMESPACE_END
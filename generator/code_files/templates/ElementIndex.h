@@ -0,0 +1,311 @@
+#ifndef SBMLElementIndex_h
+#define SBMLElementIndex_h
+
+
+#include <sbml/common/extern.h>
+#include <sbml/SBase.h>
+
+
+#ifdef __cplusplus
+
+#include <string>
+#include <utility>
+#include <vector>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+class SBMLDocument;
+
+/** @cond doxygenLibsbmlInternal */
+
+/**
+ * Index of the identifiers and metaids of all the elements of a
+ * SBMLDocument, and of the references made to identifiers by their SIdRef
+ * attributes.
+ *
+ * The index is built lazily on the first lookup by walking the document
+ * once, and is then kept up to date by the elements themselves as their
+ * identifiers and references change and as they are attached to or
+ * detached from the document.  Until it is built, attaching or detaching
+ * an element does not need to visit the elements below it.  Where two elements share an identifier the
+ * first one in document order is returned; any change that could alter
+ * which element comes first simply invalidates the index so that the next
+ * lookup rebuilds it.
+ *
+ * The references form a reverse graph from each identifier to the
+ * elements referring to it, so that renaming or deleting an element only
+ * touches the elements that actually refer to it.
+ */
+class LIBSBML_EXTERN SBMLElementIndex
+{
+public:
+
+  /**
+   * Creates a new, not yet built, SBMLElementIndex.
+   */
+  SBMLElementIndex ();
+
+
+  /**
+   * Copy constructor; the index is not copied as it refers to the
+   * elements of another document.
+   */
+  SBMLElementIndex (const SBMLElementIndex& orig);
+
+
+  /**
+   * Assignment operator; the index is invalidated rather than copied.
+   */
+  SBMLElementIndex& operator=(const SBMLElementIndex& rhs);
+
+
+  /**
+   * Destroys this SBMLElementIndex.
+   */
+  virtual ~SBMLElementIndex ();
+
+
+  /**
+   * Predicate returning @c true if the index has been built and can be
+   * used for lookups.
+   */
+  bool isBuilt () const;
+
+
+  /**
+   * Predicate returning @c true while the index is being populated
+   * by build().
+   */
+  bool isBuilding () const;
+
+
+  /**
+   * Populates the index with all the elements of the given document.
+   *
+   * @param d the SBMLDocument whose elements are to be indexed.
+   */
+  void build (SBMLDocument* d);
+
+
+  /**
+   * Empties the index and marks it as needing to be rebuilt.
+   */
+  void clear ();
+
+
+  /**
+   * Adds the identifier and metaid of the given element to the index.
+   *
+   * @param element the SBase object to add.
+   */
+  void add (SBase* element);
+
+
+  /**
+   * Removes the identifier and metaid of the given element from the index.
+   *
+   * @param element the SBase object to remove.
+   */
+  void remove (SBase* element);
+
+
+  /**
+   * Adds the given element and all the elements below it to the index,
+   * when the element has just been attached to the document.  Does nothing
+   * if the index has not been built.
+   *
+   * @param element the SBase object at the root of the subtree to add.
+   */
+  void addSubtree (SBase* element);
+
+
+  /**
+   * Removes the given element and all the elements below it from the
+   * index, when the element is about to be detached from the document.
+   * Does nothing if the index has not been built.
+   *
+   * @param element the SBase object at the root of the subtree to remove.
+   */
+  void removeSubtree (SBase* element);
+
+
+  /**
+   * Called by each element reached while the document walks its elements
+   * (see build(), addSubtree() and removeSubtree()) to add or remove it as
+   * the walk requires; does nothing outside such a walk.
+   *
+   * @param element the SBase object reached.
+   */
+  void visit (SBase* element);
+
+
+  /**
+   * Returns the epoch of the document.  It is advanced whenever an element
+   * that may have passed the document on to the elements below it leaves
+   * the document, so that those elements derive their document again.
+   */
+  unsigned long getEpoch () const;
+
+
+  /**
+   * Advances the epoch of the document (see getEpoch()).
+   */
+  void advanceEpoch ();
+
+
+  /**
+   * Returns the number of indices, and so of documents, destroyed so far.
+   * A document cached by an element can still be read while this is
+   * unchanged.
+   */
+  static unsigned long getNumDestroyed ();
+
+
+  /**
+   * Informs the index that the identifier of the given element is
+   * changing from @p oldId to @p newId.
+   */
+  void updateId (SBase* element, const std::string& oldId,
+                 const std::string& newId);
+
+
+  /**
+   * Informs the index that the metaid of the given element is
+   * changing from @p oldMetaId to @p newMetaId.
+   */
+  void updateMetaId (SBase* element, const std::string& oldMetaId,
+                     const std::string& newMetaId);
+
+
+  /**
+   * Informs the index that the SIdRef attribute @p attributeName of the
+   * given element is changing from @p oldRef to @p newRef.
+   */
+  void updateReference (SBase* element, const std::string& attributeName,
+                        const std::string& oldRef,
+                        const std::string& newRef);
+
+
+  /**
+   * Adds the references made by the SIdRef attributes of the given
+   * element to the index.  Used when the attributes of an element have
+   * been read without going through its setters.
+   *
+   * @param element the SBase object whose references are to be added.
+   */
+  void addReferences (SBase* element);
+
+
+  /**
+   * Returns the element with the given identifier, or @c NULL if
+   * there is none.
+   */
+  SBase* getElementBySId (const std::string& id) const;
+
+
+  /**
+   * Returns the elements that refer to the given identifier through one
+   * of their SIdRef attributes.
+   *
+   * @return a List of the referring elements, each listed once.  The
+   * caller owns the List (but not the elements in it) and is responsible
+   * for deleting it.
+   */
+  List* getReferrers (const std::string& id) const;
+
+
+  /**
+   * Changes the identifier of the element with the identifier @p oldId to
+   * @p newId, and updates every SIdRef attribute that referred to @p oldId
+   * to refer to @p newId instead.  Nothing is changed if another element
+   * already has the identifier @p newId.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   */
+  int renameSId (const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Removes the element with the given identifier from the document and
+   * deletes it, together with every element that refers to it and, in
+   * turn, every element that refers to one of those.
+   *
+   * Only the identifiers of the removed elements themselves are followed;
+   * elements that refer to an element nested inside a removed one are
+   * left in place.  Each element is removed with
+   * SBase::removeFromParentAndDelete(), so an element that its parent
+   * requires (and will not give up) stays and the removal fails.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int removeWithReferrers (const std::string& id);
+
+
+  /**
+   * Returns the element with the given metaid, or @c NULL if
+   * there is none.
+   */
+  SBase* getElementByMetaId (const std::string& metaid) const;
+
+
+protected:
+
+#ifdef LIBSBML_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, SBase*> ElementMap;
+#else
+  typedef std::map<std::string, SBase*> ElementMap;
+#endif
+
+  // an element referring to an identifier, and the attribute it uses
+  typedef std::pair<SBase*, std::string> Referrer;
+  // an attribute of an element, and the identifier it refers to
+  typedef std::pair<std::string, std::string> Reference;
+
+#ifdef LIBSBML_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, std::vector<Referrer> > ReferrerMap;
+  typedef std::unordered_map<const SBase*, std::vector<Reference> > ReferenceMap;
+#else
+  typedef std::map<std::string, std::vector<Referrer> > ReferrerMap;
+  typedef std::map<const SBase*, std::vector<Reference> > ReferenceMap;
+#endif
+
+  void insertEntry (ElementMap& map, const std::string& key,
+                    SBase* element);
+
+  void eraseEntry (ElementMap& map, const std::string& key,
+                   SBase* element);
+
+  void addReference (SBase* element, const std::string& attributeName,
+                     const std::string& ref);
+
+  void eraseReference (SBase* element, const std::string& attributeName,
+                       const std::string& ref);
+
+  void removeReferences (SBase* element);
+
+
+  ElementMap mIds;
+  ElementMap mMetaIds;
+  ReferrerMap mReferrers;
+  ReferenceMap mReferences;
+  bool mBuilt;
+  bool mBuilding;
+  bool mAdding;
+  bool mRemoving;
+  unsigned int mNumDuplicates;
+  SBMLCounter mEpoch;
+  static SBMLCounter mNumDestroyed;
+};
+
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* SBMLElementIndex_h */
@@ -13,6 +13,7 @@
 #ifdef __cplusplus
 
 #include <vector>
+#include <map>
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
@@ -201,6 +202,10 @@ public:
    * Only the first item will be removed if there are multiple errors
    * with the given errorId.
    *
+   * Each call takes time linear in the size of the log, as the errors
+   * after the one removed move down one place.  To remove many errors use
+   * removeIf() or removeAll(), which do so in a single pass.
+   *
    * @param errorId the error identifier of the error to be removed.
    */
   void remove (const unsigned int errorId);
@@ -221,6 +226,131 @@ public:
   bool contains (const unsigned int errorId) const;
 
 
+  /**
+   * Removes the first error having errorId that was logged at or after
+   * position @p start in the log.
+   *
+   * Passing the number of errors in the log at some earlier point (see
+   * getNumErrors()) restricts the search to the errors logged since then.
+   *
+   * @param errorId the error identifier of the error to be removed.
+   * @param start the position in the log from which to search.
+   */
+  void remove (const unsigned int errorId, unsigned int start);
+
+
+  /**
+   * Returns true if an error having errorId was logged at or after
+   * position @p start in the log.
+   *
+   * @param errorId the error identifier of the error to be found.
+   * @param start the position in the log from which to search.
+   */
+  bool contains (const unsigned int errorId, unsigned int start) const;
+
+
+  /**
+   * Removes, in a single pass, every error for which @p predicate
+   * returns @c true.
+   *
+   * @param predicate a function or function object taking an XMLError*.
+   *
+   * @return the number of errors removed.
+   */
+  template <class Predicate>
+  unsigned int removeIf (Predicate predicate)
+  {
+    return removeMatching(predicate, true);
+  }
+
+
+  /**
+   * Removes, in a single pass, every error for which @p predicate
+   * returns @c false.
+   *
+   * @param predicate a function or function object taking an XMLError*.
+   *
+   * @return the number of errors removed.
+   */
+  template <class Predicate>
+  unsigned int retainIf (Predicate predicate)
+  {
+    return removeMatching(predicate, false);
+  }
+
+
+  /**
+   * Deletes all errors from this log.
+   */
+  void clearLog ();
+
+
+  /**
+   * Changes the severity of all errors of @p originalSeverity to
+   * @p targetSeverity.
+   *
+   * @param originalSeverity the severity code to match.
+   * @param targetSeverity the severity code to use as the new severity.
+   * @param package the name of the package whose errors are to be
+   * changed, or "all" to change the errors of any package.
+   */
+  void changeErrorSeverity (XMLErrorSeverity_t originalSeverity,
+                            XMLErrorSeverity_t targetSeverity,
+                            const std::string& package = "all");
+
+
+  /** @endcond */
+
+protected:
+  /** @cond doxygenLibsbmlInternal */
+
+  template <class Predicate>
+  unsigned int removeMatching (Predicate predicate, bool matching)
+  {
+    std::vector<XMLError*>::iterator kept = mErrors.begin();
+    std::vector<XMLError*>::iterator it = mErrors.begin();
+
+    for (; it != mErrors.end(); ++it)
+    {
+      if ((predicate(*it) ? true : false) == matching)
+      {
+        delete *it;
+      }
+      else
+      {
+        *kept++ = *it;
+      }
+    }
+
+    unsigned int numRemoved = (unsigned int)(mErrors.end() - kept);
+    mErrors.erase(kept, mErrors.end());
+    ++mGeneration;
+
+    return numRemoved;
+  }
+
+
+  void updateIndex () const;
+
+  void clearIndex () const;
+
+  void removeError (std::vector<XMLError*>::iterator error);
+
+
+  /* positions in mErrors of the errors of each severity */
+  mutable std::map<unsigned int, std::vector<unsigned int> > mSeverityIndex;
+
+  /* number of errors logged with each id */
+  mutable std::map<unsigned int, unsigned int> mIdCounts;
+
+  /* number of errors at the start of mErrors covered by the index */
+  mutable unsigned int mNumIndexed;
+
+  /* advanced by every change made through this class other than adding
+   * errors; the index is rebuilt when it was built for another value */
+  unsigned long mGeneration;
+  mutable unsigned long mIndexedGeneration;
+
   /** @endcond */
 };
 
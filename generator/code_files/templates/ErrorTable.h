@@ -24,6 +24,7 @@ typedef struct {
 
 static const sbmlErrorTableEntry sbmlErrorTable[] =
 {
+<add_specific_error_table>
   // 10000
   { SBMLUnknown,
     "Encountered unknown internal libSBML error",
@@ -197,15 +198,6 @@ static const sbmlErrorTableEntry sbmlErrorTable[] =
     }
   },
 
-  /* --------------------------------------------------------------------------
-   * Boundary marker.  SBML_Lang specific errors.
-   * ----------------------------------------------------------------------- */
-
-<add_specific_error_table/>    
-  /* --------------------------------------------------------------------------
-   * Boundary marker.  Application-specific codes should begin at 100000.
-   * ----------------------------------------------------------------------- */
-
   //99994
   {
     SBMLUnknownCoreAttribute,
@@ -226,7 +218,8 @@ static const sbmlErrorTableEntry sbmlErrorTable[] =
     "Application-specific codes should begin at 100000.", 
     {""
     }
-   }
+   },
+</add_specific_error_table>
 };
 
 LIBSBML_CPP_NAMESPACE_END
@@ -2,6 +2,7 @@
 #include <functional>
 
 #include <sbml/SBMLVisitor.h>
+#include <sbml/SBMLElementIndex.h>
 #include <sbml/ListOf.h>
 #include <sbml/common/common.h>
 
@@ -19,6 +20,12 @@ LIBSBML_CPP_NAMESPACE_BEGIN
  */
 ListOf::ListOf (unsigned int level, unsigned int version)
 : SBase(level,version)
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SBMLConstructorException();
@@ -30,6 +37,12 @@ ListOf::ListOf (unsigned int level, unsigned int version)
  */
 ListOf::ListOf (SBMLNamespaces* sbmlns)
 : SBase(sbmlns)
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SBMLConstructorException();
@@ -45,11 +58,48 @@ struct Delete : public unary_function<SBase*, void>
 };
 
 
+/**
+ * Used by ListOf::setSBMLDocument().
+ */
+struct SetSBMLDocument : public unary_function<SBase*, void>
+{
+  SBMLDocument* d;
+
+  SetSBMLDocument (SBMLDocument* d) : d(d) { }
+  void operator() (SBase* sbase) { sbase->setSBMLDocument(d); }
+};
+
+
+/**
+ * Used by ListOf::connectToChild().
+ */
+struct SetParentSBMLObject : public unary_function<SBase*, void>
+{
+  SBase* sb;
+
+  SetParentSBMLObject (SBase *sb) : sb(sb) { }
+  void operator() (SBase* sbase) { sbase->connectToParent(sb); }
+};
+
+
+/**
+ * Used by ListOf::clear() when the items are handed over to the caller.
+ */
+struct ReleaseFromParent : public unary_function<SBase*, void>
+{
+  void operator() (SBase* sbase) { sbase->releaseFromParent(); }
+};
+
+
 /*
  * Destroys the given ListOf and its constituent items.
  */
 ListOf::~ListOf ()
 {
+  // rather than have the ListOf objects sharing the items copy them, give
+  // the items to one of them
+  stopSharing();
+  handOverItems();
   for_each( mItems.begin(), mItems.end(), Delete() );
 }
 
@@ -67,9 +117,30 @@ struct Clone : public unary_function<SBase*, SBase*>
  * Copy constructor. Creates a copy of this ListOf items.
  */
 ListOf::ListOf (const ListOf& orig) : SBase(orig), mItems()
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
-  mItems.resize( orig.size() );
-  transform( orig.mItems.begin(), orig.mItems.end(), mItems.begin(), Clone() );
+  // a ListOf still sharing the items of another is copied from that one
+  const ListOf& source =
+    (orig.mSharedSource != NULL) ? *orig.mSharedSource : orig;
+
+  if (isCopyingOnWrite() && !source.mItems.empty())
+  {
+    // see cloneCopyOnWrite(); the items are only copied when needed
+    mSharedSource = &source;
+    source.mSharers.push_back(this);
+    ++mNumSharingLists;
+  }
+  else
+  {
+    mItems.resize( source.mItems.size() );
+    transform( source.mItems.begin(), source.mItems.end(), mItems.begin(),
+               Clone() );
+  }
   connectToChild();
 }
 
@@ -83,19 +154,74 @@ ListOf& ListOf::operator=(const ListOf& rhs)
   {
     this->SBase::operator =(rhs);
     // Deletes existing items
+    stopSharing();
     for_each( mItems.begin(), mItems.end(), Delete() );
-    mItems.resize( rhs.size() );
-    transform( rhs.mItems.begin(), rhs.mItems.end(), mItems.begin(), Clone() );
+    clearIdIndex();
+    clearReferenceIndices();
+    const ListOf& source =
+      (rhs.mSharedSource != NULL) ? *rhs.mSharedSource : rhs;
+    mItems.resize( source.mItems.size() );
+    transform( source.mItems.begin(), source.mItems.end(), mItems.begin(),
+               Clone() );
     connectToChild();
   }
 
   return *this;
 }
 
+
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor. Takes over the items of the given ListOf.
+ */
+ListOf::ListOf (ListOf&& orig) : SBase(std::move(orig))
+, mItems(std::move(orig.mItems))
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
+{
+  orig.mItems.clear();
+  orig.clearIdIndex();
+  orig.clearReferenceIndices();
+  takeOverSharing(orig);
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator
+ */
+ListOf& ListOf::operator=(ListOf&& rhs)
+{
+  if(&rhs!=this)
+  {
+    this->SBase::operator =(std::move(rhs));
+    // Deletes existing items, unless other ListOf objects share them
+    stopSharing();
+    handOverItems();
+    for_each( mItems.begin(), mItems.end(), Delete() );
+    clearIdIndex();
+    clearReferenceIndices();
+    mItems = std::move(rhs.mItems);
+    rhs.mItems.clear();
+    rhs.clearIdIndex();
+    rhs.clearReferenceIndices();
+    takeOverSharing(rhs);
+    connectToChild();
+  }
+
+  return *this;
+}
+#endif
+
 /** @cond doxygenLibsbmlInternal */
 bool
 ListOf::accept (SBMLVisitor& v) const
 {
+  copySharedItems();
   v.visit(*this, getItemTypeCode() );
   for (unsigned int n = 0 ; n < mItems.size() && mItems[n]->accept(v); ++n) ;
   v.leave(*this, getItemTypeCode() );
@@ -133,11 +259,17 @@ ListOf::insert(int location, const SBase* item)
 int 
 ListOf::insertAndOwn(int location, SBase* item)
 {
+  copySharedItems();
+  detachSharedCopies();
+
   /* no list elements yet */
   if (this->getItemTypeCode() == SBML_UNKNOWN )
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    addToReferenceIndices(item, false);
+    prepareForChange();
     return LIBSBML_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -148,6 +280,9 @@ ListOf::insertAndOwn(int location, SBase* item)
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    addToReferenceIndices(item, false);
+    prepareForChange();
     return LIBSBML_OPERATION_SUCCESS;
   }
 }
@@ -177,11 +312,17 @@ ListOf::append (const SBase* item)
 int
 ListOf::appendAndOwn (SBase* item)
 {
+  copySharedItems();
+  detachSharedCopies();
+
   /* no list elements yet */
   if (this->getItemTypeCode() == SBML_UNKNOWN )
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    addToReferenceIndices(item, true);
+    prepareForChange();
     return LIBSBML_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -192,6 +333,9 @@ ListOf::appendAndOwn (SBase* item)
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    addToReferenceIndices(item, true);
+    prepareForChange();
     return LIBSBML_OPERATION_SUCCESS;
   }
 }
@@ -221,6 +365,9 @@ int ListOf::appendFrom(const ListOf* list)
 const SBase*
 ListOf::get (unsigned int n) const
 {
+  // the item returned must belong to this ListOf and its document
+  copySharedItems();
+
   return (n < mItems.size()) ? mItems[n] : NULL;
 }
 
@@ -231,6 +378,7 @@ ListOf::get (unsigned int n) const
 SBase*
 ListOf::get (unsigned int n)
 {
+  copySharedItems();
   return const_cast<SBase*>( static_cast<const ListOf&>(*this).get(n) );
 }
 
@@ -310,10 +458,19 @@ ListOf::getAllElements()
 void
 ListOf::clear (bool doDelete)
 {
+  // the items still shared are simply no longer shared
+  detachSharedCopies();
+  stopSharing();
+
   if (doDelete)
     for_each( mItems.begin(), mItems.end(), Delete() );
+  else
+    for_each( mItems.begin(), mItems.end(), ReleaseFromParent() );
   
   mItems.clear();
+  clearIdIndex();
+  clearReferenceIndices();
+  prepareForChange();
 }
 
 
@@ -336,46 +493,428 @@ ListOf::remove (unsigned int n)
 {
   SBase* item = get(n);
   
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    detachSharedCopies();
+    mItems.erase( mItems.begin() + n );
+    removeFromIdIndex(item, item->getId());
+    removeFromReferenceIndices(item);
+    prepareForChange();
+    // the caller now owns the item, so it leaves the document; it keeps its
+    // parent pointer
+    item->releaseFromParent();
+  }
   
   return item;
 }
 
 
+/*
+ * Returns the first item with the given identifier, using (and if
+ * necessary building) the identifier index.
+ */
+const SBase*
+ListOf::getItemById (const std::string& sid) const
+{
+  copySharedItems();
+
+  if (sid.empty())
+  {
+    // items without an identifier are not indexed
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getId().empty()) return *it;
+    }
+    return NULL;
+  }
+
+  if (!mIdIndexBuilt)
+  {
+    buildIdIndex();
+  }
+
+  IdIndex::const_iterator found = mIdIndex.find(sid);
+
+  return (found == mIdIndex.end()) ? NULL : found->second;
+}
+
+
+/*
+ * Returns the first item with the given identifier, after taking copies
+ * of shared items.
+ */
+SBase*
+ListOf::getItemById (const std::string& sid)
+{
+  copySharedItems();
+  return const_cast<SBase*>( static_cast<const ListOf&>(*this).getItemById(sid) );
+}
+
+
+/*
+ * Removes the first item with the given identifier and returns it.
+ */
+SBase*
+ListOf::removeItemById (const std::string& sid)
+{
+  SBase* item = getItemById(sid);
+
+  if (item != NULL)
+  {
+    detachSharedCopies();
+    mItems.erase( find(mItems.begin(), mItems.end(), item) );
+    removeFromIdIndex(item, sid);
+    removeFromReferenceIndices(item);
+    prepareForChange();
+    item->releaseFromParent();
+  }
+
+  return item;
+}
+
+
+/*
+ * Returns the first item whose attribute refers to the identifier, using
+ * (and if necessary building) the index of that attribute.
+ */
+const SBase*
+ListOf::getItemByReference (const std::string& attributeName,
+                            const std::string& sid) const
+{
+  copySharedItems();
+
+  if (sid.empty())
+  {
+    // items without a reference are not indexed
+    std::string ref;
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getAttribute(attributeName, ref) == LIBSBML_OPERATION_SUCCESS
+        && ref.empty())
+      {
+        return *it;
+      }
+    }
+    return NULL;
+  }
+
+  const ReferenceIndex& index = getReferenceIndex(attributeName);
+  ReferenceIndex::const_iterator found = index.find(sid);
+
+  return (found == index.end()) ? NULL : found->second.front();
+}
+
+
+/*
+ * Returns the first item whose attribute refers to the identifier, after
+ * taking copies of shared items.
+ */
+SBase*
+ListOf::getItemByReference (const std::string& attributeName,
+                            const std::string& sid)
+{
+  copySharedItems();
+  return const_cast<SBase*>( static_cast<const ListOf&>(*this)
+                               .getItemByReference(attributeName, sid) );
+}
+
+
+/*
+ * Returns all the items whose attribute refers to the identifier, after
+ * taking copies of shared items (the List hands them out for change).
+ */
+List*
+ListOf::getItemsByReference (const std::string& attributeName,
+                             const std::string& sid)
+{
+  copySharedItems();
+
+  List* ret = new List();
+
+  if (sid.empty())
+  {
+    std::string ref;
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getAttribute(attributeName, ref) == LIBSBML_OPERATION_SUCCESS
+        && ref.empty())
+      {
+        ret->add(*it);
+      }
+    }
+    return ret;
+  }
+
+  const ReferenceIndex& index = getReferenceIndex(attributeName);
+  ReferenceIndex::const_iterator found = index.find(sid);
+
+  if (found != index.end())
+  {
+    for (std::vector<SBase*>::const_iterator it = found->second.begin();
+         it != found->second.end(); ++it)
+    {
+      ret->add(*it);
+    }
+  }
+
+  return ret;
+}
+
+
 /*
  * @return the number of items in this ListOf items.
  */
 unsigned int
 ListOf::size () const
 {
-  return (unsigned int)mItems.size();
+  const ListItem& items =
+    (mSharedSource != NULL) ? mSharedSource->mItems : mItems;
+  return (unsigned int)items.size();
 }
 
 
-/**
- * Used by ListOf::setSBMLDocument().
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Updates the identifier index when the "id" of an item changes.
  */
-struct SetSBMLDocument : public unary_function<SBase*, void>
+void
+ListOf::updateIdIndex (SBase* item, const std::string& oldId,
+                       const std::string& newId)
 {
-  SBMLDocument* d;
+  if (!mIdIndexBuilt || oldId == newId) return;
 
-  SetSBMLDocument (SBMLDocument* d) : d(d) { }
-  void operator() (SBase* sbase) { sbase->setSBMLDocument(d); }
-};
+  removeFromIdIndex(item, oldId);
 
+  if (mIdIndexBuilt && !newId.empty())
+  {
+    // another item may already use the id; which one comes first then
+    // depends on the positions, so leave that to a rebuild
+    if (!mIdIndex.insert(IdIndex::value_type(newId, item)).second)
+    {
+      clearIdIndex();
+    }
+  }
+}
 
-/**
- * Used by ListOf::setParentSBMLObject().
+
+/*
+ * Rebuilds the identifier index from scratch.
  */
-struct SetParentSBMLObject : public unary_function<SBase*, void>
+void
+ListOf::buildIdIndex () const
 {
-  SBase* sb;
+  clearIdIndex();
+  mIdIndexBuilt = true;
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    addToIdIndex(*it, true);
+  }
+}
 
-  SetParentSBMLObject (SBase *sb) : sb(sb) { }
-  void operator() (SBase* sbase) { sbase->connectToParent(sb); }
-};
 
-/** @cond doxygenLibsbmlInternal */
+/*
+ * Adds an item that has just been placed in mItems to the identifier index.
+ * Items appended at the end never shadow an existing entry; items inserted
+ * elsewhere that share an identifier invalidate the index.
+ */
+void
+ListOf::addToIdIndex (SBase* item, bool atEnd) const
+{
+  if (!mIdIndexBuilt) return;
+
+  const std::string& id = item->getId();
+  if (id.empty()) return;
+
+  if (!mIdIndex.insert(IdIndex::value_type(id, item)).second)
+  {
+    if (atEnd)
+    {
+      mNumDuplicateIds++;
+    }
+    else
+    {
+      clearIdIndex();
+    }
+  }
+}
+
+
+/*
+ * Removes the entry of an item that is no longer in mItems.
+ */
+void
+ListOf::removeFromIdIndex (SBase* item, const std::string& id) const
+{
+  if (!mIdIndexBuilt || id.empty()) return;
+
+  if (mNumDuplicateIds > 0)
+  {
+    // a shadowed duplicate may need to take the place of this item
+    clearIdIndex();
+    return;
+  }
+
+  IdIndex::iterator found = mIdIndex.find(id);
+  if (found != mIdIndex.end() && found->second == item)
+  {
+    mIdIndex.erase(found);
+  }
+}
+
+
+/*
+ * Drops the identifier index; it is rebuilt on the next lookup.
+ */
+void
+ListOf::clearIdIndex () const
+{
+  mIdIndex.clear();
+  mIdIndexBuilt = false;
+  mNumDuplicateIds = 0;
+}
+
+
+/*
+ * Updates the index of an attribute when its value changes for an item.
+ */
+void
+ListOf::updateReferenceIndex (SBase* item, const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef)
+{
+  if (oldRef == newRef) return;
+
+  ReferenceIndices::iterator index = mReferenceIndices.find(attributeName);
+  if (index == mReferenceIndices.end()) return;
+
+  eraseReference(index->second, oldRef, item);
+
+  if (newRef.empty()) return;
+
+  std::vector<SBase*>& referrers = index->second[newRef];
+  if (referrers.empty() || item == mItems.back())
+  {
+    referrers.push_back(item);
+  }
+  else
+  {
+    // the item has to take its place among the others in list order;
+    // leave that to a rebuild
+    mReferenceIndices.erase(index);
+  }
+}
+
+
+/*
+ * Returns the index of the attribute, building it if necessary.
+ */
+const ListOf::ReferenceIndex&
+ListOf::getReferenceIndex (const std::string& attributeName) const
+{
+  ReferenceIndices::iterator index = mReferenceIndices.find(attributeName);
+  if (index != mReferenceIndices.end())
+  {
+    return index->second;
+  }
+
+  ReferenceIndex& built = mReferenceIndices[attributeName];
+  std::string ref;
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if ((*it)->getAttribute(attributeName, ref) == LIBSBML_OPERATION_SUCCESS
+      && !ref.empty())
+    {
+      built[ref].push_back(*it);
+    }
+  }
+
+  return built;
+}
+
+
+/*
+ * Adds an item that has just been placed in mItems to the indices that
+ * have been built.  Only an item appended at the end is known to come
+ * after all the others; any other insertion drops the indices.
+ */
+void
+ListOf::addToReferenceIndices (SBase* item, bool atEnd) const
+{
+  if (mReferenceIndices.empty()) return;
+
+  if (!atEnd)
+  {
+    clearReferenceIndices();
+    return;
+  }
+
+  std::string ref;
+  for (ReferenceIndices::iterator index = mReferenceIndices.begin();
+       index != mReferenceIndices.end(); ++index)
+  {
+    if (item->getAttribute(index->first, ref) == LIBSBML_OPERATION_SUCCESS
+      && !ref.empty())
+    {
+      index->second[ref].push_back(item);
+    }
+  }
+}
+
+
+/*
+ * Removes an item that is no longer in mItems from the indices.
+ */
+void
+ListOf::removeFromReferenceIndices (SBase* item) const
+{
+  std::string ref;
+  for (ReferenceIndices::iterator index = mReferenceIndices.begin();
+       index != mReferenceIndices.end(); ++index)
+  {
+    if (item->getAttribute(index->first, ref) == LIBSBML_OPERATION_SUCCESS)
+    {
+      eraseReference(index->second, ref, item);
+    }
+  }
+}
+
+
+/*
+ * Removes the item from the referrers of the identifier in the index.
+ */
+void
+ListOf::eraseReference (ReferenceIndex& index, const std::string& ref,
+                        SBase* item)
+{
+  if (ref.empty()) return;
+
+  ReferenceIndex::iterator found = index.find(ref);
+  if (found == index.end()) return;
+
+  std::vector<SBase*>& referrers = found->second;
+  std::vector<SBase*>::iterator pos =
+    std::find(referrers.begin(), referrers.end(), item);
+  if (pos != referrers.end())
+  {
+    referrers.erase(pos);
+  }
+  if (referrers.empty())
+  {
+    index.erase(found);
+  }
+}
+
+
+/*
+ * Drops the indices of the attributes; they are rebuilt on the next lookup.
+ */
+void
+ListOf::clearReferenceIndices () const
+{
+  mReferenceIndices.clear();
+}
+
 
 /*
  * Sets the parent SBMLDocument of this SBML_Lang object.
@@ -384,6 +923,17 @@ void
 ListOf::setSBMLDocument (SBMLDocument* d)
 {
   SBase::setSBMLDocument(d);
+
+  // the items still shared are left until they are needed, unless the
+  // index of the document is being built and needs to reach them; the
+  // copies are then added to the index as they are connected to this ListOf
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (mSharedSource != NULL && index != NULL && index->isBuilding())
+  {
+    copySharedItems();
+    return;
+  }
+
   for_each( mItems.begin(), mItems.end(), SetSBMLDocument(d) );
 }
 
@@ -399,6 +949,122 @@ ListOf::connectToChild()
   for_each( mItems.begin(), mItems.end(), SetParentSBMLObject(this) );
 }
 
+
+/*
+ * Makes the ListOf objects sharing the items of this one take copies.
+ */
+void
+ListOf::unshareChildren()
+{
+  while (!mSharers.empty())
+  {
+    mSharers.back()->copySharedItems();
+  }
+}
+
+
+/*
+ * Replaces the items this ListOf shares with copies of its own.  The
+ * copies share their own children in turn, so that only the branches
+ * actually used end up being copied.
+ */
+void
+ListOf::copySharedItems () const
+{
+  if (mSharedSource == NULL) return;
+
+  ListOf* self = const_cast<ListOf*>(this);
+  const ListOf* source = mSharedSource;
+  self->stopSharing();
+
+  beginCopyingOnWrite();
+  try
+  {
+    self->mItems.resize( source->mItems.size() );
+    transform( source->mItems.begin(), source->mItems.end(),
+               self->mItems.begin(), Clone() );
+    self->connectToChild();
+  }
+  catch (...)
+  {
+    endCopyingOnWrite();
+    throw;
+  }
+  endCopyingOnWrite();
+}
+
+
+/*
+ * Stops sharing the items of another ListOf, without copying them.
+ */
+void
+ListOf::stopSharing ()
+{
+  if (mSharedSource == NULL) return;
+
+  std::vector<ListOf*>& sharers = mSharedSource->mSharers;
+  sharers.erase( find(sharers.begin(), sharers.end(), this) );
+  mSharedSource = NULL;
+  --mNumSharingLists;
+}
+
+
+/*
+ * Gives the items of this ListOf to the first of the ListOf objects sharing
+ * them; the others then share the items of that one.
+ */
+void
+ListOf::handOverItems ()
+{
+  if (mSharers.empty()) return;
+
+  ListOf* heir = mSharers.front();
+  heir->mSharedSource = NULL;
+  --mNumSharingLists;
+
+  heir->mItems.swap(mItems);
+  heir->mSharers.swap(mSharers);
+  heir->mSharers.erase(heir->mSharers.begin());
+  for (std::vector<ListOf*>::iterator it = heir->mSharers.begin();
+       it != heir->mSharers.end(); ++it)
+  {
+    (*it)->mSharedSource = heir;
+  }
+
+  clearIdIndex();
+  clearReferenceIndices();
+
+  // the items only change hands; nothing shared changes
+  beginCopyingOnWrite();
+  heir->connectToChild();
+  endCopyingOnWrite();
+}
+
+
+/*
+ * Takes over the part orig plays in sharing items, when orig is moved
+ * into this ListOf.
+ */
+void
+ListOf::takeOverSharing (ListOf& orig)
+{
+  mSharedSource = orig.mSharedSource;
+  if (mSharedSource != NULL)
+  {
+    std::vector<ListOf*>& sharers = mSharedSource->mSharers;
+    *find(sharers.begin(), sharers.end(), &orig) = this;
+  }
+
+  mSharers.swap(orig.mSharers);
+  for (std::vector<ListOf*>::iterator it = mSharers.begin();
+       it != mSharers.end(); ++it)
+  {
+    (*it)->mSharedSource = this;
+  }
+
+  orig.mSharedSource = NULL;
+}
+
 /** @endcond */
 
 
@@ -457,6 +1123,7 @@ struct Write : public unary_function<SBase*, void>
 void
 ListOf::writeElements (XMLOutputStream& stream) const
 {
+  copySharedItems();
   SBase::writeElements(stream);
   for_each( mItems.begin(), mItems.end(), Write(stream) );
 }
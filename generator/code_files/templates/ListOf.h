@@ -85,6 +85,24 @@ public:
   ListOf& operator=(const ListOf& rhs);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor; the new ListOf takes over the items of @p orig,
+   * which is left empty.
+   *
+   * @param orig the ListOf instance to move.
+   */
+  ListOf (ListOf&& orig);
+
+
+  /**
+   * Move assignment operator for ListOf; the items of this ListOf are
+   * deleted and replaced by those of @p rhs, which is left empty.
+   */
+  ListOf& operator=(ListOf&& rhs);
+#endif
+
+
 
   /** @cond doxygenLibsbmlInternal */
   /**
@@ -148,6 +166,35 @@ public:
   int appendAndOwn (SBase* disownedItem);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Adds the item held by @p disownedItem to the end of this ListOf's list
+   * of items, transferring its ownership to this ListOf.
+   *
+   * The item is only released by @p disownedItem if it is added; otherwise
+   * @p disownedItem still owns it.
+   *
+   * @param disownedItem the item to be added to the list.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+   *
+   * @see appendAndOwn(SBase* disownedItem)
+   */
+  template <class T>
+  int appendAndOwn (std::unique_ptr<T>&& disownedItem)
+  {
+    int success = appendAndOwn(static_cast<SBase*>(disownedItem.get()));
+    if (success == LIBSBML_OPERATION_SUCCESS)
+    {
+      disownedItem.release();
+    }
+    return success;
+  }
+#endif
+
+
   /**
    * Adds a clone of a list of items to this ListOf's list.
    *
@@ -211,6 +258,9 @@ public:
    *
    * @return the <em>n</em>th item in this ListOf items, or a null pointer if
    * the index number @p n refers to a nonexistent position in this list.
+   * A ListOf that shares its items with another one (see
+   * SBase::cloneCopyOnWrite()) first takes its own copies of them, so that
+   * the item returned belongs to this ListOf and its document.
    *
    * @see size()
    */
@@ -273,7 +323,9 @@ public:
    * delete those items.  Otherwise, all items are cleared only from this
    * ListOf object; the caller is still responsible for deleting the actual
    * items.  (In the latter case, callers are advised to store pointers to
-   * all items elsewhere before calling this function.)
+   * all items elsewhere before calling this function.)  Items that are not
+   * deleted keep this ListOf as their parent but no longer belong to its
+   * document (see SBase::releaseFromParent()).
    *
    * @param doDelete if @c true (default), all items are deleted and cleared.
    * Otherwise, all items are just cleared and not deleted.
@@ -305,6 +357,8 @@ public:
    * it.
    *
    * The caller owns the returned item and is responsible for deleting it.
+   * The item keeps this ListOf as its parent but no longer belongs to its
+   * document (see SBase::releaseFromParent()).
    *
    * @param n the index of the item to remove
    *
@@ -332,6 +386,53 @@ public:
   /** @endcond */
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Updates the identifier index of this ListOf when the "id" of one of
+   * its items changes.
+   *
+   * This is called by the item itself (see SBase::updateIdIndices()) before
+   * the new identifier is stored.
+   *
+   * @param item the item whose identifier is changing.
+   * @param oldId the identifier @p item currently has.
+   * @param newId the identifier @p item is about to be given.
+   */
+  void updateIdIndex (SBase* item, const std::string& oldId,
+                      const std::string& newId);
+  /** @endcond */
+
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Updates the index of the given SIdRef attribute of the items of this
+   * ListOf when the value of that attribute changes for one of them.
+   *
+   * This is called by the item itself (see SBase::updateReferenceIndices())
+   * before the new value is stored.
+   *
+   * @param item the item whose attribute is changing.
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param oldRef the value the attribute currently has.
+   * @param newRef the value the attribute is about to be given.
+   */
+  void updateReferenceIndex (SBase* item, const std::string& attributeName,
+                             const std::string& oldRef,
+                             const std::string& newRef);
+  /** @endcond */
+
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Drops the indices of the SIdRef attributes of the items of this ListOf;
+   * they are rebuilt on the next lookup.  Used when the attributes of an
+   * item have been changed without going through its setters, as happens
+   * when it is read.
+   */
+  void clearReferenceIndices () const;
+  /** @endcond */
+
+
   /** @cond doxygenLibsbmlInternal */
   /**
    * Sets this SBML_Lang object to child SBML_Lang objects (if any).
@@ -442,8 +543,176 @@ protected:
 
   virtual bool isValidTypeForList(SBase * item);
 
+  /**
+   * Returns the first item in this ListOf with the given identifier.
+   *
+   * The lookup goes through a hash index of the item identifiers that is
+   * built on first use and then kept up to date by appendAndOwn(),
+   * insertAndOwn(), remove(), clear() and the setId() functions of the
+   * items, so repeated lookups are O(1) amortized.
+   *
+   * As for get(), a ListOf that shares its items with another one first
+   * takes its own copies of them.
+   *
+   * @param sid the identifier of the item to find.
+   *
+   * @return the first item with the given @p sid or @c NULL if no such
+   * item exists.
+   */
+  const SBase* getItemById (const std::string& sid) const;
+
+
+  /**
+   * Returns the first item in this ListOf with the given identifier.
+   *
+   * As the item may be changed through the pointer returned, a ListOf
+   * that shares its items first takes its own copies of them.
+   *
+   * @param sid the identifier of the item to find.
+   *
+   * @return the first item with the given @p sid or @c NULL if no such
+   * item exists.
+   */
+  SBase* getItemById (const std::string& sid);
+
+
+  /**
+   * Removes the first item in this ListOf with the given identifier and
+   * returns it.  The caller owns the returned item, which is released as
+   * by remove().
+   *
+   * @param sid the identifier of the item to remove.
+   *
+   * @return the item removed or @c NULL if no such item exists.
+   */
+  SBase* removeItemById (const std::string& sid);
+
+
+  /**
+   * Returns the first item in this ListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier.
+   *
+   * As for getItemById(), the lookup goes through an index, one per
+   * attribute, that is built on first use and then kept up to date by the
+   * list functions and the setters of the items; a ListOf that shares its
+   * items first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return the first item referring to @p sid or @c NULL if no such
+   * item exists.
+   */
+  const SBase* getItemByReference (const std::string& attributeName,
+                                   const std::string& sid) const;
+
+
+  /**
+   * Returns the first item in this ListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier.
+   *
+   * As for the non-const getItemById(), a ListOf that shares its items
+   * first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return the first item referring to @p sid or @c NULL if no such
+   * item exists.
+   */
+  SBase* getItemByReference (const std::string& attributeName,
+                             const std::string& sid);
+
+
+  /**
+   * Returns all the items in this ListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier, in list order.
+   *
+   * The items may be changed through the List returned, so a ListOf that
+   * shares its items first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return a List of the items referring to @p sid.  The caller owns the
+   * List (but not the items in it) and is responsible for deleting it.
+   */
+  List* getItemsByReference (const std::string& attributeName,
+                             const std::string& sid);
+
+
+  /**
+   * Makes the ListOf objects that share the items of this one (see
+   * SBase::cloneCopyOnWrite()) take their own copies of them.
+   */
+  virtual void unshareChildren ();
+
+#ifdef LIBSBML_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, SBase*> IdIndex;
+  typedef std::unordered_map<std::string, std::vector<SBase*> > ReferenceIndex;
+#else
+  typedef std::map<std::string, SBase*> IdIndex;
+  typedef std::map<std::string, std::vector<SBase*> > ReferenceIndex;
+#endif
+  typedef std::map<std::string, ReferenceIndex> ReferenceIndices;
+
   ListItem mItems;
 
+  /*
+   * Index of the identifiers of mItems; only valid when mIdIndexBuilt is
+   * true.  Where several items share an identifier the index refers to the
+   * first of them and mNumDuplicateIds records how many are shadowed.
+   */
+  mutable IdIndex      mIdIndex;
+  mutable bool         mIdIndexBuilt;
+  mutable unsigned int mNumDuplicateIds;
+
+  /*
+   * Indices of the SIdRef attributes of mItems, keyed by attribute name;
+   * an attribute only has an index once it has been looked up.  Each
+   * index lists, in list order, the items referring to an identifier.
+   */
+  mutable ReferenceIndices mReferenceIndices;
+
+  /*
+   * A ListOf copied by SBase::cloneCopyOnWrite() shares the items of the
+   * ListOf it was copied from, mSharedSource, until it first needs them;
+   * mItems is empty meanwhile.  mSharers lists the ListOf objects sharing
+   * the items of this one.
+   */
+  mutable const ListOf*        mSharedSource;
+  mutable std::vector<ListOf*> mSharers;
+
+  /** @endcond */
+
+private:
+  /** @cond doxygenLibsbmlInternal */
+
+  void buildIdIndex () const;
+
+  void addToIdIndex (SBase* item, bool atEnd) const;
+
+  void removeFromIdIndex (SBase* item, const std::string& id) const;
+
+  void clearIdIndex () const;
+
+  const ReferenceIndex& getReferenceIndex (const std::string& attributeName) const;
+
+  void addToReferenceIndices (SBase* item, bool atEnd) const;
+
+  void removeFromReferenceIndices (SBase* item) const;
+
+  static void eraseReference (ReferenceIndex& index, const std::string& ref,
+                              SBase* item);
+
+  void copySharedItems () const;
+
+  void stopSharing ();
+
+  void handOverItems ();
+
+  void takeOverSharing (ListOf& orig);
+
   /** @endcond */
 };
 
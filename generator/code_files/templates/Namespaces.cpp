@@ -48,6 +48,7 @@ SBMLNamespaces::initSBMLNamespace()
 SBMLNamespaces::SBMLNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
+  ,mNumReferences(0)
 {
   initSBMLNamespace();
 }
@@ -67,6 +68,7 @@ SBMLNamespaces::SBMLNamespaces(const SBMLNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mNumReferences(0)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
@@ -127,6 +129,82 @@ SBMLNamespaces::clone () const
 }
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * There is no registry: an object is shared by the elements created from
+ * it, which in practice are the elements of the document it belongs to.
+ * Without atomic reference counts nothing is shared and every element
+ * keeps a copy of its own, as the elements of two documents may be used
+ * from different threads.
+ */
+SBMLNamespaces*
+SBMLNamespaces::intern(const SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL) return NULL;
+
+#ifdef LIBSBML_HAS_SHARED_NAMESPACES
+  if (sbmlns->mNumReferences > 0)
+  {
+    ++sbmlns->mNumReferences;
+    return const_cast<SBMLNamespaces*>(sbmlns);
+  }
+
+  SBMLNamespaces* shared = sbmlns->clone();
+  shared->mNumReferences = 1;
+  return shared;
+#else
+  return sbmlns->clone();
+#endif
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::internAndOwn(SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL) return NULL;
+
+#ifdef LIBSBML_HAS_SHARED_NAMESPACES
+  if (sbmlns->mNumReferences == 0)
+  {
+    sbmlns->mNumReferences = 1;
+  }
+#endif
+
+  return sbmlns;
+}
+
+
+void
+SBMLNamespaces::release(SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL) return;
+
+  if (sbmlns->mNumReferences == 0 || --sbmlns->mNumReferences == 0)
+  {
+    delete sbmlns;
+  }
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::unshare(SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL || sbmlns->mNumReferences <= 1)
+  {
+    return sbmlns;
+  }
+
+  // the copy can be shared in turn by the elements created from it
+  SBMLNamespaces* copy = sbmlns->clone();
+  copy->mNumReferences = 1;
+  --sbmlns->mNumReferences;
+  return copy;
+}
+
+/** @endcond */
+
+
 std::string 
 SBMLNamespaces::getSBMLNamespaceURI(unsigned int level,
                                  unsigned int version)
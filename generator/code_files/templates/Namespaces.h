@@ -27,6 +27,11 @@ static const unsigned int SBML_DEFAULT_VERSION = <SPEC_VERSION>;
 #include <string>
 #include <stdexcept>
 
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#  include <atomic>
+#  define LIBSBML_HAS_SHARED_NAMESPACES 1
+#endif
+
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 class LIBSBML_EXTERN SBMLNamespaces
@@ -237,6 +242,52 @@ public:
   void setNamespaces(XMLNamespaces * xmlns);
   /** @endcond */
 
+
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Returns a shared SBMLNamespaces object equal to @p sbmlns.
+   *
+   * If @p sbmlns is itself shared (as the namespaces of a document are)
+   * one more reference is taken on it, so that the elements created from
+   * the namespaces of a document share them rather than each owning a
+   * copy; otherwise a shared copy of @p sbmlns is made.  The caller holds
+   * one reference, which must be given back with release().  A shared
+   * object must not be modified; use unshare() first.
+   *
+   * Sharing needs atomic reference counts (C++11 or MSVC 2012 and later);
+   * without them every caller is simply given a copy of its own.
+   *
+   * @param sbmlns the SBMLNamespaces object to share or copy.
+   *
+   * @return the shared SBMLNamespaces object, or @c NULL if @p sbmlns
+   * is @c NULL.
+   */
+  static SBMLNamespaces* intern(const SBMLNamespaces* sbmlns);
+
+
+  /**
+   * Makes @p sbmlns, which the caller owns, shareable, and returns it with
+   * the caller holding the one reference to it.
+   */
+  static SBMLNamespaces* internAndOwn(SBMLNamespaces* sbmlns);
+
+
+  /**
+   * Gives back a reference obtained from intern(), internAndOwn() or
+   * unshare(); the object is deleted once no reference is left.
+   */
+  static void release(SBMLNamespaces* sbmlns);
+
+
+  /**
+   * Returns an SBMLNamespaces object equal to @p sbmlns that the caller
+   * holds the only reference to and may modify, copying it if it is
+   * shared (copy-on-write).  The reference held on @p sbmlns is passed on
+   * to the result.
+   */
+  static SBMLNamespaces* unshare(SBMLNamespaces* sbmlns);
+  /** @endcond */
+
 protected:  
   /** @cond doxygenLibsbmlInternal */
   void initSBMLNamespace();
@@ -245,6 +296,13 @@ protected:
   unsigned int    mVersion;
   XMLNamespaces * mNamespaces;
 
+  /* the number of holders of a shared object, or 0 if it is not shared */
+#ifdef LIBSBML_HAS_SHARED_NAMESPACES
+  mutable std::atomic<unsigned int> mNumReferences;
+#else
+  mutable unsigned int mNumReferences;
+#endif
+
   /** @endcond */
 };
 
@@ -80,6 +80,28 @@ public:
   SBMLDocument* readSBMLFromString (const std::string& xml);
 
 
+  /**
+   * Reads a document from the @p length bytes of SBML_Lang content held
+   * in @p data.
+   *
+   * Content that does not begin with an XML declaration is read as if it
+   * began with <code>&lt;?xml version='1.0' encoding='UTF-8'?&gt;</code>,
+   * as for readSBMLFromString(), but without a copy being made to prepend
+   * one.  The XML parsers take no length and read up to a null character,
+   * so content is read in place only if its last byte (<code>data[length -
+   * 1]</code>) is a null character; any other content is copied once.
+   *
+   * @param data the buffer holding the SBML_Lang content.
+   * @param length the number of bytes of content in @p data.
+   *
+   * @return a pointer to the SBMLDocument created from the SBML_Lang
+   * content.
+   *
+   * @see readSBMLFromString(@if java String@endif)
+   */
+  SBMLDocument* readSBMLFromBuffer (const char* data, size_t length);
+
+
   /**
    * Static method; returns @c true if this copy of libSBML supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -104,12 +126,66 @@ public:
   static bool hasBzip2();
 
 
+  /**
+   * Sets whether the documents read by this SBMLReader allocate their
+   * elements from an arena.
+   *
+   * Allocating from an arena makes reading and destroying large documents
+   * faster, at the cost of not reusing the memory of elements deleted
+   * while the document is alive.  It is off by default.
+   *
+   * @param useArena @c true to allocate the elements from an arena.
+   */
+  void setUseArena (bool useArena);
+
+
+  /**
+   * Predicate returning @c true if the documents read by this SBMLReader
+   * allocate their elements from an arena.
+   *
+   * @see setUseArena(bool useArena)
+   */
+  bool getUseArena () const;
+
+
+  /**
+   * Sets whether this SBMLReader reads uncompressed files through a
+   * memory mapping rather than through stdio.
+   *
+   * Parsing a large file straight from the page cache saves copying it
+   * through stdio buffers.  The file must not be truncated while it is
+   * being read.  Compressed files, and all files on platforms without
+   * mmap, are read as usual.  It is off by default.
+   *
+   * @param useMemoryMap @c true to read files through a memory mapping.
+   */
+  void setUseMemoryMap (bool useMemoryMap);
+
+
+  /**
+   * Predicate returning @c true if this SBMLReader reads uncompressed
+   * files through a memory mapping.
+   *
+   * @see setUseMemoryMap(bool useMemoryMap)
+   */
+  bool getUseMemoryMap () const;
+
+
 protected:
   /** @cond doxygenLibsbmlInternal */
   /**
-   * Used by readSBML() and readSBMLFromString().
+   * Used by readSBML(), readSBMLFromString() and readSBMLFromBuffer().
+   *
+   * The declaration of content read with @p hasDeclaration @c false is
+   * not checked.
    */
-  SBMLDocument* readInternal (const char* content, bool isFile = true);
+  SBMLDocument* readInternal (const char* content, bool isFile = true,
+                              bool hasDeclaration = true);
+
+
+  bool mUseArena;
+
+  bool mUseMemoryMap;
 
   /** @endcond */
 };
@@ -208,6 +284,24 @@ SBMLDocument_t *
 SBMLReader_readSBMLFromString (SBMLReader_t *sr, const char *xml);
 
 
+/**
+ * @param sr the SBMLReader_t structure to use
+ *
+ * @param data the buffer holding the input xml.
+ *
+ * @param length the number of bytes of input xml in @p data.
+ *
+ * @return a pointer to the SBMLDocument read.
+ *
+ * @if conly
+ * @memberof SBMLReader_t
+ * @endif
+ */
+LIBSBML_EXTERN
+SBMLDocument_t *
+SBMLReader_readSBMLFromBuffer (SBMLReader_t *sr, const char *data, size_t length);
+
+
 /**
  * Returns @c true if the underlying libSBML supports @em gzip and @em zlib
  * format compression.
@@ -288,6 +382,23 @@ SBMLDocument_t *
 readSBMLFromString (const char *xml);
 
 
+/**
+ * @param data the buffer holding a full SBML model
+ *
+ * @param length the number of bytes of content in @p data.
+ *
+ * @return a pointer to the SBMLDocument structure created from the SBML
+ * content in @p data.
+ *
+ * @if conly
+ * @memberof SBMLReader_t
+ * @endif
+ */
+LIBSBML_EXTERN
+SBMLDocument_t *
+readSBMLFromBuffer (const char *data, size_t length);
+
+
 END_C_DECLS
 LIBSBML_CPP_NAMESPACE_END
 
@@ -15,6 +15,8 @@
 #include <sbml/SBMLError.h>
 #include <sbml/SBMLErrorLog.h>
 #include <sbml/SBMLDocument.h>
+#include <sbml/SBMLElementIndex.h>
+#include <sbml/SBMLArena.h>
 #include <sbml/ListOf.h>
 #include <sbml/SBase.h>
 
@@ -27,6 +29,74 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 
 #ifdef __cplusplus
 
+SBMLCounter SBase::mNumSharingLists(0);
+
+/* non-zero while this thread is in cloneCopyOnWrite(); kept out of the
+ * class as exported classes cannot have thread-local members */
+#ifdef LIBSBML_HAS_THREAD_SAFE_COUNTERS
+static thread_local unsigned int copyingOnWrite = 0;
+#else
+static unsigned int copyingOnWrite = 0;
+#endif
+
+
+/*
+ * The notes and annotation of a copy made by cloneCopyOnWrite() are shared
+ * with the original.  A shared node comes with the count of the objects
+ * sharing it, and whichever of them is about to change the node first
+ * takes a copy of its own.
+ */
+static void
+shareNode(<NS>XMLNode*& node, SBMLCounter*& shares,
+          <NS>XMLNode* origNode, SBMLCounter*& origShares)
+{
+  if (origShares == NULL)
+  {
+    origShares = new SBMLCounter(1);
+  }
+
+  ++(*origShares);
+  node = origNode;
+  shares = origShares;
+}
+
+
+static void
+releaseNode(<NS>XMLNode*& node, SBMLCounter*& shares)
+{
+  if (shares == NULL || --(*shares) == 0)
+  {
+    delete node;
+    delete shares;
+  }
+
+  node = NULL;
+  shares = NULL;
+}
+
+
+static void
+unshareNode(<NS>XMLNode*& node, SBMLCounter*& shares)
+{
+  if (shares == NULL) return;
+
+  if (*shares == 1)
+  {
+    // the others have gone, so the node is ours alone
+    delete shares;
+    shares = NULL;
+  }
+  else
+  {
+    // the copy is taken before letting go of the node, which the last of
+    // the others (possibly in another thread) then deletes
+    <NS>XMLNode* copy = new <NS>XMLNode(*node);
+    releaseNode(node, shares);
+    node = copy;
+  }
+}
+
+
 SBase*
 SBase::getElementBySId(const std::string& id)
 {
@@ -68,6 +138,81 @@ SBase::getAllElements()
   return NULL;
 }
 
+
+/** @cond doxygenLibsbmlInternal */
+/*
+ * SBase itself has no SIdRef attributes.
+ */
+void
+SBase::addReferenceAttributes(std::vector<std::string>& attributes) const
+{
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsbmlInternal */
+void*
+SBase::operator new (size_t size)
+{
+  return SBMLArena::allocate(NULL, size);
+}
+
+
+void*
+SBase::operator new (size_t size, SBMLArena* arena)
+{
+  return SBMLArena::allocate(arena, size);
+}
+
+
+void*
+SBase::operator new (size_t size, const std::nothrow_t&) throw()
+{
+  try
+  {
+    return SBMLArena::allocate(NULL, size);
+  }
+  catch (...)
+  {
+    return NULL;
+  }
+}
+
+
+void*
+SBase::operator new (size_t, void* place) throw()
+{
+  return place;
+}
+
+
+void
+SBase::operator delete (void* p)
+{
+  SBMLArena::deallocate(p);
+}
+
+
+void
+SBase::operator delete (void* p, SBMLArena*)
+{
+  SBMLArena::deallocate(p);
+}
+
+
+void
+SBase::operator delete (void* p, const std::nothrow_t&) throw()
+{
+  SBMLArena::deallocate(p);
+}
+
+
+void
+SBase::operator delete (void*, void*) throw()
+{
+}
+/** @endcond */
+
 /** @cond doxygenLibsbmlInternal */
 /*
  * Creates a new SBase object with the given level and version.
@@ -85,10 +230,16 @@ SBase::SBase (unsigned int level, unsigned int version)
  , mColumn    ( 0 )
  , mParentSBMLObject (NULL)
   , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , m<Notes>Shares(NULL)
+  , m<Annotation>Shares(NULL)
   , mEmptyString("")
  , mURI("")
 {
-  mSBMLNamespaces = new SBMLNamespaces(level, version);
+  SBMLNamespaces sbmlns(level, version);
+  mSBMLNamespaces = SBMLNamespaces::intern(&sbmlns);
 
   //
   // Sets the XMLNS URI of corresponding SBML_Lang Level/Version to
@@ -116,6 +267,11 @@ SBase::SBase (SBMLNamespaces *sbmlns)
  , mColumn    ( 0 )
  , mParentSBMLObject (NULL)
   , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , m<Notes>Shares(NULL)
+  , m<Annotation>Shares(NULL)
   , mEmptyString("")
  , mURI("")
 {
@@ -124,9 +280,9 @@ SBase::SBase (SBMLNamespaces *sbmlns)
     std::string err("SBase::SBase(SBMLNamespaces*) : SBMLNamespaces is null");
     throw SBMLConstructorException(err);
   }
-  mSBMLNamespaces = sbmlns->clone();
+  mSBMLNamespaces = SBMLNamespaces::intern(sbmlns);
 
-  setElementNamespace(static_cast<SBMLNamespaces>(*mSBMLNamespaces).getURI());
+  setElementNamespace(mSBMLNamespaces->SBMLNamespaces::getURI());
 }
 /** @endcond */
 
@@ -146,26 +302,84 @@ SBase::SBase(const SBase& orig)
   , mLine(orig.mLine)
   , mColumn(orig.mColumn)
   , mParentSBMLObject(NULL)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , m<Notes>Shares(NULL)
+  , m<Annotation>Shares(NULL)
   , mURI(orig.mURI)
 {
-  if(orig.m<Notes> != NULL)
-    this->m<Notes> = new <NS>XMLNode(*const_cast<SBase&>(orig).get<Notes>());
+  if(orig.m<Notes> != NULL && isCopyingOnWrite())
+    shareNode(m<Notes>, m<Notes>Shares, orig.m<Notes>, orig.m<Notes>Shares);
+  else if(orig.m<Notes> != NULL)
+    this->m<Notes> = new <NS>XMLNode(*orig.m<Notes>);
   else
     this->m<Notes> = NULL;
 
-  if(orig.m<Annotation> != NULL)
-    this->m<Annotation> = new <NS>XMLNode(*const_cast<SBase&>(orig).m<Annotation>);
+  if(orig.m<Annotation> != NULL && isCopyingOnWrite())
+    shareNode(m<Annotation>, m<Annotation>Shares, orig.m<Annotation>,
+              orig.m<Annotation>Shares);
+  else if(orig.m<Annotation> != NULL)
+    this->m<Annotation> = new <NS>XMLNode(*orig.m<Annotation>);
   else
     this->m<Annotation> = NULL;
 
-  if(orig.getSBMLNamespaces() != NULL)
-    this->mSBMLNamespaces =
-    new SBMLNamespaces(*const_cast<SBase&>(orig).getSBMLNamespaces());
+  // share the namespaces rather than copying them; orig.getSBMLNamespaces()
+  // is not used as it would give orig a copy of its own
+  SBMLDocument* origDoc = orig.deriveSBMLDocument();
+  if (origDoc != NULL)
+    this->mSBMLNamespaces = SBMLNamespaces::intern(origDoc->mSBMLNamespaces);
   else
-    this->mSBMLNamespaces = NULL;
+    this->mSBMLNamespaces = SBMLNamespaces::intern(orig.mSBMLNamespaces);
 
   this->mHasBeenDeleted = false;
 }
+
+
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor. Takes over the contents of the given SBase object.
+ */
+SBase::SBase(SBase&& orig)
+  : mMetaId ()
+  , mId ()
+  , m<Notes> (NULL)
+  , m<Annotation> (NULL)
+  , mSBML (NULL)
+  , mSBMLNamespaces(NULL)
+  , mUserData(orig.mUserData)
+  , mLine(orig.mLine)
+  , mColumn(orig.mColumn)
+  , mParentSBMLObject(NULL)
+  , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , m<Notes>Shares(NULL)
+  , m<Annotation>Shares(NULL)
+  , mURI(orig.mURI)
+{
+  // the copies sharing the branch orig is in take their own copies before
+  // it is emptied; this may throw, so nothing is taken from orig until then.
+  // The children of orig move along with it (a ListOf takes the ListOf
+  // objects sharing its items with it).
+  if (orig.getHoldingParent() != NULL)
+  {
+    orig.getHoldingParent()->detachSharedCopies();
+  }
+
+  // orig stays a valid element of its namespaces
+  mSBMLNamespaces = SBMLNamespaces::intern(orig.mSBMLNamespaces);
+
+  orig.releaseIndexEntries(orig.mId);
+  mMetaId.swap(orig.mMetaId);
+  mId.swap(orig.mId);
+  std::swap(m<Notes>, orig.m<Notes>);
+  std::swap(m<Notes>Shares, orig.m<Notes>Shares);
+  std::swap(m<Annotation>, orig.m<Annotation>);
+  std::swap(m<Annotation>Shares, orig.m<Annotation>Shares);
+}
+#endif
 /** @endcond */
 
 
@@ -174,9 +388,15 @@ SBase::SBase(const SBase& orig)
  */
 SBase::~SBase ()
 {
-  if (m<Notes> != NULL)       delete m<Notes>;
-  if (m<Annotation> != NULL)  delete m<Annotation>;
-  if (mSBMLNamespaces != NULL)  delete mSBMLNamespaces;
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->remove(this);
+  }
+
+  releaseNode(m<Notes>, m<Notes>Shares);
+  releaseNode(m<Annotation>, m<Annotation>Shares);
+  SBMLNamespaces::release(mSBMLNamespaces);
 }
 
 /*
@@ -186,43 +406,127 @@ SBase& SBase::operator=(const SBase& rhs)
 {
   if(&rhs!=this)
   {
+    prepareForChange();
+
+    // rather than moving this object and its children between the entries
+    // of the index, let the document rebuild it
+    SBMLElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->clear();
+    }
+    updateIdIndices(mId, rhs.mId);
+
     this->mMetaId = rhs.mMetaId;
     this->mId = rhs.mId;
 
-    delete this->m<Notes>;
+    releaseNode(this->m<Notes>, this->m<Notes>Shares);
 
     if(rhs.m<Notes> != NULL)
-      this->m<Notes> = new <NS>XMLNode(*const_cast<SBase&>(rhs).get<Notes>());
-    else
-      this->m<Notes> = NULL;
+      this->m<Notes> = new <NS>XMLNode(*rhs.m<Notes>);
 
-    delete this->m<Annotation>;
+    releaseNode(this->m<Annotation>, this->m<Annotation>Shares);
 
     if(rhs.m<Annotation> != NULL)
-      this->m<Annotation> = new <NS>XMLNode(*const_cast<SBase&>(rhs).m<Annotation>);
-    else
-      this->m<Annotation> = NULL;
+      this->m<Annotation> = new <NS>XMLNode(*rhs.m<Annotation>);
 
-    this->mSBML       = rhs.mSBML;
+    // this object keeps its place, so its parent and document are its own
     this->mLine       = rhs.mLine;
     this->mColumn     = rhs.mColumn;
-    this->mParentSBMLObject = rhs.mParentSBMLObject;
     this->mUserData   = rhs.mUserData;
 
-    delete this->mSBMLNamespaces;
+    SBMLNamespaces* sbmlns = SBMLNamespaces::intern(rhs.mSBMLNamespaces);
+    SBMLNamespaces::release(this->mSBMLNamespaces);
+    this->mSBMLNamespaces = sbmlns;
 
-    if(rhs.mSBMLNamespaces != NULL)
-      this->mSBMLNamespaces =
-      new SBMLNamespaces(*const_cast<SBase&>(rhs).mSBMLNamespaces);
-    else
-      this->mSBMLNamespaces = NULL;
 
+    this->mURI = rhs.mURI;
+  }
+
+  return *this;
+}
+
+
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+/*
+ * Move assignment operator
+ */
+SBase& SBase::operator=(SBase&& rhs)
+{
+  if(&rhs!=this)
+  {
+    // as in the move constructor, the steps that may throw come first; the
+    // children of both objects are moved by the subclasses
+    if (getHoldingParent() != NULL)
+    {
+      getHoldingParent()->detachSharedCopies();
+    }
+    if (rhs.getHoldingParent() != NULL)
+    {
+      rhs.getHoldingParent()->detachSharedCopies();
+    }
 
+    SBMLNamespaces* sbmlns = SBMLNamespaces::intern(rhs.mSBMLNamespaces);
+    SBMLNamespaces::release(this->mSBMLNamespaces);
+    this->mSBMLNamespaces = sbmlns;
     this->mURI = rhs.mURI;
+
+    // as for a copy, let the document rebuild its index
+    SBMLElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->clear();
+    }
+    updateIdIndices(mId, rhs.mId);
+    rhs.releaseIndexEntries(rhs.mId);
+
+    this->mMetaId = std::move(rhs.mMetaId);
+    this->mId = std::move(rhs.mId);
+
+    releaseNode(this->m<Notes>, this->m<Notes>Shares);
+    std::swap(this->m<Notes>, rhs.m<Notes>);
+    std::swap(this->m<Notes>Shares, rhs.m<Notes>Shares);
+
+    releaseNode(this->m<Annotation>, this->m<Annotation>Shares);
+    std::swap(this->m<Annotation>, rhs.m<Annotation>);
+    std::swap(this->m<Annotation>Shares, rhs.m<Annotation>Shares);
+
+    // this object keeps its place, so its parent and document are its own
+    this->mLine       = rhs.mLine;
+    this->mColumn     = rhs.mColumn;
+    this->mUserData   = rhs.mUserData;
+
+    rhs.mMetaId.clear();
+    rhs.mId.clear();
   }
 
   return *this;
 }
+#endif
+
+
+/*
+ * @return a copy of this object sharing its unchanged parts with it.
+ */
+SBase*
+SBase::cloneCopyOnWrite () const
+{
+  SBase* copy = NULL;
+
+  beginCopyingOnWrite();
+  try
+  {
+    copy = clone();
+  }
+  catch (...)
+  {
+    endCopyingOnWrite();
+    throw;
+  }
+  endCopyingOnWrite();
+
+  return copy;
+}
 
 
 /*
@@ -258,6 +562,8 @@ SBase::getId() const
 <NS>XMLNode*
 SBase::get<Notes>()
 {
+  // the caller may change the notes through the pointer
+  unshareNode(m<Notes>, m<Notes>Shares);
   return m<Notes>;
 }
 
@@ -292,6 +598,8 @@ SBase::get<Notes>String() const
 <NS>XMLNode*
 SBase::get<Annotation> ()
 {
+  // the caller may change the annotation through the pointer
+  unshareNode(m<Annotation>, m<Annotation>Shares);
   return m<Annotation>;
 }
 
@@ -299,7 +607,7 @@ SBase::get<Annotation> ()
 const <NS>XMLNode*
 SBase::get<Annotation> () const
 {
-  return const_cast<SBase *>(this)->get<Annotation>();
+  return m<Annotation>;
 }
 
 
@@ -309,14 +617,14 @@ SBase::get<Annotation> () const
 std::string
 SBase::get<Annotation>String ()
 {
-  return <NS>XMLNode::convertXMLNodeToString(get<Annotation>());
+  return <NS>XMLNode::convertXMLNodeToString(m<Annotation>);
 }
 
 
 std::string
 SBase::get<Annotation>String () const
 {
-  return <NS>XMLNode::convertXMLNodeToString(get<Annotation>());
+  return <NS>XMLNode::convertXMLNodeToString(m<Annotation>);
 }
 
 
@@ -329,7 +637,7 @@ SBase::getURI() const
   if (doc == NULL)
     return getElementNamespace();
 
-  SBMLNamespaces* sbmlns = doc->getSBMLNamespaces();
+  const SBMLNamespaces* sbmlns = doc->getSBMLNamespaces();
 
   if (sbmlns == NULL)
     return getElementNamespace();
@@ -391,24 +699,39 @@ SBase::unsetUserData()
   }
 }
 
+
+/*
+ * Makes the copies sharing the branch holding this object take their own
+ * copies of it before it changes.
+ */
+void
+SBase::prepareForChange()
+{
+  detachSharedCopies();
+}
+
 /*
  * @return the Namespaces associated with this SBML_Lang object
  */
 <NS>XMLNamespaces*
 SBase::getNamespaces()
 {
-  if (mSBML != NULL)
-    return mSBML->getSBMLNamespaces()->getNamespaces();
-  else
-    return mSBMLNamespaces->getNamespaces();
+  SBMLDocument* d = deriveSBMLDocument();
+  if (d != NULL)
+    return d->getSBMLNamespaces()->getNamespaces();
+
+  // the caller may change the namespaces, so stop sharing them
+  mSBMLNamespaces = SBMLNamespaces::unshare(mSBMLNamespaces);
+  return mSBMLNamespaces->getNamespaces();
 }
 
 
 const <NS>XMLNamespaces*
 SBase::getNamespaces() const
 {
-  if (mSBML != NULL)
-    return mSBML->getSBMLNamespaces()->getNamespaces();
+  const SBMLDocument* d = deriveSBMLDocument();
+  if (d != NULL)
+    return d->getSBMLNamespaces()->getNamespaces();
   else
     return mSBMLNamespaces->getNamespaces();
 }
@@ -420,19 +743,21 @@ SBase::getNamespaces() const
 const SBMLDocument*
 SBase::getSBMLDocument () const
 {
-  if (mSBML != NULL)
+  SBMLDocument* d = deriveSBMLDocument();
+
+  if (d != NULL)
   {
     // if the doc object has been deleted the pointer is
     // still valid but points to nothing
     try
     {
-      if (mSBML->getHasBeenDeleted())
+      if (d->getHasBeenDeleted())
       {
         return NULL;
       }
       else
       {
-        return mSBML;
+        return d;
       }
     }
     catch ( ... )
@@ -441,7 +766,7 @@ SBase::getSBMLDocument () const
     }
   }
 
-  return mSBML;
+  return d;
 }
 
 /*
@@ -450,19 +775,21 @@ SBase::getSBMLDocument () const
 SBMLDocument*
 SBase::getSBMLDocument ()
 {
-  if (mSBML != NULL)
+  SBMLDocument* d = deriveSBMLDocument();
+
+  if (d != NULL)
   {
     // if the doc object has been deleted the pointer is
     // still valid but points to nothing
     try
     {
-      if (mSBML->getHasBeenDeleted())
+      if (d->getHasBeenDeleted())
       {
         return NULL;
       }
       else
       {
-        return mSBML;
+        return d;
       }
     }
     catch ( ... )
@@ -470,7 +797,7 @@ SBase::getSBMLDocument ()
       return NULL;
     }
   }
-  return mSBML;
+  return d;
 }
 SBase*
 SBase::getParentSBMLObject ()
@@ -595,6 +922,8 @@ SBase::setMetaId (const std::string& metaid)
 {
   if (metaid.empty())
   {
+    prepareForChange();
+    updateMetaIdIndex(mMetaId, metaid);
     mMetaId.erase();
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -604,6 +933,8 @@ SBase::setMetaId (const std::string& metaid)
   }
   else
   {
+    prepareForChange();
+    updateMetaIdIndex(mMetaId, metaid);
     mMetaId = metaid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -617,6 +948,8 @@ SBase::setId (const std::string& sid)
 {
   if (sid.empty())
   {
+    prepareForChange();
+    updateIdIndices(mId, sid);
     mId.erase();
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -626,6 +959,8 @@ SBase::setId (const std::string& sid)
   }
   else
   {
+    prepareForChange();
+    updateIdIndices(mId, sid);
     mId = sid;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -638,6 +973,9 @@ SBase::setId (const std::string& sid)
 int
 SBase::set<Annotation> (<NS>XMLNode* annotation)
 {
+  prepareForChange();
+  unshareNode(m<Annotation>, m<Annotation>Shares);
+
   if (annotation == NULL)
   {
     delete m<Annotation>;
@@ -723,6 +1061,9 @@ SBase::append<Annotation> (const <NS>XMLNode* annotation)
 
   if (m<Annotation> != NULL)
   {
+    prepareForChange();
+    unshareNode(m<Annotation>, m<Annotation>Shares);
+
     // if m<Annotation> is just <annotation/> need to tell
     // it to no longer be an end
     if (m<Annotation>->isEnd())
@@ -864,6 +1205,8 @@ SBase::removeTopLevel<Annotation>Element(const std::string elementName,
     }
 
     // remove the annotation at the index corresponding to the name
+    prepareForChange();
+    unshareNode(m<Annotation>, m<Annotation>Shares);
     delete m<Annotation>->removeChild(index);
 
       if (m<Annotation>->getNumChildren() == 0)
@@ -953,7 +1296,11 @@ SBase::set<Notes>(const <NS>XMLNode* notes)
   {
     return LIBSBML_OPERATION_SUCCESS;
   }
-  else if (notes == NULL)
+
+  prepareForChange();
+  unshareNode(m<Notes>, m<Notes>Shares);
+
+  if (notes == NULL)
   {
     delete m<Notes>;
     m<Notes> = NULL;
@@ -1242,6 +1589,9 @@ SBase::append<Notes>(const <NS>XMLNode* notes)
 
   if ( m<Notes> != NULL )
   {
+    prepareForChange();
+    unshareNode(m<Notes>, m<Notes>Shares);
+
     //------------------------------------------------------------
     //
     //  STEP2: identifies the type of the existing notes
@@ -1459,7 +1809,17 @@ SBase::append<Notes>(const std::string& notes)
 void
 SBase::setSBMLDocument (SBMLDocument* d)
 {
+  mNumDestroyedDocuments =
+    static_cast<unsigned long>(SBMLElementIndex::getNumDestroyed());
+  mDocumentEpoch = (d != NULL) ? d->getElementIndex()->getEpoch() : 0;
   mSBML = d;
+
+  // the document may be walking its elements to update its index
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->visit(this);
+  }
 }
 
 
@@ -1471,19 +1831,284 @@ SBase::setSBMLDocument (SBMLDocument* d)
 void
 SBase::connectToParent (SBase* parent)
 {
-  mParentSBMLObject = parent;
+  if (parent != mParentSBMLObject || mReleasedByParent)
+  {
+    leaveSBMLDocument();
+    mParentSBMLObject = parent;
+    mReleasedByParent = false;
+
+    SBMLElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->addSubtree(this);
+    }
+  }
+
   if (mParentSBMLObject)
   {
+    prepareForChange();
 #if 0
     cout << "[DEBUG] connectToParent " << this << " (parent) " << SBMLTypeCode_toString(parent->getTypeCode(),"core")
          << " " << parent->getSBMLDocument() << endl;
 #endif
-    setSBMLDocument(mParentSBMLObject->getSBMLDocument());
   }
-  else
+}
+
+
+/*
+ * Takes this object and the objects below it out of the document they
+ * belong to; the parent pointer is left alone.
+ */
+void
+SBase::releaseFromParent ()
+{
+  leaveSBMLDocument();
+  mReleasedByParent = true;
+}
+
+
+/*
+ * Takes this object and the objects below it out of the document they
+ * belong to, before this object leaves its parent.
+ */
+void
+SBase::leaveSBMLDocument()
+{
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->removeSubtree(this);
+
+    // rather than pushing the new document down the subtree, advance the
+    // epoch of the document left, so that the elements below this one
+    // derive their document again when next needed.  The documents cached
+    // by the elements of other documents stay valid, and no element below
+    // one that belonged to no document can have cached one (a missing one
+    // is never trusted).
+    index->advanceEpoch();
+  }
+  mSBML = NULL;
+}
+
+
+/*
+ * Informs the indices that refer to this object by its identifier
+ * that the identifier is about to change.
+ */
+void
+SBase::updateIdIndices(const std::string& oldId, const std::string& newId)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SBML_LIST_OF)
+  {
+    static_cast<ListOf*>(getHoldingParent())->updateIdIndex(this, oldId, newId);
+  }
+
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateId(this, oldId, newId);
+  }
+}
+
+
+/*
+ * Drops the entries the indices hold for this object, whose identifiers
+ * and references have been moved elsewhere.
+ */
+void
+SBase::releaseIndexEntries(const std::string& movedId)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SBML_LIST_OF)
+  {
+    ListOf* parent = static_cast<ListOf*>(getHoldingParent());
+    parent->updateIdIndex(this, movedId, "");
+    parent->clearReferenceIndices();
+  }
+
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->clear();
+  }
+}
+
+
+/*
+ * Informs the indices of the parent ListOf and of the document that a
+ * reference is about to change.
+ */
+void
+SBase::updateReferenceIndices(const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SBML_LIST_OF)
+  {
+    static_cast<ListOf*>(getHoldingParent())->updateReferenceIndex(this,
+      attributeName, oldRef, newRef);
+  }
+
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateReference(this, attributeName, oldRef, newRef);
+  }
+}
+
+
+/*
+ * Informs the index of the document that the metaid is about to change.
+ */
+void
+SBase::updateMetaIdIndex(const std::string& oldMetaId,
+                         const std::string& newMetaId)
+{
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateMetaId(this, oldMetaId, newMetaId);
+  }
+}
+
+
+/*
+ * @return the element index of the document this object belongs to.
+ */
+SBMLElementIndex*
+SBase::getDocumentElementIndex() const
+{
+  SBMLDocument* d = deriveSBMLDocument();
+  if (d == NULL || d == this || d->getHasBeenDeleted())
+  {
+    return NULL;
+  }
+
+  return d->getElementIndex();
+}
+
+
+/*
+ * @return the arena of the document this object belongs to.
+ */
+SBMLArena*
+SBase::getDocumentArena() const
+{
+  SBMLDocument* d = deriveSBMLDocument();
+  if (d == NULL || d->getHasBeenDeleted())
+  {
+    return NULL;
+  }
+
+  return d->getArena();
+}
+
+
+/*
+ * @return the namespaces to construct a child of this object with.
+ */
+SBMLNamespaces*
+SBase::getSharedSBMLNamespaces() const
+{
+  // the constructor only takes a reference to them
+  return const_cast<SBMLNamespaces*>(getSBMLNamespaces());
+}
+
+
+/*
+ * @return the document this object belongs to; an object with a parent
+ * takes it from the parent unless the tree is unchanged since it last did.
+ */
+SBMLDocument*
+SBase::deriveSBMLDocument() const
+{
+  SBMLDocument* d = mSBML;
+  SBase* parent = getHoldingParent();
+  if (parent == NULL)
+  {
+    return d;
+  }
+
+  // the cached document can only be read while no document has been
+  // destroyed since it was cached.  The count is read first, so that a
+  // document destroyed while this one is derived only makes the cache stale
+  unsigned long numDestroyed = SBMLElementIndex::getNumDestroyed();
+  if (d == NULL || mNumDestroyedDocuments != numDestroyed
+    || mDocumentEpoch != d->getElementIndex()->getEpoch())
+  {
+    // a document being destroyed may already have lost its index
+    d = parent->deriveSBMLDocument();
+    mDocumentEpoch = (d != NULL && !d->getHasBeenDeleted())
+      ? d->getElementIndex()->getEpoch() : 0;
+    mNumDestroyedDocuments = numDestroyed;
+    mSBML = d;
+  }
+
+  return d;
+}
+
+
+/*
+ * @return the parent this object takes its document from.
+ */
+SBase*
+SBase::getHoldingParent() const
+{
+  return mReleasedByParent ? NULL : mParentSBMLObject;
+}
+
+
+/*
+ * Makes the copies sharing the branch holding this object take their own
+ * copies of it.  The ancestors go first: the copies they make share the
+ * children below them, which the next object down then detaches in turn.
+ */
+void
+SBase::detachSharedCopies()
+{
+  if (mNumSharingLists == 0 || isCopyingOnWrite()) return;
+
+  if (getHoldingParent() != NULL)
   {
-    setSBMLDocument(NULL);
+    getHoldingParent()->detachSharedCopies();
   }
+
+  unshareChildren();
+}
+
+
+/*
+ * Only ListOf objects share their children.
+ */
+void
+SBase::unshareChildren()
+{
+}
+
+
+/*
+ * @return true while this thread is making a copy with cloneCopyOnWrite().
+ */
+bool
+SBase::isCopyingOnWrite()
+{
+  return copyingOnWrite > 0;
+}
+
+
+void
+SBase::beginCopyingOnWrite()
+{
+  ++copyingOnWrite;
+}
+
+
+void
+SBase::endCopyingOnWrite()
+{
+  --copyingOnWrite;
 }
 
 
@@ -1566,6 +2191,8 @@ SBase::getAncestorOfType(int type) const
 int
 SBase::setNamespaces(<NS>XMLNamespaces* xmlns)
 {
+  mSBMLNamespaces = SBMLNamespaces::unshare(mSBMLNamespaces);
+
   if (xmlns == NULL)
   {
     mSBMLNamespaces->setNamespaces(NULL);
@@ -1586,6 +2213,8 @@ SBase::setNamespaces(<NS>XMLNamespaces* xmlns)
 int
 SBase::unsetMetaId ()
 {
+  prepareForChange();
+  updateMetaIdIndex(mMetaId, "");
   mMetaId.erase();
 
   if (mMetaId.empty())
@@ -1605,6 +2234,8 @@ SBase::unsetMetaId ()
 int
 SBase::unsetId ()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty())
@@ -1624,8 +2255,8 @@ SBase::unsetId ()
 int
 SBase::unset<Notes> ()
 {
-  delete m<Notes>;
-  m<Notes> = NULL;
+  prepareForChange();
+  releaseNode(m<Notes>, m<Notes>Shares);
   return LIBSBML_OPERATION_SUCCESS;
 }
 
@@ -1648,8 +2279,9 @@ unsigned int
 SBase::getLevel () const
 {
 <if_has_level_version>
-  if (mSBML != NULL)
-    return mSBML->getLevel();
+  SBMLDocument* d = deriveSBMLDocument();
+  if (d != NULL)
+    return d->getLevel();
   else if (mSBMLNamespaces != NULL)
 <else>
   if (mSBMLNamespaces != NULL)
@@ -1667,8 +2299,9 @@ unsigned int
 SBase::getVersion () const
 {
 <if_has_level_version>
-  if (mSBML != NULL)
-    return mSBML->getVersion();
+  SBMLDocument* d = deriveSBMLDocument();
+  if (d != NULL)
+    return d->getVersion();
   else if (mSBMLNamespaces != NULL)
 <else>
   if (mSBMLNamespaces != NULL)
@@ -1750,8 +2383,8 @@ SBase::matchesCoreSBMLNamespace(const SBase * sb)
 {
   bool match = false;
 
-  SBMLNamespaces *sbmlns = getSBMLNamespaces();
-  SBMLNamespaces *sbmlns_rhs = sb->getSBMLNamespaces();
+  const SBMLNamespaces *sbmlns = static_cast<const SBase*>(this)->getSBMLNamespaces();
+  const SBMLNamespaces *sbmlns_rhs = sb->getSBMLNamespaces();
 
   if (sbmlns->getLevel() != sbmlns_rhs->getLevel())
     return match;
@@ -1777,8 +2410,8 @@ SBase::matchesCoreSBMLNamespace(const SBase * sb) const
 {
   bool match = false;
 
-  SBMLNamespaces *sbmlns = getSBMLNamespaces();
-  SBMLNamespaces *sbmlns_rhs = sb->getSBMLNamespaces();
+  const SBMLNamespaces *sbmlns = static_cast<const SBase*>(this)->getSBMLNamespaces();
+  const SBMLNamespaces *sbmlns_rhs = sb->getSBMLNamespaces();
 
   if (sbmlns->getLevel() != sbmlns_rhs->getLevel())
     return match;
@@ -1863,26 +2496,45 @@ SBase::setSBMLNamespaces(SBMLNamespaces * sbmlns)
 void
 SBase::setSBMLNamespacesAndOwn(SBMLNamespaces * sbmlns)
 {
-  delete mSBMLNamespaces;
-  mSBMLNamespaces = sbmlns;
+  SBMLNamespaces::release(mSBMLNamespaces);
+  mSBMLNamespaces = SBMLNamespaces::internAndOwn(sbmlns);
 
-  if(sbmlns != NULL)
-    setElementNamespace(sbmlns->getURI());
+  if(mSBMLNamespaces != NULL)
+    setElementNamespace(mSBMLNamespaces->getURI());
 }
 
 
 /* gets the SBMLnamespaces - internal use only*/
-SBMLNamespaces *
+const SBMLNamespaces *
 SBase::getSBMLNamespaces() const
 {
-  if (mSBML != NULL)
-    return mSBML->mSBMLNamespaces;
+  const SBMLDocument* d = deriveSBMLDocument();
+  if (d != NULL && d != this)
+    return d->getSBMLNamespaces();
   
   // initialize SBML_Lang namespace if need be
   if (mSBMLNamespaces == NULL)
     const_cast<SBase*>(this)->mSBMLNamespaces = new SBMLNamespaces(getLevel(), getVersion());
+
   return mSBMLNamespaces;  
 }
+
+
+/* gets the SBMLnamespaces for modification - internal use only*/
+SBMLNamespaces *
+SBase::getSBMLNamespaces()
+{
+  SBMLDocument* d = deriveSBMLDocument();
+  if (d != NULL && d != this)
+    return d->getSBMLNamespaces();
+
+  if (mSBMLNamespaces == NULL)
+    mSBMLNamespaces = new SBMLNamespaces(getLevel(), getVersion());
+
+  // the caller may change the namespaces, so stop sharing them
+  mSBMLNamespaces = SBMLNamespaces::unshare(mSBMLNamespaces);
+  return mSBMLNamespaces;
+}
 /** @endcond */
 
 
@@ -2111,6 +2763,27 @@ SBase::read (<NS>XMLInputStream& stream)
   addExpectedAttributes(expectedAttributes);
   readAttributes( element.getAttributes(), expectedAttributes );
 
+  // the attributes are read straight into the members, so let any
+  // index of the parent or the document know about the identifiers
+  if (!getId().empty())
+  {
+    updateIdIndices("", getId());
+  }
+  if (!getMetaId().empty())
+  {
+    updateMetaIdIndex("", getMetaId());
+  }
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SBML_LIST_OF)
+  {
+    static_cast<ListOf*>(getHoldingParent())->clearReferenceIndices();
+  }
+  SBMLElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->addReferences(this);
+  }
+
   /* if we are reading a document pass the
    * SBML_Lang Namespace information to the input stream object
    * thus the MathML reader can find out what level/version
@@ -2122,7 +2795,9 @@ SBase::read (<NS>XMLInputStream& stream)
     // need to check that any prefix on the sbmlns also occurs on element
     // remembering the horrible situation where the sbmlns might be declared
     // with more than one prefix
-    <NS>XMLNamespaces * xmlns = this->getSBMLNamespaces()->getNamespaces();
+    const SBMLNamespaces * sbmlns =
+      static_cast<const SBase*>(this)->getSBMLNamespaces();
+    const <NS>XMLNamespaces * xmlns = sbmlns->getNamespaces();
     if (xmlns != NULL)
     {
       int i = xmlns->getIndexByPrefix(element.getPrefix());
@@ -2132,7 +2807,7 @@ SBase::read (<NS>XMLInputStream& stream)
         bool error = false;
         if (i > -1)
         {
-          if (xmlns->getURI(i) != this->getSBMLNamespaces()->getURI())
+          if (xmlns->getURI(i) != sbmlns->getURI())
           {
             error = true;
           }
@@ -2340,7 +3015,7 @@ SBase::read<Annotation> (<NS>XMLInputStream& stream)
       logError(SBMLMultiple<Annotation>s, getLevel(), getVersion(), msg);
     }
 
-    delete m<Annotation>;
+    releaseNode(m<Annotation>, m<Annotation>Shares);
     m<Annotation> = new <NS>XMLNode(stream);
     check<Annotation>();
     return true;
@@ -2371,7 +3046,7 @@ SBase::read<Notes> (<NS>XMLInputStream& stream)
       logError(SBMLOnlyOne<Notes>ElementAllowed, getLevel(), getVersion());
     }
 
-    delete m<Notes>;
+    releaseNode(m<Notes>, m<Notes>Shares);
     m<Notes> = new <NS>XMLNode(stream);
 
     //
@@ -2412,7 +3087,8 @@ SBase::getElementPosition () const
 SBMLErrorLog*
 SBase::getErrorLog ()
 {
-  return (mSBML != NULL) ? mSBML->getErrorLog() : NULL;
+  SBMLDocument* d = deriveSBMLDocument();
+  return (d != NULL) ? d->getErrorLog() : NULL;
 }
 /** @endcond */
 
@@ -2434,7 +3110,7 @@ SBase::logUnknownAttribute( const string& attribute,
         << "definition of an SBML_Lang Level " << level
         << " Version " << version << " <" << element << "> element.";
 
-  if (mSBML)
+  if (deriveSBMLDocument())
   {
   //
   // (TODO) Needs to be fixed so that error can be added when
@@ -2463,7 +3139,7 @@ SBase::logUnknownElement( const string& element,
     msg << "Element '" << element << "' is not part of the definition of "
         << "SBML_Lang Level " << level << " Version " << version << ".";
 
-    if (mSBML != NULL)
+    if (deriveSBMLDocument() != NULL)
     {
       getErrorLog()->logError(SBMLUnrecognizedElement,
             level, version, msg.str(), getLine(), getColumn());
@@ -2494,7 +3170,7 @@ SBase::logEmptyString( const string& attribute,
   // (TODO) Needs to be fixed so that error can be added when
   // no SBMLDocument attached.
   //
-  if (mSBML != NULL)
+  if (deriveSBMLDocument() != NULL)
     getErrorLog()->logError(SBMLNotSchemaConformant,
                             level, version, msg.str(), getLine(), getColumn());
 }
@@ -2518,7 +3194,7 @@ SBase::logError (  unsigned int       id
   // (TODO) Needs to be fixed so that error can be added when
   // no SBMLDocument attached.
   //
-  if ( SBase::getErrorLog() != NULL && mSBML != NULL)
+  if ( SBase::getErrorLog() != NULL && deriveSBMLDocument() != NULL)
     getErrorLog()->logError(id, getLevel(), getVersion(), details, getLine(), getColumn());
 }
 /** @endcond */
@@ -2625,7 +3301,7 @@ SBase::getPrefix() const
 
   const <NS>XMLNamespaces *xmlns = getNamespaces();
   string uri = getURI();
-  if(xmlns && mSBML)
+  if(xmlns && deriveSBMLDocument())
   {
     prefix = xmlns->getPrefix(uri);
   }
@@ -2666,9 +3342,10 @@ SBase::getSBMLPrefix() const
 SBase*
 SBase::getRootElement()
 {
-  if (mSBML)
+  SBMLDocument* d = deriveSBMLDocument();
+  if (d)
   {
-    return mSBML;
+    return d;
   }
   else if (mParentSBMLObject)
   {
@@ -2744,11 +3421,20 @@ int SBase::removeFromParentAndDelete()
   SBase* parent = getParentSBMLObject();
 
   if (parent==NULL) return LIBSBML_OPERATION_FAILED;
+
+  // a single child is detached by its parent, which gives it back
+  if (parent->getTypeCode() != SBML_LIST_OF)
+  {
+    parent->prepareForChange();
+    if (parent->removeChildObject(getElementName(), getId()) != this)
+      return LIBSBML_OPERATION_FAILED;
+
+    delete this;
+    return LIBSBML_OPERATION_SUCCESS;
+  }
   
   ListOf* parentList = static_cast<ListOf*>(parent);
   
-  if (parentList == NULL) return LIBSBML_OPERATION_FAILED;
-  
   for (unsigned int i=0; i<parentList->size(); i++) 
   {
     SBase* sibling = parentList->get(i);
@@ -2783,16 +3469,17 @@ SBase::checkMathMLNamespace(const <NS>XMLToken elem)
   }
   if (match == 0)
   {
-    if( mSBML->getNamespaces() != NULL)
+    SBMLDocument* d = deriveSBMLDocument();
+    if( d->getNamespaces() != NULL)
     /* check for implicit declaration */
     {
-      for (n = 0; n < mSBML->getNamespaces()->getLength(); n++)
+      for (n = 0; n < d->getNamespaces()->getLength(); n++)
       {
-        if (!strcmp(mSBML->getNamespaces()->getURI(n).c_str(),
+        if (!strcmp(d->getNamespaces()->getURI(n).c_str(),
                     "http://www.w3.org/1998/Math/MathML"))
         {
           match = 1;
-          prefix = mSBML->getNamespaces()->getPrefix(n);
+          prefix = d->getNamespaces()->getPrefix(n);
           break;
         }
       }
@@ -2908,12 +3595,13 @@ SBase::check<Annotation>()
     if (topLevel.getNamespaces().getLength() == 0)
     {
       // not on actual element - is it explicit ??
-      if(mSBML != NULL && mSBML->getNamespaces() != NULL)
+      SBMLDocument* d = deriveSBMLDocument();
+      if(d != NULL && d->getNamespaces() != NULL)
       /* check for implicit declaration */
       {
-        for (n = 0; n < mSBML->getNamespaces()->getLength(); n++)
+        for (n = 0; n < d->getNamespaces()->getLength(); n++)
         {
-          if (!strcmp(mSBML->getNamespaces()->getPrefix(n).c_str(),
+          if (!strcmp(d->getNamespaces()->getPrefix(n).c_str(),
                         prefix.c_str()))
           {
             implicitNSdecl = true;
@@ -3000,7 +3688,8 @@ SBase::checkXHTML(const <NS>XMLNode * xhtml)
     }
   }
 
-  <NS>XMLNamespaces* toplevelNS = (mSBML) ? mSBML->getNamespaces() : NULL;
+  SBMLDocument* d = deriveSBMLDocument();
+  <NS>XMLNamespaces* toplevelNS = (d) ? d->getNamespaces() : NULL;
 
   /*
   * namespace declaration is variable
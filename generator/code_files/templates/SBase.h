@@ -22,8 +22,28 @@
 
 
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <new>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#  include <unordered_map>
+#  define LIBSBML_HAS_UNORDERED_MAP 1
+#else
+#  include <map>
+#endif
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#  include <memory>
+#  include <utility>
+#  define LIBSBML_HAS_MOVE_SEMANTICS 1
+#endif
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#  include <atomic>
+#  define LIBSBML_HAS_THREAD_SAFE_COUNTERS 1
+#endif
 
 #include <sbml/SBMLErrorLog.h>
 #include <sbml/SBMLVisitor.h>
@@ -47,6 +67,21 @@ LIBSBML_CPP_NAMESPACE_END
 LIBSBML_CPP_NAMESPACE_BEGIN
 
 class SBMLDocument;
+class SBMLElementIndex;
+class SBMLArena;
+
+/** @cond doxygenLibsbmlInternal */
+/*
+ * The counters SBase keeps across documents, and the counts of the objects
+ * sharing a node, are atomic so that different documents can be used from
+ * different threads (see SBase::cloneCopyOnWrite()).
+ */
+#ifdef LIBSBML_HAS_THREAD_SAFE_COUNTERS
+typedef std::atomic<unsigned long> SBMLCounter;
+#else
+typedef unsigned long SBMLCounter;
+#endif
+/** @endcond */
 
 
 class LIBSBML_EXTERN SBase
@@ -59,6 +94,42 @@ public:
   virtual ~SBase ();
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Allocates an SBase object from the heap.
+   */
+  static void* operator new (size_t size);
+
+
+  /**
+   * Allocates an SBase object from the given SBMLArena, or from the heap
+   * if @p arena is @c NULL or not enabled.
+   */
+  static void* operator new (size_t size, SBMLArena* arena);
+
+
+  static void* operator new (size_t size, const std::nothrow_t&) throw();
+
+
+  static void* operator new (size_t size, void* place) throw();
+
+
+  /**
+   * Frees an SBase object allocated by any of the forms of operator new.
+   */
+  static void operator delete (void* p);
+
+
+  static void operator delete (void* p, SBMLArena* arena);
+
+
+  static void operator delete (void* p, const std::nothrow_t&) throw();
+
+
+  static void operator delete (void* p, void* place) throw();
+  /** @endcond */
+
+
   /**
    * Assignment operator for SBase.
    *
@@ -68,6 +139,22 @@ public:
   SBase& operator=(const SBase& rhs);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Move assignment operator for SBase.
+   *
+   * The identifiers, notes and annotation of @p rhs are taken over rather
+   * than copied.  This object keeps its own parent, and @p rhs is left as
+   * a valid element without them, in the place it had.  The copies made
+   * with cloneCopyOnWrite() that share either object take their own
+   * copies first, which may throw @c std::bad_alloc.
+   *
+   * @param rhs The object whose values are moved into this one.
+   */
+  SBase& operator=(SBase&& rhs);
+#endif
+
+
   /** @cond doxygenLibsbmlInternal */
   /**
    * Accepts the given SBMLVisitor for this SBase object.
@@ -88,6 +175,39 @@ public:
   virtual SBase* clone () const = 0;
 
 
+  /**
+   * Creates and returns a copy of this SBase object that shares its
+   * unchanged parts with the original.
+   *
+   * The items of the ListOf objects in the copy, and the notes and
+   * annotations of its elements, are not copied straight away but shared
+   * with the original.  A ListOf only takes copies of the items it shares
+   * when it or the items are first used, and those copies share their own
+   * children in turn; conversely a ListOf whose items are shared makes the
+   * ListOf objects sharing them take their copies before it or anything
+   * below it changes.  Only the branches actually used or changed are thus
+   * ever copied, which makes it cheap to derive many variants of a large
+   * document that each differ in a few places.
+   *
+   * The sharing relies on changes being made through the setters and the
+   * create, add and remove functions, which all call prepareForChange()
+   * first.  An element, math or XML node of the original changed by other
+   * means (for instance through a pointer to a node obtained from a getter)
+   * may also change the copies that still share it.
+   *
+   * Different documents can be used from different threads at the same
+   * time.  The original and the copies made here, however, count as one
+   * document for as long as a ListOf of one shares the items of another,
+   * and must then be used from one thread at a time; shared notes and
+   * annotations do not tie them together.  This needs atomic counters and
+   * thread-local storage (C++11 or MSVC 2015 and later); without them the
+   * library must only be used from one thread at a time.
+   *
+   * @return the copy of this SBase object.
+   */
+  SBase* cloneCopyOnWrite () const;
+
+
   /**
    * Returns the first child element it can find with a specific "id"
    * attribute value, or @c NULL if no such object is found.
@@ -143,6 +263,21 @@ public:
   virtual List* getAllElements();
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Adds the XML names of the SIdRef attributes of this object to the
+   * given list, so that the references it makes can be found through
+   * getAttribute().
+   *
+   * Subclasses with SIdRef attributes override this, calling the
+   * implementation of their parent class first.
+   *
+   * @param attributes the list to add the names to.
+   */
+  virtual void addReferenceAttributes(std::vector<std::string>& attributes) const;
+  /** @endcond */
+
+
   /**
    * Returns the value of the "metaid" attribute of this object.
    *
@@ -1172,6 +1307,11 @@ public:
   /**
    * Sets the parent SBMLDocument of this SBML_Lang object.
    *
+   * The document of an object with a parent is derived from that parent
+   * when it is needed, so this only has a lasting effect on an object
+   * without one; subclasses pass it on to their children so that a
+   * document can visit all of its elements to update its element index.
+   *
    * @param d the SBMLDocument object to use
    *
    * @see connectToChild()
@@ -1192,11 +1332,27 @@ public:
    * addXXX, createXXX, and connectToChild functions of the
    * parent element).
    *
+   * Only the parent pointer is changed, so this takes constant time unless
+   * the document this object leaves or joins has built its element index,
+   * in which case each element of the subtree is removed from or added to
+   * that index.
+   *
    * @param parent the SBML_Lang object to use
    */
   virtual void connectToParent (SBase* parent);
 
 
+  /**
+   * Takes this SBML_Lang object and the objects below it out of the
+   * document they belong to, as its parent hands it over to the caller
+   * (see ListOf::remove()).  The parent pointer is left alone, but the
+   * object no longer takes its document from its parent, so
+   * getSBMLDocument() returns @c NULL until it is connected to a parent
+   * again.
+   */
+  void releaseFromParent ();
+
+
   /**
    * Sets this SBML_Lang object to child SBML_Lang objects (if any).
    * (Creates a child-parent relationship by the parent)
@@ -1593,8 +1749,13 @@ public:
 
 
   /** @cond doxygenLibsbmlInternal */
-  /* gets the SBMLnamespaces - internal use only*/
-  virtual SBMLNamespaces * getSBMLNamespaces() const;
+  /* gets the SBMLnamespaces - internal use only; the object may be shared
+   * with other elements and documents */
+  virtual const SBMLNamespaces * getSBMLNamespaces() const;
+
+  /* gets the SBMLnamespaces for modification - internal use only; they are
+   * copied first if they are shared (copy-on-write) */
+  virtual SBMLNamespaces * getSBMLNamespaces();
   /** @endcond */
 
 
@@ -1606,8 +1767,9 @@ public:
    * virtual method, as every SBase element has different parents, and
    * therefore different methods of removing itself.  Will fail (and not
    * delete itself) if it has no parent object.  This function is designed to
-   * be overridden, but for all objects whose parent is of the class ListOf,
-   * the default implementation will work.
+   * be overridden, but the default implementation will work for all objects
+   * whose parent is of the class ListOf, and for the other objects whose
+   * parent gives them up through removeChildObject().
    *
    * @copydetails doc_returns_success_code
    * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
@@ -1715,6 +1877,18 @@ public:
   int unsetUserData();
 
 
+  /**
+   * Makes the copies made with cloneCopyOnWrite() that still share the
+   * branch holding this element take their own copy of it.  Does nothing
+   * unless such copies exist.
+   *
+   * The generated setters and the create, add and remove functions call
+   * this before making their change; it only needs to be called directly
+   * by code that changes an element by other means.
+   */
+  void prepareForChange();
+
+
   /**
    * Returns the SBMLErrorLog used to log errors while reading and
    * validating SBML_Lang.
@@ -1764,6 +1938,21 @@ protected:
   SBase(const SBase& orig);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor.  The new object takes over the identifiers, notes
+   * and annotation of @p orig but, like a copy, has no parent.  @p orig is
+   * left as a valid element without them, in the place it had; it can be
+   * taken out with removeFromParentAndDelete().  The copies made with
+   * cloneCopyOnWrite() that share @p orig take their own copies first,
+   * which may throw @c std::bad_alloc.
+   *
+   * @param orig the object to move.
+   */
+  SBase(SBase&& orig);
+#endif
+
+
   /**
    * Subclasses should override this method to create, store, and then
    * return an SBML_Lang object corresponding to the next XMLToken in the
@@ -1979,6 +2168,139 @@ protected:
   SBase* getRootElement();
 
 
+  /**
+   * Informs the indices that refer to this object by its identifier (the
+   * one kept by a parent ListOf and the one kept by the SBMLDocument) that
+   * the "id" is about to change.
+   *
+   * Subclasses that store the identifier themselves must call this before
+   * storing the new value.
+   *
+   * @param oldId the identifier this object currently has.
+   * @param newId the identifier this object is about to be given.
+   */
+  void updateIdIndices(const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Informs the indices that refer to this object that its identifiers and
+   * references have been moved to another object.  The parent ListOf drops
+   * the identifier @p movedId and its reference indices, and the
+   * SBMLDocument drops its element index, to rebuild them when next used.
+   *
+   * @param movedId the identifier this object had before the move.
+   */
+  void releaseIndexEntries(const std::string& movedId);
+
+
+  /**
+   * Makes the copies made with cloneCopyOnWrite() that share the branch
+   * holding this object take their own copies, starting from the root so
+   * that the copies taken on the way share nothing below this object.
+   * Called before anything in the branch changes.
+   */
+  void detachSharedCopies();
+
+
+  /**
+   * Makes the copies that share the children of this object take their own
+   * copies of them.  Does nothing here; overridden by ListOf.
+   */
+  virtual void unshareChildren();
+
+
+  /**
+   * Predicate returning @c true while the calling thread is making a copy
+   * with cloneCopyOnWrite(), during which copies share rather than copy
+   * and nothing shared changes.
+   */
+  static bool isCopyingOnWrite();
+
+
+  /**
+   * Starts and ends a stretch of copying on write in the calling thread
+   * (see isCopyingOnWrite()).  The calls nest.
+   */
+  static void beginCopyingOnWrite();
+
+  static void endCopyingOnWrite();
+
+
+  /**
+   * Informs the index that the parent ListOf keeps of the given SIdRef
+   * attribute, and the index of the references of the SBMLDocument, that
+   * its value is about to change for this object.
+   *
+   * Subclasses must call this from the setters of their SIdRef attributes
+   * before storing the new value.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param oldRef the value the attribute currently has.
+   * @param newRef the value the attribute is about to be given.
+   */
+  void updateReferenceIndices(const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef);
+
+
+  /**
+   * Informs the index of the SBMLDocument that the "metaid" of this object
+   * is about to change.
+   *
+   * @param oldMetaId the metaid this object currently has.
+   * @param newMetaId the metaid this object is about to be given.
+   */
+  void updateMetaIdIndex(const std::string& oldMetaId,
+                         const std::string& newMetaId);
+
+
+  /**
+   * Returns the element index of the SBMLDocument this object belongs to,
+   * or @c NULL if there is no such document (or this object is the
+   * document itself).
+   */
+  SBMLElementIndex* getDocumentElementIndex() const;
+
+
+  /**
+   * Returns the arena new elements of the SBMLDocument this object belongs
+   * to are allocated from, or @c NULL if there is no such document.
+   */
+  SBMLArena* getDocumentArena() const;
+
+
+  /**
+   * Returns the namespaces to pass to the constructor of a new child of
+   * this object.  They are shared rather than copied, so they must not be
+   * modified; the constructor takes its own reference to them.
+   */
+  SBMLNamespaces* getSharedSBMLNamespaces() const;
+
+
+  /**
+   * Returns the SBMLDocument this object belongs to without checking
+   * whether it has been deleted.  The document is taken from the parent
+   * and cached until an element leaves that document or a document is
+   * destroyed.
+   */
+  SBMLDocument* deriveSBMLDocument() const;
+
+
+  /**
+   * Returns the parent this object takes its document from: its parent,
+   * unless the parent has handed it over to the caller.
+   */
+  SBase* getHoldingParent() const;
+
+
+  /**
+   * Takes this object and the objects below it out of the index of the
+   * document they belong to, and makes the objects below it derive their
+   * document again, before this object leaves its parent.
+   */
+  void leaveSBMLDocument();
+
+
   // ------------------------------------------------------------------
 
 
@@ -1986,7 +2308,11 @@ protected:
   std::string     mId;
   <NS>XMLNode*        m<Notes>;
   <NS>XMLNode*        m<Annotation>;
-  SBMLDocument*   mSBML;
+#ifdef LIBSBML_HAS_THREAD_SAFE_COUNTERS
+  mutable std::atomic<SBMLDocument*> mSBML;
+#else
+  mutable SBMLDocument* mSBML;
+#endif
   SBMLNamespaces* mSBMLNamespaces;
   void*           mUserData;
 
@@ -1996,6 +2322,22 @@ protected:
   /* store the parent SBML_Lang object */
   SBase* mParentSBMLObject;
   bool mHasBeenDeleted;
+  /* set once the parent has handed this object over to the caller */
+  bool mReleasedByParent;
+
+  /* mSBML is valid for an object with a parent while these match the
+   * epoch of that document and the number of documents destroyed (see
+   * SBMLElementIndex) */
+  mutable SBMLCounter mDocumentEpoch;
+  mutable SBMLCounter mNumDestroyedDocuments;
+
+  /* the number of ListOf objects still sharing the items of another */
+  static SBMLCounter mNumSharingLists;
+
+  /* counts the objects sharing m<Notes> / m<Annotation>, or NULL if the
+   * node is not shared */
+  mutable SBMLCounter* m<Notes>Shares;
+  mutable SBMLCounter* m<Annotation>Shares;
 
   std::string mEmptyString;
 
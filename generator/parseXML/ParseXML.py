@@ -842,6 +842,12 @@ class ParseXML():
         if attr_abstract and attr_element in self.concrete_dict:
             attribute_dict['concrete'] = self.concrete_dict[attr_element]
 
+        # the values of an array may be stored in the type named by the
+        # value of an enum attribute, e.g. elementTypeFrom="dataType"
+        element_type_from = self.get_value(node, 'elementTypeFrom')
+        if element_type_from:
+            attribute_dict['element_type_from'] = element_type_from
+
         return attribute_dict
 
     def update_element_description(self, node, version_count, element):
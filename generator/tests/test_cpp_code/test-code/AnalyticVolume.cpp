@@ -777,21 +777,38 @@ AnalyticVolume::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "functionType")
-  {
-    value = isSetFunctionType();
-  }
-  else if (attributeName == "ordinal")
+  switch (attributeName.size())
   {
-    value = isSetOrdinal();
-  }
-  else if (attributeName == "domainType")
-  {
-    value = isSetDomainType();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "ordinal")
+    {
+      value = isSetOrdinal();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "domainType")
+    {
+      value = isSetDomainType();
+    }
+
+    break;
+  case 12:
+    if (attributeName == "functionType")
+    {
+      value = isSetFunctionType();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -916,21 +933,38 @@ AnalyticVolume::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "functionType")
-  {
-    value = unsetFunctionType();
-  }
-  else if (attributeName == "ordinal")
+  switch (attributeName.size())
   {
-    value = unsetOrdinal();
-  }
-  else if (attributeName == "domainType")
-  {
-    value = unsetDomainType();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "ordinal")
+    {
+      value = unsetOrdinal();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "domainType")
+    {
+      value = unsetDomainType();
+    }
+
+    break;
+  case 12:
+    if (attributeName == "functionType")
+    {
+      value = unsetFunctionType();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -161,6 +161,59 @@ Arc::operator=(const Arc& rhs)
 }
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for Arc.
+ */
+Arc::Arc(Arc&& orig)
+  : SBase( std::move(orig) )
+  , mClazz ( std::move(orig.mClazz) )
+  , mSource ( std::move(orig.mSource) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mGlyphs ( std::move(orig.mGlyphs) )
+  , mStart ( orig.mStart )
+  , mPoints ( std::move(orig.mPoints) )
+  , mEnd ( orig.mEnd )
+  , mPorts ( std::move(orig.mPorts) )
+{
+  orig.mStart = NULL;
+  orig.mEnd = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for Arc.
+ */
+Arc&
+Arc::operator=(Arc&& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(std::move(rhs));
+    mClazz = std::move(rhs.mClazz);
+    mSource = std::move(rhs.mSource);
+    mTarget = std::move(rhs.mTarget);
+    mGlyphs = std::move(rhs.mGlyphs);
+    mPoints = std::move(rhs.mPoints);
+    mPorts = std::move(rhs.mPorts);
+    delete mStart;
+    mStart = rhs.mStart;
+    rhs.mStart = NULL;
+    delete mEnd;
+    mEnd = rhs.mEnd;
+    rhs.mEnd = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this Arc object.
  */
@@ -269,6 +322,8 @@ Arc::isSetTarget() const
 int
 Arc::setId(const std::string& id)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidXMLID(id)))
   {
     return LIBSBGN_INVALID_ATTRIBUTE_VALUE;
@@ -287,6 +342,7 @@ Arc::setId(const std::string& id)
 int
 Arc::setClazz(const std::string& clazz)
 {
+  prepareForChange();
   mClazz = clazz;
   return LIBSBGN_OPERATION_SUCCESS;
 }
@@ -298,6 +354,8 @@ Arc::setClazz(const std::string& clazz)
 int
 Arc::setSource(const std::string& source)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidXMLID(source)))
   {
     return LIBSBGN_INVALID_ATTRIBUTE_VALUE;
@@ -316,6 +374,8 @@ Arc::setSource(const std::string& source)
 int
 Arc::setTarget(const std::string& target)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidXMLID(target)))
   {
     return LIBSBGN_INVALID_ATTRIBUTE_VALUE;
@@ -334,6 +394,7 @@ Arc::setTarget(const std::string& target)
 int
 Arc::unsetId()
 {
+  prepareForChange();
   mId.erase();
 
   if (mId.empty() == true)
@@ -353,6 +414,7 @@ Arc::unsetId()
 int
 Arc::unsetClazz()
 {
+  prepareForChange();
   mClazz.erase();
 
   if (mClazz.empty() == true)
@@ -372,6 +434,7 @@ Arc::unsetClazz()
 int
 Arc::unsetSource()
 {
+  prepareForChange();
   mSource.erase();
 
   if (mSource.empty() == true)
@@ -391,6 +454,7 @@ Arc::unsetSource()
 int
 Arc::unsetTarget()
 {
+  prepareForChange();
   mTarget.erase();
 
   if (mTarget.empty() == true)
@@ -470,6 +534,8 @@ Arc::isSetEnd() const
 int
 Arc::setStart(const Point* start)
 {
+  prepareForChange();
+
   if (mStart == start)
   {
     return LIBSBGN_OPERATION_SUCCESS;
@@ -501,6 +567,8 @@ Arc::setStart(const Point* start)
 int
 Arc::setEnd(const Point* end)
 {
+  prepareForChange();
+
   if (mEnd == end)
   {
     return LIBSBGN_OPERATION_SUCCESS;
@@ -533,12 +601,14 @@ Arc::setEnd(const Point* end)
 Point*
 Arc::createStart()
 {
+  prepareForChange();
+
   if (mStart != NULL)
   {
     delete mStart;
   }
 
-  mStart = new Point(getSbgnNamespaces());
+  mStart = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
 
   mStart->setElementName("start");
 
@@ -555,12 +625,14 @@ Arc::createStart()
 Point*
 Arc::createEnd()
 {
+  prepareForChange();
+
   if (mEnd != NULL)
   {
     delete mEnd;
   }
 
-  mEnd = new Point(getSbgnNamespaces());
+  mEnd = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
 
   mEnd->setElementName("end");
 
@@ -576,6 +648,7 @@ Arc::createEnd()
 int
 Arc::unsetStart()
 {
+  prepareForChange();
   delete mStart;
   mStart = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -588,6 +661,7 @@ Arc::unsetStart()
 int
 Arc::unsetEnd()
 {
+  prepareForChange();
   delete mEnd;
   mEnd = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -713,7 +787,7 @@ Arc::createGlyph()
 
   try
   {
-    g = new Glyph(getSbgnNamespaces());
+    g = new (getDocumentArena()) Glyph(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -844,7 +918,7 @@ Arc::createNext()
 
   try
   {
-    p = new Point(getSbgnNamespaces());
+    p = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -989,7 +1063,7 @@ Arc::createPort()
 
   try
   {
-    p = new Port(getSbgnNamespaces());
+    p = new (getDocumentArena()) Port(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -1304,25 +1378,39 @@ Arc::getAttribute(const std::string& attributeName, std::string& value) const
     return return_value;
   }
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = getId();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "class")
-  {
-    value = getClazz();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "source")
-  {
-    value = getSource();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "target")
-  {
-    value = getTarget();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBGN_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 5:
+    if (attributeName == "class")
+    {
+      value = getClazz();
+      return_value = LIBSBGN_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      value = getSource();
+      return_value = LIBSBGN_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "target")
+    {
+      value = getTarget();
+      return_value = LIBSBGN_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1342,21 +1430,35 @@ Arc::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = isSetId();
-  }
-  else if (attributeName == "class")
-  {
-    value = isSetClazz();
-  }
-  else if (attributeName == "source")
-  {
-    value = isSetSource();
-  }
-  else if (attributeName == "target")
-  {
-    value = isSetTarget();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "class")
+    {
+      value = isSetClazz();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      value = isSetSource();
+    }
+    else if (attributeName == "target")
+    {
+      value = isSetTarget();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1444,21 +1546,35 @@ Arc::setAttribute(const std::string& attributeName, const std::string& value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "class")
-  {
-    return_value = setClazz(value);
-  }
-  else if (attributeName == "source")
-  {
-    return_value = setSource(value);
-  }
-  else if (attributeName == "target")
+  switch (attributeName.size())
   {
-    return_value = setTarget(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 5:
+    if (attributeName == "class")
+    {
+      return_value = setClazz(value);
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      return_value = setSource(value);
+    }
+    else if (attributeName == "target")
+    {
+      return_value = setTarget(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1478,21 +1594,35 @@ Arc::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "class")
+  switch (attributeName.size())
   {
-    value = unsetClazz();
-  }
-  else if (attributeName == "source")
-  {
-    value = unsetSource();
-  }
-  else if (attributeName == "target")
-  {
-    value = unsetTarget();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "class")
+    {
+      value = unsetClazz();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      value = unsetSource();
+    }
+    else if (attributeName == "target")
+    {
+      value = unsetTarget();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1803,7 +1933,7 @@ Arc::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mStart;
-    mStart = new Point(getSbgnNamespaces());
+    mStart = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
     mStart->setElementName(name);
     obj = mStart;
   }
@@ -1816,7 +1946,7 @@ Arc::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mEnd;
-    mEnd = new Point(getSbgnNamespaces());
+    mEnd = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
     mEnd->setElementName(name);
     obj = mEnd;
   }
@@ -1893,25 +2023,24 @@ Arc::readAttributes(
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
+        log->remove(SbgnUnknownCoreAttribute, n);
         log->logError(SbgnmlMapLOArcsAllowedCoreAttributes, level, version,
           details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
+        log->remove(SbgnUnknownCoreAttribute, n);
         log->logError(SbgnmlArcAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -123,6 +123,28 @@ public:
   Arc& operator=(const Arc& rhs);
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for Arc.
+   *
+   * @param orig the Arc instance to move; it is left as an empty Arc in the
+   * place it had.
+   */
+  Arc(Arc&& orig);
+
+
+  /**
+   * Move assignment operator for Arc.
+   *
+   * @param rhs the Arc object whose values are to be moved into this one; it
+   * is left as an empty Arc in the place it had.
+   */
+  Arc& operator=(Arc&& rhs);
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this Arc object.
    *
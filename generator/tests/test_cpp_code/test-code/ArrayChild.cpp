@@ -37,6 +37,7 @@
 #include <sbml/packages/test/sbml/ArrayChild.h>
 #include <sbml/packages/test/validator/TestSBMLError.h>
 #include <sbml/util/ElementFilter.h>
+#include <sbml/util/util.h>
 
 
 using namespace std;
@@ -430,10 +431,40 @@ ArrayChild::write(XMLOutputStream& stream) const
 
   if (isSetNumber())
   {
+    std::string chunk;
+    char value[32];
+    chunk.reserve(4096);
     for (int i = 0; i < mNumberLength; ++i)
     {
-      stream << (double)mNumber[i] << " ";
+      double number = (double)mNumber[i];
+
+      if (util_isNaN(number))
+      {
+        chunk.append("NaN ");
+      }
+      else if (util_isInf(number) > 0)
+      {
+        chunk.append("INF ");
+      }
+      else if (util_isInf(number) < 0)
+      {
+        chunk.append("-INF ");
+      }
+      else
+      {
+        int numChars = c_locale_snprintf(value, sizeof(value), "%.15g ",
+          number);
+        chunk.append(value, numChars);
+      }
+
+      if (chunk.size() > 4000)
+      {
+        stream << chunk;
+        chunk.clear();
+      }
     }
+
+    stream << chunk;
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -1047,27 +1078,49 @@ ArrayChild::writeAttributes(XMLOutputStream& stream) const
 void
 ArrayChild::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  double val;
-  vector<double> valuesVector;
+  const char* current = text.c_str();
+  char* next = NULL;
+  unsigned int length = 0;
+  bool inValue = false;
 
-  while (strStream >> val)
+  for (const char* c = current; *c != '\0'; ++c)
   {
-    valuesVector.push_back(val);
-  }
+    bool isSpace = (isspace((unsigned char)*c) != 0);
+    if (!isSpace && !inValue)
+    {
+      ++length;
+    }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+    inValue = !isSpace;
+  }
 
   if (length > 0)
   {
     double* data = new double[length];
-    for (unsigned int i = 0; i < length; ++i)
+    unsigned int numValues = 0;
+    while (numValues < length)
     {
-      data[i] = valuesVector.at(i);
+      double value = c_locale_strtod(current, &next);
+      if (next == current)
+      {
+        break;
+      }
+
+      data[numValues++] = (double)value;
+      current = next;
     }
 
-    setNumber(data, length);
-    delete[] data;
+    if (numValues > 0)
+    {
+      delete[] mNumber;
+      mNumber = data;
+      mNumberLength = (int)numValues;
+      mIsSetNumberLength = true;
+    }
+    else
+    {
+      delete[] data;
+    }
   }
 }
 
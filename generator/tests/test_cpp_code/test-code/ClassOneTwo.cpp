@@ -949,25 +949,39 @@ ClassOneTwo::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "attStr")
-  {
-    value = getAttStr();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "attUnit")
-  {
-    value = getAttUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "attEnum")
-  {
-    value = getAttEnumAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 6:
+    if (attributeName == "attStr")
+    {
+      value = getAttStr();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 7:
+    if (attributeName == "attUnit")
+    {
+      value = getAttUnit();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "attEnum")
+    {
+      value = getAttEnumAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -988,37 +1002,54 @@ ClassOneTwo::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "att1")
-  {
-    value = isSetAtt1();
-  }
-  else if (attributeName == "attStr")
-  {
-    value = isSetAttStr();
-  }
-  else if (attributeName == "attInt")
+  switch (attributeName.size())
   {
-    value = isSetAttInt();
-  }
-  else if (attributeName == "att2")
-  {
-    value = isSetAtt2();
-  }
-  else if (attributeName == "attDbl")
-  {
-    value = isSetAttDbl();
-  }
-  else if (attributeName == "attUnit")
-  {
-    value = isSetAttUnit();
-  }
-  else if (attributeName == "attEnum")
-  {
-    value = isSetAttEnum();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "att1")
+    {
+      value = isSetAtt1();
+    }
+    else if (attributeName == "att2")
+    {
+      value = isSetAtt2();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "attStr")
+    {
+      value = isSetAttStr();
+    }
+    else if (attributeName == "attInt")
+    {
+      value = isSetAttInt();
+    }
+    else if (attributeName == "attDbl")
+    {
+      value = isSetAttDbl();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "attUnit")
+    {
+      value = isSetAttUnit();
+    }
+    else if (attributeName == "attEnum")
+    {
+      value = isSetAttEnum();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1127,21 +1158,35 @@ ClassOneTwo::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "attStr")
-  {
-    return_value = setAttStr(value);
-  }
-  else if (attributeName == "attUnit")
-  {
-    return_value = setAttUnit(value);
-  }
-  else if (attributeName == "attEnum")
+  switch (attributeName.size())
   {
-    return_value = setAttEnum(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 6:
+    if (attributeName == "attStr")
+    {
+      return_value = setAttStr(value);
+    }
+
+    break;
+  case 7:
+    if (attributeName == "attUnit")
+    {
+      return_value = setAttUnit(value);
+    }
+    else if (attributeName == "attEnum")
+    {
+      return_value = setAttEnum(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1161,37 +1206,54 @@ ClassOneTwo::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "att1")
-  {
-    value = unsetAtt1();
-  }
-  else if (attributeName == "attStr")
-  {
-    value = unsetAttStr();
-  }
-  else if (attributeName == "attInt")
-  {
-    value = unsetAttInt();
-  }
-  else if (attributeName == "att2")
-  {
-    value = unsetAtt2();
-  }
-  else if (attributeName == "attDbl")
-  {
-    value = unsetAttDbl();
-  }
-  else if (attributeName == "attUnit")
-  {
-    value = unsetAttUnit();
-  }
-  else if (attributeName == "attEnum")
+  switch (attributeName.size())
   {
-    value = unsetAttEnum();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "att1")
+    {
+      value = unsetAtt1();
+    }
+    else if (attributeName == "att2")
+    {
+      value = unsetAtt2();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "attStr")
+    {
+      value = unsetAttStr();
+    }
+    else if (attributeName == "attInt")
+    {
+      value = unsetAttInt();
+    }
+    else if (attributeName == "attDbl")
+    {
+      value = unsetAttDbl();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "attUnit")
+    {
+      value = unsetAttUnit();
+    }
+    else if (attributeName == "attEnum")
+    {
+      value = unsetAttEnum();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
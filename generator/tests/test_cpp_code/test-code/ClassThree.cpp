@@ -719,30 +719,47 @@ ClassThree::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "number")
+  switch (attributeName.size())
   {
-    value = getNumberAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getNameAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "badName")
-  {
-    value = getBadNameAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "otherNum")
-  {
-    value = getOtherNumAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "longEnum")
-  {
-    value = getLongEnumAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = getNameAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 6:
+    if (attributeName == "number")
+    {
+      value = getNumberAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 7:
+    if (attributeName == "badName")
+    {
+      value = getBadNameAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 8:
+    if (attributeName == "otherNum")
+    {
+      value = getOtherNumAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "longEnum")
+    {
+      value = getLongEnumAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -763,25 +780,42 @@ ClassThree::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "number")
+  switch (attributeName.size())
   {
-    value = isSetNumber();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "badName")
-  {
-    value = isSetBadName();
-  }
-  else if (attributeName == "otherNum")
-  {
-    value = isSetOtherNum();
-  }
-  else if (attributeName == "longEnum")
-  {
-    value = isSetLongEnum();
+  case 4:
+    if (attributeName == "name")
+    {
+      value = isSetName();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "number")
+    {
+      value = isSetNumber();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "badName")
+    {
+      value = isSetBadName();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "otherNum")
+    {
+      value = isSetOtherNum();
+    }
+    else if (attributeName == "longEnum")
+    {
+      value = isSetLongEnum();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -870,25 +904,42 @@ ClassThree::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "number")
+  switch (attributeName.size())
   {
-    return_value = setNumber(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "badName")
-  {
-    return_value = setBadName(value);
-  }
-  else if (attributeName == "otherNum")
-  {
-    return_value = setOtherNum(value);
-  }
-  else if (attributeName == "longEnum")
-  {
-    return_value = setLongEnum(value);
+  case 4:
+    if (attributeName == "name")
+    {
+      return_value = setName(value);
+    }
+
+    break;
+  case 6:
+    if (attributeName == "number")
+    {
+      return_value = setNumber(value);
+    }
+
+    break;
+  case 7:
+    if (attributeName == "badName")
+    {
+      return_value = setBadName(value);
+    }
+
+    break;
+  case 8:
+    if (attributeName == "otherNum")
+    {
+      return_value = setOtherNum(value);
+    }
+    else if (attributeName == "longEnum")
+    {
+      return_value = setLongEnum(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -908,25 +959,42 @@ ClassThree::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "number")
+  switch (attributeName.size())
   {
-    value = unsetNumber();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "badName")
-  {
-    value = unsetBadName();
-  }
-  else if (attributeName == "otherNum")
-  {
-    value = unsetOtherNum();
-  }
-  else if (attributeName == "longEnum")
-  {
-    value = unsetLongEnum();
+  case 4:
+    if (attributeName == "name")
+    {
+      value = unsetName();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "number")
+    {
+      value = unsetNumber();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "badName")
+    {
+      value = unsetBadName();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "otherNum")
+    {
+      value = unsetOtherNum();
+    }
+    else if (attributeName == "longEnum")
+    {
+      value = unsetLongEnum();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
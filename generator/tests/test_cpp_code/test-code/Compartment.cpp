@@ -139,6 +139,56 @@ Compartment::operator=(const Compartment& rhs)
 }
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for Compartment.
+ */
+Compartment::Compartment(Compartment&& orig)
+  : SBase( std::move(orig) )
+  , mSize ( orig.mSize )
+  , mIsSetSize ( orig.mIsSetSize )
+  , mVolume ( orig.mVolume )
+  , mIsSetVolume ( orig.mIsSetVolume )
+  , mUnits ( std::move(orig.mUnits) )
+  , mSpatialDimensions ( orig.mSpatialDimensions )
+  , mIsSetSpatialDimensions ( orig.mIsSetSpatialDimensions )
+  , mConstant ( orig.mConstant )
+  , mIsSetConstant ( orig.mIsSetConstant )
+  , mOutside ( std::move(orig.mOutside) )
+  , mCompartmentType ( std::move(orig.mCompartmentType) )
+{
+}
+
+
+/*
+ * Move assignment operator for Compartment.
+ */
+Compartment&
+Compartment::operator=(Compartment&& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(std::move(rhs));
+    mSize = rhs.mSize;
+    mIsSetSize = rhs.mIsSetSize;
+    mVolume = rhs.mVolume;
+    mIsSetVolume = rhs.mIsSetVolume;
+    mUnits = std::move(rhs.mUnits);
+    mSpatialDimensions = rhs.mSpatialDimensions;
+    mIsSetSpatialDimensions = rhs.mIsSetSpatialDimensions;
+    mConstant = rhs.mConstant;
+    mIsSetConstant = rhs.mIsSetConstant;
+    mOutside = std::move(rhs.mOutside);
+    mCompartmentType = std::move(rhs.mCompartmentType);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this Compartment object.
  */
@@ -307,6 +357,7 @@ Compartment::isSetCompartmentType() const
 int
 Compartment::setSize(double size)
 {
+  prepareForChange();
   mSize = size;
   mIsSetSize = true;
   return LIBSBML_OPERATION_SUCCESS;
@@ -319,6 +370,7 @@ Compartment::setSize(double size)
 int
 Compartment::setVolume(double volume)
 {
+  prepareForChange();
   mVolume = volume;
   mIsSetVolume = true;
   return LIBSBML_OPERATION_SUCCESS;
@@ -331,6 +383,8 @@ Compartment::setVolume(double volume)
 int
 Compartment::setUnits(const std::string& units)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidInternalUnitSId(units)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -349,6 +403,7 @@ Compartment::setUnits(const std::string& units)
 int
 Compartment::setSpatialDimensions(unsigned int spatialDimensions)
 {
+  prepareForChange();
   mSpatialDimensions = spatialDimensions;
   mIsSetSpatialDimensions = true;
   return LIBSBML_OPERATION_SUCCESS;
@@ -361,6 +416,7 @@ Compartment::setSpatialDimensions(unsigned int spatialDimensions)
 int
 Compartment::setConstant(bool constant)
 {
+  prepareForChange();
   mConstant = constant;
   mIsSetConstant = true;
   return LIBSBML_OPERATION_SUCCESS;
@@ -373,12 +429,15 @@ Compartment::setConstant(bool constant)
 int
 Compartment::setOutside(const std::string& outside)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidInternalSId(outside)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    updateReferenceIndices("outside", mOutside, outside);
     mOutside = outside;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -391,12 +450,16 @@ Compartment::setOutside(const std::string& outside)
 int
 Compartment::setCompartmentType(const std::string& compartmentType)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidInternalSId(compartmentType)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    updateReferenceIndices("compartmentType", mCompartmentType,
+      compartmentType);
     mCompartmentType = compartmentType;
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -409,6 +472,7 @@ Compartment::setCompartmentType(const std::string& compartmentType)
 int
 Compartment::unsetSize()
 {
+  prepareForChange();
   mSize = util_NaN();
   mIsSetSize = false;
 
@@ -429,6 +493,7 @@ Compartment::unsetSize()
 int
 Compartment::unsetVolume()
 {
+  prepareForChange();
   mVolume = util_NaN();
   mIsSetVolume = false;
 
@@ -449,6 +514,7 @@ Compartment::unsetVolume()
 int
 Compartment::unsetUnits()
 {
+  prepareForChange();
   mUnits.erase();
 
   if (mUnits.empty() == true)
@@ -468,6 +534,7 @@ Compartment::unsetUnits()
 int
 Compartment::unsetSpatialDimensions()
 {
+  prepareForChange();
   mSpatialDimensions = SBML_INT_MAX;
   mIsSetSpatialDimensions = false;
 
@@ -488,6 +555,7 @@ Compartment::unsetSpatialDimensions()
 int
 Compartment::unsetConstant()
 {
+  prepareForChange();
   mConstant = false;
   mIsSetConstant = false;
 
@@ -508,6 +576,8 @@ Compartment::unsetConstant()
 int
 Compartment::unsetOutside()
 {
+  prepareForChange();
+  updateReferenceIndices("outside", mOutside, "");
   mOutside.erase();
 
   if (mOutside.empty() == true)
@@ -527,6 +597,8 @@ Compartment::unsetOutside()
 int
 Compartment::unsetCompartmentType()
 {
+  prepareForChange();
+  updateReferenceIndices("compartmentType", mCompartmentType, "");
   mCompartmentType.erase();
 
   if (mCompartmentType.empty() == true)
@@ -807,33 +879,59 @@ Compartment::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "size")
+  switch (attributeName.size())
   {
-    value = isSetSize();
-  }
-  else if (attributeName == "volume")
-  {
-    value = isSetVolume();
-  }
-  else if (attributeName == "units")
-  {
-    value = isSetUnits();
-  }
-  else if (attributeName == "spatialDimensions")
-  {
-    value = isSetSpatialDimensions();
-  }
-  else if (attributeName == "constant")
-  {
-    value = isSetConstant();
-  }
-  else if (attributeName == "outside")
-  {
-    value = isSetOutside();
-  }
-  else if (attributeName == "compartmentType")
-  {
-    value = isSetCompartmentType();
+  case 4:
+    if (attributeName == "size")
+    {
+      value = isSetSize();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "units")
+    {
+      value = isSetUnits();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "volume")
+    {
+      value = isSetVolume();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "outside")
+    {
+      value = isSetOutside();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "constant")
+    {
+      value = isSetConstant();
+    }
+
+    break;
+  case 15:
+    if (attributeName == "compartmentType")
+    {
+      value = isSetCompartmentType();
+    }
+
+    break;
+  case 17:
+    if (attributeName == "spatialDimensions")
+    {
+      value = isSetSpatialDimensions();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -972,33 +1070,59 @@ Compartment::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "size")
-  {
-    value = unsetSize();
-  }
-  else if (attributeName == "volume")
-  {
-    value = unsetVolume();
-  }
-  else if (attributeName == "units")
+  switch (attributeName.size())
   {
-    value = unsetUnits();
-  }
-  else if (attributeName == "spatialDimensions")
-  {
-    value = unsetSpatialDimensions();
-  }
-  else if (attributeName == "constant")
-  {
-    value = unsetConstant();
-  }
-  else if (attributeName == "outside")
-  {
-    value = unsetOutside();
-  }
-  else if (attributeName == "compartmentType")
-  {
-    value = unsetCompartmentType();
+  case 4:
+    if (attributeName == "size")
+    {
+      value = unsetSize();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "units")
+    {
+      value = unsetUnits();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "volume")
+    {
+      value = unsetVolume();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "outside")
+    {
+      value = unsetOutside();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "constant")
+    {
+      value = unsetConstant();
+    }
+
+    break;
+  case 15:
+    if (attributeName == "compartmentType")
+    {
+      value = unsetCompartmentType();
+    }
+
+    break;
+  case 17:
+    if (attributeName == "spatialDimensions")
+    {
+      value = unsetSpatialDimensions();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1038,6 +1162,25 @@ Compartment::addExpectedAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the names of the SIdRef attributes of this element
+ */
+void
+Compartment::addReferenceAttributes(std::vector<std::string>& attributes) const
+{
+  SBase::addReferenceAttributes(attributes);
+
+  attributes.push_back("outside");
+
+  attributes.push_back("compartmentType");
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1065,25 +1208,24 @@ Compartment::readAttributes(
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
+        log->remove(SBMLUnknownCoreAttribute, n);
         log->logError(CoreModelLOCompartmentsAllowedCoreAttributes, level,
           version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
+        log->remove(SBMLUnknownCoreAttribute, n);
         log->logError(CoreCompartmentAllowedAttributes, level, version,
           details, getLine(), getColumn());
       }
@@ -1100,9 +1242,9 @@ Compartment::readAttributes(
   if ( mIsSetSize == false && log)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       std::string message = "Core attribute 'size' from the <Compartment> "
         "element must be an integer.";
       log->logError(CoreCompartmentSizeMustBeDouble, level, version, message,
@@ -1120,9 +1262,9 @@ Compartment::readAttributes(
   if ( mIsSetVolume == false && log)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       std::string message = "Core attribute 'volume' from the <Compartment> "
         "element must be an integer.";
       log->logError(CoreCompartmentVolumeMustBeDouble, level, version, message,
@@ -1168,9 +1310,9 @@ Compartment::readAttributes(
   if ( mIsSetSpatialDimensions == false && log)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       std::string message = "Core attribute 'spatialDimensions' from the "
         "<Compartment> element must be an integer.";
       log->logError(CoreCompartmentSpatialDimensionsMustBeNonNegativeInteger,
@@ -1188,9 +1330,9 @@ Compartment::readAttributes(
   if (mIsSetConstant == false)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       log->logError(CoreCompartmentConstantMustBeBoolean, level, version);
     }
     else
@@ -125,6 +125,28 @@ public:
   Compartment& operator=(const Compartment& rhs);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for Compartment.
+   *
+   * @param orig the Compartment instance to move; it is left as an empty
+   * Compartment in the place it had.
+   */
+  Compartment(Compartment&& orig);
+
+
+  /**
+   * Move assignment operator for Compartment.
+   *
+   * @param rhs the Compartment object whose values are to be moved into this
+   * one; it is left as an empty Compartment in the place it had.
+   */
+  Compartment& operator=(Compartment&& rhs);
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this Compartment object.
    *
@@ -769,6 +791,18 @@ protected:
 
 
 
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the names of the SIdRef attributes of this element
+   */
+  virtual void addReferenceAttributes(std::vector<std::string>& attributes)
+    const;
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibsbmlInternal */
 
   /**
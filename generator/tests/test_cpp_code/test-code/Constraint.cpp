@@ -135,6 +135,47 @@ Constraint::operator=(const Constraint& rhs)
 }
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for Constraint.
+ */
+Constraint::Constraint(Constraint&& orig)
+  : SBase( std::move(orig) )
+  , mMath ( orig.mMath )
+  , mMessage ( orig.mMessage )
+{
+  orig.mMath = NULL;
+  orig.mMessage = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for Constraint.
+ */
+Constraint&
+Constraint::operator=(Constraint&& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(std::move(rhs));
+    delete mMath;
+    mMath = rhs.mMath;
+    rhs.mMath = NULL;
+    delete mMessage;
+    mMessage = rhs.mMessage;
+    rhs.mMessage = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this Constraint object.
  */
@@ -223,6 +264,8 @@ Constraint::isSetMessage() const
 int
 Constraint::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 {
+  prepareForChange();
+
   if (mMath == math)
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -252,6 +295,8 @@ Constraint::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 int
 Constraint::setMessage(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* message)
 {
+  prepareForChange();
+
   if (mMessage == message)
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -277,6 +322,7 @@ Constraint::setMessage(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* message)
 int
 Constraint::unsetMath()
 {
+  prepareForChange();
   delete mMath;
   mMath = NULL;
   return LIBSBML_OPERATION_SUCCESS;
@@ -289,6 +335,7 @@ Constraint::unsetMath()
 int
 Constraint::unsetMessage()
 {
+  prepareForChange();
   delete mMessage;
   mMessage = NULL;
   return LIBSBML_OPERATION_SUCCESS;
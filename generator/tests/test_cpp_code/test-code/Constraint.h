@@ -117,6 +117,28 @@ public:
   Constraint& operator=(const Constraint& rhs);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for Constraint.
+   *
+   * @param orig the Constraint instance to move; it is left as an empty
+   * Constraint in the place it had.
+   */
+  Constraint(Constraint&& orig);
+
+
+  /**
+   * Move assignment operator for Constraint.
+   *
+   * @param rhs the Constraint object whose values are to be moved into this
+   * one; it is left as an empty Constraint in the place it had.
+   */
+  Constraint& operator=(Constraint&& rhs);
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this Constraint object.
    *
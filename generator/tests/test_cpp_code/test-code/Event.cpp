@@ -169,6 +169,60 @@ Event::operator=(const Event& rhs)
 }
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for Event.
+ */
+Event::Event(Event&& orig)
+  : SBase( std::move(orig) )
+  , mUseValuesFromTriggerTime ( orig.mUseValuesFromTriggerTime )
+  , mIsSetUseValuesFromTriggerTime ( orig.mIsSetUseValuesFromTriggerTime )
+  , mTrigger ( orig.mTrigger )
+  , mPriority ( orig.mPriority )
+  , mDelay ( orig.mDelay )
+  , mEventAssignments ( std::move(orig.mEventAssignments) )
+  , mTimeUnits ( std::move(orig.mTimeUnits) )
+{
+  orig.mTrigger = NULL;
+  orig.mPriority = NULL;
+  orig.mDelay = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for Event.
+ */
+Event&
+Event::operator=(Event&& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(std::move(rhs));
+    mUseValuesFromTriggerTime = rhs.mUseValuesFromTriggerTime;
+    mIsSetUseValuesFromTriggerTime = rhs.mIsSetUseValuesFromTriggerTime;
+    mEventAssignments = std::move(rhs.mEventAssignments);
+    mTimeUnits = std::move(rhs.mTimeUnits);
+    delete mTrigger;
+    mTrigger = rhs.mTrigger;
+    rhs.mTrigger = NULL;
+    delete mPriority;
+    mPriority = rhs.mPriority;
+    rhs.mPriority = NULL;
+    delete mDelay;
+    mDelay = rhs.mDelay;
+    rhs.mDelay = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this Event object.
  */
@@ -240,6 +294,7 @@ Event::isSetTimeUnits() const
 int
 Event::setUseValuesFromTriggerTime(bool useValuesFromTriggerTime)
 {
+  prepareForChange();
   mUseValuesFromTriggerTime = useValuesFromTriggerTime;
   mIsSetUseValuesFromTriggerTime = true;
   return LIBSBML_OPERATION_SUCCESS;
@@ -252,6 +307,8 @@ Event::setUseValuesFromTriggerTime(bool useValuesFromTriggerTime)
 int
 Event::setTimeUnits(const std::string& timeUnits)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidInternalUnitSId(timeUnits)))
   {
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
@@ -270,6 +327,7 @@ Event::setTimeUnits(const std::string& timeUnits)
 int
 Event::unsetUseValuesFromTriggerTime()
 {
+  prepareForChange();
   mUseValuesFromTriggerTime = false;
   mIsSetUseValuesFromTriggerTime = false;
 
@@ -290,6 +348,7 @@ Event::unsetUseValuesFromTriggerTime()
 int
 Event::unsetTimeUnits()
 {
+  prepareForChange();
   mTimeUnits.erase();
 
   if (mTimeUnits.empty() == true)
@@ -399,6 +458,8 @@ Event::isSetDelay() const
 int
 Event::setTrigger(const Trigger* trigger)
 {
+  prepareForChange();
+
   if (mTrigger == trigger)
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -429,6 +490,8 @@ Event::setTrigger(const Trigger* trigger)
 int
 Event::setPriority(const Priority* priority)
 {
+  prepareForChange();
+
   if (mPriority == priority)
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -459,6 +522,8 @@ Event::setPriority(const Priority* priority)
 int
 Event::setDelay(const Delay* delay)
 {
+  prepareForChange();
+
   if (mDelay == delay)
   {
     return LIBSBML_OPERATION_SUCCESS;
@@ -490,12 +555,14 @@ Event::setDelay(const Delay* delay)
 Trigger*
 Event::createTrigger()
 {
+  prepareForChange();
+
   if (mTrigger != NULL)
   {
     delete mTrigger;
   }
 
-  mTrigger = new Trigger(getSBMLNamespaces());
+  mTrigger = new (getDocumentArena()) Trigger(getSharedSBMLNamespaces());
 
   connectToChild();
 
@@ -510,12 +577,14 @@ Event::createTrigger()
 Priority*
 Event::createPriority()
 {
+  prepareForChange();
+
   if (mPriority != NULL)
   {
     delete mPriority;
   }
 
-  mPriority = new Priority(getSBMLNamespaces());
+  mPriority = new (getDocumentArena()) Priority(getSharedSBMLNamespaces());
 
   connectToChild();
 
@@ -530,12 +599,14 @@ Event::createPriority()
 Delay*
 Event::createDelay()
 {
+  prepareForChange();
+
   if (mDelay != NULL)
   {
     delete mDelay;
   }
 
-  mDelay = new Delay(getSBMLNamespaces());
+  mDelay = new (getDocumentArena()) Delay(getSharedSBMLNamespaces());
 
   connectToChild();
 
@@ -549,6 +620,7 @@ Event::createDelay()
 int
 Event::unsetTrigger()
 {
+  prepareForChange();
   delete mTrigger;
   mTrigger = NULL;
   return LIBSBML_OPERATION_SUCCESS;
@@ -561,6 +633,7 @@ Event::unsetTrigger()
 int
 Event::unsetPriority()
 {
+  prepareForChange();
   delete mPriority;
   mPriority = NULL;
   return LIBSBML_OPERATION_SUCCESS;
@@ -573,6 +646,7 @@ Event::unsetPriority()
 int
 Event::unsetDelay()
 {
+  prepareForChange();
   delete mDelay;
   mDelay = NULL;
   return LIBSBML_OPERATION_SUCCESS;
@@ -696,7 +770,7 @@ Event::createEventAssignment()
 
   try
   {
-    ea = new EventAssignment(getSBMLNamespaces());
+    ea = new (getDocumentArena()) EventAssignment(getSharedSBMLNamespaces());
   }
   catch (...)
   {
@@ -1423,7 +1497,7 @@ Event::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mTrigger;
-    mTrigger = new Trigger(getSBMLNamespaces());
+    mTrigger = new (getDocumentArena()) Trigger(getSharedSBMLNamespaces());
     obj = mTrigger;
   }
   else if (name == "priority")
@@ -1435,7 +1509,7 @@ Event::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mPriority;
-    mPriority = new Priority(getSBMLNamespaces());
+    mPriority = new (getDocumentArena()) Priority(getSharedSBMLNamespaces());
     obj = mPriority;
   }
   else if (name == "delay")
@@ -1447,7 +1521,7 @@ Event::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mDelay;
-    mDelay = new Delay(getSBMLNamespaces());
+    mDelay = new (getDocumentArena()) Delay(getSharedSBMLNamespaces());
     obj = mDelay;
   }
   else if (name == "sBMLListOfEventAssignments")
@@ -1517,25 +1591,24 @@ Event::readAttributes(
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
+        log->remove(SBMLUnknownCoreAttribute, n);
         log->logError(CoreModelLOEventsAllowedCoreAttributes, level, version,
           details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
+        log->remove(SBMLUnknownCoreAttribute, n);
         log->logError(CoreEventAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -1553,9 +1626,9 @@ Event::readAttributes(
   if (mIsSetUseValuesFromTriggerTime == false)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       log->logError(CoreEventUseValuesFromTriggerTimeMustBeBoolean, level,
         version);
     }
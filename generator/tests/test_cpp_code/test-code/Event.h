@@ -122,6 +122,28 @@ public:
   Event& operator=(const Event& rhs);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for Event.
+   *
+   * @param orig the Event instance to move; it is left as an empty Event in
+   * the place it had.
+   */
+  Event(Event&& orig);
+
+
+  /**
+   * Move assignment operator for Event.
+   *
+   * @param rhs the Event object whose values are to be moved into this one; it
+   * is left as an empty Event in the place it had.
+   */
+  Event& operator=(Event&& rhs);
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this Event object.
    *
@@ -1148,25 +1148,42 @@ Fred::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "identifier")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "myBoolean")
+  switch (attributeName.size())
   {
-    value = isSetBol();
-  }
-  else if (attributeName == "myNumber")
-  {
-    value = isSetNum();
-  }
-  else if (attributeName == "myString")
-  {
-    value = isSetStr();
-  }
-  else if (attributeName == "myEnum")
-  {
-    value = isSetMyEnum();
+  case 6:
+    if (attributeName == "myEnum")
+    {
+      value = isSetMyEnum();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "myNumber")
+    {
+      value = isSetNum();
+    }
+    else if (attributeName == "myString")
+    {
+      value = isSetStr();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "myBoolean")
+    {
+      value = isSetBol();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "identifier")
+    {
+      value = isSetId();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1294,25 +1311,42 @@ Fred::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "identifier")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "myBoolean")
+  switch (attributeName.size())
   {
-    value = unsetBol();
-  }
-  else if (attributeName == "myNumber")
-  {
-    value = unsetNum();
-  }
-  else if (attributeName == "myString")
-  {
-    value = unsetStr();
-  }
-  else if (attributeName == "myEnum")
-  {
-    value = unsetMyEnum();
+  case 6:
+    if (attributeName == "myEnum")
+    {
+      value = unsetMyEnum();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "myNumber")
+    {
+      value = unsetNum();
+    }
+    else if (attributeName == "myString")
+    {
+      value = unsetStr();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "myBoolean")
+    {
+      value = unsetBol();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "identifier")
+    {
+      value = unsetId();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
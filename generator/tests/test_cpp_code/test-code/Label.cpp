@@ -120,6 +120,44 @@ Label::operator=(const Label& rhs)
 }
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for Label.
+ */
+Label::Label(Label&& orig)
+  : SBase( std::move(orig) )
+  , mText ( std::move(orig.mText) )
+  , mBBox ( orig.mBBox )
+{
+  orig.mBBox = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for Label.
+ */
+Label&
+Label::operator=(Label&& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(std::move(rhs));
+    mText = std::move(rhs.mText);
+    delete mBBox;
+    mBBox = rhs.mBBox;
+    rhs.mBBox = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this Label object.
  */
@@ -186,6 +224,8 @@ Label::isSetText() const
 int
 Label::setId(const std::string& id)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidXMLID(id)))
   {
     return LIBSBGN_INVALID_ATTRIBUTE_VALUE;
@@ -204,6 +244,7 @@ Label::setId(const std::string& id)
 int
 Label::setText(const std::string& text)
 {
+  prepareForChange();
   mText = text;
   return LIBSBGN_OPERATION_SUCCESS;
 }
@@ -215,6 +256,7 @@ Label::setText(const std::string& text)
 int
 Label::unsetId()
 {
+  prepareForChange();
   mId.erase();
 
   if (mId.empty() == true)
@@ -234,6 +276,7 @@ Label::unsetId()
 int
 Label::unsetText()
 {
+  prepareForChange();
   mText.erase();
 
   if (mText.empty() == true)
@@ -283,6 +326,8 @@ Label::isSetBBox() const
 int
 Label::setBBox(const BBox* bbox)
 {
+  prepareForChange();
+
   if (mBBox == bbox)
   {
     return LIBSBGN_OPERATION_SUCCESS;
@@ -314,12 +359,14 @@ Label::setBBox(const BBox* bbox)
 BBox*
 Label::createBBox()
 {
+  prepareForChange();
+
   if (mBBox != NULL)
   {
     delete mBBox;
   }
 
-  mBBox = new BBox(getSbgnNamespaces());
+  mBBox = new (getDocumentArena()) BBox(getSharedSbgnNamespaces());
 
   connectToChild();
 
@@ -333,6 +380,7 @@ Label::createBBox()
 int
 Label::unsetBBox()
 {
+  prepareForChange();
   delete mBBox;
   mBBox = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -884,7 +932,7 @@ Label::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mBBox;
-    mBBox = new BBox(getSbgnNamespaces());
+    mBBox = new (getDocumentArena()) BBox(getSharedSbgnNamespaces());
     obj = mBBox;
   }
 
@@ -935,18 +983,17 @@ Label::readAttributes(
   bool assigned = false;
   SbgnErrorLog* log = getErrorLog();
 
+  numErrs = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
+        log->remove(SbgnUnknownCoreAttribute, n);
         log->logError(SbgnmlLabelAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -114,6 +114,28 @@ public:
   Label& operator=(const Label& rhs);
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for Label.
+   *
+   * @param orig the Label instance to move; it is left as an empty Label in
+   * the place it had.
+   */
+  Label(Label&& orig);
+
+
+  /**
+   * Move assignment operator for Label.
+   *
+   * @param rhs the Label object whose values are to be moved into this one; it
+   * is left as an empty Label in the place it had.
+   */
+  Label& operator=(Label&& rhs);
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this Label object.
    *
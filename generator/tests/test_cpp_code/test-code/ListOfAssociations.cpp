@@ -395,20 +395,17 @@ ListOfAssociations::createObject(XMLInputStream& stream)
     object = new Association(fbcns);
     appendAndOwn(object);
   }
-
-  if (name == "fbcAnd")
+  else if (name == "fbcAnd")
   {
     object = new FbcAnd(fbcns);
     appendAndOwn(object);
   }
-
-  if (name == "fbcOr")
+  else if (name == "fbcOr")
   {
     object = new FbcOr(fbcns);
     appendAndOwn(object);
   }
-
-  if (name == "geneProductRef")
+  else if (name == "geneProductRef")
   {
     object = new GeneProductRef(fbcns);
     appendAndOwn(object);
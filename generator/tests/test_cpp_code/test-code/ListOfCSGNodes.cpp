@@ -480,38 +480,32 @@ ListOfCSGNodes::createObject(XMLInputStream& stream)
     object = new CSGNode(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "csgPrimitive")
+  else if (name == "csgPrimitive")
   {
     object = new CSGPrimitive(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "csgTranslation")
+  else if (name == "csgTranslation")
   {
     object = new CSGTranslation(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "csgRotation")
+  else if (name == "csgRotation")
   {
     object = new CSGRotation(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "csgScale")
+  else if (name == "csgScale")
   {
     object = new CSGScale(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "csgHomogeneousTransformation")
+  else if (name == "csgHomogeneousTransformation")
   {
     object = new CSGHomogeneousTransformation(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "csgSetOperator")
+  else if (name == "csgSetOperator")
   {
     object = new CSGSetOperator(spatialns);
     appendAndOwn(object);
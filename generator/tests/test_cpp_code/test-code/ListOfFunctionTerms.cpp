@@ -583,8 +583,7 @@ ListOfFunctionTerms::createObject(XMLInputStream& stream)
     object = new FunctionTerm(qualns);
     appendAndOwn(object);
   }
-
-  if (name == "defaultTerm")
+  else if (name == "defaultTerm")
   {
     DefaultTerm newDT(qualns);
     setDefaultTerm(&newDT);
@@ -464,32 +464,27 @@ ListOfGeometryDefinitions::createObject(XMLInputStream& stream)
     object = new GeometryDefinition(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "analyticGeometry")
+  else if (name == "analyticGeometry")
   {
     object = new AnalyticGeometry(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "sampledFieldGeometry")
+  else if (name == "sampledFieldGeometry")
   {
     object = new SampledFieldGeometry(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "csGeometry")
+  else if (name == "csGeometry")
   {
     object = new CSGeometry(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "parametricGeometry")
+  else if (name == "parametricGeometry")
   {
     object = new ParametricGeometry(spatialns);
     appendAndOwn(object);
   }
-
-  if (name == "mixedGeometry")
+  else if (name == "mixedGeometry")
   {
     object = new MixedGeometry(spatialns);
     appendAndOwn(object);
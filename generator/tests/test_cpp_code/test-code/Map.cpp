@@ -132,6 +132,50 @@ Map::operator=(const Map& rhs)
 }
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for Map.
+ */
+Map::Map(Map&& orig)
+  : SBase( std::move(orig) )
+  , mLanguage ( orig.mLanguage )
+  , mBBox ( orig.mBBox )
+  , mGlyphs ( std::move(orig.mGlyphs) )
+  , mArcs ( std::move(orig.mArcs) )
+  , mArcGroups ( std::move(orig.mArcGroups) )
+{
+  orig.mBBox = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for Map.
+ */
+Map&
+Map::operator=(Map&& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(std::move(rhs));
+    mLanguage = rhs.mLanguage;
+    mGlyphs = std::move(rhs.mGlyphs);
+    mArcs = std::move(rhs.mArcs);
+    mArcGroups = std::move(rhs.mArcGroups);
+    delete mBBox;
+    mBBox = rhs.mBBox;
+    rhs.mBBox = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this Map object.
  */
@@ -209,6 +253,8 @@ Map::isSetLanguage() const
 int
 Map::setId(const std::string& id)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidXMLID(id)))
   {
     return LIBSBGN_INVALID_ATTRIBUTE_VALUE;
@@ -227,6 +273,8 @@ Map::setId(const std::string& id)
 int
 Map::setLanguage(const Language_t language)
 {
+  prepareForChange();
+
   if (Language_isValid(language) == 0)
   {
     mLanguage = SBGNML_LANGUAGE_INVALID;
@@ -246,6 +294,7 @@ Map::setLanguage(const Language_t language)
 int
 Map::setLanguage(const std::string& language)
 {
+  prepareForChange();
   mLanguage = Language_fromString(language.c_str());
 
   if (mLanguage == SBGNML_LANGUAGE_INVALID)
@@ -263,6 +312,7 @@ Map::setLanguage(const std::string& language)
 int
 Map::unsetId()
 {
+  prepareForChange();
   mId.erase();
 
   if (mId.empty() == true)
@@ -282,6 +332,7 @@ Map::unsetId()
 int
 Map::unsetLanguage()
 {
+  prepareForChange();
   mLanguage = SBGNML_LANGUAGE_INVALID;
   return LIBSBGN_OPERATION_SUCCESS;
 }
@@ -323,6 +374,8 @@ Map::isSetBBox() const
 int
 Map::setBBox(const BBox* bbox)
 {
+  prepareForChange();
+
   if (mBBox == bbox)
   {
     return LIBSBGN_OPERATION_SUCCESS;
@@ -354,12 +407,14 @@ Map::setBBox(const BBox* bbox)
 BBox*
 Map::createBBox()
 {
+  prepareForChange();
+
   if (mBBox != NULL)
   {
     delete mBBox;
   }
 
-  mBBox = new BBox(getSbgnNamespaces());
+  mBBox = new (getDocumentArena()) BBox(getSharedSbgnNamespaces());
 
   connectToChild();
 
@@ -373,6 +428,7 @@ Map::createBBox()
 int
 Map::unsetBBox()
 {
+  prepareForChange();
   delete mBBox;
   mBBox = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -498,7 +554,7 @@ Map::createGlyph()
 
   try
   {
-    g = new Glyph(getSbgnNamespaces());
+    g = new (getDocumentArena()) Glyph(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -653,7 +709,7 @@ Map::createArc()
 
   try
   {
-    a = new Arc(getSbgnNamespaces());
+    a = new (getDocumentArena()) Arc(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -784,7 +840,7 @@ Map::createArcGroup()
 
   try
   {
-    ag = new ArcGroup(getSbgnNamespaces());
+    ag = new (getDocumentArena()) ArcGroup(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -1475,7 +1531,7 @@ Map::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     }
 
     delete mBBox;
-    mBBox = new BBox(getSbgnNamespaces());
+    mBBox = new (getDocumentArena()) BBox(getSharedSbgnNamespaces());
     obj = mBBox;
   }
   else if (name == "glyph")
@@ -1538,18 +1594,17 @@ Map::readAttributes(
   bool assigned = false;
   SbgnErrorLog* log = getErrorLog();
 
+  numErrs = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
+        log->remove(SbgnUnknownCoreAttribute, n);
         log->logError(SbgnmlMapAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -148,6 +148,28 @@ public:
   Map& operator=(const Map& rhs);
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for Map.
+   *
+   * @param orig the Map instance to move; it is left as an empty Map in the
+   * place it had.
+   */
+  Map(Map&& orig);
+
+
+  /**
+   * Move assignment operator for Map.
+   *
+   * @param rhs the Map object whose values are to be moved into this one; it
+   * is left as an empty Map in the place it had.
+   */
+  Map& operator=(Map&& rhs);
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this Map object.
    *
@@ -535,25 +535,42 @@ Member::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "idRef")
-  {
-    value = getIdRef();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "metaIdRef")
-  {
-    value = getMetaIdRef();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = getName();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 5:
+    if (attributeName == "idRef")
+    {
+      value = getIdRef();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 9:
+    if (attributeName == "metaIdRef")
+    {
+      value = getMetaIdRef();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -574,21 +591,38 @@ Member::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = isSetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "idRef")
-  {
-    value = isSetIdRef();
-  }
-  else if (attributeName == "metaIdRef")
-  {
-    value = isSetMetaIdRef();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = isSetName();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "idRef")
+    {
+      value = isSetIdRef();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "metaIdRef")
+    {
+      value = isSetMetaIdRef();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -677,21 +711,38 @@ Member::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    return_value = setId(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "idRef")
-  {
-    return_value = setIdRef(value);
-  }
-  else if (attributeName == "metaIdRef")
-  {
-    return_value = setMetaIdRef(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      return_value = setName(value);
+    }
+
+    break;
+  case 5:
+    if (attributeName == "idRef")
+    {
+      return_value = setIdRef(value);
+    }
+
+    break;
+  case 9:
+    if (attributeName == "metaIdRef")
+    {
+      return_value = setMetaIdRef(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -711,21 +762,38 @@ Member::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = unsetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "idRef")
-  {
-    value = unsetIdRef();
-  }
-  else if (attributeName == "metaIdRef")
-  {
-    value = unsetMetaIdRef();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = unsetName();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "idRef")
+    {
+      value = unsetIdRef();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "metaIdRef")
+    {
+      value = unsetMetaIdRef();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -103,6 +103,37 @@ ModifierSpeciesReference::operator=(const ModifierSpeciesReference& rhs)
 }
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for ModifierSpeciesReference.
+ */
+ModifierSpeciesReference::ModifierSpeciesReference(ModifierSpeciesReference&&
+  orig)
+  : SimpleSpeciesReference( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for ModifierSpeciesReference.
+ */
+ModifierSpeciesReference&
+ModifierSpeciesReference::operator=(ModifierSpeciesReference&& rhs)
+{
+  if (&rhs != this)
+  {
+    SimpleSpeciesReference::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this ModifierSpeciesReference object.
  */
@@ -517,25 +548,24 @@ ModifierSpeciesReference::readAttributes(
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
+        log->remove(SBMLUnknownCoreAttribute, n);
         log->logError(CoreReactionLOModifierSpeciesReferencesAllowedCoreAttributes,
           level, version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SimpleSpeciesReference::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
+        log->remove(SBMLUnknownCoreAttribute, n);
         log->logError(CoreModifierSpeciesReferenceAllowedAttributes, level,
           version, details, getLine(), getColumn());
       }
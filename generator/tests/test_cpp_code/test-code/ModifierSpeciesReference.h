@@ -116,6 +116,29 @@ public:
   ModifierSpeciesReference& operator=(const ModifierSpeciesReference& rhs);
 
 
+#ifdef LIBSBML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for ModifierSpeciesReference.
+   *
+   * @param orig the ModifierSpeciesReference instance to move; it is left as
+   * an empty ModifierSpeciesReference in the place it had.
+   */
+  ModifierSpeciesReference(ModifierSpeciesReference&& orig);
+
+
+  /**
+   * Move assignment operator for ModifierSpeciesReference.
+   *
+   * @param rhs the ModifierSpeciesReference object whose values are to be
+   * moved into this one; it is left as an empty ModifierSpeciesReference in
+   * the place it had.
+   */
+  ModifierSpeciesReference& operator=(ModifierSpeciesReference&& rhs);
+
+
+#endif  /* LIBSBML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this ModifierSpeciesReference object.
    *
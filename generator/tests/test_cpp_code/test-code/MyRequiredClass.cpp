@@ -36,6 +36,7 @@
  */
 #include <sbml/packages/test/sbml/MyRequiredClass.h>
 #include <sbml/packages/test/validator/TestSBMLError.h>
+#include <sbml/util/util.h>
 
 
 using namespace std;
@@ -2091,10 +2092,22 @@ MyRequiredClass::write(XMLOutputStream& stream) const
 
   if (isSetArrayInt())
   {
+    std::string chunk;
+    char value[32];
+    chunk.reserve(4096);
     for (int i = 0; i < mArrayIntLength; ++i)
     {
-      stream << (long)mArrayInt[i] << " ";
+      int numChars = snprintf(value, sizeof(value), "%ld ",
+        (long)mArrayInt[i]);
+      chunk.append(value, numChars);
+      if (chunk.size() > 4000)
+      {
+        stream << chunk;
+        chunk.clear();
+      }
     }
+
+    stream << chunk;
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -2234,30 +2247,47 @@ MyRequiredClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "num")
-  {
-    value = getNum();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "num2")
-  {
-    value = getNum2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "posint")
-  {
-    value = getPosint();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "posint2")
-  {
-    value = getPosint2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "posint1")
+  switch (attributeName.size())
   {
-    value = getPosint1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 3:
+    if (attributeName == "num")
+    {
+      value = getNum();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 4:
+    if (attributeName == "num2")
+    {
+      value = getNum2();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 6:
+    if (attributeName == "posint")
+    {
+      value = getPosint();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 7:
+    if (attributeName == "posint2")
+    {
+      value = getPosint2();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "posint1")
+    {
+      value = getPosint1();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -2283,60 +2313,80 @@ MyRequiredClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "unit")
-  {
-    value = getUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref1")
-  {
-    value = getRef1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref2")
-  {
-    value = getRef2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = getRefUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "correctId")
-  {
-    value = getCorrectId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "metaid2")
+  switch (attributeName.size())
   {
-    value = getMetaid2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "metaid1")
-  {
-    value = getMetaid1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "metaidref1")
-  {
-    value = getMetaidref1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "notmetaid")
-  {
-    value = getNotmetaid();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = getName();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "unit")
+    {
+      value = getUnit();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "ref1")
+    {
+      value = getRef1();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "ref2")
+    {
+      value = getRef2();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      value = getRefUnit();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "metaid2")
+    {
+      value = getMetaid2();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "metaid1")
+    {
+      value = getMetaid1();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      value = getCorrectId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "notmetaid")
+    {
+      value = getNotmetaid();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 10:
+    if (attributeName == "metaidref1")
+    {
+      value = getMetaidref1();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -2357,113 +2407,151 @@ MyRequiredClass::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = isSetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = isSetNum2();
-  }
-  else if (attributeName == "num3")
-  {
-    value = isSetNum3();
-  }
-  else if (attributeName == "num1")
-  {
-    value = isSetNum1();
-  }
-  else if (attributeName == "true")
-  {
-    value = isSetTrue();
-  }
-  else if (attributeName == "false")
-  {
-    value = isSetFalse();
-  }
-  else if (attributeName == "unit")
-  {
-    value = isSetUnit();
-  }
-  else if (attributeName == "ref1")
-  {
-    value = isSetRef1();
-  }
-  else if (attributeName == "ref2")
-  {
-    value = isSetRef2();
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = isSetRefUnit();
-  }
-  else if (attributeName == "correctId")
-  {
-    value = isSetCorrectId();
-  }
-  else if (attributeName == "posint")
-  {
-    value = isSetPosint();
-  }
-  else if (attributeName == "posint2")
-  {
-    value = isSetPosint2();
-  }
-  else if (attributeName == "posint1")
-  {
-    value = isSetPosint1();
-  }
-  else if (attributeName == "metaid2")
-  {
-    value = isSetMetaid2();
-  }
-  else if (attributeName == "metaid1")
-  {
-    value = isSetMetaid1();
-  }
-  else if (attributeName == "num4")
-  {
-    value = isSetNum4();
-  }
-  else if (attributeName == "metaidref1")
+  switch (attributeName.size())
   {
-    value = isSetMetaidref1();
-  }
-  else if (attributeName == "notmetaid")
-  {
-    value = isSetNotmetaid();
-  }
-  else if (attributeName == "vectorDouble")
-  {
-    value = hasVectorDoubles();
-  }
-  else if (attributeName == "vectorDouble1")
-  {
-    value = hasVectorDouble1s();
-  }
-  else if (attributeName == "vectorInt")
-  {
-    value = hasVectorInts();
-  }
-  else if (attributeName == "vectorInt1")
-  {
-    value = hasVectorInt1s();
-  }
-  else if (attributeName == "arrayD")
-  {
-    value = isSetArrayD();
-  }
-  else if (attributeName == "arrayInt")
-  {
-    value = isSetArrayInt();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 3:
+    if (attributeName == "num")
+    {
+      value = isSetNum();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = isSetName();
+    }
+    else if (attributeName == "num2")
+    {
+      value = isSetNum2();
+    }
+    else if (attributeName == "num3")
+    {
+      value = isSetNum3();
+    }
+    else if (attributeName == "num1")
+    {
+      value = isSetNum1();
+    }
+    else if (attributeName == "true")
+    {
+      value = isSetTrue();
+    }
+    else if (attributeName == "unit")
+    {
+      value = isSetUnit();
+    }
+    else if (attributeName == "ref1")
+    {
+      value = isSetRef1();
+    }
+    else if (attributeName == "ref2")
+    {
+      value = isSetRef2();
+    }
+    else if (attributeName == "num4")
+    {
+      value = isSetNum4();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "false")
+    {
+      value = isSetFalse();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "posint")
+    {
+      value = isSetPosint();
+    }
+    else if (attributeName == "arrayD")
+    {
+      value = isSetArrayD();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      value = isSetRefUnit();
+    }
+    else if (attributeName == "posint2")
+    {
+      value = isSetPosint2();
+    }
+    else if (attributeName == "posint1")
+    {
+      value = isSetPosint1();
+    }
+    else if (attributeName == "metaid2")
+    {
+      value = isSetMetaid2();
+    }
+    else if (attributeName == "metaid1")
+    {
+      value = isSetMetaid1();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "arrayInt")
+    {
+      value = isSetArrayInt();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      value = isSetCorrectId();
+    }
+    else if (attributeName == "notmetaid")
+    {
+      value = isSetNotmetaid();
+    }
+    else if (attributeName == "vectorInt")
+    {
+      value = hasVectorInts();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "metaidref1")
+    {
+      value = isSetMetaidref1();
+    }
+    else if (attributeName == "vectorInt1")
+    {
+      value = hasVectorInt1s();
+    }
+
+    break;
+  case 12:
+    if (attributeName == "vectorDouble")
+    {
+      value = hasVectorDoubles();
+    }
+
+    break;
+  case 13:
+    if (attributeName == "vectorDouble1")
+    {
+      value = hasVectorDouble1s();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -2558,25 +2646,42 @@ MyRequiredClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "num")
-  {
-    return_value = setNum(value);
-  }
-  else if (attributeName == "num2")
-  {
-    return_value = setNum2(value);
-  }
-  else if (attributeName == "posint")
+  switch (attributeName.size())
   {
-    return_value = setPosint(value);
-  }
-  else if (attributeName == "posint2")
-  {
-    return_value = setPosint2(value);
-  }
-  else if (attributeName == "posint1")
-  {
-    return_value = setPosint1(value);
+  case 3:
+    if (attributeName == "num")
+    {
+      return_value = setNum(value);
+    }
+
+    break;
+  case 4:
+    if (attributeName == "num2")
+    {
+      return_value = setNum2(value);
+    }
+
+    break;
+  case 6:
+    if (attributeName == "posint")
+    {
+      return_value = setPosint(value);
+    }
+
+    break;
+  case 7:
+    if (attributeName == "posint2")
+    {
+      return_value = setPosint2(value);
+    }
+    else if (attributeName == "posint1")
+    {
+      return_value = setPosint1(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -2597,49 +2702,69 @@ MyRequiredClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    return_value = setId(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "unit")
-  {
-    return_value = setUnit(value);
-  }
-  else if (attributeName == "ref1")
-  {
-    return_value = setRef1(value);
-  }
-  else if (attributeName == "ref2")
-  {
-    return_value = setRef2(value);
-  }
-  else if (attributeName == "refUnit")
-  {
-    return_value = setRefUnit(value);
-  }
-  else if (attributeName == "correctId")
-  {
-    return_value = setCorrectId(value);
-  }
-  else if (attributeName == "metaid2")
-  {
-    return_value = setMetaid2(value);
-  }
-  else if (attributeName == "metaid1")
-  {
-    return_value = setMetaid1(value);
-  }
-  else if (attributeName == "metaidref1")
-  {
-    return_value = setMetaidref1(value);
-  }
-  else if (attributeName == "notmetaid")
-  {
-    return_value = setNotmetaid(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      return_value = setName(value);
+    }
+    else if (attributeName == "unit")
+    {
+      return_value = setUnit(value);
+    }
+    else if (attributeName == "ref1")
+    {
+      return_value = setRef1(value);
+    }
+    else if (attributeName == "ref2")
+    {
+      return_value = setRef2(value);
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      return_value = setRefUnit(value);
+    }
+    else if (attributeName == "metaid2")
+    {
+      return_value = setMetaid2(value);
+    }
+    else if (attributeName == "metaid1")
+    {
+      return_value = setMetaid1(value);
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      return_value = setCorrectId(value);
+    }
+    else if (attributeName == "notmetaid")
+    {
+      return_value = setNotmetaid(value);
+    }
+
+    break;
+  case 10:
+    if (attributeName == "metaidref1")
+    {
+      return_value = setMetaidref1(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -2659,113 +2784,151 @@ MyRequiredClass::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "name")
+  switch (attributeName.size())
   {
-    value = unsetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = unsetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = unsetNum2();
-  }
-  else if (attributeName == "num3")
-  {
-    value = unsetNum3();
-  }
-  else if (attributeName == "num1")
-  {
-    value = unsetNum1();
-  }
-  else if (attributeName == "true")
-  {
-    value = unsetTrue();
-  }
-  else if (attributeName == "false")
-  {
-    value = unsetFalse();
-  }
-  else if (attributeName == "unit")
-  {
-    value = unsetUnit();
-  }
-  else if (attributeName == "ref1")
-  {
-    value = unsetRef1();
-  }
-  else if (attributeName == "ref2")
-  {
-    value = unsetRef2();
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = unsetRefUnit();
-  }
-  else if (attributeName == "correctId")
-  {
-    value = unsetCorrectId();
-  }
-  else if (attributeName == "posint")
-  {
-    value = unsetPosint();
-  }
-  else if (attributeName == "posint2")
-  {
-    value = unsetPosint2();
-  }
-  else if (attributeName == "posint1")
-  {
-    value = unsetPosint1();
-  }
-  else if (attributeName == "metaid2")
-  {
-    value = unsetMetaid2();
-  }
-  else if (attributeName == "metaid1")
-  {
-    value = unsetMetaid1();
-  }
-  else if (attributeName == "num4")
-  {
-    value = unsetNum4();
-  }
-  else if (attributeName == "metaidref1")
-  {
-    value = unsetMetaidref1();
-  }
-  else if (attributeName == "notmetaid")
-  {
-    value = unsetNotmetaid();
-  }
-  else if (attributeName == "vectorDouble")
-  {
-    value = clearVectorDoubles();
-  }
-  else if (attributeName == "vectorDouble1")
-  {
-    value = clearVectorDouble1s();
-  }
-  else if (attributeName == "vectorInt")
-  {
-    value = clearVectorInts();
-  }
-  else if (attributeName == "vectorInt1")
-  {
-    value = clearVectorInt1s();
-  }
-  else if (attributeName == "arrayD")
-  {
-    value = unsetArrayD();
-  }
-  else if (attributeName == "arrayInt")
-  {
-    value = unsetArrayInt();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 3:
+    if (attributeName == "num")
+    {
+      value = unsetNum();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = unsetName();
+    }
+    else if (attributeName == "num2")
+    {
+      value = unsetNum2();
+    }
+    else if (attributeName == "num3")
+    {
+      value = unsetNum3();
+    }
+    else if (attributeName == "num1")
+    {
+      value = unsetNum1();
+    }
+    else if (attributeName == "true")
+    {
+      value = unsetTrue();
+    }
+    else if (attributeName == "unit")
+    {
+      value = unsetUnit();
+    }
+    else if (attributeName == "ref1")
+    {
+      value = unsetRef1();
+    }
+    else if (attributeName == "ref2")
+    {
+      value = unsetRef2();
+    }
+    else if (attributeName == "num4")
+    {
+      value = unsetNum4();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "false")
+    {
+      value = unsetFalse();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "posint")
+    {
+      value = unsetPosint();
+    }
+    else if (attributeName == "arrayD")
+    {
+      value = unsetArrayD();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      value = unsetRefUnit();
+    }
+    else if (attributeName == "posint2")
+    {
+      value = unsetPosint2();
+    }
+    else if (attributeName == "posint1")
+    {
+      value = unsetPosint1();
+    }
+    else if (attributeName == "metaid2")
+    {
+      value = unsetMetaid2();
+    }
+    else if (attributeName == "metaid1")
+    {
+      value = unsetMetaid1();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "arrayInt")
+    {
+      value = unsetArrayInt();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      value = unsetCorrectId();
+    }
+    else if (attributeName == "notmetaid")
+    {
+      value = unsetNotmetaid();
+    }
+    else if (attributeName == "vectorInt")
+    {
+      value = clearVectorInts();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "metaidref1")
+    {
+      value = unsetMetaidref1();
+    }
+    else if (attributeName == "vectorInt1")
+    {
+      value = clearVectorInt1s();
+    }
+
+    break;
+  case 12:
+    if (attributeName == "vectorDouble")
+    {
+      value = clearVectorDoubles();
+    }
+
+    break;
+  case 13:
+    if (attributeName == "vectorDouble1")
+    {
+      value = clearVectorDouble1s();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -3740,27 +3903,49 @@ MyRequiredClass::writeAttributes(XMLOutputStream& stream) const
 void
 MyRequiredClass::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  int val;
-  vector<int> valuesVector;
+  const char* current = text.c_str();
+  char* next = NULL;
+  unsigned int length = 0;
+  bool inValue = false;
 
-  while (strStream >> val)
+  for (const char* c = current; *c != '\0'; ++c)
   {
-    valuesVector.push_back(val);
-  }
+    bool isSpace = (isspace((unsigned char)*c) != 0);
+    if (!isSpace && !inValue)
+    {
+      ++length;
+    }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+    inValue = !isSpace;
+  }
 
   if (length > 0)
   {
     int* data = new int[length];
-    for (unsigned int i = 0; i < length; ++i)
+    unsigned int numValues = 0;
+    while (numValues < length)
     {
-      data[i] = valuesVector.at(i);
+      long value = strtol(current, &next, 10);
+      if (next == current)
+      {
+        break;
+      }
+
+      data[numValues++] = (int)value;
+      current = next;
     }
 
-    setArrayInt(data, length);
-    delete[] data;
+    if (numValues > 0)
+    {
+      delete[] mArrayInt;
+      mArrayInt = data;
+      mArrayIntLength = (int)numValues;
+      mIsSetArrayIntLength = true;
+    }
+    else
+    {
+      delete[] data;
+    }
   }
 }
 
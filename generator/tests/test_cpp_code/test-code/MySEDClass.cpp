@@ -78,6 +78,34 @@ MySEDClass::operator=(const MySEDClass& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for MySEDClass.
+ */
+MySEDClass::MySEDClass(MySEDClass&& orig)
+  : SedBase( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for MySEDClass.
+ */
+MySEDClass&
+MySEDClass::operator=(MySEDClass&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this MySEDClass object.
  */
@@ -122,6 +150,8 @@ MySEDClass::isSetId() const
 int
 MySEDClass::setId(const std::string& id)
 {
+  prepareForChange();
+  updateIdIndices(mId, id);
   mId = id;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -133,6 +163,8 @@ MySEDClass::setId(const std::string& id)
 int
 MySEDClass::unsetId()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -498,18 +530,17 @@ MySEDClass::readAttributes(
   bool assigned = false;
   SedErrorLog* log = getErrorLog();
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(TestMySEDClassAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -98,6 +98,28 @@ public:
   MySEDClass& operator=(const MySEDClass& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for MySEDClass.
+   *
+   * @param orig the MySEDClass instance to move; it is left as an empty
+   * MySEDClass in the place it had.
+   */
+  MySEDClass(MySEDClass&& orig);
+
+
+  /**
+   * Move assignment operator for MySEDClass.
+   *
+   * @param rhs the MySEDClass object whose values are to be moved into this
+   * one; it is left as an empty MySEDClass in the place it had.
+   */
+  MySEDClass& operator=(MySEDClass&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this MySEDClass object.
    *
@@ -1319,55 +1319,78 @@ MyTestClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "unit")
-  {
-    value = getUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref1")
-  {
-    value = getRef1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref2")
-  {
-    value = getRef2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = getRefUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "correctId")
-  {
-    value = getCorrectId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "idRef")
-  {
-    value = getIdRef();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "idref1")
-  {
-    value = getIdref1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "idref2")
-  {
-    value = getIdref2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = getName();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "unit")
+    {
+      value = getUnit();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "ref1")
+    {
+      value = getRef1();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "ref2")
+    {
+      value = getRef2();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 5:
+    if (attributeName == "idRef")
+    {
+      value = getIdRef();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 6:
+    if (attributeName == "idref1")
+    {
+      value = getIdref1();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "idref2")
+    {
+      value = getIdref2();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      value = getRefUnit();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      value = getCorrectId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1388,69 +1411,95 @@ MyTestClass::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = isSetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = isSetNum2();
-  }
-  else if (attributeName == "num3")
-  {
-    value = isSetNum3();
-  }
-  else if (attributeName == "num1")
-  {
-    value = isSetNum1();
-  }
-  else if (attributeName == "true")
-  {
-    value = isSetTrue();
-  }
-  else if (attributeName == "false")
-  {
-    value = isSetFalse();
-  }
-  else if (attributeName == "unit")
-  {
-    value = isSetUnit();
-  }
-  else if (attributeName == "ref1")
-  {
-    value = isSetRef1();
-  }
-  else if (attributeName == "ref2")
-  {
-    value = isSetRef2();
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = isSetRefUnit();
-  }
-  else if (attributeName == "correctId")
-  {
-    value = isSetCorrectId();
-  }
-  else if (attributeName == "idRef")
+  switch (attributeName.size())
   {
-    value = isSetIdRef();
-  }
-  else if (attributeName == "idref1")
-  {
-    value = isSetIdref1();
-  }
-  else if (attributeName == "idref2")
-  {
-    value = isSetIdref2();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 3:
+    if (attributeName == "num")
+    {
+      value = isSetNum();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = isSetName();
+    }
+    else if (attributeName == "num2")
+    {
+      value = isSetNum2();
+    }
+    else if (attributeName == "num3")
+    {
+      value = isSetNum3();
+    }
+    else if (attributeName == "num1")
+    {
+      value = isSetNum1();
+    }
+    else if (attributeName == "true")
+    {
+      value = isSetTrue();
+    }
+    else if (attributeName == "unit")
+    {
+      value = isSetUnit();
+    }
+    else if (attributeName == "ref1")
+    {
+      value = isSetRef1();
+    }
+    else if (attributeName == "ref2")
+    {
+      value = isSetRef2();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "false")
+    {
+      value = isSetFalse();
+    }
+    else if (attributeName == "idRef")
+    {
+      value = isSetIdRef();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "idref1")
+    {
+      value = isSetIdref1();
+    }
+    else if (attributeName == "idref2")
+    {
+      value = isSetIdref2();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      value = isSetRefUnit();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      value = isSetCorrectId();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1568,45 +1617,68 @@ MyTestClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "unit")
-  {
-    return_value = setUnit(value);
-  }
-  else if (attributeName == "ref1")
-  {
-    return_value = setRef1(value);
-  }
-  else if (attributeName == "ref2")
-  {
-    return_value = setRef2(value);
-  }
-  else if (attributeName == "refUnit")
+  switch (attributeName.size())
   {
-    return_value = setRefUnit(value);
-  }
-  else if (attributeName == "correctId")
-  {
-    return_value = setCorrectId(value);
-  }
-  else if (attributeName == "idRef")
-  {
-    return_value = setIdRef(value);
-  }
-  else if (attributeName == "idref1")
-  {
-    return_value = setIdref1(value);
-  }
-  else if (attributeName == "idref2")
-  {
-    return_value = setIdref2(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      return_value = setName(value);
+    }
+    else if (attributeName == "unit")
+    {
+      return_value = setUnit(value);
+    }
+    else if (attributeName == "ref1")
+    {
+      return_value = setRef1(value);
+    }
+    else if (attributeName == "ref2")
+    {
+      return_value = setRef2(value);
+    }
+
+    break;
+  case 5:
+    if (attributeName == "idRef")
+    {
+      return_value = setIdRef(value);
+    }
+
+    break;
+  case 6:
+    if (attributeName == "idref1")
+    {
+      return_value = setIdref1(value);
+    }
+    else if (attributeName == "idref2")
+    {
+      return_value = setIdref2(value);
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      return_value = setRefUnit(value);
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      return_value = setCorrectId(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1626,69 +1698,95 @@ MyTestClass::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = unsetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = unsetNum2();
-  }
-  else if (attributeName == "num3")
-  {
-    value = unsetNum3();
-  }
-  else if (attributeName == "num1")
+  switch (attributeName.size())
   {
-    value = unsetNum1();
-  }
-  else if (attributeName == "true")
-  {
-    value = unsetTrue();
-  }
-  else if (attributeName == "false")
-  {
-    value = unsetFalse();
-  }
-  else if (attributeName == "unit")
-  {
-    value = unsetUnit();
-  }
-  else if (attributeName == "ref1")
-  {
-    value = unsetRef1();
-  }
-  else if (attributeName == "ref2")
-  {
-    value = unsetRef2();
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = unsetRefUnit();
-  }
-  else if (attributeName == "correctId")
-  {
-    value = unsetCorrectId();
-  }
-  else if (attributeName == "idRef")
-  {
-    value = unsetIdRef();
-  }
-  else if (attributeName == "idref1")
-  {
-    value = unsetIdref1();
-  }
-  else if (attributeName == "idref2")
-  {
-    value = unsetIdref2();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 3:
+    if (attributeName == "num")
+    {
+      value = unsetNum();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = unsetName();
+    }
+    else if (attributeName == "num2")
+    {
+      value = unsetNum2();
+    }
+    else if (attributeName == "num3")
+    {
+      value = unsetNum3();
+    }
+    else if (attributeName == "num1")
+    {
+      value = unsetNum1();
+    }
+    else if (attributeName == "true")
+    {
+      value = unsetTrue();
+    }
+    else if (attributeName == "unit")
+    {
+      value = unsetUnit();
+    }
+    else if (attributeName == "ref1")
+    {
+      value = unsetRef1();
+    }
+    else if (attributeName == "ref2")
+    {
+      value = unsetRef2();
+    }
+
+    break;
+  case 5:
+    if (attributeName == "false")
+    {
+      value = unsetFalse();
+    }
+    else if (attributeName == "idRef")
+    {
+      value = unsetIdRef();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "idref1")
+    {
+      value = unsetIdref1();
+    }
+    else if (attributeName == "idref2")
+    {
+      value = unsetIdref2();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "refUnit")
+    {
+      value = unsetRefUnit();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "correctId")
+    {
+      value = unsetCorrectId();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -640,25 +640,42 @@ Output::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "qualitativeSpecies")
-  {
-    value = getQualitativeSpecies();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "transitionEffect")
-  {
-    value = getTransitionEffectAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = getName();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 16:
+    if (attributeName == "transitionEffect")
+    {
+      value = getTransitionEffectAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 18:
+    if (attributeName == "qualitativeSpecies")
+    {
+      value = getQualitativeSpecies();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -679,25 +696,45 @@ Output::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = isSetId();
-  }
-  else if (attributeName == "qualitativeSpecies")
-  {
-    value = isSetQualitativeSpecies();
-  }
-  else if (attributeName == "transitionEffect")
-  {
-    value = isSetTransitionEffect();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "outputLevel")
-  {
-    value = isSetOutputLevel();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = isSetName();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "outputLevel")
+    {
+      value = isSetOutputLevel();
+    }
+
+    break;
+  case 16:
+    if (attributeName == "transitionEffect")
+    {
+      value = isSetTransitionEffect();
+    }
+
+    break;
+  case 18:
+    if (attributeName == "qualitativeSpecies")
+    {
+      value = isSetQualitativeSpecies();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -791,21 +828,38 @@ Output::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "qualitativeSpecies")
-  {
-    return_value = setQualitativeSpecies(value);
-  }
-  else if (attributeName == "transitionEffect")
+  switch (attributeName.size())
   {
-    return_value = setTransitionEffect(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      return_value = setName(value);
+    }
+
+    break;
+  case 16:
+    if (attributeName == "transitionEffect")
+    {
+      return_value = setTransitionEffect(value);
+    }
+
+    break;
+  case 18:
+    if (attributeName == "qualitativeSpecies")
+    {
+      return_value = setQualitativeSpecies(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -825,25 +879,45 @@ Output::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "qualitativeSpecies")
+  switch (attributeName.size())
   {
-    value = unsetQualitativeSpecies();
-  }
-  else if (attributeName == "transitionEffect")
-  {
-    value = unsetTransitionEffect();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "outputLevel")
-  {
-    value = unsetOutputLevel();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = unsetName();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "outputLevel")
+    {
+      value = unsetOutputLevel();
+    }
+
+    break;
+  case 16:
+    if (attributeName == "transitionEffect")
+    {
+      value = unsetTransitionEffect();
+    }
+
+    break;
+  case 18:
+    if (attributeName == "qualitativeSpecies")
+    {
+      value = unsetQualitativeSpecies();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
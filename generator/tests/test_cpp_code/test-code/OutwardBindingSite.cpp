@@ -577,25 +577,42 @@ OutwardBindingSite::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "bindingStatus")
-  {
-    value = getBindingStatusAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "component")
-  {
-    value = getComponent();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = getName();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 9:
+    if (attributeName == "component")
+    {
+      value = getComponent();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 13:
+    if (attributeName == "bindingStatus")
+    {
+      value = getBindingStatusAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -616,21 +633,38 @@ OutwardBindingSite::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = isSetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "bindingStatus")
-  {
-    value = isSetBindingStatus();
-  }
-  else if (attributeName == "component")
-  {
-    value = isSetComponent();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = isSetName();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "component")
+    {
+      value = isSetComponent();
+    }
+
+    break;
+  case 13:
+    if (attributeName == "bindingStatus")
+    {
+      value = isSetBindingStatus();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -721,21 +755,38 @@ OutwardBindingSite::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    return_value = setId(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "bindingStatus")
-  {
-    return_value = setBindingStatus(value);
-  }
-  else if (attributeName == "component")
-  {
-    return_value = setComponent(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      return_value = setName(value);
+    }
+
+    break;
+  case 9:
+    if (attributeName == "component")
+    {
+      return_value = setComponent(value);
+    }
+
+    break;
+  case 13:
+    if (attributeName == "bindingStatus")
+    {
+      return_value = setBindingStatus(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -756,21 +807,38 @@ OutwardBindingSite::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = unsetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "bindingStatus")
-  {
-    value = unsetBindingStatus();
-  }
-  else if (attributeName == "component")
-  {
-    value = unsetComponent();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = unsetName();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "component")
+    {
+      value = unsetComponent();
+    }
+
+    break;
+  case 13:
+    if (attributeName == "bindingStatus")
+    {
+      value = unsetBindingStatus();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -137,6 +137,52 @@ Point::operator=(const Point& rhs)
 }
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for Point.
+ */
+Point::Point(Point&& orig)
+  : SBase( std::move(orig) )
+  , mX ( orig.mX )
+  , mIsSetX ( orig.mIsSetX )
+  , mY ( orig.mY )
+  , mIsSetY ( orig.mIsSetY )
+  , mPoints ( orig.mPoints )
+  , mElementName ( std::move(orig.mElementName) )
+{
+  orig.mPoints = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for Point.
+ */
+Point&
+Point::operator=(Point&& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(std::move(rhs));
+    mX = rhs.mX;
+    mIsSetX = rhs.mIsSetX;
+    mY = rhs.mY;
+    mIsSetY = rhs.mIsSetY;
+    mElementName = std::move(rhs.mElementName);
+    delete mPoints;
+    mPoints = rhs.mPoints;
+    rhs.mPoints = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this Point object.
  */
@@ -203,6 +249,7 @@ Point::isSetY() const
 int
 Point::setX(double x)
 {
+  prepareForChange();
   mX = x;
   mIsSetX = true;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -215,6 +262,7 @@ Point::setX(double x)
 int
 Point::setY(double y)
 {
+  prepareForChange();
   mY = y;
   mIsSetY = true;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -227,6 +275,7 @@ Point::setY(double y)
 int
 Point::unsetX()
 {
+  prepareForChange();
   mX = util_NaN();
   mIsSetX = false;
 
@@ -247,6 +296,7 @@ Point::unsetX()
 int
 Point::unsetY()
 {
+  prepareForChange();
   mY = util_NaN();
   mIsSetY = false;
 
@@ -356,7 +406,7 @@ Point::createPoint()
 
   try
   {
-    p1 = new Point(getSbgnNamespaces());
+    p1 = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -991,25 +1041,24 @@ Point::readAttributes(
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
+        log->remove(SbgnUnknownCoreAttribute, n);
         log->logError(SbgnmlArcLOPointsAllowedCoreAttributes, level, version,
           details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
+        log->remove(SbgnUnknownCoreAttribute, n);
         log->logError(SbgnmlPointAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -1026,9 +1075,9 @@ Point::readAttributes(
   if ( mIsSetX == false && log)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       std::string message = "Sbgnml attribute 'x' from the <Point> element must "
         "be an integer.";
       log->logError(SbgnmlPointXMustBeDouble, level, version, message,
@@ -1053,9 +1102,9 @@ Point::readAttributes(
   if ( mIsSetY == false && log)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       std::string message = "Sbgnml attribute 'y' from the <Point> element must "
         "be an integer.";
       log->logError(SbgnmlPointYMustBeDouble, level, version, message,
@@ -119,6 +119,28 @@ public:
   Point& operator=(const Point& rhs);
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for Point.
+   *
+   * @param orig the Point instance to move; it is left as an empty Point in
+   * the place it had.
+   */
+  Point(Point&& orig);
+
+
+  /**
+   * Move assignment operator for Point.
+   *
+   * @param rhs the Point object whose values are to be moved into this one; it
+   * is left as an empty Point in the place it had.
+   */
+  Point& operator=(Point&& rhs);
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this Point object.
    *
@@ -1369,40 +1369,60 @@ RenderGroup::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "startHead")
+  switch (attributeName.size())
   {
-    value = getStartHead();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "endHead")
-  {
-    value = getEndHead();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "font-family")
-  {
-    value = getFontFamily();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "font-weight")
-  {
-    value = getFontWeightAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "font-style")
-  {
-    value = getFontStyleAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "text-anchor")
-  {
-    value = getTextAnchorAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "vtext-anchor")
-  {
-    value = getVtextAnchorAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 7:
+    if (attributeName == "endHead")
+    {
+      value = getEndHead();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 9:
+    if (attributeName == "startHead")
+    {
+      value = getStartHead();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 10:
+    if (attributeName == "font-style")
+    {
+      value = getFontStyleAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 11:
+    if (attributeName == "font-family")
+    {
+      value = getFontFamily();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "font-weight")
+    {
+      value = getFontWeightAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "text-anchor")
+    {
+      value = getTextAnchorAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 12:
+    if (attributeName == "vtext-anchor")
+    {
+      value = getVtextAnchorAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1423,33 +1443,53 @@ RenderGroup::isSetAttribute(const std::string& attributeName) const
 {
   bool value = GraphicalPrimitive2D::isSetAttribute(attributeName);
 
-  if (attributeName == "startHead")
+  switch (attributeName.size())
   {
-    value = isSetStartHead();
-  }
-  else if (attributeName == "endHead")
-  {
-    value = isSetEndHead();
-  }
-  else if (attributeName == "font-family")
-  {
-    value = isSetFontFamily();
-  }
-  else if (attributeName == "font-weight")
-  {
-    value = isSetFontWeight();
-  }
-  else if (attributeName == "font-style")
-  {
-    value = isSetFontStyle();
-  }
-  else if (attributeName == "text-anchor")
-  {
-    value = isSetTextAnchor();
-  }
-  else if (attributeName == "vtext-anchor")
-  {
-    value = isSetVtextAnchor();
+  case 7:
+    if (attributeName == "endHead")
+    {
+      value = isSetEndHead();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "startHead")
+    {
+      value = isSetStartHead();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "font-style")
+    {
+      value = isSetFontStyle();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "font-family")
+    {
+      value = isSetFontFamily();
+    }
+    else if (attributeName == "font-weight")
+    {
+      value = isSetFontWeight();
+    }
+    else if (attributeName == "text-anchor")
+    {
+      value = isSetTextAnchor();
+    }
+
+    break;
+  case 12:
+    if (attributeName == "vtext-anchor")
+    {
+      value = isSetVtextAnchor();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1539,33 +1579,53 @@ RenderGroup::setAttribute(const std::string& attributeName,
 {
   int return_value = GraphicalPrimitive2D::setAttribute(attributeName, value);
 
-  if (attributeName == "startHead")
+  switch (attributeName.size())
   {
-    return_value = setStartHead(value);
-  }
-  else if (attributeName == "endHead")
-  {
-    return_value = setEndHead(value);
-  }
-  else if (attributeName == "font-family")
-  {
-    return_value = setFontFamily(value);
-  }
-  else if (attributeName == "font-weight")
-  {
-    return_value = setFontWeight(value);
-  }
-  else if (attributeName == "font-style")
-  {
-    return_value = setFontStyle(value);
-  }
-  else if (attributeName == "text-anchor")
-  {
-    return_value = setTextAnchor(value);
-  }
-  else if (attributeName == "vtext-anchor")
-  {
-    return_value = setVtextAnchor(value);
+  case 7:
+    if (attributeName == "endHead")
+    {
+      return_value = setEndHead(value);
+    }
+
+    break;
+  case 9:
+    if (attributeName == "startHead")
+    {
+      return_value = setStartHead(value);
+    }
+
+    break;
+  case 10:
+    if (attributeName == "font-style")
+    {
+      return_value = setFontStyle(value);
+    }
+
+    break;
+  case 11:
+    if (attributeName == "font-family")
+    {
+      return_value = setFontFamily(value);
+    }
+    else if (attributeName == "font-weight")
+    {
+      return_value = setFontWeight(value);
+    }
+    else if (attributeName == "text-anchor")
+    {
+      return_value = setTextAnchor(value);
+    }
+
+    break;
+  case 12:
+    if (attributeName == "vtext-anchor")
+    {
+      return_value = setVtextAnchor(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1585,33 +1645,53 @@ RenderGroup::unsetAttribute(const std::string& attributeName)
 {
   int value = GraphicalPrimitive2D::unsetAttribute(attributeName);
 
-  if (attributeName == "startHead")
+  switch (attributeName.size())
   {
-    value = unsetStartHead();
-  }
-  else if (attributeName == "endHead")
-  {
-    value = unsetEndHead();
-  }
-  else if (attributeName == "font-family")
-  {
-    value = unsetFontFamily();
-  }
-  else if (attributeName == "font-weight")
-  {
-    value = unsetFontWeight();
-  }
-  else if (attributeName == "font-style")
-  {
-    value = unsetFontStyle();
-  }
-  else if (attributeName == "text-anchor")
-  {
-    value = unsetTextAnchor();
-  }
-  else if (attributeName == "vtext-anchor")
-  {
-    value = unsetVtextAnchor();
+  case 7:
+    if (attributeName == "endHead")
+    {
+      value = unsetEndHead();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "startHead")
+    {
+      value = unsetStartHead();
+    }
+
+    break;
+  case 10:
+    if (attributeName == "font-style")
+    {
+      value = unsetFontStyle();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "font-family")
+    {
+      value = unsetFontFamily();
+    }
+    else if (attributeName == "font-weight")
+    {
+      value = unsetFontWeight();
+    }
+    else if (attributeName == "text-anchor")
+    {
+      value = unsetTextAnchor();
+    }
+
+    break;
+  case 12:
+    if (attributeName == "vtext-anchor")
+    {
+      value = unsetVtextAnchor();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
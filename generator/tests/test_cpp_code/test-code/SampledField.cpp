@@ -37,6 +37,9 @@
 #include <sbml/packages/spatial/sbml/SampledField.h>
 #include <sbml/packages/spatial/sbml/ListOfSampledFields.h>
 #include <sbml/packages/spatial/validator/SpatialSBMLError.h>
+#include <sbml/util/util.h>
+#include <climits>
+#include <cfloat>
 
 
 using namespace std;
@@ -69,6 +72,7 @@ SampledField::SampledField(unsigned int level,
   , mInterpolationType (SPATIAL_INTERPOLATIONKIND_INVALID)
   , mCompression (SPATIAL_COMPRESSIONKIND_INVALID)
   , mSamples (NULL)
+  , mSamplesStorageType (SPATIAL_DATAKIND_INVALID)
   , mSamplesLength (SBML_INT_MAX)
   , mIsSetSamplesLength (false)
 {
@@ -92,6 +96,7 @@ SampledField::SampledField(SpatialPkgNamespaces *spatialns)
   , mInterpolationType (SPATIAL_INTERPOLATIONKIND_INVALID)
   , mCompression (SPATIAL_COMPRESSIONKIND_INVALID)
   , mSamples (NULL)
+  , mSamplesStorageType (SPATIAL_DATAKIND_INVALID)
   , mSamplesLength (SBML_INT_MAX)
   , mIsSetSamplesLength (false)
 {
@@ -115,10 +120,11 @@ SampledField::SampledField(const SampledField& orig)
   , mInterpolationType ( orig.mInterpolationType )
   , mCompression ( orig.mCompression )
   , mSamples ( NULL )
+  , mSamplesStorageType ( SPATIAL_DATAKIND_INVALID )
   , mSamplesLength ( orig.mSamplesLength )
   , mIsSetSamplesLength ( orig.mIsSetSamplesLength )
 {
-  setSamples(orig.mSamples, orig.mSamplesLength);
+  setSamples(orig.mSamples, orig.mSamplesStorageType, orig.mSamplesLength);
 
 }
 
@@ -142,7 +148,7 @@ SampledField::operator=(const SampledField& rhs)
     mInterpolationType = rhs.mInterpolationType;
     mCompression = rhs.mCompression;
     mSamples = NULL;
-    setSamples(rhs.mSamples, rhs.mSamplesLength);
+    setSamples(rhs.mSamples, rhs.mSamplesStorageType, rhs.mSamplesLength);
     mSamplesLength = rhs.mSamplesLength;
     mIsSetSamplesLength = rhs.mIsSetSamplesLength;
   }
@@ -168,7 +174,7 @@ SampledField::~SampledField()
 {
   if (mSamples != NULL)
   {
-    delete [] mSamples;
+    free(mSamples);
   }
 
   mSamples = NULL;
@@ -289,7 +295,33 @@ SampledField::getSamples(int* outArray) const
     return;
   }
 
-  memcpy(outArray, mSamples, sizeof(int)*mSamplesLength);
+  for (int i = 0; i < mSamplesLength; ++i)
+  {
+    setSamplesValue(outArray, SPATIAL_DATAKIND_INVALID, i,
+      getSamplesValue(mSamples, mSamplesStorageType, i));
+  }
+}
+
+
+/*
+ * Returns the values of the "samples" attribute of this SampledField without
+ * converting them.
+ */
+const void*
+SampledField::getSamplesStorage() const
+{
+  return mSamples;
+}
+
+
+/*
+ * Returns the type in which the values of the "samples" attribute of this
+ * SampledField are stored.
+ */
+DataKind_t
+SampledField::getSamplesStorageType() const
+{
+  return mSamplesStorageType;
 }
 
 
@@ -566,13 +598,61 @@ SampledField::setSamples(int* inArray, int arrayLength)
     return LIBSBML_INVALID_ATTRIBUTE_VALUE;
   }
 
+  DataKind_t type = SPATIAL_DATAKIND_UINT8;
+
+  for (int i = 0; i < arrayLength; ++i)
+  {
+    type = getSamplesValueType(type, inArray[i]);
+  }
+
+  void* data = malloc(getSamplesValueSize(type)*(arrayLength > 0 ? arrayLength
+    : 1));
+
+  for (int i = 0; i < arrayLength; ++i)
+  {
+    setSamplesValue(data, type, i, inArray[i]);
+  }
+
+  if (mSamples != NULL)
+  {
+    free(mSamples);
+  }
+
+  mSamples = data;
+  mSamplesStorageType = type;
+  mIsSetSamplesLength = true;
+  mSamplesLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "samples" attribute of this SampledField from values
+ * of the given type.
+ */
+int
+SampledField::setSamples(const void* inArray,
+                         DataKind_t type,
+                         int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  size_t numBytes = getSamplesValueSize(type)*(arrayLength > 0 ? arrayLength :
+    1);
+  void* data = malloc(numBytes);
+  memcpy(data, inArray, numBytes);
+
   if (mSamples != NULL)
   {
-    delete[] mSamples;
+    free(mSamples);
   }
 
-  mSamples = new int[arrayLength];
-  memcpy(mSamples, inArray, sizeof(int)*arrayLength);
+  mSamples = data;
+  mSamplesStorageType = type;
   mIsSetSamplesLength = true;
   mSamplesLength = arrayLength;
 
@@ -712,10 +792,11 @@ SampledField::unsetSamples()
 {
   if (mSamples != NULL)
   {
-    delete[] mSamples;
+    free(mSamples);
   }
 
   mSamples = NULL;
+  mSamplesStorageType = SPATIAL_DATAKIND_INVALID;
 
   return unsetSamplesLength();
 }
@@ -871,10 +952,40 @@ SampledField::write(XMLOutputStream& stream) const
 
   if (isSetSamples())
   {
+    std::string chunk;
+    char value[32];
+    chunk.reserve(4096);
     for (int i = 0; i < mSamplesLength; ++i)
     {
-      stream << (long)mSamples[i] << " ";
+      double number = getSamplesValue(mSamples, mSamplesStorageType, i);
+
+      if (util_isNaN(number))
+      {
+        chunk.append("NaN ");
+      }
+      else if (util_isInf(number) > 0)
+      {
+        chunk.append("INF ");
+      }
+      else if (util_isInf(number) < 0)
+      {
+        chunk.append("-INF ");
+      }
+      else
+      {
+        int numChars = c_locale_snprintf(value, sizeof(value), "%.15g ",
+          number);
+        chunk.append(value, numChars);
+      }
+
+      if (chunk.size() > 4000)
+      {
+        stream << chunk;
+        chunk.clear();
+      }
     }
+
+    stream << chunk;
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -934,25 +1045,36 @@ SampledField::getAttribute(const std::string& attributeName, int& value) const
     return return_value;
   }
 
-  if (attributeName == "numSamples1")
-  {
-    value = getNumSamples1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "numSamples2")
-  {
-    value = getNumSamples2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "numSamples3")
-  {
-    value = getNumSamples3();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "samplesLength")
+  switch (attributeName.size())
   {
-    value = getSamplesLength();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 11:
+    if (attributeName == "numSamples1")
+    {
+      value = getNumSamples1();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "numSamples2")
+    {
+      value = getNumSamples2();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "numSamples3")
+    {
+      value = getNumSamples3();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 13:
+    if (attributeName == "samplesLength")
+    {
+      value = getSamplesLength();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1014,25 +1136,42 @@ SampledField::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "dataType")
-  {
-    value = getDataTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "interpolationType")
+  switch (attributeName.size())
   {
-    value = getInterpolationTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "compression")
-  {
-    value = getCompressionAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 8:
+    if (attributeName == "dataType")
+    {
+      value = getDataTypeAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 11:
+    if (attributeName == "compression")
+    {
+      value = getCompressionAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 17:
+    if (attributeName == "interpolationType")
+    {
+      value = getInterpolationTypeAsString();
+      return_value = LIBSBML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1053,41 +1192,64 @@ SampledField::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "dataType")
-  {
-    value = isSetDataType();
-  }
-  else if (attributeName == "numSamples1")
-  {
-    value = isSetNumSamples1();
-  }
-  else if (attributeName == "numSamples2")
-  {
-    value = isSetNumSamples2();
-  }
-  else if (attributeName == "numSamples3")
-  {
-    value = isSetNumSamples3();
-  }
-  else if (attributeName == "interpolationType")
-  {
-    value = isSetInterpolationType();
-  }
-  else if (attributeName == "compression")
-  {
-    value = isSetCompression();
-  }
-  else if (attributeName == "samples")
-  {
-    value = isSetSamples();
-  }
-  else if (attributeName == "samplesLength")
+  switch (attributeName.size())
   {
-    value = isSetSamplesLength();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "samples")
+    {
+      value = isSetSamples();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "dataType")
+    {
+      value = isSetDataType();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "numSamples1")
+    {
+      value = isSetNumSamples1();
+    }
+    else if (attributeName == "numSamples2")
+    {
+      value = isSetNumSamples2();
+    }
+    else if (attributeName == "numSamples3")
+    {
+      value = isSetNumSamples3();
+    }
+    else if (attributeName == "compression")
+    {
+      value = isSetCompression();
+    }
+
+    break;
+  case 13:
+    if (attributeName == "samplesLength")
+    {
+      value = isSetSamplesLength();
+    }
+
+    break;
+  case 17:
+    if (attributeName == "interpolationType")
+    {
+      value = isSetInterpolationType();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1124,21 +1286,32 @@ SampledField::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "numSamples1")
-  {
-    return_value = setNumSamples1(value);
-  }
-  else if (attributeName == "numSamples2")
-  {
-    return_value = setNumSamples2(value);
-  }
-  else if (attributeName == "numSamples3")
+  switch (attributeName.size())
   {
-    return_value = setNumSamples3(value);
-  }
-  else if (attributeName == "samplesLength")
-  {
-    return_value = setSamplesLength(value);
+  case 11:
+    if (attributeName == "numSamples1")
+    {
+      return_value = setNumSamples1(value);
+    }
+    else if (attributeName == "numSamples2")
+    {
+      return_value = setNumSamples2(value);
+    }
+    else if (attributeName == "numSamples3")
+    {
+      return_value = setNumSamples3(value);
+    }
+
+    break;
+  case 13:
+    if (attributeName == "samplesLength")
+    {
+      return_value = setSamplesLength(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1194,21 +1367,38 @@ SampledField::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "dataType")
-  {
-    return_value = setDataType(value);
-  }
-  else if (attributeName == "interpolationType")
-  {
-    return_value = setInterpolationType(value);
-  }
-  else if (attributeName == "compression")
+  switch (attributeName.size())
   {
-    return_value = setCompression(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 8:
+    if (attributeName == "dataType")
+    {
+      return_value = setDataType(value);
+    }
+
+    break;
+  case 11:
+    if (attributeName == "compression")
+    {
+      return_value = setCompression(value);
+    }
+
+    break;
+  case 17:
+    if (attributeName == "interpolationType")
+    {
+      return_value = setInterpolationType(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -1228,41 +1418,64 @@ SampledField::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "dataType")
-  {
-    value = unsetDataType();
-  }
-  else if (attributeName == "numSamples1")
-  {
-    value = unsetNumSamples1();
-  }
-  else if (attributeName == "numSamples2")
-  {
-    value = unsetNumSamples2();
-  }
-  else if (attributeName == "numSamples3")
+  switch (attributeName.size())
   {
-    value = unsetNumSamples3();
-  }
-  else if (attributeName == "interpolationType")
-  {
-    value = unsetInterpolationType();
-  }
-  else if (attributeName == "compression")
-  {
-    value = unsetCompression();
-  }
-  else if (attributeName == "samples")
-  {
-    value = unsetSamples();
-  }
-  else if (attributeName == "samplesLength")
-  {
-    value = unsetSamplesLength();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 7:
+    if (attributeName == "samples")
+    {
+      value = unsetSamples();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "dataType")
+    {
+      value = unsetDataType();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "numSamples1")
+    {
+      value = unsetNumSamples1();
+    }
+    else if (attributeName == "numSamples2")
+    {
+      value = unsetNumSamples2();
+    }
+    else if (attributeName == "numSamples3")
+    {
+      value = unsetNumSamples3();
+    }
+    else if (attributeName == "compression")
+    {
+      value = unsetCompression();
+    }
+
+    break;
+  case 13:
+    if (attributeName == "samplesLength")
+    {
+      value = unsetSamplesLength();
+    }
+
+    break;
+  case 17:
+    if (attributeName == "interpolationType")
+    {
+      value = unsetInterpolationType();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1705,28 +1918,196 @@ SampledField::writeAttributes(XMLOutputStream& stream) const
 void
 SampledField::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  int val;
-  vector<int> valuesVector;
+  const char* current = text.c_str();
+  char* next = NULL;
+  unsigned int length = 0;
+  bool inValue = false;
 
-  while (strStream >> val)
+  for (const char* c = current; *c != '\0'; ++c)
   {
-    valuesVector.push_back(val);
-  }
+    bool isSpace = (isspace((unsigned char)*c) != 0);
+    if (!isSpace && !inValue)
+    {
+      ++length;
+    }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+    inValue = !isSpace;
+  }
 
   if (length > 0)
   {
-    int* data = new int[length];
-    for (unsigned int i = 0; i < length; ++i)
+    DataKind_t type = SPATIAL_DATAKIND_UINT8;
+    void* data = malloc(getSamplesValueSize(type)*length);
+    unsigned int numValues = 0;
+    while (numValues < length)
+    {
+      double value = c_locale_strtod(current, &next);
+      if (next == current)
+      {
+        break;
+      }
+
+      DataKind_t valueType = getSamplesValueType(type, value);
+      if (valueType != type)
+      {
+        void* wider = malloc(getSamplesValueSize(valueType)*length);
+        for (unsigned int i = 0; i < numValues; ++i)
+        {
+          setSamplesValue(wider, valueType, i, getSamplesValue(data, type, i));
+        }
+
+        free(data);
+        data = wider;
+        type = valueType;
+      }
+
+      setSamplesValue(data, type, numValues++, value);
+      current = next;
+    }
+
+    if (numValues > 0)
+    {
+      free(mSamples);
+      mSamples = data;
+      mSamplesStorageType = type;
+      mSamplesLength = (int)numValues;
+      mIsSetSamplesLength = true;
+    }
+    else
     {
-      data[i] = valuesVector.at(i);
+      free(data);
     }
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the number of bytes taken by one value of the given type
+ */
+size_t
+SampledField::getSamplesValueSize(DataKind_t type)
+{
+  switch (type)
+  {
+  case SPATIAL_DATAKIND_DOUBLE:
+    return sizeof(double);
+  case SPATIAL_DATAKIND_FLOAT:
+    return sizeof(float);
+  case SPATIAL_DATAKIND_UINT8:
+    return sizeof(unsigned char);
+  case SPATIAL_DATAKIND_UINT16:
+    return sizeof(unsigned short);
+  case SPATIAL_DATAKIND_UINT32:
+    return sizeof(unsigned int);
+  default:
+    return sizeof(int);
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns a value of an array of the given type
+ */
+double
+SampledField::getSamplesValue(const void* data, DataKind_t type, int index)
+{
+  switch (type)
+  {
+  case SPATIAL_DATAKIND_DOUBLE:
+    return ((const double*)data)[index];
+  case SPATIAL_DATAKIND_FLOAT:
+    return ((const float*)data)[index];
+  case SPATIAL_DATAKIND_UINT8:
+    return ((const unsigned char*)data)[index];
+  case SPATIAL_DATAKIND_UINT16:
+    return ((const unsigned short*)data)[index];
+  case SPATIAL_DATAKIND_UINT32:
+    return ((const unsigned int*)data)[index];
+  default:
+    return ((const int*)data)[index];
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets a value of an array of the given type
+ */
+void
+SampledField::setSamplesValue(void* data,
+                              DataKind_t type,
+                              int index,
+                              double value)
+{
+  switch (type)
+  {
+  case SPATIAL_DATAKIND_DOUBLE:
+    ((double*)data)[index] = value;
+    break;
+  case SPATIAL_DATAKIND_FLOAT:
+    ((float*)data)[index] = (float)(value > -FLT_MAX ? (value < FLT_MAX ? value
+      : FLT_MAX) : -FLT_MAX);
+    break;
+  case SPATIAL_DATAKIND_UINT8:
+    ((unsigned char*)data)[index] = (unsigned char)(value > 0 ? (value <
+      UCHAR_MAX ? value : UCHAR_MAX) : 0);
+    break;
+  case SPATIAL_DATAKIND_UINT16:
+    ((unsigned short*)data)[index] = (unsigned short)(value > 0 ? (value <
+      USHRT_MAX ? value : USHRT_MAX) : 0);
+    break;
+  case SPATIAL_DATAKIND_UINT32:
+    ((unsigned int*)data)[index] = (unsigned int)(value > 0 ? (value < UINT_MAX
+      ? value : UINT_MAX) : 0);
+    break;
+  default:
+    ((int*)data)[index] = (int)(value > INT_MIN ? (value < INT_MAX ? value :
+      INT_MAX) : INT_MIN);
+    break;
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
 
-    setSamples(data, length);
-    delete[] data;
+/*
+ * Returns the type in which values of the given type are stored together with
+ * the given value: the first of bytes, the element type and doubles that holds
+ * them all exactly
+ */
+DataKind_t
+SampledField::getSamplesValueType(DataKind_t type, double value)
+{
+  if (type == SPATIAL_DATAKIND_UINT8 && value >= 0 && value <= UCHAR_MAX &&
+    value == (unsigned char)value)
+  {
+    return SPATIAL_DATAKIND_UINT8;
+  }
+
+  if (type != SPATIAL_DATAKIND_DOUBLE && value >= INT_MIN && value <= INT_MAX
+    && value == (int)value)
+  {
+    return SPATIAL_DATAKIND_INVALID;
   }
+
+  return SPATIAL_DATAKIND_DOUBLE;
 }
 
 /** @endcond */
@@ -1738,6 +2119,30 @@ SampledField::setElementText(const std::string& text)
 #include <zlib.h>
 #endif
 
+/*
+ * Reverses the bytes of each value of the given size on a big endian
+ * machine, so that deflated values are in little endian order whatever the
+ * machine.
+ */
+static void
+swapLittleEndian(unsigned char* data, int length, size_t size)
+{
+  unsigned short probe = 1;
+  if (size < 2 || *(unsigned char*)&probe == 1)
+    return;
+
+  for (int i = 0; i + (int)size <= length; i += (int)size)
+  {
+    for (size_t j = 0; j < size / 2; ++j)
+    {
+      unsigned char byte = data[i + j];
+      data[i + j] = data[i + size - 1 - j];
+      data[i + size - 1 - j] = byte;
+    }
+  }
+}
+
+
 /**  
  *  Returns the data of this image as uncompressed array of integers
  * 
@@ -1749,140 +2154,329 @@ SampledField::setElementText(const std::string& text)
 void 
 SampledField::getUncompressedData(int* &data, int& length) 
 {
-  if (mUncompressedSamples == NULL)
-  {
-    uncompress();
-  }
-
-  copySampleArrays(data, length, mUncompressedSamples, mUncompressedLength);
+  length = (int)getUncompressedLength();
+  data = (int*)malloc(sizeof(int)*(length > 0 ? length : 1));
+  getUncompressed(data);
   return;
 
 }
 
+/*
+ * Deflated samples hold the bytes of the values, of the type given by the
+ * "dataType" attribute, in little endian order; they are inflated into a
+ * buffer that is then used as an array of that type.  Samples that are not
+ * deflated are already held in their type and are read in place.
+ */
 void 
 SampledField::uncompress()
 {
   freeUncompressed();
-  if (mCompression == SPATIAL_COMPRESSIONKIND_DEFLATED)
-  {
-    char* csamples = (char*)malloc(sizeof(char)*mSamplesLength);
-    for (int i = 0 ; i < mSamplesLength; ++i)
-      csamples[i] = mSamples[i];
-    SampledField::uncompress_data(csamples, mSamplesLength, mUncompressedSamples, mUncompressedLength);
-    free(csamples);
+  if (mCompression != SPATIAL_COMPRESSIONKIND_DEFLATED || mSamples == NULL)
+    return;
 
-    if (mUncompressedSamples == 0)
-      copySampleArrays(mUncompressedSamples, mUncompressedLength, mSamples, mSamplesLength);
-  }
-  else
+  // the deflated bytes are held as bytes unless set otherwise
+  const unsigned char* deflated = (const unsigned char*)mSamples;
+  unsigned char* narrowed = NULL;
+  if (mSamplesStorageType != SPATIAL_DATAKIND_UINT8)
   {
-    copySampleArrays(mUncompressedSamples, mUncompressedLength, mSamples, mSamplesLength);
+    narrowed = (unsigned char*)malloc(mSamplesLength > 0 ? mSamplesLength : 1);
+    for (int i = 0; i < mSamplesLength; ++i)
+      setSamplesValue(narrowed, SPATIAL_DATAKIND_UINT8, i, getSamplesValue(mSamples, mSamplesStorageType, i));
+    deflated = narrowed;
   }
 
+  size_t size = getSamplesValueSize(mDataType);
+  unsigned char* bytes = NULL;
+  int numBytes = 0;
+  SampledField::uncompress_data(deflated, mSamplesLength, getExpectedUncompressedLength()*(int)size, bytes, numBytes);
+  free(narrowed);
+
+  // not inflatable: the samples are read as they are
+  if (bytes == NULL)
+    return;
+
+  swapLittleEndian(bytes, numBytes, size);
+  mUncompressedData = bytes;
+  mUncompressedType = mDataType;
+  mUncompressedLength = numBytes / (int)size;
 }
 
 unsigned int 
 SampledField::getUncompressedLength()
 {
-  if (mUncompressedSamples == NULL)
-    uncompress();
-  return mUncompressedLength;
+  getUncompressedBuffer();
+  if (mUncompressedData != NULL)
+    return mUncompressedLength;
+  return (mSamples != NULL) ? mSamplesLength : 0;
 }
 
 void 
 SampledField::getUncompressed(int* outputSamples)
 {
   if (outputSamples == NULL) return;
-  if (mUncompressedSamples == NULL)
-    uncompress();
-  memcpy(outputSamples , mUncompressedSamples, sizeof(int)*mUncompressedLength);   
+  const void* data = getUncompressedBuffer();
+  DataKind_t type = getUncompressedType();
+  int length = (int)getUncompressedLength();
+  // values of no type are ints
+  for (int i = 0; i < length; ++i)
+    setSamplesValue(outputSamples, SPATIAL_DATAKIND_INVALID, i, getSamplesValue(data, type, i));
 }
 
 void 
 SampledField::freeUncompressed()
 {
-  if (mUncompressedSamples == NULL) return;
+  if (mUncompressedData == NULL) return;
   mUncompressedLength = 0;
-  free(mUncompressedSamples);
-  mUncompressedSamples = NULL;
+  free(mUncompressedData);
+  mUncompressedData = NULL;
+  mUncompressedType = SPATIAL_DATAKIND_INVALID;
+}
+
+
+DataKind_t 
+SampledField::getUncompressedType()
+{
+  getUncompressedBuffer();
+  return (mUncompressedData != NULL) ? mUncompressedType : mSamplesStorageType;
+}
+
+
+const void* 
+SampledField::getUncompressedBuffer()
+{
+  if (mUncompressedData == NULL && mCompression == SPATIAL_COMPRESSIONKIND_DEFLATED)
+    uncompress();
+  return (mUncompressedData != NULL) ? mUncompressedData : mSamples;
+}
+
+
+const unsigned char* 
+SampledField::getUncompressedUInt8()
+{
+  return (getUncompressedType() == SPATIAL_DATAKIND_UINT8) ?
+    (const unsigned char*)getUncompressedBuffer() : NULL;
+}
+
+
+const unsigned short* 
+SampledField::getUncompressedUInt16()
+{
+  return (getUncompressedType() == SPATIAL_DATAKIND_UINT16) ?
+    (const unsigned short*)getUncompressedBuffer() : NULL;
 }
 
 
+const unsigned int* 
+SampledField::getUncompressedUInt32()
+{
+  return (getUncompressedType() == SPATIAL_DATAKIND_UINT32) ?
+    (const unsigned int*)getUncompressedBuffer() : NULL;
+}
+
+
+const float* 
+SampledField::getUncompressedFloat()
+{
+  return (getUncompressedType() == SPATIAL_DATAKIND_FLOAT) ?
+    (const float*)getUncompressedBuffer() : NULL;
+}
+
+
+const double* 
+SampledField::getUncompressedDouble()
+{
+  return (getUncompressedType() == SPATIAL_DATAKIND_DOUBLE) ?
+    (const double*)getUncompressedBuffer() : NULL;
+}
+
+
+/*
+ * Inflates the given bytes a chunk of output at a time, each chunk being
+ * copied straight into the result; the result is sized from the expected
+ * number of bytes (when known) so that it rarely needs to grow.
+ */
 void 
-SampledField::uncompress_data(void *data, size_t length, int*& result, int& outLength)
+SampledField::uncompress_data(const unsigned char* data, int length, int expectedLength, unsigned char*& result, int& outLength)
 {
-#ifndef USE_ZLIB
-  // throwing an exception won't help our users, better set the result array and length to NULL. 
-  // throw ZlibNotLinked();
   outLength = 0;
   result = NULL;  
-#else
-  std::vector<char> buffer;
+#ifdef USE_ZLIB
+  const int CHUNK = 64 * 1024;
+  Bytef out[CHUNK];
 
- const size_t BUFSIZE = 128 * 1024;
- Bytef temp_buffer[BUFSIZE];
+  if (data == NULL || length <= 0)
+    return;
 
- z_stream strm;
- strm.zalloc = 0;
- strm.zfree = 0;
- strm.next_in = reinterpret_cast<Bytef *>(data);
- strm.avail_in = length;
- strm.next_out = reinterpret_cast<Bytef *>(temp_buffer);
- strm.avail_out = BUFSIZE;
+  int capacity = (expectedLength > 0) ? expectedLength : 4 * length;
+  unsigned char* samples = (unsigned char*)malloc(capacity);
 
- int res = inflateInit(&strm);
+  z_stream strm;
+  memset(&strm, 0, sizeof(strm));
 
- while (strm.avail_in != 0)
- {
-  res = inflate(&strm, Z_NO_FLUSH);
-  if (res < 0)
+  if (samples == NULL || inflateInit(&strm) != Z_OK)
   {
-    outLength = 0;
-    result = NULL;
-    break;
+    free(samples);
+    return;
   }
-  if (strm.avail_out == 0)
+
+  strm.next_in = (Bytef*)data;
+  strm.avail_in = (uInt)length;
+
+  int numSamples = 0;
+  int res = Z_OK;
+
+  while (res != Z_STREAM_END)
   {
-   buffer.insert(buffer.end(), temp_buffer, temp_buffer + BUFSIZE);
-   strm.next_out = reinterpret_cast<Bytef *>(temp_buffer);
-   strm.avail_out = BUFSIZE;
+    strm.next_out = out;
+    strm.avail_out = CHUNK;
+    res = inflate(&strm, Z_NO_FLUSH);
+
+    int numOut = CHUNK - (int)strm.avail_out;
+
+    if (res != Z_OK && res != Z_STREAM_END && !(res == Z_BUF_ERROR && numOut > 0))
+    {
+      // corrupt data, or a stream that ends before it is complete
+      free(samples);
+      samples = NULL;
+      break;
+    }
+
+    if (numSamples + numOut > capacity)
+    {
+      capacity = (2 * capacity > numSamples + numOut) ? 2 * capacity : numSamples + numOut;
+      unsigned char* grown = (unsigned char*)realloc(samples, capacity);
+      if (grown == NULL)
+      {
+        free(samples);
+        samples = NULL;
+        break;
+      }
+      samples = grown;
+    }
+
+    memcpy(samples + numSamples, out, numOut);
+    numSamples += numOut;
   }
- }
 
- res = Z_OK;
- while (res == Z_OK)
- {
-  if (strm.avail_out == 0)
+  inflateEnd(&strm);
+
+  if (samples != NULL)
   {
-   buffer.insert(buffer.end(), temp_buffer, temp_buffer + BUFSIZE);
-   strm.next_out = reinterpret_cast<Bytef *>(temp_buffer);
-   strm.avail_out = BUFSIZE;
+    result = samples;
+    outLength = numSamples;
   }
-  res = inflate(&strm, Z_FINISH);
-  if (res < 0)
+#endif
+}
+
+
+/*
+ * Deflates the given bytes, in one go, into a malloc'd buffer of
+ * deflateBound() bytes, in the form uncompress_data() reads.
+ */
+void 
+SampledField::compress_data(const unsigned char* data, int length, int level, unsigned char*& result, int& outLength)
+{
+  outLength = 0;
+  result = NULL;  
+#ifdef USE_ZLIB
+  z_stream strm;
+  memset(&strm, 0, sizeof(strm));
+
+  if (data == NULL || length < 0 || deflateInit(&strm, level) != Z_OK)
+    return;
+
+  uLong capacity = deflateBound(&strm, (uLong)length);
+  Bytef* bytes = (Bytef*)malloc(capacity);
+
+  if (bytes == NULL)
   {
-    outLength = 0;
-    result = NULL;
+    deflateEnd(&strm);
+    return;
   }
- }
 
- buffer.insert(buffer.end(), temp_buffer, temp_buffer + BUFSIZE - strm.avail_out);
- deflateEnd(&strm);
+  strm.next_in = (Bytef*)data;
+  strm.avail_in = (uInt)length;
+  strm.next_out = bytes;
+  strm.avail_out = (uInt)capacity;
+
+  int res = deflate(&strm, Z_FINISH);
+  int numBytes = (int)strm.total_out;
+  deflateEnd(&strm);
 
- outLength = buffer.size();
- result = (int*) malloc(sizeof(int)*outLength);
- for (int i = 0; i < outLength; i++)
-   result[i] = buffer[i];
+  if (res != Z_STREAM_END)
+  {
+    free(bytes);
+    return;
+  }
+
+  result = bytes;
+  outLength = numBytes;
 #endif
 }
 
-void 
-SampledField::copySampleArrays(int* &target, int& targetLength, int* source, int sourceLength)
+/*
+ * The number of samples declared by the "numSamples" attributes, or 0 if
+ * none is set.
+ */
+int 
+SampledField::getExpectedUncompressedLength() const
+{
+  if (!isSetNumSamples1())
+    return 0;
+
+  int expected = getNumSamples1();
+  if (isSetNumSamples2())
+    expected *= getNumSamples2();
+  if (isSetNumSamples3())
+    expected *= getNumSamples3();
+
+  return (expected > 0) ? expected : 0;
+}
+
+
+/*
+ * Deflates the samples in place: their values are written out in the type
+ * given by the "dataType" attribute, in little endian order, and the
+ * deflated bytes replace them, held as bytes.
+ */
+int 
+SampledField::compress(int level)
 {
-    targetLength = sourceLength;
-    target = (int*)malloc(sizeof(int)*sourceLength);
-    memset(target, 0, sizeof(int)*sourceLength);
-    memcpy(target, source, sizeof(int)*sourceLength);
+  if (mCompression == SPATIAL_COMPRESSIONKIND_DEFLATED)
+    return LIBSBML_OPERATION_SUCCESS;
+
+#ifndef USE_ZLIB
+  return LIBSBML_OPERATION_FAILED;
+#else
+  if (mSamples == NULL)
+    return LIBSBML_OPERATION_FAILED;
+
+  size_t size = getSamplesValueSize(mDataType);
+  int numBytes = mSamplesLength * (int)size;
+  unsigned char* values = (unsigned char*)malloc(numBytes > 0 ? numBytes : 1);
+  for (int i = 0; i < mSamplesLength; ++i)
+    setSamplesValue(values, mDataType, i, getSamplesValue(mSamples, mSamplesStorageType, i));
+  swapLittleEndian(values, numBytes, size);
+
+  unsigned char* compressed = NULL;
+  int compressedLength = 0;
+
+  compress_data(values, numBytes, level, compressed, compressedLength);
+  free(values);
+
+  if (compressed == NULL)
+    return LIBSBML_OPERATION_FAILED;
+
+  free(mSamples);
+  mSamples = compressed;
+  mSamplesStorageType = SPATIAL_DATAKIND_UINT8;
+  mSamplesLength = compressedLength;
+  mIsSetSamplesLength = true;
+  mCompression = SPATIAL_COMPRESSIONKIND_DEFLATED;
+  freeUncompressed();
+
+  return LIBSBML_OPERATION_SUCCESS;
+#endif
 }
 
 
@@ -140,7 +140,8 @@ protected:
   bool mIsSetNumSamples3;
   InterpolationKind_t mInterpolationType;
   CompressionKind_t mCompression;
-  int* mSamples;
+  void* mSamples;
+  DataKind_t mSamplesStorageType;
   int mSamplesLength;
   bool mIsSetSamplesLength;
 
@@ -359,10 +360,41 @@ public:
    *
    * @note the value of the "samples" attribute of this SampledField is
    * returned in the argument array.
+   * @note the values are converted from the type they are stored in; see
+   * getSamplesStorageType().
    */
   void getSamples(int* outArray) const;
 
 
+  /**
+   * Returns the values of the "samples" attribute of this SampledField without
+   * converting them.
+   *
+   * @return the getSamplesLength() values of the "samples" attribute of this
+   * SampledField, of the type returned by getSamplesStorageType(), or @c NULL
+   * if it is not set.
+   *
+   * @note the values are owned by this SampledField and are invalidated when
+   * the "samples" attribute is set or unset.
+   */
+  const void* getSamplesStorage() const;
+
+
+  /**
+   * Returns the type in which the values of the "samples" attribute of this
+   * SampledField are stored.
+   *
+   * @return the type of the values returned by getSamplesStorage().
+   *
+   * Values set from integers or read from text are stored in the first of
+   * bytes (@sbmlconstant{SPATIAL_DATAKIND_UINT8, DataKind_t}), values of type
+   * int (@sbmlconstant{SPATIAL_DATAKIND_INVALID, DataKind_t}) and doubles
+   * (@sbmlconstant{SPATIAL_DATAKIND_DOUBLE, DataKind_t}) that holds them all
+   * exactly, whatever the "dataType" attribute.
+   */
+  DataKind_t getSamplesStorageType() const;
+
+
   /**
    * Returns the value of the "samplesLength" attribute of this SampledField.
    *
@@ -628,10 +660,35 @@ public:
    * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
    * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
    * OperationReturnValues_t}
+   *
+   * @note the values are converted to the type they are stored in; see
+   * getSamplesStorageType().
    */
   int setSamples(int* inArray, int arrayLength);
 
 
+  /**
+   * Sets the value of the "samples" attribute of this SampledField from values
+   * of the given type.
+   *
+   * @param inArray the values of the "samples" attribute to be set, which are
+   * copied without being converted.
+   *
+   * @param type DataKind_t value giving the type of the values in inArray.
+   *
+   * @param arrayLength int value for the number of values in inArray.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   *
+   * @note values of type @sbmlconstant{SPATIAL_DATAKIND_INVALID, DataKind_t}
+   * are taken to be of type int.
+   */
+  int setSamples(const void* inArray, DataKind_t type, int arrayLength);
+
+
   /**
    * Sets the value of the "samplesLength" attribute of this SampledField.
    *
@@ -1129,12 +1186,64 @@ protected:
   /** @endcond */
 
 
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the number of bytes taken by one value of the given type
+   */
+  static size_t getSamplesValueSize(DataKind_t type);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns a value of an array of the given type
+   */
+  static double getSamplesValue(const void* data, DataKind_t type, int index);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets a value of an array of the given type
+   */
+  static void setSamplesValue(void* data,
+                              DataKind_t type,
+                              int index,
+                              double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the type in which values of the given type are stored together
+   * with the given value: the first of bytes, the element type and doubles
+   * that holds them all exactly
+   */
+  static DataKind_t getSamplesValueType(DataKind_t type, double value);
+
+  /** @endcond */
+
+
 protected:
-  int* mUncompressedSamples;
+  void* mUncompressedData;
+  DataKind_t mUncompressedType;
   int mUncompressedLength;
 
-  static void copySampleArrays(int* &target, int& targetLength, int* source, int sourceLength);
-  static void uncompress_data(void *data, size_t length, int*& result, int& outLength);
+  static void uncompress_data(const unsigned char* data, int length, int expectedLength, unsigned char*& result, int& outLength);
+  static void compress_data(const unsigned char* data, int length, int level, unsigned char*& result, int& outLength);
+
+  int getExpectedUncompressedLength() const;
 
 public:
 
@@ -1164,6 +1273,20 @@ public:
    */
   void uncompress();
 
+  /** 
+   * Deflates the samples of this SampledField, replacing them by the compressed
+   * data (one byte per sample).  The values are deflated in the type given by
+   * the "dataType" attribute, in little endian order.
+   *
+   * @param level the zlib compression level, from 0 to 9, or -1 for the
+   *              default.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int compress(int level = -1);
+
   /**  
    *  Returns the data of this image as uncompressed array of integers
    * 
@@ -1174,6 +1297,61 @@ public:
    */
   void getUncompressedData(int* &data, int& length);
 
+  /**
+   * Returns the type of the samples held by the buffer returned by
+   * getUncompressedBuffer().
+   *
+   * Inflated samples are held in the type given by the "dataType" attribute,
+   * or as plain integers (@sbmlconstant{SPATIAL_DATAKIND_INVALID, DataKind_t})
+   * if it is not set; samples that are not deflated are read in place, in
+   * the type returned by getSamplesStorageType().
+   *
+   * @return the type of the uncompressed samples of this SampledField.
+   */
+  DataKind_t getUncompressedType();
+
+  /**
+   * Returns the uncompressed samples of this SampledField without
+   * converting them; the buffer holds getUncompressedLength() samples of
+   * the type returned by getUncompressedType().
+   *
+   * The buffer is owned by this SampledField and is invalidated by
+   * freeUncompressed() and by changing the samples.
+   *
+   * @return the uncompressed samples of this SampledField.
+   */
+  const void* getUncompressedBuffer();
+
+  /**
+   * Returns the uncompressed samples of this SampledField if they are held
+   * as bytes, @c NULL otherwise.
+   */
+  const unsigned char* getUncompressedUInt8();
+
+  /**
+   * Returns the uncompressed samples of this SampledField if they are held
+   * as 16 bit unsigned integers, @c NULL otherwise.
+   */
+  const unsigned short* getUncompressedUInt16();
+
+  /**
+   * Returns the uncompressed samples of this SampledField if they are held
+   * as 32 bit unsigned integers, @c NULL otherwise.
+   */
+  const unsigned int* getUncompressedUInt32();
+
+  /**
+   * Returns the uncompressed samples of this SampledField if they are held
+   * as floats, @c NULL otherwise.
+   */
+  const float* getUncompressedFloat();
+
+  /**
+   * Returns the uncompressed samples of this SampledField if they are held
+   * as doubles, @c NULL otherwise.
+   */
+  const double* getUncompressedDouble();
+
 
 
 };
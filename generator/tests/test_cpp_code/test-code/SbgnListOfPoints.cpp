@@ -100,6 +100,36 @@ SbgnListOfPoints::operator=(const SbgnListOfPoints& rhs)
 }
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SbgnListOfPoints.
+ */
+SbgnListOfPoints::SbgnListOfPoints(SbgnListOfPoints&& orig)
+  : SbgnListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SbgnListOfPoints.
+ */
+SbgnListOfPoints&
+SbgnListOfPoints::operator=(SbgnListOfPoints&& rhs)
+{
+  if (&rhs != this)
+  {
+    SbgnListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SbgnListOfPoints object.
  */
@@ -144,8 +174,7 @@ SbgnListOfPoints::get(unsigned int n) const
 Point*
 SbgnListOfPoints::get(const std::string& sid)
 {
-  return const_cast<Point*>(static_cast<const
-    SbgnListOfPoints&>(*this).get(sid));
+  return static_cast<Point*>(getItemById(sid));
 }
 
 
@@ -155,9 +184,7 @@ SbgnListOfPoints::get(const std::string& sid)
 const Point*
 SbgnListOfPoints::get(const std::string& sid) const
 {
-  vector<SbgnBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SbgnIdEq<Point>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const Point*> (*result);
+  return static_cast<const Point*>(getItemById(sid));
 }
 
 
@@ -179,18 +206,7 @@ SbgnListOfPoints::remove(unsigned int n)
 Point*
 SbgnListOfPoints::remove(const std::string& sid)
 {
-  SbgnBase* item = NULL;
-  vector<SbgnBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SbgnIdEq<Point>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <Point*> (item);
+  return static_cast<Point*>(removeItemById(sid));
 }
 
 
@@ -249,7 +265,7 @@ SbgnListOfPoints::createPoint()
 
   try
   {
-    p = new Point(getSbgnNamespaces());
+    p = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
   }
   catch (...)
   {
@@ -325,7 +341,7 @@ SbgnListOfPoints::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == mElementName)
   {
-    object = new Point(getSbgnNamespaces());
+    object = new (getDocumentArena()) Point(getSharedSbgnNamespaces());
     if (object)
     {
       dynamic_cast<Point*>(object)->setElementName(name);
@@ -117,6 +117,28 @@ public:
   SbgnListOfPoints& operator=(const SbgnListOfPoints& rhs);
 
 
+#ifdef LIBSBGN_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SbgnListOfPoints.
+   *
+   * @param orig the SbgnListOfPoints instance to move; it is left as an empty
+   * SbgnListOfPoints in the place it had.
+   */
+  SbgnListOfPoints(SbgnListOfPoints&& orig);
+
+
+  /**
+   * Move assignment operator for SbgnListOfPoints.
+   *
+   * @param rhs the SbgnListOfPoints object whose values are to be moved into
+   * this one; it is left as an empty SbgnListOfPoints in the place it had.
+   */
+  SbgnListOfPoints& operator=(SbgnListOfPoints&& rhs);
+
+
+#endif  /* LIBSBGN_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SbgnListOfPoints object.
    *
@@ -36,6 +36,7 @@
  */
 #include <sbml/packages/spatial/sbml/SpatialPoints.h>
 #include <sbml/packages/spatial/validator/SpatialSBMLError.h>
+#include <sbml/util/util.h>
 
 
 using namespace std;
@@ -589,10 +590,40 @@ SpatialPoints::write(XMLOutputStream& stream) const
 
   if (isSetArrayData())
   {
+    std::string chunk;
+    char value[32];
+    chunk.reserve(4096);
     for (int i = 0; i < mArrayDataLength; ++i)
     {
-      stream << (double)mArrayData[i] << " ";
+      double number = (double)mArrayData[i];
+
+      if (util_isNaN(number))
+      {
+        chunk.append("NaN ");
+      }
+      else if (util_isInf(number) > 0)
+      {
+        chunk.append("INF ");
+      }
+      else if (util_isInf(number) < 0)
+      {
+        chunk.append("-INF ");
+      }
+      else
+      {
+        int numChars = c_locale_snprintf(value, sizeof(value), "%.15g ",
+          number);
+        chunk.append(value, numChars);
+      }
+
+      if (chunk.size() > 4000)
+      {
+        stream << chunk;
+        chunk.clear();
+      }
     }
+
+    stream << chunk;
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -752,25 +783,45 @@ SpatialPoints::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "compression")
+  switch (attributeName.size())
   {
-    value = isSetCompression();
-  }
-  else if (attributeName == "arrayData")
-  {
-    value = isSetArrayData();
-  }
-  else if (attributeName == "arrayDataLength")
-  {
-    value = isSetArrayDataLength();
-  }
-  else if (attributeName == "dataType")
-  {
-    value = isSetDataType();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "dataType")
+    {
+      value = isSetDataType();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "arrayData")
+    {
+      value = isSetArrayData();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "compression")
+    {
+      value = isSetCompression();
+    }
+
+    break;
+  case 15:
+    if (attributeName == "arrayDataLength")
+    {
+      value = isSetArrayDataLength();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -895,25 +946,45 @@ SpatialPoints::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "compression")
-  {
-    value = unsetCompression();
-  }
-  else if (attributeName == "arrayData")
-  {
-    value = unsetArrayData();
-  }
-  else if (attributeName == "arrayDataLength")
+  switch (attributeName.size())
   {
-    value = unsetArrayDataLength();
-  }
-  else if (attributeName == "dataType")
-  {
-    value = unsetDataType();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "dataType")
+    {
+      value = unsetDataType();
+    }
+
+    break;
+  case 9:
+    if (attributeName == "arrayData")
+    {
+      value = unsetArrayData();
+    }
+
+    break;
+  case 11:
+    if (attributeName == "compression")
+    {
+      value = unsetCompression();
+    }
+
+    break;
+  case 15:
+    if (attributeName == "arrayDataLength")
+    {
+      value = unsetArrayDataLength();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1178,27 +1249,49 @@ SpatialPoints::writeAttributes(XMLOutputStream& stream) const
 void
 SpatialPoints::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  double val;
-  vector<double> valuesVector;
+  const char* current = text.c_str();
+  char* next = NULL;
+  unsigned int length = 0;
+  bool inValue = false;
 
-  while (strStream >> val)
+  for (const char* c = current; *c != '\0'; ++c)
   {
-    valuesVector.push_back(val);
-  }
+    bool isSpace = (isspace((unsigned char)*c) != 0);
+    if (!isSpace && !inValue)
+    {
+      ++length;
+    }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+    inValue = !isSpace;
+  }
 
   if (length > 0)
   {
     double* data = new double[length];
-    for (unsigned int i = 0; i < length; ++i)
+    unsigned int numValues = 0;
+    while (numValues < length)
     {
-      data[i] = valuesVector.at(i);
+      double value = c_locale_strtod(current, &next);
+      if (next == current)
+      {
+        break;
+      }
+
+      data[numValues++] = (double)value;
+      current = next;
     }
 
-    setArrayData(data, length);
-    delete[] data;
+    if (numValues > 0)
+    {
+      delete[] mArrayData;
+      mArrayData = data;
+      mArrayDataLength = (int)numValues;
+      mIsSetArrayDataLength = true;
+    }
+    else
+    {
+      delete[] data;
+    }
   }
 }
 
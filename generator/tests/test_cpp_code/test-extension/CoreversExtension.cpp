@@ -327,18 +327,28 @@ CoreversExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize =
     sizeof(coreversErrorTable)/sizeof(coreversErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int lower = 0;
+  unsigned int upper = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  while (lower < upper)
   {
-    if (errorId == coreversErrorTable[i].code)
+    unsigned int middle = lower + (upper - lower) / 2;
+    if (coreversErrorTable[middle].code < errorId)
     {
-      index = i;
-      break;
+      lower = middle + 1;
     }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  if (lower < tableSize && coreversErrorTable[lower].code == errorId)
+  {
+    return lower;
   }
 
-  return index;
+  return 0;
 }
 
 /** @endcond */
@@ -44,6 +44,8 @@
 #include <sbml/packages/groups/validator/GroupsSBMLErrorTable.h>
 #include <sbml/packages/groups/extension/GroupsModelPlugin.h>
 
+#include <cstring>
+
 
 using namespace std;
 
@@ -328,18 +330,28 @@ GroupsExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize =
     sizeof(groupsErrorTable)/sizeof(groupsErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int lower = 0;
+  unsigned int upper = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  while (lower < upper)
   {
-    if (errorId == groupsErrorTable[i].code)
+    unsigned int middle = lower + (upper - lower) / 2;
+    if (groupsErrorTable[middle].code < errorId)
+    {
+      lower = middle + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      upper = middle;
     }
   }
 
-  return index;
+  if (lower < tableSize && groupsErrorTable[lower].code == errorId)
+  {
+    return lower;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -442,16 +454,36 @@ LIBSBML_EXTERN
 GroupKind_t
 GroupKind_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_GROUP_KIND_STRINGS)/sizeof(SBML_GROUP_KIND_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return GROUP_KIND_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_GROUP_KIND_STRINGS[i])
+  case 9:
+    if (strcmp(code, SBML_GROUP_KIND_STRINGS[1]) == 0)
+    {
+      return GROUP_KIND_PARTONOMY;
+    }
+
+    break;
+  case 10:
+    if (strcmp(code, SBML_GROUP_KIND_STRINGS[2]) == 0)
     {
-      return (GroupKind_t)(i);
+      return GROUP_KIND_COLLECTION;
     }
+
+    break;
+  case 14:
+    if (strcmp(code, SBML_GROUP_KIND_STRINGS[0]) == 0)
+    {
+      return GROUP_KIND_CLASSIFICATION;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return GROUP_KIND_INVALID;
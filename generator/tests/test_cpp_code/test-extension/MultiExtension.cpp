@@ -48,6 +48,8 @@
 #include <sbml/packages/multi/extension/MultiSimpleSpeciesReferencePlugin.h>
 #include <sbml/packages/multi/extension/MultiSpeciesReferencePlugin.h>
 
+#include <cstring>
+
 
 using namespace std;
 
@@ -343,18 +345,28 @@ unsigned int
 MultiExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(multiErrorTable)/sizeof(multiErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int lower = 0;
+  unsigned int upper = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  while (lower < upper)
   {
-    if (errorId == multiErrorTable[i].code)
+    unsigned int middle = lower + (upper - lower) / 2;
+    if (multiErrorTable[middle].code < errorId)
+    {
+      lower = middle + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      upper = middle;
     }
   }
 
-  return index;
+  if (lower < tableSize && multiErrorTable[lower].code == errorId)
+  {
+    return lower;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -476,15 +488,36 @@ LIBSBML_EXTERN
 BindingStatus_t
 BindingStatus_fromString(const char* code)
 {
-  static int size = sizeof(SBML_BINDING_STATUS_STRINGS)/sizeof(SBML_BINDING_STATUS_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return MULTI_BINDING_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_BINDING_STATUS_STRINGS[i])
+  case 5:
+    if (strcmp(code, SBML_BINDING_STATUS_STRINGS[0]) == 0)
+    {
+      return MULTI_BINDING_STATUS_BOUND;
+    }
+
+    break;
+  case 6:
+    if (strcmp(code, SBML_BINDING_STATUS_STRINGS[2]) == 0)
+    {
+      return MULTI_BINDING_STATUS_EITHER;
+    }
+
+    break;
+  case 7:
+    if (strcmp(code, SBML_BINDING_STATUS_STRINGS[1]) == 0)
     {
-      return (BindingStatus_t)(i);
+      return MULTI_BINDING_STATUS_UNBOUND;
     }
+
+    break;
+  default:
+    break;
   }
 
   return MULTI_BINDING_INVALID;
@@ -562,16 +595,33 @@ LIBSBML_EXTERN
 Relation_t
 Relation_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_RELATION_STRINGS)/sizeof(SBML_RELATION_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return MULTI_RELATION_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_RELATION_STRINGS[i])
+  case 2:
+    if (strcmp(code, SBML_RELATION_STRINGS[1]) == 0)
+    {
+      return MULTI_RELATION_OR;
+    }
+
+    break;
+  case 3:
+    if (strcmp(code, SBML_RELATION_STRINGS[0]) == 0)
+    {
+      return MULTI_RELATION_AND;
+    }
+    else if (strcmp(code, SBML_RELATION_STRINGS[2]) == 0)
     {
-      return (Relation_t)(i);
+      return MULTI_RELATION_NOT;
     }
+
+    break;
+  default:
+    break;
   }
 
   return MULTI_RELATION_INVALID;
@@ -650,15 +700,29 @@ LIBSBML_EXTERN
 RepresentationType_t
 RepresentationType_fromString(const char* code)
 {
-  static int size = sizeof(SBML_REPRESENTATION_TYPE_STRINGS)/sizeof(SBML_REPRESENTATION_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return MULTI_REPRESENTATIONTYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_REPRESENTATION_TYPE_STRINGS[i])
+  case 3:
+    if (strcmp(code, SBML_REPRESENTATION_TYPE_STRINGS[0]) == 0)
     {
-      return (RepresentationType_t)(i);
+      return MULTI_REPRESENTATIONTYPE_SUM;
     }
+
+    break;
+  case 12:
+    if (strcmp(code, SBML_REPRESENTATION_TYPE_STRINGS[1]) == 0)
+    {
+      return MULTI_REPRESENTATIONTYPE_NUMERICVALUE;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return MULTI_REPRESENTATIONTYPE_INVALID;
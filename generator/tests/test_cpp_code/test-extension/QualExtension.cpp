@@ -44,6 +44,8 @@
 #include <sbml/packages/qual/validator/QualSBMLErrorTable.h>
 #include <sbml/packages/qual/extension/QualModelPlugin.h>
 
+#include <cstring>
+
 
 using namespace std;
 
@@ -331,18 +333,28 @@ unsigned int
 QualExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(qualErrorTable)/sizeof(qualErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int lower = 0;
+  unsigned int upper = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  while (lower < upper)
   {
-    if (errorId == qualErrorTable[i].code)
+    unsigned int middle = lower + (upper - lower) / 2;
+    if (qualErrorTable[middle].code < errorId)
+    {
+      lower = middle + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      upper = middle;
     }
   }
 
-  return index;
+  if (lower < tableSize && qualErrorTable[lower].code == errorId)
+  {
+    return lower;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -446,15 +458,40 @@ LIBSBML_EXTERN
 Sign_t
 Sign_fromString(const char* code)
 {
-  static int size = sizeof(SBML_SIGN_STRINGS)/sizeof(SBML_SIGN_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return INPUT_SIGN_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_SIGN_STRINGS[i])
+  case 4:
+    if (strcmp(code, SBML_SIGN_STRINGS[2]) == 0)
+    {
+      return INPUT_SIGN_DUAL;
+    }
+
+    break;
+  case 7:
+    if (strcmp(code, SBML_SIGN_STRINGS[3]) == 0)
+    {
+      return INPUT_SIGN_UNKNOWN;
+    }
+
+    break;
+  case 8:
+    if (strcmp(code, SBML_SIGN_STRINGS[0]) == 0)
     {
-      return (Sign_t)(i);
+      return INPUT_SIGN_POSITIVE;
     }
+    else if (strcmp(code, SBML_SIGN_STRINGS[1]) == 0)
+    {
+      return INPUT_SIGN_NEGATIVE;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return INPUT_SIGN_INVALID;
@@ -533,15 +570,29 @@ LIBSBML_EXTERN
 TransitionOutputEffect_t
 TransitionOutputEffect_fromString(const char* code)
 {
-  static int size = sizeof(SBML_TRANSITION_OUTPUT_EFFECT_STRINGS)/sizeof(SBML_TRANSITION_OUTPUT_EFFECT_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return OUTPUT_TRANSITION_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_TRANSITION_OUTPUT_EFFECT_STRINGS[i])
+  case 10:
+    if (strcmp(code, SBML_TRANSITION_OUTPUT_EFFECT_STRINGS[0]) == 0)
+    {
+      return OUTPUT_TRANSITION_EFFECT_PRODUCTION;
+    }
+
+    break;
+  case 16:
+    if (strcmp(code, SBML_TRANSITION_OUTPUT_EFFECT_STRINGS[1]) == 0)
     {
-      return (TransitionOutputEffect_t)(i);
+      return OUTPUT_TRANSITION_EFFECT_ASSIGNMENT_LEVEL;
     }
+
+    break;
+  default:
+    break;
   }
 
   return OUTPUT_TRANSITION_INVALID;
@@ -621,15 +672,29 @@ LIBSBML_EXTERN
 TransitionInputEffect_t
 TransitionInputEffect_fromString(const char* code)
 {
-  static int size = sizeof(SBML_TRANSITION_INPUT_EFFECT_STRINGS)/sizeof(SBML_TRANSITION_INPUT_EFFECT_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return INPUT_TRANSITION_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_TRANSITION_INPUT_EFFECT_STRINGS[i])
+  case 4:
+    if (strcmp(code, SBML_TRANSITION_INPUT_EFFECT_STRINGS[0]) == 0)
     {
-      return (TransitionInputEffect_t)(i);
+      return INPUT_TRANSITION_EFFECT_NONE;
     }
+
+    break;
+  case 11:
+    if (strcmp(code, SBML_TRANSITION_INPUT_EFFECT_STRINGS[1]) == 0)
+    {
+      return INPUT_TRANSITION_EFFECT_CONSUMPTION;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return INPUT_TRANSITION_INVALID;
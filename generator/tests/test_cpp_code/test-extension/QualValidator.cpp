@@ -130,7 +130,7 @@ public:
 
 protected:
 
-  std::list< TConstraint<T>* > constraints;
+  std::vector< TConstraint<T>* > constraints;
 };
 
 
@@ -149,7 +149,7 @@ struct QualValidatorConstraints
   ConstraintSet<DefaultTerm>                    mDefaultTerm;
   ConstraintSet<FunctionTerm>                   mFunctionTerm;
 
-  map<VConstraint*, bool> ptrMap;
+  vector<VConstraint*> constraints;
 
   ~QualValidatorConstraints();
 
@@ -163,15 +163,11 @@ struct QualValidatorConstraints
  */
 QualValidatorConstraints::~QualValidatorConstraints()
 {
-  map<VConstraint*, bool>::iterator it = ptrMap.begin();
+  vector<VConstraint*>::iterator it = constraints.begin();
 
-  while (it != ptrMap.end())
+  while (it != constraints.end())
   {
-    if (it->second)
-    {
-      delete it->first;
-    }
-
+    delete *it;
     ++it;
   }
 }
@@ -185,7 +181,7 @@ QualValidatorConstraints::add(VConstraint* c)
 {
   if (c == NULL) return;
 
-  ptrMap.insert(pair<VConstraint*, bool>(c, true));
+  constraints.push_back(c);
 
   if (dynamic_cast< TConstraint<SBMLDocument>* >(c) != NULL)
   {
@@ -311,45 +307,23 @@ public:
       return SBMLVisitor::visit(x);
     }
 
-    int code = x.getTypeCode();
-
-    const ListOf* list = dynamic_cast<const ListOf*>(&x);
-
-    if (list != NULL)
+    switch (x.getTypeCode())
     {
+    case SBML_QUAL_QUALITATIVE_SPECIES:
+      return visit((const QualitativeSpecies&)x);
+    case SBML_QUAL_TRANSITION:
+      return visit((const Transition&)x);
+    case SBML_QUAL_INPUT:
+      return visit((const Input&)x);
+    case SBML_QUAL_OUTPUT:
+      return visit((const Output&)x);
+    case SBML_QUAL_DEFAULT_TERM:
+      return visit((const DefaultTerm&)x);
+    case SBML_QUAL_FUNCTION_TERM:
+      return visit((const FunctionTerm&)x);
+    default:
       return SBMLVisitor::visit(x);
     }
-    else
-    {
-      if (code == SBML_QUAL_QUALITATIVE_SPECIES)
-      {
-        return visit((const QualitativeSpecies&)x);
-      }
-      else if (code == SBML_QUAL_TRANSITION)
-      {
-        return visit((const Transition&)x);
-      }
-      else if (code == SBML_QUAL_INPUT)
-      {
-        return visit((const Input&)x);
-      }
-      else if (code == SBML_QUAL_OUTPUT)
-      {
-        return visit((const Output&)x);
-      }
-      else if (code == SBML_QUAL_DEFAULT_TERM)
-      {
-        return visit((const DefaultTerm&)x);
-      }
-      else if (code == SBML_QUAL_FUNCTION_TERM)
-      {
-        return visit((const FunctionTerm&)x);
-      }
-      else
-      {
-        return SBMLVisitor::visit(x);
-      }
-    }
   }
 
 
@@ -393,6 +367,111 @@ QualValidator::addConstraint(VConstraint* c)
 }
 
 
+/*
+ * Adds the given constraint on SBMLDocument objects to this QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<SBMLDocument>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mSBMLDocument.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Model objects to this QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<Model>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mModel.add(c);
+}
+
+
+/*
+ * Adds the given constraint on QualitativeSpecies objects to this
+ * QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<QualitativeSpecies>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mQualitativeSpecies.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Transition objects to this QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<Transition>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mTransition.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Input objects to this QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<Input>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mInput.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Output objects to this QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<Output>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mOutput.add(c);
+}
+
+
+/*
+ * Adds the given constraint on DefaultTerm objects to this QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<DefaultTerm>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mDefaultTerm.add(c);
+}
+
+
+/*
+ * Adds the given constraint on FunctionTerm objects to this QualValidator.
+ */
+void
+QualValidator::addConstraint(TConstraint<FunctionTerm>* c)
+{
+  if (c == NULL) return;
+
+  mQualConstraints->constraints.push_back(c);
+  mQualConstraints->mFunctionTerm.add(c);
+}
+
+
 /*
  * Validates the given SBMLDocument
  */
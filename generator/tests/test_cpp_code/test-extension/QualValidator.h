@@ -66,6 +66,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 /** @endcond */
 
@@ -78,8 +79,16 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 
 
 class VConstraint;
+template <typename T> class TConstraint;
 struct QualValidatorConstraints;
 class SBMLDocument;
+class Model;
+class QualitativeSpecies;
+class Transition;
+class Input;
+class Output;
+class DefaultTerm;
+class FunctionTerm;
 
 
 class QualValidator : public Validator
@@ -118,6 +127,103 @@ public:
   virtual void addConstraint(VConstraint* c);
 
 
+  /**
+   * Adds the given constraint on SBMLDocument objects to this QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<SBMLDocument>* c);
+
+
+  /**
+   * Adds the given constraint on Model objects to this QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Model>* c);
+
+
+  /**
+   * Adds the given constraint on QualitativeSpecies objects to this
+   * QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<QualitativeSpecies>* c);
+
+
+  /**
+   * Adds the given constraint on Transition objects to this QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Transition>* c);
+
+
+  /**
+   * Adds the given constraint on Input objects to this QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Input>* c);
+
+
+  /**
+   * Adds the given constraint on Output objects to this QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Output>* c);
+
+
+  /**
+   * Adds the given constraint on DefaultTerm objects to this QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<DefaultTerm>* c);
+
+
+  /**
+   * Adds the given constraint on FunctionTerm objects to this QualValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<FunctionTerm>* c);
+
+
   /**
    * Validates the given SBMLDocument
    *
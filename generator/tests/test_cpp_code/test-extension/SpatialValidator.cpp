@@ -130,7 +130,7 @@ public:
 
 protected:
 
-  std::list< TConstraint<T>* > constraints;
+  std::vector< TConstraint<T>* > constraints;
 };
 
 
@@ -177,7 +177,7 @@ struct SpatialValidatorConstraints
   ConstraintSet<OrdinalMapping>                 mOrdinalMapping;
   ConstraintSet<SpatialPoints>                  mSpatialPoints;
 
-  map<VConstraint*, bool> ptrMap;
+  vector<VConstraint*> constraints;
 
   ~SpatialValidatorConstraints();
 
@@ -191,15 +191,11 @@ struct SpatialValidatorConstraints
  */
 SpatialValidatorConstraints::~SpatialValidatorConstraints()
 {
-  map<VConstraint*, bool>::iterator it = ptrMap.begin();
+  vector<VConstraint*>::iterator it = constraints.begin();
 
-  while (it != ptrMap.end())
+  while (it != constraints.end())
   {
-    if (it->second)
-    {
-      delete it->first;
-    }
-
+    delete *it;
     ++it;
   }
 }
@@ -213,7 +209,7 @@ SpatialValidatorConstraints::add(VConstraint* c)
 {
   if (c == NULL) return;
 
-  ptrMap.insert(pair<VConstraint*, bool>(c, true));
+  constraints.push_back(c);
 
   if (dynamic_cast< TConstraint<SBMLDocument>* >(c) != NULL)
   {
@@ -740,157 +736,79 @@ public:
       return SBMLVisitor::visit(x);
     }
 
-    int code = x.getTypeCode();
-
-    const ListOf* list = dynamic_cast<const ListOf*>(&x);
-
-    if (list != NULL)
+    switch (x.getTypeCode())
     {
+    case SBML_SPATIAL_DOMAINTYPE:
+      return visit((const DomainType&)x);
+    case SBML_SPATIAL_DOMAIN:
+      return visit((const Domain&)x);
+    case SBML_SPATIAL_INTERIORPOINT:
+      return visit((const InteriorPoint&)x);
+    case SBML_SPATIAL_BOUNDARY:
+      return visit((const Boundary&)x);
+    case SBML_SPATIAL_ADJACENTDOMAINS:
+      return visit((const AdjacentDomains&)x);
+    case SBML_SPATIAL_GEOMETRYDEFINITION:
+      return visit((const GeometryDefinition&)x);
+    case SBML_SPATIAL_COMPARTMENTMAPPING:
+      return visit((const CompartmentMapping&)x);
+    case SBML_SPATIAL_COORDINATECOMPONENT:
+      return visit((const CoordinateComponent&)x);
+    case SBML_SPATIAL_SAMPLEDFIELDGEOMETRY:
+      return visit((const SampledFieldGeometry&)x);
+    case SBML_SPATIAL_SAMPLEDFIELD:
+      return visit((const SampledField&)x);
+    case SBML_SPATIAL_SAMPLEDVOLUME:
+      return visit((const SampledVolume&)x);
+    case SBML_SPATIAL_ANALYTICGEOMETRY:
+      return visit((const AnalyticGeometry&)x);
+    case SBML_SPATIAL_ANALYTICVOLUME:
+      return visit((const AnalyticVolume&)x);
+    case SBML_SPATIAL_PARAMETRICGEOMETRY:
+      return visit((const ParametricGeometry&)x);
+    case SBML_SPATIAL_PARAMETRICOBJECT:
+      return visit((const ParametricObject&)x);
+    case SBML_SPATIAL_CSGEOMETRY:
+      return visit((const CSGeometry&)x);
+    case SBML_SPATIAL_CSGOBJECT:
+      return visit((const CSGObject&)x);
+    case SBML_SPATIAL_CSGNODE:
+      return visit((const CSGNode&)x);
+    case SBML_SPATIAL_CSGTRANSFORMATION:
+      return visit((const CSGTransformation&)x);
+    case SBML_SPATIAL_CSGTRANSLATION:
+      return visit((const CSGTranslation&)x);
+    case SBML_SPATIAL_CSGROTATION:
+      return visit((const CSGRotation&)x);
+    case SBML_SPATIAL_CSGSCALE:
+      return visit((const CSGScale&)x);
+    case SBML_SPATIAL_CSGHOMOGENEOUSTRANSFORMATION:
+      return visit((const CSGHomogeneousTransformation&)x);
+    case SBML_SPATIAL_TRANSFORMATIONCOMPONENT:
+      return visit((const TransformationComponent&)x);
+    case SBML_SPATIAL_CSGPRIMITIVE:
+      return visit((const CSGPrimitive&)x);
+    case SBML_SPATIAL_CSGSETOPERATOR:
+      return visit((const CSGSetOperator&)x);
+    case SBML_SPATIAL_SPATIALSYMBOLREFERENCE:
+      return visit((const SpatialSymbolReference&)x);
+    case SBML_SPATIAL_DIFFUSIONCOEFFICIENT:
+      return visit((const DiffusionCoefficient&)x);
+    case SBML_SPATIAL_ADVECTIONCOEFFICIENT:
+      return visit((const AdvectionCoefficient&)x);
+    case SBML_SPATIAL_BOUNDARYCONDITION:
+      return visit((const BoundaryCondition&)x);
+    case SBML_SPATIAL_GEOMETRY:
+      return visit((const Geometry&)x);
+    case SBML_SPATIAL_MIXEDGEOMETRY:
+      return visit((const MixedGeometry&)x);
+    case SBML_SPATIAL_ORDINALMAPPING:
+      return visit((const OrdinalMapping&)x);
+    case SBML_SPATIAL_SPATIALPOINTS:
+      return visit((const SpatialPoints&)x);
+    default:
       return SBMLVisitor::visit(x);
     }
-    else
-    {
-      if (code == SBML_SPATIAL_DOMAINTYPE)
-      {
-        return visit((const DomainType&)x);
-      }
-      else if (code == SBML_SPATIAL_DOMAIN)
-      {
-        return visit((const Domain&)x);
-      }
-      else if (code == SBML_SPATIAL_INTERIORPOINT)
-      {
-        return visit((const InteriorPoint&)x);
-      }
-      else if (code == SBML_SPATIAL_BOUNDARY)
-      {
-        return visit((const Boundary&)x);
-      }
-      else if (code == SBML_SPATIAL_ADJACENTDOMAINS)
-      {
-        return visit((const AdjacentDomains&)x);
-      }
-      else if (code == SBML_SPATIAL_GEOMETRYDEFINITION)
-      {
-        return visit((const GeometryDefinition&)x);
-      }
-      else if (code == SBML_SPATIAL_COMPARTMENTMAPPING)
-      {
-        return visit((const CompartmentMapping&)x);
-      }
-      else if (code == SBML_SPATIAL_COORDINATECOMPONENT)
-      {
-        return visit((const CoordinateComponent&)x);
-      }
-      else if (code == SBML_SPATIAL_SAMPLEDFIELDGEOMETRY)
-      {
-        return visit((const SampledFieldGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_SAMPLEDFIELD)
-      {
-        return visit((const SampledField&)x);
-      }
-      else if (code == SBML_SPATIAL_SAMPLEDVOLUME)
-      {
-        return visit((const SampledVolume&)x);
-      }
-      else if (code == SBML_SPATIAL_ANALYTICGEOMETRY)
-      {
-        return visit((const AnalyticGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_ANALYTICVOLUME)
-      {
-        return visit((const AnalyticVolume&)x);
-      }
-      else if (code == SBML_SPATIAL_PARAMETRICGEOMETRY)
-      {
-        return visit((const ParametricGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_PARAMETRICOBJECT)
-      {
-        return visit((const ParametricObject&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGEOMETRY)
-      {
-        return visit((const CSGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGOBJECT)
-      {
-        return visit((const CSGObject&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGNODE)
-      {
-        return visit((const CSGNode&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGTRANSFORMATION)
-      {
-        return visit((const CSGTransformation&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGTRANSLATION)
-      {
-        return visit((const CSGTranslation&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGROTATION)
-      {
-        return visit((const CSGRotation&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGSCALE)
-      {
-        return visit((const CSGScale&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGHOMOGENEOUSTRANSFORMATION)
-      {
-        return visit((const CSGHomogeneousTransformation&)x);
-      }
-      else if (code == SBML_SPATIAL_TRANSFORMATIONCOMPONENT)
-      {
-        return visit((const TransformationComponent&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGPRIMITIVE)
-      {
-        return visit((const CSGPrimitive&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGSETOPERATOR)
-      {
-        return visit((const CSGSetOperator&)x);
-      }
-      else if (code == SBML_SPATIAL_SPATIALSYMBOLREFERENCE)
-      {
-        return visit((const SpatialSymbolReference&)x);
-      }
-      else if (code == SBML_SPATIAL_DIFFUSIONCOEFFICIENT)
-      {
-        return visit((const DiffusionCoefficient&)x);
-      }
-      else if (code == SBML_SPATIAL_ADVECTIONCOEFFICIENT)
-      {
-        return visit((const AdvectionCoefficient&)x);
-      }
-      else if (code == SBML_SPATIAL_BOUNDARYCONDITION)
-      {
-        return visit((const BoundaryCondition&)x);
-      }
-      else if (code == SBML_SPATIAL_GEOMETRY)
-      {
-        return visit((const Geometry&)x);
-      }
-      else if (code == SBML_SPATIAL_MIXEDGEOMETRY)
-      {
-        return visit((const MixedGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_ORDINALMAPPING)
-      {
-        return visit((const OrdinalMapping&)x);
-      }
-      else if (code == SBML_SPATIAL_SPATIALPOINTS)
-      {
-        return visit((const SpatialPoints&)x);
-      }
-      else
-      {
-        return SBMLVisitor::visit(x);
-      }
-    }
   }
 
 
@@ -934,6 +852,493 @@ SpatialValidator::addConstraint(VConstraint* c)
 }
 
 
+/*
+ * Adds the given constraint on SBMLDocument objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SBMLDocument>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mSBMLDocument.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Model objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<Model>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mModel.add(c);
+}
+
+
+/*
+ * Adds the given constraint on DomainType objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<DomainType>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mDomainType.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Domain objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<Domain>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mDomain.add(c);
+}
+
+
+/*
+ * Adds the given constraint on InteriorPoint objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<InteriorPoint>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mInteriorPoint.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Boundary objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<Boundary>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mBoundary.add(c);
+}
+
+
+/*
+ * Adds the given constraint on AdjacentDomains objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AdjacentDomains>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mAdjacentDomains.add(c);
+}
+
+
+/*
+ * Adds the given constraint on GeometryDefinition objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<GeometryDefinition>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mGeometryDefinition.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CompartmentMapping objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CompartmentMapping>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCompartmentMapping.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CoordinateComponent objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CoordinateComponent>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCoordinateComponent.add(c);
+}
+
+
+/*
+ * Adds the given constraint on SampledFieldGeometry objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SampledFieldGeometry>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mSampledFieldGeometry.add(c);
+}
+
+
+/*
+ * Adds the given constraint on SampledField objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SampledField>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mSampledField.add(c);
+}
+
+
+/*
+ * Adds the given constraint on SampledVolume objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SampledVolume>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mSampledVolume.add(c);
+}
+
+
+/*
+ * Adds the given constraint on AnalyticGeometry objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AnalyticGeometry>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mAnalyticGeometry.add(c);
+}
+
+
+/*
+ * Adds the given constraint on AnalyticVolume objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AnalyticVolume>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mAnalyticVolume.add(c);
+}
+
+
+/*
+ * Adds the given constraint on ParametricGeometry objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<ParametricGeometry>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mParametricGeometry.add(c);
+}
+
+
+/*
+ * Adds the given constraint on ParametricObject objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<ParametricObject>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mParametricObject.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGeometry objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGeometry>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGeometry.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGObject objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGObject>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGObject.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGNode objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGNode>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGNode.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGTransformation objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGTransformation>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGTransformation.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGTranslation objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGTranslation>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGTranslation.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGRotation objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGRotation>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGRotation.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGScale objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGScale>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGScale.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGHomogeneousTransformation objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGHomogeneousTransformation>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGHomogeneousTransformation.add(c);
+}
+
+
+/*
+ * Adds the given constraint on TransformationComponent objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<TransformationComponent>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mTransformationComponent.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGPrimitive objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGPrimitive>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGPrimitive.add(c);
+}
+
+
+/*
+ * Adds the given constraint on CSGSetOperator objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGSetOperator>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mCSGSetOperator.add(c);
+}
+
+
+/*
+ * Adds the given constraint on SpatialSymbolReference objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SpatialSymbolReference>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mSpatialSymbolReference.add(c);
+}
+
+
+/*
+ * Adds the given constraint on DiffusionCoefficient objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<DiffusionCoefficient>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mDiffusionCoefficient.add(c);
+}
+
+
+/*
+ * Adds the given constraint on AdvectionCoefficient objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AdvectionCoefficient>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mAdvectionCoefficient.add(c);
+}
+
+
+/*
+ * Adds the given constraint on BoundaryCondition objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<BoundaryCondition>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mBoundaryCondition.add(c);
+}
+
+
+/*
+ * Adds the given constraint on Geometry objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<Geometry>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mGeometry.add(c);
+}
+
+
+/*
+ * Adds the given constraint on MixedGeometry objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<MixedGeometry>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mMixedGeometry.add(c);
+}
+
+
+/*
+ * Adds the given constraint on OrdinalMapping objects to this
+ * SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<OrdinalMapping>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mOrdinalMapping.add(c);
+}
+
+
+/*
+ * Adds the given constraint on SpatialPoints objects to this SpatialValidator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SpatialPoints>* c)
+{
+  if (c == NULL) return;
+
+  mSpatialConstraints->constraints.push_back(c);
+  mSpatialConstraints->mSpatialPoints.add(c);
+}
+
+
 /*
  * Validates the given SBMLDocument
  */
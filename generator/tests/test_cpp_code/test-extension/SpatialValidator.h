@@ -68,6 +68,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 /** @endcond */
 
@@ -80,8 +81,44 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 
 
 class VConstraint;
+template <typename T> class TConstraint;
 struct SpatialValidatorConstraints;
 class SBMLDocument;
+class Model;
+class DomainType;
+class Domain;
+class InteriorPoint;
+class Boundary;
+class AdjacentDomains;
+class GeometryDefinition;
+class CompartmentMapping;
+class CoordinateComponent;
+class SampledFieldGeometry;
+class SampledField;
+class SampledVolume;
+class AnalyticGeometry;
+class AnalyticVolume;
+class ParametricGeometry;
+class ParametricObject;
+class CSGeometry;
+class CSGObject;
+class CSGNode;
+class CSGTransformation;
+class CSGTranslation;
+class CSGRotation;
+class CSGScale;
+class CSGHomogeneousTransformation;
+class TransformationComponent;
+class CSGPrimitive;
+class CSGSetOperator;
+class SpatialSymbolReference;
+class DiffusionCoefficient;
+class AdvectionCoefficient;
+class BoundaryCondition;
+class Geometry;
+class MixedGeometry;
+class OrdinalMapping;
+class SpatialPoints;
 
 
 class SpatialValidator : public Validator
@@ -121,6 +158,464 @@ public:
   virtual void addConstraint(VConstraint* c);
 
 
+  /**
+   * Adds the given constraint on SBMLDocument objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<SBMLDocument>* c);
+
+
+  /**
+   * Adds the given constraint on Model objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Model>* c);
+
+
+  /**
+   * Adds the given constraint on DomainType objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<DomainType>* c);
+
+
+  /**
+   * Adds the given constraint on Domain objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Domain>* c);
+
+
+  /**
+   * Adds the given constraint on InteriorPoint objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<InteriorPoint>* c);
+
+
+  /**
+   * Adds the given constraint on Boundary objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Boundary>* c);
+
+
+  /**
+   * Adds the given constraint on AdjacentDomains objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<AdjacentDomains>* c);
+
+
+  /**
+   * Adds the given constraint on GeometryDefinition objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<GeometryDefinition>* c);
+
+
+  /**
+   * Adds the given constraint on CompartmentMapping objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CompartmentMapping>* c);
+
+
+  /**
+   * Adds the given constraint on CoordinateComponent objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CoordinateComponent>* c);
+
+
+  /**
+   * Adds the given constraint on SampledFieldGeometry objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<SampledFieldGeometry>* c);
+
+
+  /**
+   * Adds the given constraint on SampledField objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<SampledField>* c);
+
+
+  /**
+   * Adds the given constraint on SampledVolume objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<SampledVolume>* c);
+
+
+  /**
+   * Adds the given constraint on AnalyticGeometry objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<AnalyticGeometry>* c);
+
+
+  /**
+   * Adds the given constraint on AnalyticVolume objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<AnalyticVolume>* c);
+
+
+  /**
+   * Adds the given constraint on ParametricGeometry objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<ParametricGeometry>* c);
+
+
+  /**
+   * Adds the given constraint on ParametricObject objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<ParametricObject>* c);
+
+
+  /**
+   * Adds the given constraint on CSGeometry objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGeometry>* c);
+
+
+  /**
+   * Adds the given constraint on CSGObject objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGObject>* c);
+
+
+  /**
+   * Adds the given constraint on CSGNode objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGNode>* c);
+
+
+  /**
+   * Adds the given constraint on CSGTransformation objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGTransformation>* c);
+
+
+  /**
+   * Adds the given constraint on CSGTranslation objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGTranslation>* c);
+
+
+  /**
+   * Adds the given constraint on CSGRotation objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGRotation>* c);
+
+
+  /**
+   * Adds the given constraint on CSGScale objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGScale>* c);
+
+
+  /**
+   * Adds the given constraint on CSGHomogeneousTransformation objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGHomogeneousTransformation>* c);
+
+
+  /**
+   * Adds the given constraint on TransformationComponent objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<TransformationComponent>* c);
+
+
+  /**
+   * Adds the given constraint on CSGPrimitive objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGPrimitive>* c);
+
+
+  /**
+   * Adds the given constraint on CSGSetOperator objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<CSGSetOperator>* c);
+
+
+  /**
+   * Adds the given constraint on SpatialSymbolReference objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<SpatialSymbolReference>* c);
+
+
+  /**
+   * Adds the given constraint on DiffusionCoefficient objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<DiffusionCoefficient>* c);
+
+
+  /**
+   * Adds the given constraint on AdvectionCoefficient objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<AdvectionCoefficient>* c);
+
+
+  /**
+   * Adds the given constraint on BoundaryCondition objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<BoundaryCondition>* c);
+
+
+  /**
+   * Adds the given constraint on Geometry objects to this SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<Geometry>* c);
+
+
+  /**
+   * Adds the given constraint on MixedGeometry objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<MixedGeometry>* c);
+
+
+  /**
+   * Adds the given constraint on OrdinalMapping objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<OrdinalMapping>* c);
+
+
+  /**
+   * Adds the given constraint on SpatialPoints objects to this
+   * SpatialValidator.
+   *
+   * @param c the TConstraint object to add.
+   *
+   * The constraints declared for a validator are added through this overload
+   * where their type is known, so that they are filed without testing their
+   * type against each ConstraintSet.
+   */
+  void addConstraint(TConstraint<SpatialPoints>* c);
+
+
   /**
    * Validates the given SBMLDocument
    *
@@ -44,6 +44,8 @@
 #include <sbml/packages/test/validator/TestSBMLErrorTable.h>
 #include <sbml/packages/test/extension/TestModelPlugin.h>
 
+#include <cstring>
+
 
 using namespace std;
 
@@ -328,18 +330,28 @@ unsigned int
 TestExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(testErrorTable)/sizeof(testErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int lower = 0;
+  unsigned int upper = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  while (lower < upper)
   {
-    if (errorId == testErrorTable[i].code)
+    unsigned int middle = lower + (upper - lower) / 2;
+    if (testErrorTable[middle].code < errorId)
+    {
+      lower = middle + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      upper = middle;
     }
   }
 
-  return index;
+  if (lower < tableSize && testErrorTable[lower].code == errorId)
+  {
+    return lower;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -441,15 +453,26 @@ LIBSBML_EXTERN
 Enum_t
 Enum_fromString(const char* code)
 {
-  static int size = sizeof(SBML_ENUM_STRINGS)/sizeof(SBML_ENUM_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return TEST_ENUM_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_ENUM_STRINGS[i])
+  case 3:
+    if (strcmp(code, SBML_ENUM_STRINGS[0]) == 0)
     {
-      return (Enum_t)(i);
+      return TEST_ENUM_ONE;
     }
+    else if (strcmp(code, SBML_ENUM_STRINGS[1]) == 0)
+    {
+      return TEST_ENUM_TWO;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return TEST_ENUM_INVALID;
@@ -526,15 +549,29 @@ LIBSBML_EXTERN
 Fred_t
 Fred_fromString(const char* code)
 {
-  static int size = sizeof(SBML_FRED_STRINGS)/sizeof(SBML_FRED_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return TEST_FRED_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_FRED_STRINGS[i])
+  case 3:
+    if (strcmp(code, SBML_FRED_STRINGS[0]) == 0)
+    {
+      return TEST_FRED_T_TOM;
+    }
+
+    break;
+  case 4:
+    if (strcmp(code, SBML_FRED_STRINGS[1]) == 0)
     {
-      return (Fred_t)(i);
+      return TEST_FRED_T_DICK;
     }
+
+    break;
+  default:
+    break;
   }
 
   return TEST_FRED_INVALID;
@@ -612,16 +649,29 @@ LIBSBML_EXTERN
 ExtraLong_t
 ExtraLong_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_EXTRA_LONG_STRINGS)/sizeof(SBML_EXTRA_LONG_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return TEST_EXTRALONG_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_EXTRA_LONG_STRINGS[i])
+  case 73:
+    if (strcmp(code, SBML_EXTRA_LONG_STRINGS[0]) == 0)
+    {
+      return TEST_EXTRALONG_FRANK;
+    }
+
+    break;
+  case 142:
+    if (strcmp(code, SBML_EXTRA_LONG_STRINGS[1]) == 0)
     {
-      return (ExtraLong_t)(i);
+      return TEST_EXTRALONG_SARAH;
     }
+
+    break;
+  default:
+    break;
   }
 
   return TEST_EXTRALONG_INVALID;
@@ -374,18 +374,28 @@ TwoatonceExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize =
     sizeof(twoatonceErrorTable)/sizeof(twoatonceErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int lower = 0;
+  unsigned int upper = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  while (lower < upper)
   {
-    if (errorId == twoatonceErrorTable[i].code)
+    unsigned int middle = lower + (upper - lower) / 2;
+    if (twoatonceErrorTable[middle].code < errorId)
     {
-      index = i;
-      break;
+      lower = middle + 1;
     }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  if (lower < tableSize && twoatonceErrorTable[lower].code == errorId)
+  {
+    return lower;
   }
 
-  return index;
+  return 0;
 }
 
 /** @endcond */
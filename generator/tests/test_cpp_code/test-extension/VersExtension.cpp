@@ -46,6 +46,8 @@
 #include <sbml/packages/vers/extension/VersSpeciesPlugin.h>
 #include <sbml/packages/vers/extension/VersReactionPlugin.h>
 
+#include <cstring>
+
 
 using namespace std;
 
@@ -376,18 +378,28 @@ unsigned int
 VersExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(versErrorTable)/sizeof(versErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int lower = 0;
+  unsigned int upper = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  while (lower < upper)
   {
-    if (errorId == versErrorTable[i].code)
+    unsigned int middle = lower + (upper - lower) / 2;
+    if (versErrorTable[middle].code < errorId)
+    {
+      lower = middle + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      upper = middle;
     }
   }
 
-  return index;
+  if (lower < tableSize && versErrorTable[lower].code == errorId)
+  {
+    return lower;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -514,16 +526,26 @@ LIBSBML_EXTERN
 FbcType_t
 FbcType_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_FBC_TYPE_STRINGS)/sizeof(SBML_FBC_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return OBJECTIVE_TYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SBML_FBC_TYPE_STRINGS[i])
+  case 8:
+    if (strcmp(code, SBML_FBC_TYPE_STRINGS[0]) == 0)
     {
-      return (FbcType_t)(i);
+      return OBJECTIVE_TYPE_MAXIMIZE;
     }
+    else if (strcmp(code, SBML_FBC_TYPE_STRINGS[1]) == 0)
+    {
+      return OBJECTIVE_TYPE_MINIMIZE;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return OBJECTIVE_TYPE_INVALID;
@@ -1,6 +1,7 @@
 #!/usr/bin/env python
 
 import os
+import re
 import sys
 sys.path.append(os.path.dirname(os.path.abspath(__file__)) + '/../')
 sys.path.append(os.path.dirname(os.path.abspath(__file__)) + '/../../')
@@ -255,6 +256,34 @@ def compare_code_cmake(class_name):
 def compare_code_txt(class_name, ext='.txt'):
     return compare_code(class_name, ext)
 
+
+def check_error_table_order(prefix):
+    """
+    Check that the generated error table is sorted by error code, as
+    the error constructor looks entries up by bisection.
+
+    :param prefix: the start of the filename, e.g. 'Sed' or 'Ca'.
+    :returns: 0 on success, or file not present; 1 on failure.
+    """
+    error_file = os.path.normpath('./temp/{1}/{0}Error.h'.format(prefix, gv.language))
+    table_file = os.path.normpath('./temp/{1}/{0}ErrorTable.h'.format(prefix, gv.language))
+    if not os.path.isfile(error_file) or not os.path.isfile(table_file):
+        return 0
+    codes = dict()
+    for match in re.finditer(r'^[ ,]*(\w+)\s*=\s*(\d+)',
+                             test_functions.read_file(error_file), re.M):
+        codes[match.group(1)] = int(match.group(2))
+    table = test_functions.read_file(table_file)
+    table = table[table.index('ErrorTable[] ='):]
+    order = [codes.get(name, -1)
+             for name in re.findall(r'//\s*\d+\s*\{\s*(\w+)', table)]
+    if len(order) > 0 and -1 not in order and order == sorted(set(order)):
+        print('{0} .... ORDERED'.format(table_file))
+        return 0
+    fails.append(table_file)
+    print('{0}=================>> NOT ORDERED'.format(table_file))
+    return 1
+
 #########
 
 def compare_binding(class_name, binding, end, prefix=""):
@@ -363,6 +392,10 @@ def test_other_templates(prefix):
     fail += compare_code_impl('{0}Writer'.format(prefix))
     fail += compare_code_headers('{0}ErrorLog'.format(prefix))
     fail += compare_code_impl('{0}ErrorLog'.format(prefix))
+    fail += compare_code_headers('{0}ElementIndex'.format(prefix))
+    fail += compare_code_impl('{0}ElementIndex'.format(prefix))
+    fail += compare_code_headers('{0}Arena'.format(prefix))
+    fail += compare_code_impl('{0}Arena'.format(prefix))
     fail += compare_code_headers('{0}Namespaces'.format(prefix))
     fail += compare_code_impl('{0}Namespaces'.format(prefix))
     fail += compare_code_headers('{0}Error'.format(prefix))
@@ -373,6 +406,7 @@ def test_other_templates(prefix):
     fail += compare_code_headers('{0}Visitor'.format(prefix))
     fail += compare_code_impl('{0}Visitor'.format(prefix))
     fail += compare_code_headers('{0}ErrorTable'.format(prefix))
+    fail += check_error_table_order(prefix)
     print('')
     return fail
 
@@ -0,0 +1,244 @@
+/**
+ * @file CaArena.cpp
+ * @brief Implementation of the CaArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <omex/CaArena.h>
+
+#include <new>
+#include <vector>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#  include <atomic>
+#  define LIBCOMBINE_HAS_ARENA 1
+#endif
+
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBCOMBINE_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibomexInternal */
+
+/*
+ * Every allocation is preceded by a header recording the pool it came
+ * from (NULL for the heap), so that deallocate() knows where it belongs
+ * without searching for it.  The header is a whole number of alignment
+ * units long so that the object following it stays aligned.
+ */
+union CaArenaHeader
+{
+  CaArenaPool* pool;
+  void*          pointer;
+  double         number;
+  long           integer;
+};
+
+
+#ifdef LIBCOMBINE_HAS_ARENA
+
+/*
+ * The blocks of an arena.  The arena holds one reference to its pool and
+ * every live allocation another, so the pool outlives the CaArena that
+ * created it for as long as any allocation made from it is live, and the
+ * last of them to go frees all the blocks at once.
+ */
+struct CaArenaPool
+{
+  static const size_t BLOCK_SIZE = 64 * 1024;
+
+  std::vector<char*>  mBlocks;
+  char*               mNext;
+  char*               mEnd;
+  std::atomic<size_t> mNumReferences;
+
+  CaArenaPool ()
+    : mBlocks()
+    , mNext (NULL)
+    , mEnd (NULL)
+    , mNumReferences (1)
+  {
+  }
+
+  ~CaArenaPool ()
+  {
+    for (std::vector<char*>::iterator it = mBlocks.begin();
+         it != mBlocks.end(); ++it)
+    {
+      ::operator delete(*it);
+    }
+  }
+
+  char* allocate (size_t size)
+  {
+    char* memory;
+
+    if (size > BLOCK_SIZE / 4)
+    {
+      // large allocations get a block of their own so that the space left
+      // in the current block is not wasted
+      memory = static_cast<char*>(::operator new(size));
+      mBlocks.push_back(memory);
+    }
+    else
+    {
+      if (mNext == NULL || (size_t)(mEnd - mNext) < size)
+      {
+        mNext = static_cast<char*>(::operator new(BLOCK_SIZE));
+        mEnd = mNext + BLOCK_SIZE;
+        mBlocks.push_back(mNext);
+      }
+
+      memory = mNext;
+      mNext += size;
+    }
+
+    ++mNumReferences;
+    return memory;
+  }
+
+  // gives up one reference; the pool goes once none is left
+  void release ()
+  {
+    if (--mNumReferences == 0)
+    {
+      delete this;
+    }
+  }
+};
+
+#endif  /* LIBCOMBINE_HAS_ARENA */
+
+
+CaArena::CaArena ()
+  : mPool (NULL)
+{
+}
+
+
+CaArena::CaArena (const CaArena&)
+  : mPool (NULL)
+{
+}
+
+
+CaArena&
+CaArena::operator=(const CaArena&)
+{
+  return *this;
+}
+
+
+CaArena::~CaArena ()
+{
+  setEnabled(false);
+}
+
+
+void
+CaArena::setEnabled (bool enabled)
+{
+#ifdef LIBCOMBINE_HAS_ARENA
+  if (enabled && mPool == NULL)
+  {
+    mPool = new CaArenaPool();
+  }
+  else if (!enabled && mPool != NULL)
+  {
+    mPool->release();
+    mPool = NULL;
+  }
+#endif
+}
+
+
+bool
+CaArena::isEnabled () const
+{
+  return mPool != NULL;
+}
+
+
+void*
+CaArena::allocate (CaArena* arena, size_t size)
+{
+  const size_t headerSize = sizeof(CaArenaHeader);
+  size_t total = headerSize + ((size + headerSize - 1) / headerSize) * headerSize;
+  CaArenaHeader* header;
+
+#ifdef LIBCOMBINE_HAS_ARENA
+  if (arena != NULL && arena->mPool != NULL)
+  {
+    header = reinterpret_cast<CaArenaHeader*>(arena->mPool->allocate(total));
+    header->pool = arena->mPool;
+    return header + 1;
+  }
+#endif
+
+  header = static_cast<CaArenaHeader*>(::operator new(total));
+  header->pool = NULL;
+  return header + 1;
+}
+
+
+void
+CaArena::deallocate (void* p)
+{
+  if (p == NULL) return;
+
+  CaArenaHeader* header = static_cast<CaArenaHeader*>(p) - 1;
+
+#ifdef LIBCOMBINE_HAS_ARENA
+  if (header->pool != NULL)
+  {
+    // the memory itself goes back with the rest of the blocks
+    header->pool->release();
+    return;
+  }
+#endif
+
+  ::operator delete(header);
+}
+
+/** @endcond */
+
+#endif  /* __cplusplus */
+
+LIBCOMBINE_CPP_NAMESPACE_END
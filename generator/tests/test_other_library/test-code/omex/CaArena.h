@@ -0,0 +1,152 @@
+/**
+ * @file CaArena.h
+ * @brief Definition of the CaArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class CaArena
+ * @sbmlbrief{} TODO:Definition of the CaArena class.
+ */
+
+
+#ifndef CaArena_h
+#define CaArena_h
+
+
+#include <omex/common/extern.h>
+
+
+#ifdef __cplusplus
+
+#include <cstddef>
+
+LIBCOMBINE_CPP_NAMESPACE_BEGIN
+
+struct CaArenaPool;
+
+/** @cond doxygenLibomexInternal */
+
+/**
+ * Arena from which the elements of an CaOmexManifest can be allocated.
+ *
+ * When enabled, elements created for the document (most notably while it
+ * is being read) are carved out of a few large blocks instead of being
+ * allocated one by one.  Deleting such an element only records that it has
+ * gone; the blocks themselves are handed back in one go once the document
+ * has been destroyed and no element allocated from them is left, so an
+ * element removed from the document may safely outlive it.
+ *
+ * Every element, from an arena or from the heap, is preceded by a
+ * one-word header naming the pool it came from, so deleting it needs no
+ * lookup and no lock.  Deleting an element of an arena only drops a
+ * reference to its blocks, which are all freed together when the last
+ * element goes; normally that is while the document is destroyed.
+ *
+ * An arena must not be used from several threads at once, like the
+ * document it belongs to, but elements of different documents may be
+ * created and deleted concurrently.  Arenas need C++11 (or MSVC 2012 and
+ * later); without it setEnabled() has no effect and every element is
+ * allocated from the heap.
+ */
+class LIBCOMBINE_EXTERN CaArena
+{
+public:
+
+  /**
+   * Creates a new, disabled, CaArena.
+   */
+  CaArena ();
+
+
+  /**
+   * Copy constructor; the copy starts out disabled and shares nothing
+   * with the original.
+   */
+  CaArena (const CaArena& orig);
+
+
+  /**
+   * Assignment operator; the arena is left unchanged.
+   */
+  CaArena& operator=(const CaArena& rhs);
+
+
+  /**
+   * Destroys this CaArena.  Its blocks are freed as soon as the last
+   * element allocated from them has been deleted.
+   */
+  ~CaArena ();
+
+
+  /**
+   * Enables or disables allocation from this arena.  Disabling it does not
+   * affect the elements already allocated.
+   *
+   * @param enabled @c true to allocate new elements from the arena.
+   */
+  void setEnabled (bool enabled);
+
+
+  /**
+   * Predicate returning @c true if new elements are allocated from this
+   * arena.
+   */
+  bool isEnabled () const;
+
+
+  /**
+   * Allocates @p size bytes from the given arena, or from the heap if
+   * @p arena is @c NULL or disabled.
+   *
+   * @return the allocated memory; throws std::bad_alloc on failure.
+   */
+  static void* allocate (CaArena* arena, size_t size);
+
+
+  /**
+   * Frees memory obtained from allocate().
+   */
+  static void deallocate (void* p);
+
+
+protected:
+
+  CaArenaPool* mPool;
+};
+
+/** @endcond */
+
+LIBCOMBINE_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* CaArena_h */
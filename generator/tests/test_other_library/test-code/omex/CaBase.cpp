@@ -51,6 +51,8 @@
 #include <omex/CaError.h>
 #include <omex/CaErrorLog.h>
 #include <omex/CaOmexManifest.h>
+#include <omex/CaElementIndex.h>
+#include <omex/CaArena.h>
 #include <omex/CaListOf.h>
 #include <omex/CaBase.h>
 
@@ -63,6 +65,74 @@ LIBCOMBINE_CPP_NAMESPACE_BEGIN
 
 #ifdef __cplusplus
 
+CaCounter CaBase::mNumSharingLists(0);
+
+/* non-zero while this thread is in cloneCopyOnWrite(); kept out of the
+ * class as exported classes cannot have thread-local members */
+#ifdef LIBCOMBINE_HAS_THREAD_SAFE_COUNTERS
+static thread_local unsigned int copyingOnWrite = 0;
+#else
+static unsigned int copyingOnWrite = 0;
+#endif
+
+
+/*
+ * The notes and annotation of a copy made by cloneCopyOnWrite() are shared
+ * with the original.  A shared node comes with the count of the objects
+ * sharing it, and whichever of them is about to change the node first
+ * takes a copy of its own.
+ */
+static void
+shareNode(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*& node, CaCounter*& shares,
+          LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* origNode, CaCounter*& origShares)
+{
+  if (origShares == NULL)
+  {
+    origShares = new CaCounter(1);
+  }
+
+  ++(*origShares);
+  node = origNode;
+  shares = origShares;
+}
+
+
+static void
+releaseNode(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*& node, CaCounter*& shares)
+{
+  if (shares == NULL || --(*shares) == 0)
+  {
+    delete node;
+    delete shares;
+  }
+
+  node = NULL;
+  shares = NULL;
+}
+
+
+static void
+unshareNode(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*& node, CaCounter*& shares)
+{
+  if (shares == NULL) return;
+
+  if (*shares == 1)
+  {
+    // the others have gone, so the node is ours alone
+    delete shares;
+    shares = NULL;
+  }
+  else
+  {
+    // the copy is taken before letting go of the node, which the last of
+    // the others (possibly in another thread) then deletes
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* copy = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*node);
+    releaseNode(node, shares);
+    node = copy;
+  }
+}
+
+
 CaBase*
 CaBase::getElementBySId(const std::string& id)
 {
@@ -104,6 +174,81 @@ CaBase::getAllElements()
   return NULL;
 }
 
+
+/** @cond doxygenLibomexInternal */
+/*
+ * CaBase itself has no SIdRef attributes.
+ */
+void
+CaBase::addReferenceAttributes(std::vector<std::string>& attributes) const
+{
+}
+/** @endcond */
+
+
+/** @cond doxygenLibomexInternal */
+void*
+CaBase::operator new (size_t size)
+{
+  return CaArena::allocate(NULL, size);
+}
+
+
+void*
+CaBase::operator new (size_t size, CaArena* arena)
+{
+  return CaArena::allocate(arena, size);
+}
+
+
+void*
+CaBase::operator new (size_t size, const std::nothrow_t&) throw()
+{
+  try
+  {
+    return CaArena::allocate(NULL, size);
+  }
+  catch (...)
+  {
+    return NULL;
+  }
+}
+
+
+void*
+CaBase::operator new (size_t, void* place) throw()
+{
+  return place;
+}
+
+
+void
+CaBase::operator delete (void* p)
+{
+  CaArena::deallocate(p);
+}
+
+
+void
+CaBase::operator delete (void* p, CaArena*)
+{
+  CaArena::deallocate(p);
+}
+
+
+void
+CaBase::operator delete (void* p, const std::nothrow_t&) throw()
+{
+  CaArena::deallocate(p);
+}
+
+
+void
+CaBase::operator delete (void*, void*) throw()
+{
+}
+/** @endcond */
+
 /** @cond doxygenLibomexInternal */
 /*
  * Creates a new CaBase object with the given level and version.
@@ -121,10 +266,16 @@ CaBase::CaBase (unsigned int level, unsigned int version)
  , mColumn    ( 0 )
  , mParentCaObject (NULL)
   , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
   , mEmptyString("")
  , mURI("")
 {
-  mCaNamespaces = new CaNamespaces(level, version);
+  CaNamespaces omexns(level, version);
+  mCaNamespaces = CaNamespaces::intern(&omexns);
 
   //
   // Sets the XMLNS URI of corresponding OMEX Level/Version to
@@ -152,6 +303,11 @@ CaBase::CaBase (CaNamespaces *omexns)
  , mColumn    ( 0 )
  , mParentCaObject (NULL)
   , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
   , mEmptyString("")
  , mURI("")
 {
@@ -160,9 +316,9 @@ CaBase::CaBase (CaNamespaces *omexns)
     std::string err("CaBase::CaBase(CaNamespaces*) : CaNamespaces is null");
     throw CaConstructorException(err);
   }
-  mCaNamespaces = omexns->clone();
+  mCaNamespaces = CaNamespaces::intern(omexns);
 
-  setElementNamespace(static_cast<CaNamespaces>(*mCaNamespaces).getURI());
+  setElementNamespace(mCaNamespaces->CaNamespaces::getURI());
 }
 /** @endcond */
 
@@ -182,26 +338,84 @@ CaBase::CaBase(const CaBase& orig)
   , mLine(orig.mLine)
   , mColumn(orig.mColumn)
   , mParentCaObject(NULL)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
   , mURI(orig.mURI)
 {
-  if(orig.mNotes != NULL)
-    this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<CaBase&>(orig).getNotes());
+  if(orig.mNotes != NULL && isCopyingOnWrite())
+    shareNode(mNotes, mNotesShares, orig.mNotes, orig.mNotesShares);
+  else if(orig.mNotes != NULL)
+    this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*orig.mNotes);
   else
     this->mNotes = NULL;
 
-  if(orig.mAnnotation != NULL)
-    this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<CaBase&>(orig).mAnnotation);
+  if(orig.mAnnotation != NULL && isCopyingOnWrite())
+    shareNode(mAnnotation, mAnnotationShares, orig.mAnnotation,
+              orig.mAnnotationShares);
+  else if(orig.mAnnotation != NULL)
+    this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*orig.mAnnotation);
   else
     this->mAnnotation = NULL;
 
-  if(orig.getCaNamespaces() != NULL)
-    this->mCaNamespaces =
-    new CaNamespaces(*const_cast<CaBase&>(orig).getCaNamespaces());
+  // share the namespaces rather than copying them; orig.getCaNamespaces()
+  // is not used as it would give orig a copy of its own
+  CaOmexManifest* origDoc = orig.deriveCaOmexManifest();
+  if (origDoc != NULL)
+    this->mCaNamespaces = CaNamespaces::intern(origDoc->mCaNamespaces);
   else
-    this->mCaNamespaces = NULL;
+    this->mCaNamespaces = CaNamespaces::intern(orig.mCaNamespaces);
 
   this->mHasBeenDeleted = false;
 }
+
+
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor. Takes over the contents of the given CaBase object.
+ */
+CaBase::CaBase(CaBase&& orig)
+  : mMetaId ()
+  , mId ()
+  , mNotes (NULL)
+  , mAnnotation (NULL)
+  , mCa (NULL)
+  , mCaNamespaces(NULL)
+  , mUserData(orig.mUserData)
+  , mLine(orig.mLine)
+  , mColumn(orig.mColumn)
+  , mParentCaObject(NULL)
+  , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
+  , mURI(orig.mURI)
+{
+  // the copies sharing the branch orig is in take their own copies before
+  // it is emptied; this may throw, so nothing is taken from orig until then.
+  // The children of orig move along with it (a CaListOf takes the CaListOf
+  // objects sharing its items with it).
+  if (orig.getHoldingParent() != NULL)
+  {
+    orig.getHoldingParent()->detachSharedCopies();
+  }
+
+  // orig stays a valid element of its namespaces
+  mCaNamespaces = CaNamespaces::intern(orig.mCaNamespaces);
+
+  orig.releaseIndexEntries(orig.mId);
+  mMetaId.swap(orig.mMetaId);
+  mId.swap(orig.mId);
+  std::swap(mNotes, orig.mNotes);
+  std::swap(mNotesShares, orig.mNotesShares);
+  std::swap(mAnnotation, orig.mAnnotation);
+  std::swap(mAnnotationShares, orig.mAnnotationShares);
+}
+#endif
 /** @endcond */
 
 
@@ -210,9 +424,15 @@ CaBase::CaBase(const CaBase& orig)
  */
 CaBase::~CaBase ()
 {
-  if (mNotes != NULL)       delete mNotes;
-  if (mAnnotation != NULL)  delete mAnnotation;
-  if (mCaNamespaces != NULL)  delete mCaNamespaces;
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->remove(this);
+  }
+
+  releaseNode(mNotes, mNotesShares);
+  releaseNode(mAnnotation, mAnnotationShares);
+  CaNamespaces::release(mCaNamespaces);
 }
 
 /*
@@ -222,43 +442,127 @@ CaBase& CaBase::operator=(const CaBase& rhs)
 {
   if(&rhs!=this)
   {
+    prepareForChange();
+
+    // rather than moving this object and its children between the entries
+    // of the index, let the document rebuild it
+    CaElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->clear();
+    }
+    updateIdIndices(mId, rhs.mId);
+
     this->mMetaId = rhs.mMetaId;
     this->mId = rhs.mId;
 
-    delete this->mNotes;
+    releaseNode(this->mNotes, this->mNotesShares);
 
     if(rhs.mNotes != NULL)
-      this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<CaBase&>(rhs).getNotes());
-    else
-      this->mNotes = NULL;
+      this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*rhs.mNotes);
 
-    delete this->mAnnotation;
+    releaseNode(this->mAnnotation, this->mAnnotationShares);
 
     if(rhs.mAnnotation != NULL)
-      this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<CaBase&>(rhs).mAnnotation);
-    else
-      this->mAnnotation = NULL;
+      this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*rhs.mAnnotation);
 
-    this->mCa       = rhs.mCa;
+    // this object keeps its place, so its parent and document are its own
     this->mLine       = rhs.mLine;
     this->mColumn     = rhs.mColumn;
-    this->mParentCaObject = rhs.mParentCaObject;
     this->mUserData   = rhs.mUserData;
 
-    delete this->mCaNamespaces;
+    CaNamespaces* omexns = CaNamespaces::intern(rhs.mCaNamespaces);
+    CaNamespaces::release(this->mCaNamespaces);
+    this->mCaNamespaces = omexns;
 
-    if(rhs.mCaNamespaces != NULL)
-      this->mCaNamespaces =
-      new CaNamespaces(*const_cast<CaBase&>(rhs).mCaNamespaces);
-    else
-      this->mCaNamespaces = NULL;
 
+    this->mURI = rhs.mURI;
+  }
+
+  return *this;
+}
+
+
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+/*
+ * Move assignment operator
+ */
+CaBase& CaBase::operator=(CaBase&& rhs)
+{
+  if(&rhs!=this)
+  {
+    // as in the move constructor, the steps that may throw come first; the
+    // children of both objects are moved by the subclasses
+    if (getHoldingParent() != NULL)
+    {
+      getHoldingParent()->detachSharedCopies();
+    }
+    if (rhs.getHoldingParent() != NULL)
+    {
+      rhs.getHoldingParent()->detachSharedCopies();
+    }
 
+    CaNamespaces* omexns = CaNamespaces::intern(rhs.mCaNamespaces);
+    CaNamespaces::release(this->mCaNamespaces);
+    this->mCaNamespaces = omexns;
     this->mURI = rhs.mURI;
+
+    // as for a copy, let the document rebuild its index
+    CaElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->clear();
+    }
+    updateIdIndices(mId, rhs.mId);
+    rhs.releaseIndexEntries(rhs.mId);
+
+    this->mMetaId = std::move(rhs.mMetaId);
+    this->mId = std::move(rhs.mId);
+
+    releaseNode(this->mNotes, this->mNotesShares);
+    std::swap(this->mNotes, rhs.mNotes);
+    std::swap(this->mNotesShares, rhs.mNotesShares);
+
+    releaseNode(this->mAnnotation, this->mAnnotationShares);
+    std::swap(this->mAnnotation, rhs.mAnnotation);
+    std::swap(this->mAnnotationShares, rhs.mAnnotationShares);
+
+    // this object keeps its place, so its parent and document are its own
+    this->mLine       = rhs.mLine;
+    this->mColumn     = rhs.mColumn;
+    this->mUserData   = rhs.mUserData;
+
+    rhs.mMetaId.clear();
+    rhs.mId.clear();
   }
 
   return *this;
 }
+#endif
+
+
+/*
+ * @return a copy of this object sharing its unchanged parts with it.
+ */
+CaBase*
+CaBase::cloneCopyOnWrite () const
+{
+  CaBase* copy = NULL;
+
+  beginCopyingOnWrite();
+  try
+  {
+    copy = clone();
+  }
+  catch (...)
+  {
+    endCopyingOnWrite();
+    throw;
+  }
+  endCopyingOnWrite();
+
+  return copy;
+}
 
 
 /*
@@ -294,6 +598,8 @@ CaBase::getId() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 CaBase::getNotes()
 {
+  // the caller may change the notes through the pointer
+  unshareNode(mNotes, mNotesShares);
   return mNotes;
 }
 
@@ -328,6 +634,8 @@ CaBase::getNotesString() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 CaBase::getAnnotation ()
 {
+  // the caller may change the annotation through the pointer
+  unshareNode(mAnnotation, mAnnotationShares);
   return mAnnotation;
 }
 
@@ -335,7 +643,7 @@ CaBase::getAnnotation ()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 CaBase::getAnnotation () const
 {
-  return const_cast<CaBase *>(this)->getAnnotation();
+  return mAnnotation;
 }
 
 
@@ -345,14 +653,14 @@ CaBase::getAnnotation () const
 std::string
 CaBase::getAnnotationString ()
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(getAnnotation());
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mAnnotation);
 }
 
 
 std::string
 CaBase::getAnnotationString () const
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(getAnnotation());
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mAnnotation);
 }
 
 
@@ -365,7 +673,7 @@ CaBase::getURI() const
   if (doc == NULL)
     return getElementNamespace();
 
-  CaNamespaces* omexns = doc->getCaNamespaces();
+  const CaNamespaces* omexns = doc->getCaNamespaces();
 
   if (omexns == NULL)
     return getElementNamespace();
@@ -427,24 +735,39 @@ CaBase::unsetUserData()
   }
 }
 
+
+/*
+ * Makes the copies sharing the branch holding this object take their own
+ * copies of it before it changes.
+ */
+void
+CaBase::prepareForChange()
+{
+  detachSharedCopies();
+}
+
 /*
  * @return the Namespaces associated with this OMEX object
  */
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 CaBase::getNamespaces()
 {
-  if (mCa != NULL)
-    return mCa->getCaNamespaces()->getNamespaces();
-  else
-    return mCaNamespaces->getNamespaces();
+  CaOmexManifest* d = deriveCaOmexManifest();
+  if (d != NULL)
+    return d->getCaNamespaces()->getNamespaces();
+
+  // the caller may change the namespaces, so stop sharing them
+  mCaNamespaces = CaNamespaces::unshare(mCaNamespaces);
+  return mCaNamespaces->getNamespaces();
 }
 
 
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 CaBase::getNamespaces() const
 {
-  if (mCa != NULL)
-    return mCa->getCaNamespaces()->getNamespaces();
+  const CaOmexManifest* d = deriveCaOmexManifest();
+  if (d != NULL)
+    return d->getCaNamespaces()->getNamespaces();
   else
     return mCaNamespaces->getNamespaces();
 }
@@ -456,19 +779,21 @@ CaBase::getNamespaces() const
 const CaOmexManifest*
 CaBase::getCaOmexManifest () const
 {
-  if (mCa != NULL)
+  CaOmexManifest* d = deriveCaOmexManifest();
+
+  if (d != NULL)
   {
     // if the doc object has been deleted the pointer is
     // still valid but points to nothing
     try
     {
-      if (mCa->getHasBeenDeleted())
+      if (d->getHasBeenDeleted())
       {
         return NULL;
       }
       else
       {
-        return mCa;
+        return d;
       }
     }
     catch ( ... )
@@ -477,7 +802,7 @@ CaBase::getCaOmexManifest () const
     }
   }
 
-  return mCa;
+  return d;
 }
 
 /*
@@ -486,19 +811,21 @@ CaBase::getCaOmexManifest () const
 CaOmexManifest*
 CaBase::getCaOmexManifest ()
 {
-  if (mCa != NULL)
+  CaOmexManifest* d = deriveCaOmexManifest();
+
+  if (d != NULL)
   {
     // if the doc object has been deleted the pointer is
     // still valid but points to nothing
     try
     {
-      if (mCa->getHasBeenDeleted())
+      if (d->getHasBeenDeleted())
       {
         return NULL;
       }
       else
       {
-        return mCa;
+        return d;
       }
     }
     catch ( ... )
@@ -506,7 +833,7 @@ CaBase::getCaOmexManifest ()
       return NULL;
     }
   }
-  return mCa;
+  return d;
 }
 CaBase*
 CaBase::getParentCaObject ()
@@ -631,6 +958,8 @@ CaBase::setMetaId (const std::string& metaid)
 {
   if (metaid.empty())
   {
+    prepareForChange();
+    updateMetaIdIndex(mMetaId, metaid);
     mMetaId.erase();
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
@@ -640,6 +969,8 @@ CaBase::setMetaId (const std::string& metaid)
   }
   else
   {
+    prepareForChange();
+    updateMetaIdIndex(mMetaId, metaid);
     mMetaId = metaid;
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
@@ -653,6 +984,8 @@ CaBase::setId (const std::string& sid)
 {
   if (sid.empty())
   {
+    prepareForChange();
+    updateIdIndices(mId, sid);
     mId.erase();
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
@@ -662,6 +995,8 @@ CaBase::setId (const std::string& sid)
   }
   else
   {
+    prepareForChange();
+    updateIdIndices(mId, sid);
     mId = sid;
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
@@ -674,6 +1009,9 @@ CaBase::setId (const std::string& sid)
 int
 CaBase::setAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotation)
 {
+  prepareForChange();
+  unshareNode(mAnnotation, mAnnotationShares);
+
   if (annotation == NULL)
   {
     delete mAnnotation;
@@ -759,6 +1097,9 @@ CaBase::appendAnnotation (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotat
 
   if (mAnnotation != NULL)
   {
+    prepareForChange();
+    unshareNode(mAnnotation, mAnnotationShares);
+
     // if mAnnotation is just <annotation/> need to tell
     // it to no longer be an end
     if (mAnnotation->isEnd())
@@ -900,6 +1241,8 @@ CaBase::removeTopLevelAnnotationElement(const std::string elementName,
     }
 
     // remove the annotation at the index corresponding to the name
+    prepareForChange();
+    unshareNode(mAnnotation, mAnnotationShares);
     delete mAnnotation->removeChild(index);
 
       if (mAnnotation->getNumChildren() == 0)
@@ -989,7 +1332,11 @@ CaBase::setNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
   {
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
-  else if (notes == NULL)
+
+  prepareForChange();
+  unshareNode(mNotes, mNotesShares);
+
+  if (notes == NULL)
   {
     delete mNotes;
     mNotes = NULL;
@@ -1278,6 +1625,9 @@ CaBase::appendNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
 
   if ( mNotes != NULL )
   {
+    prepareForChange();
+    unshareNode(mNotes, mNotesShares);
+
     //------------------------------------------------------------
     //
     //  STEP2: identifies the type of the existing notes
@@ -1495,7 +1845,17 @@ CaBase::appendNotes(const std::string& notes)
 void
 CaBase::setCaOmexManifest (CaOmexManifest* d)
 {
+  mNumDestroyedDocuments =
+    static_cast<unsigned long>(CaElementIndex::getNumDestroyed());
+  mDocumentEpoch = (d != NULL) ? d->getElementIndex()->getEpoch() : 0;
   mCa = d;
+
+  // the document may be walking its elements to update its index
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->visit(this);
+  }
 }
 
 
@@ -1507,19 +1867,284 @@ CaBase::setCaOmexManifest (CaOmexManifest* d)
 void
 CaBase::connectToParent (CaBase* parent)
 {
-  mParentCaObject = parent;
+  if (parent != mParentCaObject || mReleasedByParent)
+  {
+    leaveCaOmexManifest();
+    mParentCaObject = parent;
+    mReleasedByParent = false;
+
+    CaElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->addSubtree(this);
+    }
+  }
+
   if (mParentCaObject)
   {
+    prepareForChange();
 #if 0
     cout << "[DEBUG] connectToParent " << this << " (parent) " << CaTypeCode_toString(parent->getTypeCode(),"core")
          << " " << parent->getCaOmexManifest() << endl;
 #endif
-    setCaOmexManifest(mParentCaObject->getCaOmexManifest());
   }
-  else
+}
+
+
+/*
+ * Takes this object and the objects below it out of the document they
+ * belong to; the parent pointer is left alone.
+ */
+void
+CaBase::releaseFromParent ()
+{
+  leaveCaOmexManifest();
+  mReleasedByParent = true;
+}
+
+
+/*
+ * Takes this object and the objects below it out of the document they
+ * belong to, before this object leaves its parent.
+ */
+void
+CaBase::leaveCaOmexManifest()
+{
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->removeSubtree(this);
+
+    // rather than pushing the new document down the subtree, advance the
+    // epoch of the document left, so that the elements below this one
+    // derive their document again when next needed.  The documents cached
+    // by the elements of other documents stay valid, and no element below
+    // one that belonged to no document can have cached one (a missing one
+    // is never trusted).
+    index->advanceEpoch();
+  }
+  mCa = NULL;
+}
+
+
+/*
+ * Informs the indices that refer to this object by its identifier
+ * that the identifier is about to change.
+ */
+void
+CaBase::updateIdIndices(const std::string& oldId, const std::string& newId)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == OMEX_LIST_OF)
+  {
+    static_cast<CaListOf*>(getHoldingParent())->updateIdIndex(this, oldId, newId);
+  }
+
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateId(this, oldId, newId);
+  }
+}
+
+
+/*
+ * Drops the entries the indices hold for this object, whose identifiers
+ * and references have been moved elsewhere.
+ */
+void
+CaBase::releaseIndexEntries(const std::string& movedId)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == OMEX_LIST_OF)
+  {
+    CaListOf* parent = static_cast<CaListOf*>(getHoldingParent());
+    parent->updateIdIndex(this, movedId, "");
+    parent->clearReferenceIndices();
+  }
+
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->clear();
+  }
+}
+
+
+/*
+ * Informs the indices of the parent CaListOf and of the document that a
+ * reference is about to change.
+ */
+void
+CaBase::updateReferenceIndices(const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == OMEX_LIST_OF)
+  {
+    static_cast<CaListOf*>(getHoldingParent())->updateReferenceIndex(this,
+      attributeName, oldRef, newRef);
+  }
+
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateReference(this, attributeName, oldRef, newRef);
+  }
+}
+
+
+/*
+ * Informs the index of the document that the metaid is about to change.
+ */
+void
+CaBase::updateMetaIdIndex(const std::string& oldMetaId,
+                         const std::string& newMetaId)
+{
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateMetaId(this, oldMetaId, newMetaId);
+  }
+}
+
+
+/*
+ * @return the element index of the document this object belongs to.
+ */
+CaElementIndex*
+CaBase::getDocumentElementIndex() const
+{
+  CaOmexManifest* d = deriveCaOmexManifest();
+  if (d == NULL || d == this || d->getHasBeenDeleted())
+  {
+    return NULL;
+  }
+
+  return d->getElementIndex();
+}
+
+
+/*
+ * @return the arena of the document this object belongs to.
+ */
+CaArena*
+CaBase::getDocumentArena() const
+{
+  CaOmexManifest* d = deriveCaOmexManifest();
+  if (d == NULL || d->getHasBeenDeleted())
+  {
+    return NULL;
+  }
+
+  return d->getArena();
+}
+
+
+/*
+ * @return the namespaces to construct a child of this object with.
+ */
+CaNamespaces*
+CaBase::getSharedCaNamespaces() const
+{
+  // the constructor only takes a reference to them
+  return const_cast<CaNamespaces*>(getCaNamespaces());
+}
+
+
+/*
+ * @return the document this object belongs to; an object with a parent
+ * takes it from the parent unless the tree is unchanged since it last did.
+ */
+CaOmexManifest*
+CaBase::deriveCaOmexManifest() const
+{
+  CaOmexManifest* d = mCa;
+  CaBase* parent = getHoldingParent();
+  if (parent == NULL)
+  {
+    return d;
+  }
+
+  // the cached document can only be read while no document has been
+  // destroyed since it was cached.  The count is read first, so that a
+  // document destroyed while this one is derived only makes the cache stale
+  unsigned long numDestroyed = CaElementIndex::getNumDestroyed();
+  if (d == NULL || mNumDestroyedDocuments != numDestroyed
+    || mDocumentEpoch != d->getElementIndex()->getEpoch())
+  {
+    // a document being destroyed may already have lost its index
+    d = parent->deriveCaOmexManifest();
+    mDocumentEpoch = (d != NULL && !d->getHasBeenDeleted())
+      ? d->getElementIndex()->getEpoch() : 0;
+    mNumDestroyedDocuments = numDestroyed;
+    mCa = d;
+  }
+
+  return d;
+}
+
+
+/*
+ * @return the parent this object takes its document from.
+ */
+CaBase*
+CaBase::getHoldingParent() const
+{
+  return mReleasedByParent ? NULL : mParentCaObject;
+}
+
+
+/*
+ * Makes the copies sharing the branch holding this object take their own
+ * copies of it.  The ancestors go first: the copies they make share the
+ * children below them, which the next object down then detaches in turn.
+ */
+void
+CaBase::detachSharedCopies()
+{
+  if (mNumSharingLists == 0 || isCopyingOnWrite()) return;
+
+  if (getHoldingParent() != NULL)
   {
-    setCaOmexManifest(NULL);
+    getHoldingParent()->detachSharedCopies();
   }
+
+  unshareChildren();
+}
+
+
+/*
+ * Only CaListOf objects share their children.
+ */
+void
+CaBase::unshareChildren()
+{
+}
+
+
+/*
+ * @return true while this thread is making a copy with cloneCopyOnWrite().
+ */
+bool
+CaBase::isCopyingOnWrite()
+{
+  return copyingOnWrite > 0;
+}
+
+
+void
+CaBase::beginCopyingOnWrite()
+{
+  ++copyingOnWrite;
+}
+
+
+void
+CaBase::endCopyingOnWrite()
+{
+  --copyingOnWrite;
 }
 
 
@@ -1602,6 +2227,8 @@ CaBase::getAncestorOfType(int type) const
 int
 CaBase::setNamespaces(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns)
 {
+  mCaNamespaces = CaNamespaces::unshare(mCaNamespaces);
+
   if (xmlns == NULL)
   {
     mCaNamespaces->setNamespaces(NULL);
@@ -1622,6 +2249,8 @@ CaBase::setNamespaces(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns)
 int
 CaBase::unsetMetaId ()
 {
+  prepareForChange();
+  updateMetaIdIndex(mMetaId, "");
   mMetaId.erase();
 
   if (mMetaId.empty())
@@ -1641,6 +2270,8 @@ CaBase::unsetMetaId ()
 int
 CaBase::unsetId ()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty())
@@ -1660,8 +2291,8 @@ CaBase::unsetId ()
 int
 CaBase::unsetNotes ()
 {
-  delete mNotes;
-  mNotes = NULL;
+  prepareForChange();
+  releaseNode(mNotes, mNotesShares);
   return LIBCOMBINE_OPERATION_SUCCESS;
 }
 
@@ -1774,8 +2405,8 @@ CaBase::matchesCoreCaNamespace(const CaBase * sb)
 {
   bool match = false;
 
-  CaNamespaces *omexns = getCaNamespaces();
-  CaNamespaces *omexns_rhs = sb->getCaNamespaces();
+  const CaNamespaces *omexns = static_cast<const CaBase*>(this)->getCaNamespaces();
+  const CaNamespaces *omexns_rhs = sb->getCaNamespaces();
 
   if (omexns->getLevel() != omexns_rhs->getLevel())
     return match;
@@ -1801,8 +2432,8 @@ CaBase::matchesCoreCaNamespace(const CaBase * sb) const
 {
   bool match = false;
 
-  CaNamespaces *omexns = getCaNamespaces();
-  CaNamespaces *omexns_rhs = sb->getCaNamespaces();
+  const CaNamespaces *omexns = static_cast<const CaBase*>(this)->getCaNamespaces();
+  const CaNamespaces *omexns_rhs = sb->getCaNamespaces();
 
   if (omexns->getLevel() != omexns_rhs->getLevel())
     return match;
@@ -1887,26 +2518,45 @@ CaBase::setCaNamespaces(CaNamespaces * omexns)
 void
 CaBase::setCaNamespacesAndOwn(CaNamespaces * omexns)
 {
-  delete mCaNamespaces;
-  mCaNamespaces = omexns;
+  CaNamespaces::release(mCaNamespaces);
+  mCaNamespaces = CaNamespaces::internAndOwn(omexns);
 
-  if(omexns != NULL)
-    setElementNamespace(omexns->getURI());
+  if(mCaNamespaces != NULL)
+    setElementNamespace(mCaNamespaces->getURI());
 }
 
 
 /* gets the Canamespaces - internal use only*/
-CaNamespaces *
+const CaNamespaces *
 CaBase::getCaNamespaces() const
 {
-  if (mCa != NULL)
-    return mCa->mCaNamespaces;
+  const CaOmexManifest* d = deriveCaOmexManifest();
+  if (d != NULL && d != this)
+    return d->getCaNamespaces();
   
   // initialize OMEX namespace if need be
   if (mCaNamespaces == NULL)
     const_cast<CaBase*>(this)->mCaNamespaces = new CaNamespaces(getLevel(), getVersion());
+
   return mCaNamespaces;  
 }
+
+
+/* gets the Canamespaces for modification - internal use only*/
+CaNamespaces *
+CaBase::getCaNamespaces()
+{
+  CaOmexManifest* d = deriveCaOmexManifest();
+  if (d != NULL && d != this)
+    return d->getCaNamespaces();
+
+  if (mCaNamespaces == NULL)
+    mCaNamespaces = new CaNamespaces(getLevel(), getVersion());
+
+  // the caller may change the namespaces, so stop sharing them
+  mCaNamespaces = CaNamespaces::unshare(mCaNamespaces);
+  return mCaNamespaces;
+}
 /** @endcond */
 
 
@@ -2135,6 +2785,27 @@ CaBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
   addExpectedAttributes(expectedAttributes);
   readAttributes( element.getAttributes(), expectedAttributes );
 
+  // the attributes are read straight into the members, so let any
+  // index of the parent or the document know about the identifiers
+  if (!getId().empty())
+  {
+    updateIdIndices("", getId());
+  }
+  if (!getMetaId().empty())
+  {
+    updateMetaIdIndex("", getMetaId());
+  }
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == OMEX_LIST_OF)
+  {
+    static_cast<CaListOf*>(getHoldingParent())->clearReferenceIndices();
+  }
+  CaElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->addReferences(this);
+  }
+
   /* if we are reading a document pass the
    * OMEX Namespace information to the input stream object
    * thus the MathML reader can find out what level/version
@@ -2146,7 +2817,9 @@ CaBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     // need to check that any prefix on the omexns also occurs on element
     // remembering the horrible situation where the omexns might be declared
     // with more than one prefix
-    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * xmlns = this->getCaNamespaces()->getNamespaces();
+    const CaNamespaces * omexns =
+      static_cast<const CaBase*>(this)->getCaNamespaces();
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * xmlns = omexns->getNamespaces();
     if (xmlns != NULL)
     {
       int i = xmlns->getIndexByPrefix(element.getPrefix());
@@ -2156,7 +2829,7 @@ CaBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
         bool error = false;
         if (i > -1)
         {
-          if (xmlns->getURI(i) != this->getCaNamespaces()->getURI())
+          if (xmlns->getURI(i) != omexns->getURI())
           {
             error = true;
           }
@@ -2365,7 +3038,7 @@ CaBase::readAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
       logError(CaMultipleAnnotations, getLevel(), getVersion(), msg);
     }
 
-    delete mAnnotation;
+    releaseNode(mAnnotation, mAnnotationShares);
     mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
     checkAnnotation();
     return true;
@@ -2396,7 +3069,7 @@ CaBase::readNotes (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
       logError(CaOnlyOneNotesElementAllowed, getLevel(), getVersion());
     }
 
-    delete mNotes;
+    releaseNode(mNotes, mNotesShares);
     mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
 
     //
@@ -2437,7 +3110,8 @@ CaBase::getElementPosition () const
 CaErrorLog*
 CaBase::getErrorLog ()
 {
-  return (mCa != NULL) ? mCa->getErrorLog() : NULL;
+  CaOmexManifest* d = deriveCaOmexManifest();
+  return (d != NULL) ? d->getErrorLog() : NULL;
 }
 /** @endcond */
 
@@ -2459,7 +3133,7 @@ CaBase::logUnknownAttribute( const string& attribute,
         << "definition of an OMEX Level " << level
         << " Version " << version << " <" << element << "> element.";
 
-  if (mCa)
+  if (deriveCaOmexManifest())
   {
   //
   // (TODO) Needs to be fixed so that error can be added when
@@ -2488,7 +3162,7 @@ CaBase::logUnknownElement( const string& element,
     msg << "Element '" << element << "' is not part of the definition of "
         << "OMEX Level " << level << " Version " << version << ".";
 
-    if (mCa != NULL)
+    if (deriveCaOmexManifest() != NULL)
     {
       getErrorLog()->logError(CaUnrecognizedElement,
             level, version, msg.str(), getLine(), getColumn());
@@ -2519,7 +3193,7 @@ CaBase::logEmptyString( const string& attribute,
   // (TODO) Needs to be fixed so that error can be added when
   // no CaOmexManifest attached.
   //
-  if (mCa != NULL)
+  if (deriveCaOmexManifest() != NULL)
     getErrorLog()->logError(CaNotSchemaConformant,
                             level, version, msg.str(), getLine(), getColumn());
 }
@@ -2543,7 +3217,7 @@ CaBase::logError (  unsigned int       id
   // (TODO) Needs to be fixed so that error can be added when
   // no CaOmexManifest attached.
   //
-  if ( CaBase::getErrorLog() != NULL && mCa != NULL)
+  if ( CaBase::getErrorLog() != NULL && deriveCaOmexManifest() != NULL)
     getErrorLog()->logError(id, getLevel(), getVersion(), details, getLine(), getColumn());
 }
 /** @endcond */
@@ -2650,7 +3324,7 @@ CaBase::getPrefix() const
 
   const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns = getNamespaces();
   string uri = getURI();
-  if(xmlns && mCa)
+  if(xmlns && deriveCaOmexManifest())
   {
     prefix = xmlns->getPrefix(uri);
   }
@@ -2691,9 +3365,10 @@ CaBase::getCaPrefix() const
 CaBase*
 CaBase::getRootElement()
 {
-  if (mCa)
+  CaOmexManifest* d = deriveCaOmexManifest();
+  if (d)
   {
-    return mCa;
+    return d;
   }
   else if (mParentCaObject)
   {
@@ -2769,11 +3444,20 @@ int CaBase::removeFromParentAndDelete()
   CaBase* parent = getParentCaObject();
 
   if (parent==NULL) return LIBCOMBINE_OPERATION_FAILED;
+
+  // a single child is detached by its parent, which gives it back
+  if (parent->getTypeCode() != OMEX_LIST_OF)
+  {
+    parent->prepareForChange();
+    if (parent->removeChildObject(getElementName(), getId()) != this)
+      return LIBCOMBINE_OPERATION_FAILED;
+
+    delete this;
+    return LIBCOMBINE_OPERATION_SUCCESS;
+  }
   
   CaListOf* parentList = static_cast<CaListOf*>(parent);
   
-  if (parentList == NULL) return LIBCOMBINE_OPERATION_FAILED;
-  
   for (unsigned int i=0; i<parentList->size(); i++) 
   {
     CaBase* sibling = parentList->get(i);
@@ -2808,16 +3492,17 @@ CaBase::checkMathMLNamespace(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem
   }
   if (match == 0)
   {
-    if( mCa->getNamespaces() != NULL)
+    CaOmexManifest* d = deriveCaOmexManifest();
+    if( d->getNamespaces() != NULL)
     /* check for implicit declaration */
     {
-      for (n = 0; n < mCa->getNamespaces()->getLength(); n++)
+      for (n = 0; n < d->getNamespaces()->getLength(); n++)
       {
-        if (!strcmp(mCa->getNamespaces()->getURI(n).c_str(),
+        if (!strcmp(d->getNamespaces()->getURI(n).c_str(),
                     "http://www.w3.org/1998/Math/MathML"))
         {
           match = 1;
-          prefix = mCa->getNamespaces()->getPrefix(n);
+          prefix = d->getNamespaces()->getPrefix(n);
           break;
         }
       }
@@ -2933,12 +3618,13 @@ CaBase::checkAnnotation()
     if (topLevel.getNamespaces().getLength() == 0)
     {
       // not on actual element - is it explicit ??
-      if(mCa != NULL && mCa->getNamespaces() != NULL)
+      CaOmexManifest* d = deriveCaOmexManifest();
+      if(d != NULL && d->getNamespaces() != NULL)
       /* check for implicit declaration */
       {
-        for (n = 0; n < mCa->getNamespaces()->getLength(); n++)
+        for (n = 0; n < d->getNamespaces()->getLength(); n++)
         {
-          if (!strcmp(mCa->getNamespaces()->getPrefix(n).c_str(),
+          if (!strcmp(d->getNamespaces()->getPrefix(n).c_str(),
                         prefix.c_str()))
           {
             implicitNSdecl = true;
@@ -3025,7 +3711,8 @@ CaBase::checkXHTML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode * xhtml)
     }
   }
 
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* toplevelNS = (mCa) ? mCa->getNamespaces() : NULL;
+  CaOmexManifest* d = deriveCaOmexManifest();
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* toplevelNS = (d) ? d->getNamespaces() : NULL;
 
   /*
   * namespace declaration is variable
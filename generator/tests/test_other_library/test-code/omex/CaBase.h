@@ -59,8 +59,28 @@
 
 
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <new>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#  include <unordered_map>
+#  define LIBCOMBINE_HAS_UNORDERED_MAP 1
+#else
+#  include <map>
+#endif
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#  include <memory>
+#  include <utility>
+#  define LIBCOMBINE_HAS_MOVE_SEMANTICS 1
+#endif
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#  include <atomic>
+#  define LIBCOMBINE_HAS_THREAD_SAFE_COUNTERS 1
+#endif
 
 #include <omex/CaErrorLog.h>
 #include <omex/CaVisitor.h>
@@ -82,6 +102,21 @@ LIBSBML_CPP_NAMESPACE_END
 LIBCOMBINE_CPP_NAMESPACE_BEGIN
 
 class CaOmexManifest;
+class CaElementIndex;
+class CaArena;
+
+/** @cond doxygenLibomexInternal */
+/*
+ * The counters CaBase keeps across documents, and the counts of the objects
+ * sharing a node, are atomic so that different documents can be used from
+ * different threads (see CaBase::cloneCopyOnWrite()).
+ */
+#ifdef LIBCOMBINE_HAS_THREAD_SAFE_COUNTERS
+typedef std::atomic<unsigned long> CaCounter;
+#else
+typedef unsigned long CaCounter;
+#endif
+/** @endcond */
 
 
 class LIBCOMBINE_EXTERN CaBase
@@ -94,6 +129,42 @@ public:
   virtual ~CaBase ();
 
 
+  /** @cond doxygenLibomexInternal */
+  /**
+   * Allocates an CaBase object from the heap.
+   */
+  static void* operator new (size_t size);
+
+
+  /**
+   * Allocates an CaBase object from the given CaArena, or from the heap
+   * if @p arena is @c NULL or not enabled.
+   */
+  static void* operator new (size_t size, CaArena* arena);
+
+
+  static void* operator new (size_t size, const std::nothrow_t&) throw();
+
+
+  static void* operator new (size_t size, void* place) throw();
+
+
+  /**
+   * Frees an CaBase object allocated by any of the forms of operator new.
+   */
+  static void operator delete (void* p);
+
+
+  static void operator delete (void* p, CaArena* arena);
+
+
+  static void operator delete (void* p, const std::nothrow_t&) throw();
+
+
+  static void operator delete (void* p, void* place) throw();
+  /** @endcond */
+
+
   /**
    * Assignment operator for CaBase.
    *
@@ -103,6 +174,22 @@ public:
   CaBase& operator=(const CaBase& rhs);
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+  /**
+   * Move assignment operator for CaBase.
+   *
+   * The identifiers, notes and annotation of @p rhs are taken over rather
+   * than copied.  This object keeps its own parent, and @p rhs is left as
+   * a valid element without them, in the place it had.  The copies made
+   * with cloneCopyOnWrite() that share either object take their own
+   * copies first, which may throw @c std::bad_alloc.
+   *
+   * @param rhs The object whose values are moved into this one.
+   */
+  CaBase& operator=(CaBase&& rhs);
+#endif
+
+
   /** @cond doxygenLibomexInternal */
   /**
    * Accepts the given CaVisitor for this CaBase object.
@@ -123,6 +210,39 @@ public:
   virtual CaBase* clone () const = 0;
 
 
+  /**
+   * Creates and returns a copy of this CaBase object that shares its
+   * unchanged parts with the original.
+   *
+   * The items of the CaListOf objects in the copy, and the notes and
+   * annotations of its elements, are not copied straight away but shared
+   * with the original.  A CaListOf only takes copies of the items it shares
+   * when it or the items are first used, and those copies share their own
+   * children in turn; conversely a CaListOf whose items are shared makes the
+   * CaListOf objects sharing them take their copies before it or anything
+   * below it changes.  Only the branches actually used or changed are thus
+   * ever copied, which makes it cheap to derive many variants of a large
+   * document that each differ in a few places.
+   *
+   * The sharing relies on changes being made through the setters and the
+   * create, add and remove functions, which all call prepareForChange()
+   * first.  An element, math or XML node of the original changed by other
+   * means (for instance through a pointer to a node obtained from a getter)
+   * may also change the copies that still share it.
+   *
+   * Different documents can be used from different threads at the same
+   * time.  The original and the copies made here, however, count as one
+   * document for as long as a CaListOf of one shares the items of another,
+   * and must then be used from one thread at a time; shared notes and
+   * annotations do not tie them together.  This needs atomic counters and
+   * thread-local storage (C++11 or MSVC 2015 and later); without them the
+   * library must only be used from one thread at a time.
+   *
+   * @return the copy of this CaBase object.
+   */
+  CaBase* cloneCopyOnWrite () const;
+
+
   /**
    * Returns the first child element it can find with a specific "id"
    * attribute value, or @c NULL if no such object is found.
@@ -178,6 +298,21 @@ public:
   virtual List* getAllElements();
 
 
+  /** @cond doxygenLibomexInternal */
+  /**
+   * Adds the XML names of the SIdRef attributes of this object to the
+   * given list, so that the references it makes can be found through
+   * getAttribute().
+   *
+   * Subclasses with SIdRef attributes override this, calling the
+   * implementation of their parent class first.
+   *
+   * @param attributes the list to add the names to.
+   */
+  virtual void addReferenceAttributes(std::vector<std::string>& attributes) const;
+  /** @endcond */
+
+
   /**
    * Returns the value of the "metaid" attribute of this object.
    *
@@ -1207,6 +1342,11 @@ public:
   /**
    * Sets the parent CaOmexManifest of this OMEX object.
    *
+   * The document of an object with a parent is derived from that parent
+   * when it is needed, so this only has a lasting effect on an object
+   * without one; subclasses pass it on to their children so that a
+   * document can visit all of its elements to update its element index.
+   *
    * @param d the CaOmexManifest object to use
    *
    * @see connectToChild()
@@ -1227,11 +1367,27 @@ public:
    * addXXX, createXXX, and connectToChild functions of the
    * parent element).
    *
+   * Only the parent pointer is changed, so this takes constant time unless
+   * the document this object leaves or joins has built its element index,
+   * in which case each element of the subtree is removed from or added to
+   * that index.
+   *
    * @param parent the OMEX object to use
    */
   virtual void connectToParent (CaBase* parent);
 
 
+  /**
+   * Takes this OMEX object and the objects below it out of the
+   * document they belong to, as its parent hands it over to the caller
+   * (see CaListOf::remove()).  The parent pointer is left alone, but the
+   * object no longer takes its document from its parent, so
+   * getCaOmexManifest() returns @c NULL until it is connected to a parent
+   * again.
+   */
+  void releaseFromParent ();
+
+
   /**
    * Sets this OMEX object to child OMEX objects (if any).
    * (Creates a child-parent relationship by the parent)
@@ -1628,8 +1784,13 @@ public:
 
 
   /** @cond doxygenLibomexInternal */
-  /* gets the Canamespaces - internal use only*/
-  virtual CaNamespaces * getCaNamespaces() const;
+  /* gets the Canamespaces - internal use only; the object may be shared
+   * with other elements and documents */
+  virtual const CaNamespaces * getCaNamespaces() const;
+
+  /* gets the Canamespaces for modification - internal use only; they are
+   * copied first if they are shared (copy-on-write) */
+  virtual CaNamespaces * getCaNamespaces();
   /** @endcond */
 
 
@@ -1641,8 +1802,9 @@ public:
    * virtual method, as every CaBase element has different parents, and
    * therefore different methods of removing itself.  Will fail (and not
    * delete itself) if it has no parent object.  This function is designed to
-   * be overridden, but for all objects whose parent is of the class CaListOf,
-   * the default implementation will work.
+   * be overridden, but the default implementation will work for all objects
+   * whose parent is of the class CaListOf, and for the other objects whose
+   * parent gives them up through removeChildObject().
    *
    * @copydetails doc_returns_success_code
    * @li @omexconstant{LIBCOMBINE_OPERATION_SUCCESS, OperationReturnValues_t}
@@ -1750,6 +1912,18 @@ public:
   int unsetUserData();
 
 
+  /**
+   * Makes the copies made with cloneCopyOnWrite() that still share the
+   * branch holding this element take their own copy of it.  Does nothing
+   * unless such copies exist.
+   *
+   * The generated setters and the create, add and remove functions call
+   * this before making their change; it only needs to be called directly
+   * by code that changes an element by other means.
+   */
+  void prepareForChange();
+
+
   /**
    * Returns the CaErrorLog used to log errors while reading and
    * validating OMEX.
@@ -1799,6 +1973,21 @@ protected:
   CaBase(const CaBase& orig);
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor.  The new object takes over the identifiers, notes
+   * and annotation of @p orig but, like a copy, has no parent.  @p orig is
+   * left as a valid element without them, in the place it had; it can be
+   * taken out with removeFromParentAndDelete().  The copies made with
+   * cloneCopyOnWrite() that share @p orig take their own copies first,
+   * which may throw @c std::bad_alloc.
+   *
+   * @param orig the object to move.
+   */
+  CaBase(CaBase&& orig);
+#endif
+
+
   /**
    * Subclasses should override this method to create, store, and then
    * return an OMEX object corresponding to the next XMLToken in the
@@ -2014,6 +2203,139 @@ protected:
   CaBase* getRootElement();
 
 
+  /**
+   * Informs the indices that refer to this object by its identifier (the
+   * one kept by a parent CaListOf and the one kept by the CaOmexManifest) that
+   * the "id" is about to change.
+   *
+   * Subclasses that store the identifier themselves must call this before
+   * storing the new value.
+   *
+   * @param oldId the identifier this object currently has.
+   * @param newId the identifier this object is about to be given.
+   */
+  void updateIdIndices(const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Informs the indices that refer to this object that its identifiers and
+   * references have been moved to another object.  The parent CaListOf drops
+   * the identifier @p movedId and its reference indices, and the
+   * CaOmexManifest drops its element index, to rebuild them when next used.
+   *
+   * @param movedId the identifier this object had before the move.
+   */
+  void releaseIndexEntries(const std::string& movedId);
+
+
+  /**
+   * Makes the copies made with cloneCopyOnWrite() that share the branch
+   * holding this object take their own copies, starting from the root so
+   * that the copies taken on the way share nothing below this object.
+   * Called before anything in the branch changes.
+   */
+  void detachSharedCopies();
+
+
+  /**
+   * Makes the copies that share the children of this object take their own
+   * copies of them.  Does nothing here; overridden by CaListOf.
+   */
+  virtual void unshareChildren();
+
+
+  /**
+   * Predicate returning @c true while the calling thread is making a copy
+   * with cloneCopyOnWrite(), during which copies share rather than copy
+   * and nothing shared changes.
+   */
+  static bool isCopyingOnWrite();
+
+
+  /**
+   * Starts and ends a stretch of copying on write in the calling thread
+   * (see isCopyingOnWrite()).  The calls nest.
+   */
+  static void beginCopyingOnWrite();
+
+  static void endCopyingOnWrite();
+
+
+  /**
+   * Informs the index that the parent CaListOf keeps of the given SIdRef
+   * attribute, and the index of the references of the CaOmexManifest, that
+   * its value is about to change for this object.
+   *
+   * Subclasses must call this from the setters of their SIdRef attributes
+   * before storing the new value.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param oldRef the value the attribute currently has.
+   * @param newRef the value the attribute is about to be given.
+   */
+  void updateReferenceIndices(const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef);
+
+
+  /**
+   * Informs the index of the CaOmexManifest that the "metaid" of this object
+   * is about to change.
+   *
+   * @param oldMetaId the metaid this object currently has.
+   * @param newMetaId the metaid this object is about to be given.
+   */
+  void updateMetaIdIndex(const std::string& oldMetaId,
+                         const std::string& newMetaId);
+
+
+  /**
+   * Returns the element index of the CaOmexManifest this object belongs to,
+   * or @c NULL if there is no such document (or this object is the
+   * document itself).
+   */
+  CaElementIndex* getDocumentElementIndex() const;
+
+
+  /**
+   * Returns the arena new elements of the CaOmexManifest this object belongs
+   * to are allocated from, or @c NULL if there is no such document.
+   */
+  CaArena* getDocumentArena() const;
+
+
+  /**
+   * Returns the namespaces to pass to the constructor of a new child of
+   * this object.  They are shared rather than copied, so they must not be
+   * modified; the constructor takes its own reference to them.
+   */
+  CaNamespaces* getSharedCaNamespaces() const;
+
+
+  /**
+   * Returns the CaOmexManifest this object belongs to without checking
+   * whether it has been deleted.  The document is taken from the parent
+   * and cached until an element leaves that document or a document is
+   * destroyed.
+   */
+  CaOmexManifest* deriveCaOmexManifest() const;
+
+
+  /**
+   * Returns the parent this object takes its document from: its parent,
+   * unless the parent has handed it over to the caller.
+   */
+  CaBase* getHoldingParent() const;
+
+
+  /**
+   * Takes this object and the objects below it out of the index of the
+   * document they belong to, and makes the objects below it derive their
+   * document again, before this object leaves its parent.
+   */
+  void leaveCaOmexManifest();
+
+
   // ------------------------------------------------------------------
 
 
@@ -2021,7 +2343,11 @@ protected:
   std::string     mId;
   LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mNotes;
   LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mAnnotation;
-  CaOmexManifest*   mCa;
+#ifdef LIBCOMBINE_HAS_THREAD_SAFE_COUNTERS
+  mutable std::atomic<CaOmexManifest*> mCa;
+#else
+  mutable CaOmexManifest* mCa;
+#endif
   CaNamespaces* mCaNamespaces;
   void*           mUserData;
 
@@ -2031,6 +2357,22 @@ protected:
   /* store the parent OMEX object */
   CaBase* mParentCaObject;
   bool mHasBeenDeleted;
+  /* set once the parent has handed this object over to the caller */
+  bool mReleasedByParent;
+
+  /* mCa is valid for an object with a parent while these match the
+   * epoch of that document and the number of documents destroyed (see
+   * CaElementIndex) */
+  mutable CaCounter mDocumentEpoch;
+  mutable CaCounter mNumDestroyedDocuments;
+
+  /* the number of CaListOf objects still sharing the items of another */
+  static CaCounter mNumSharingLists;
+
+  /* counts the objects sharing mNotes / mAnnotation, or NULL if the
+   * node is not shared */
+  mutable CaCounter* mNotesShares;
+  mutable CaCounter* mAnnotationShares;
 
   std::string mEmptyString;
 
@@ -111,6 +111,42 @@ CaContent::operator=(const CaContent& rhs)
 }
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for CaContent.
+ */
+CaContent::CaContent(CaContent&& orig)
+  : CaBase( std::move(orig) )
+  , mLocation ( std::move(orig.mLocation) )
+  , mFormat ( std::move(orig.mFormat) )
+  , mMaster ( orig.mMaster )
+  , mIsSetMaster ( orig.mIsSetMaster )
+{
+}
+
+
+/*
+ * Move assignment operator for CaContent.
+ */
+CaContent&
+CaContent::operator=(CaContent&& rhs)
+{
+  if (&rhs != this)
+  {
+    CaBase::operator=(std::move(rhs));
+    mLocation = std::move(rhs.mLocation);
+    mFormat = std::move(rhs.mFormat);
+    mMaster = rhs.mMaster;
+    mIsSetMaster = rhs.mIsSetMaster;
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBCOMBINE_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this CaContent object.
  */
@@ -195,6 +231,7 @@ CaContent::isSetMaster() const
 int
 CaContent::setLocation(const std::string& location)
 {
+  prepareForChange();
   mLocation = location;
   return LIBCOMBINE_OPERATION_SUCCESS;
 }
@@ -206,6 +243,7 @@ CaContent::setLocation(const std::string& location)
 int
 CaContent::setFormat(const std::string& format)
 {
+  prepareForChange();
   mFormat = format;
   return LIBCOMBINE_OPERATION_SUCCESS;
 }
@@ -217,6 +255,7 @@ CaContent::setFormat(const std::string& format)
 int
 CaContent::setMaster(bool master)
 {
+  prepareForChange();
   mMaster = master;
   mIsSetMaster = true;
   return LIBCOMBINE_OPERATION_SUCCESS;
@@ -229,6 +268,7 @@ CaContent::setMaster(bool master)
 int
 CaContent::unsetLocation()
 {
+  prepareForChange();
   mLocation.erase();
 
   if (mLocation.empty() == true)
@@ -248,6 +288,7 @@ CaContent::unsetLocation()
 int
 CaContent::unsetFormat()
 {
+  prepareForChange();
   mFormat.erase();
 
   if (mFormat.empty() == true)
@@ -267,6 +308,7 @@ CaContent::unsetFormat()
 int
 CaContent::unsetMaster()
 {
+  prepareForChange();
   mMaster = false;
   mIsSetMaster = false;
 
@@ -696,25 +738,24 @@ CaContent::readAttributes(
       if (log->getError(n)->getErrorId() == CaUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(CaUnknownCoreAttribute);
+        log->remove(CaUnknownCoreAttribute, n);
         log->logError(CombineOmexManifestLOContentsAllowedCoreAttributes,
           level, version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   CaBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == CaUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(CaUnknownCoreAttribute);
+        log->remove(CaUnknownCoreAttribute, n);
         log->logError(CombineContentAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -779,9 +820,9 @@ CaContent::readAttributes(
   if (mIsSetMaster == false)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       log->logError(CombineContentMasterMustBeBoolean, level, version);
     }
   }
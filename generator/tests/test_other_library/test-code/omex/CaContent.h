@@ -116,6 +116,28 @@ public:
   CaContent& operator=(const CaContent& rhs);
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for CaContent.
+   *
+   * @param orig the CaContent instance to move; it is left as an empty
+   * CaContent in the place it had.
+   */
+  CaContent(CaContent&& orig);
+
+
+  /**
+   * Move assignment operator for CaContent.
+   *
+   * @param rhs the CaContent object whose values are to be moved into this
+   * one; it is left as an empty CaContent in the place it had.
+   */
+  CaContent& operator=(CaContent&& rhs);
+
+
+#endif  /* LIBCOMBINE_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this CaContent object.
    *
@@ -0,0 +1,352 @@
+/**
+ * @file CaElementIndex.h
+ * @brief Definition of the CaElementIndex class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class CaElementIndex
+ * @sbmlbrief{} TODO:Definition of the CaElementIndex class.
+ */
+
+
+#ifndef CaElementIndex_h
+#define CaElementIndex_h
+
+
+#include <omex/common/extern.h>
+#include <omex/CaBase.h>
+
+
+#ifdef __cplusplus
+
+#include <string>
+#include <utility>
+#include <vector>
+
+LIBCOMBINE_CPP_NAMESPACE_BEGIN
+
+class CaOmexManifest;
+
+/** @cond doxygenLibomexInternal */
+
+/**
+ * Index of the identifiers and metaids of all the elements of a
+ * CaOmexManifest, and of the references made to identifiers by their SIdRef
+ * attributes.
+ *
+ * The index is built lazily on the first lookup by walking the document
+ * once, and is then kept up to date by the elements themselves as their
+ * identifiers and references change and as they are attached to or
+ * detached from the document.  Until it is built, attaching or detaching
+ * an element does not need to visit the elements below it.  Where two elements share an identifier the
+ * first one in document order is returned; any change that could alter
+ * which element comes first simply invalidates the index so that the next
+ * lookup rebuilds it.
+ *
+ * The references form a reverse graph from each identifier to the
+ * elements referring to it, so that renaming or deleting an element only
+ * touches the elements that actually refer to it.
+ */
+class LIBCOMBINE_EXTERN CaElementIndex
+{
+public:
+
+  /**
+   * Creates a new, not yet built, CaElementIndex.
+   */
+  CaElementIndex ();
+
+
+  /**
+   * Copy constructor; the index is not copied as it refers to the
+   * elements of another document.
+   */
+  CaElementIndex (const CaElementIndex& orig);
+
+
+  /**
+   * Assignment operator; the index is invalidated rather than copied.
+   */
+  CaElementIndex& operator=(const CaElementIndex& rhs);
+
+
+  /**
+   * Destroys this CaElementIndex.
+   */
+  virtual ~CaElementIndex ();
+
+
+  /**
+   * Predicate returning @c true if the index has been built and can be
+   * used for lookups.
+   */
+  bool isBuilt () const;
+
+
+  /**
+   * Predicate returning @c true while the index is being populated
+   * by build().
+   */
+  bool isBuilding () const;
+
+
+  /**
+   * Populates the index with all the elements of the given document.
+   *
+   * @param d the CaOmexManifest whose elements are to be indexed.
+   */
+  void build (CaOmexManifest* d);
+
+
+  /**
+   * Empties the index and marks it as needing to be rebuilt.
+   */
+  void clear ();
+
+
+  /**
+   * Adds the identifier and metaid of the given element to the index.
+   *
+   * @param element the CaBase object to add.
+   */
+  void add (CaBase* element);
+
+
+  /**
+   * Removes the identifier and metaid of the given element from the index.
+   *
+   * @param element the CaBase object to remove.
+   */
+  void remove (CaBase* element);
+
+
+  /**
+   * Adds the given element and all the elements below it to the index,
+   * when the element has just been attached to the document.  Does nothing
+   * if the index has not been built.
+   *
+   * @param element the CaBase object at the root of the subtree to add.
+   */
+  void addSubtree (CaBase* element);
+
+
+  /**
+   * Removes the given element and all the elements below it from the
+   * index, when the element is about to be detached from the document.
+   * Does nothing if the index has not been built.
+   *
+   * @param element the CaBase object at the root of the subtree to remove.
+   */
+  void removeSubtree (CaBase* element);
+
+
+  /**
+   * Called by each element reached while the document walks its elements
+   * (see build(), addSubtree() and removeSubtree()) to add or remove it as
+   * the walk requires; does nothing outside such a walk.
+   *
+   * @param element the CaBase object reached.
+   */
+  void visit (CaBase* element);
+
+
+  /**
+   * Returns the epoch of the document.  It is advanced whenever an element
+   * that may have passed the document on to the elements below it leaves
+   * the document, so that those elements derive their document again.
+   */
+  unsigned long getEpoch () const;
+
+
+  /**
+   * Advances the epoch of the document (see getEpoch()).
+   */
+  void advanceEpoch ();
+
+
+  /**
+   * Returns the number of indices, and so of documents, destroyed so far.
+   * A document cached by an element can still be read while this is
+   * unchanged.
+   */
+  static unsigned long getNumDestroyed ();
+
+
+  /**
+   * Informs the index that the identifier of the given element is
+   * changing from @p oldId to @p newId.
+   */
+  void updateId (CaBase* element, const std::string& oldId,
+                 const std::string& newId);
+
+
+  /**
+   * Informs the index that the metaid of the given element is
+   * changing from @p oldMetaId to @p newMetaId.
+   */
+  void updateMetaId (CaBase* element, const std::string& oldMetaId,
+                     const std::string& newMetaId);
+
+
+  /**
+   * Informs the index that the SIdRef attribute @p attributeName of the
+   * given element is changing from @p oldRef to @p newRef.
+   */
+  void updateReference (CaBase* element, const std::string& attributeName,
+                        const std::string& oldRef,
+                        const std::string& newRef);
+
+
+  /**
+   * Adds the references made by the SIdRef attributes of the given
+   * element to the index.  Used when the attributes of an element have
+   * been read without going through its setters.
+   *
+   * @param element the CaBase object whose references are to be added.
+   */
+  void addReferences (CaBase* element);
+
+
+  /**
+   * Returns the element with the given identifier, or @c NULL if
+   * there is none.
+   */
+  CaBase* getElementBySId (const std::string& id) const;
+
+
+  /**
+   * Returns the elements that refer to the given identifier through one
+   * of their SIdRef attributes.
+   *
+   * @return a List of the referring elements, each listed once.  The
+   * caller owns the List (but not the elements in it) and is responsible
+   * for deleting it.
+   */
+  List* getReferrers (const std::string& id) const;
+
+
+  /**
+   * Changes the identifier of the element with the identifier @p oldId to
+   * @p newId, and updates every SIdRef attribute that referred to @p oldId
+   * to refer to @p newId instead.  Nothing is changed if another element
+   * already has the identifier @p newId.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @omexconstant{LIBCOMBINE_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   */
+  int renameSId (const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Removes the element with the given identifier from the document and
+   * deletes it, together with every element that refers to it and, in
+   * turn, every element that refers to one of those.
+   *
+   * Only the identifiers of the removed elements themselves are followed;
+   * elements that refer to an element nested inside a removed one are
+   * left in place.  Each element is removed with
+   * CaBase::removeFromParentAndDelete(), so an element that its parent
+   * requires (and will not give up) stays and the removal fails.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @omexconstant{LIBCOMBINE_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int removeWithReferrers (const std::string& id);
+
+
+  /**
+   * Returns the element with the given metaid, or @c NULL if
+   * there is none.
+   */
+  CaBase* getElementByMetaId (const std::string& metaid) const;
+
+
+protected:
+
+#ifdef LIBCOMBINE_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, CaBase*> ElementMap;
+#else
+  typedef std::map<std::string, CaBase*> ElementMap;
+#endif
+
+  // an element referring to an identifier, and the attribute it uses
+  typedef std::pair<CaBase*, std::string> Referrer;
+  // an attribute of an element, and the identifier it refers to
+  typedef std::pair<std::string, std::string> Reference;
+
+#ifdef LIBCOMBINE_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, std::vector<Referrer> > ReferrerMap;
+  typedef std::unordered_map<const CaBase*, std::vector<Reference> > ReferenceMap;
+#else
+  typedef std::map<std::string, std::vector<Referrer> > ReferrerMap;
+  typedef std::map<const CaBase*, std::vector<Reference> > ReferenceMap;
+#endif
+
+  void insertEntry (ElementMap& map, const std::string& key,
+                    CaBase* element);
+
+  void eraseEntry (ElementMap& map, const std::string& key,
+                   CaBase* element);
+
+  void addReference (CaBase* element, const std::string& attributeName,
+                     const std::string& ref);
+
+  void eraseReference (CaBase* element, const std::string& attributeName,
+                       const std::string& ref);
+
+  void removeReferences (CaBase* element);
+
+
+  ElementMap mIds;
+  ElementMap mMetaIds;
+  ReferrerMap mReferrers;
+  ReferenceMap mReferences;
+  bool mBuilt;
+  bool mBuilding;
+  bool mAdding;
+  bool mRemoving;
+  unsigned int mNumDuplicates;
+  CaCounter mEpoch;
+  static CaCounter mNumDestroyed;
+};
+
+/** @endcond */
+
+LIBCOMBINE_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* CaElementIndex_h */
@@ -187,13 +187,29 @@ CaError::CaError (  const unsigned int errorId
     unsigned int tableSize = sizeof(omexErrorTable)/sizeof(omexErrorTable[0]);
     unsigned int index = 0;
 
-    for ( unsigned int i = 0; i < tableSize; i++ )
+    // The table is written in order of error code, so it can be bisected
+    // rather than scanned.
+
+    unsigned int lower = 0;
+    unsigned int upper = tableSize;
+
+    while ( lower < upper )
     {
-      if ( mErrorId == omexErrorTable[i].code )
+      unsigned int middle = lower + (upper - lower) / 2;
+
+      if ( omexErrorTable[middle].code < mErrorId )
       {
-        index = i;
-        break;
+        lower = middle + 1;
       }
+      else
+      {
+        upper = middle;
+      }
+    }
+
+    if ( lower < tableSize && omexErrorTable[lower].code == mErrorId )
+    {
+      index = lower;
     }
 
     if ( index == 0 && mErrorId != CaUnknown )
@@ -115,6 +115,32 @@ static const omexErrorTableEntry omexErrorTable[] =
     }
   },
 
+  // 10101
+  { CombineNSUndeclared,
+    "The Combine namespace is not correctly declared.",
+    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
+    LIBCOMBINE_SEV_ERROR,
+    "To conform to the Package specification for SBML Level 1 Version 1, an "
+    "SBML document must declare "
+    "'http://www.sbml.org/sbml/level1/version1/combine/version1' as the "
+    "XMLNamespace to use for elements of this package.",
+    { "L3V1 Combine V1 Section 3.1"
+    }
+  },
+
+  // 10102
+  { CombineElementNotInNs,
+    "Element not in Combine namespace",
+    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
+    LIBCOMBINE_SEV_ERROR,
+    "Wherever they appear in an SBML document, elements and attributes from the "
+    "Package must use the "
+    "'http://www.sbml.org/sbml/level1/version1/combine/version1' namespace, "
+    "declaring so either explicitly or implicitly.",
+    { "L3V1 Combine V1 Section 3.1"
+    }
+  },
+
   //10201
   {
     CaInvalidMathElement,
@@ -128,6 +154,39 @@ static const omexErrorTableEntry omexErrorTable[] =
     }
   },
 
+  // 10301
+  { CombineDuplicateComponentId,
+    "Duplicate 'id' attribute value",
+    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
+    LIBCOMBINE_SEV_ERROR,
+    "(Extends validation rule #10301 in the SBML Level 3 Core specification. TO "
+    "DO list scope of ids)",
+    { "L3V1 Combine V1 Section"
+    }
+  },
+
+  // 10302
+  { CombineIdSyntaxRule,
+    "Invalid SId syntax",
+    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
+    LIBCOMBINE_SEV_ERROR,
+    "The value of a 'combine:id' must conform to the syntax of the <sbml> data "
+    "type 'SId'",
+    { "L3V1 Combine V1 Section"
+    }
+  },
+
+  // 10303
+  { CaInvalidMetaidSyntax,
+    "Invalid SId syntax",
+    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
+    LIBCOMBINE_SEV_ERROR,
+    "The value of a 'combine:metaid' must conform to the syntax of the XML Type "
+    "ID",
+    { "L3V1 Combine V1 Section"
+    }
+  },
+
   //10401
   {
     CaMissingAnnotationNamespace,
@@ -235,69 +294,6 @@ static const omexErrorTableEntry omexErrorTable[] =
     }
   },
 
-  /* --------------------------------------------------------------------------
-   * Boundary marker.  OMEX specific errors.
-   * ----------------------------------------------------------------------- */
-
-  // 10101
-  { CombineNSUndeclared,
-    "The Combine namespace is not correctly declared.",
-    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
-    LIBCOMBINE_SEV_ERROR,
-    "To conform to the Package specification for SBML Level 1 Version 1, an "
-    "SBML document must declare "
-    "'http://www.sbml.org/sbml/level1/version1/combine/version1' as the "
-    "XMLNamespace to use for elements of this package.",
-    { "L3V1 Combine V1 Section 3.1"
-    }
-  },
-
-  // 10102
-  { CombineElementNotInNs,
-    "Element not in Combine namespace",
-    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
-    LIBCOMBINE_SEV_ERROR,
-    "Wherever they appear in an SBML document, elements and attributes from the "
-    "Package must use the "
-    "'http://www.sbml.org/sbml/level1/version1/combine/version1' namespace, "
-    "declaring so either explicitly or implicitly.",
-    { "L3V1 Combine V1 Section 3.1"
-    }
-  },
-
-  // 10301
-  { CombineDuplicateComponentId,
-    "Duplicate 'id' attribute value",
-    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
-    LIBCOMBINE_SEV_ERROR,
-    "(Extends validation rule #10301 in the SBML Level 3 Core specification. TO "
-    "DO list scope of ids)",
-    { "L3V1 Combine V1 Section"
-    }
-  },
-
-  // 10302
-  { CombineIdSyntaxRule,
-    "Invalid SId syntax",
-    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
-    LIBCOMBINE_SEV_ERROR,
-    "The value of a 'combine:id' must conform to the syntax of the <sbml> data "
-    "type 'SId'",
-    { "L3V1 Combine V1 Section"
-    }
-  },
-
-  // 10303
-  { CaInvalidMetaidSyntax,
-    "Invalid SId syntax",
-    LIBCOMBINE_CAT_GENERAL_CONSISTENCY,
-    LIBCOMBINE_SEV_ERROR,
-    "The value of a 'combine:metaid' must conform to the syntax of the XML Type "
-    "ID",
-    { "L3V1 Combine V1 Section"
-    }
-  },
-
   // 20101
   { InvalidNamespaceOnCa,
     "Invalid namespace",
@@ -434,10 +430,6 @@ static const omexErrorTableEntry omexErrorTable[] =
     }
   },
 
-  /* --------------------------------------------------------------------------
-   * Boundary marker.  Application-specific codes should begin at 100000.
-   * ----------------------------------------------------------------------- */
-
   //99994
   {
     CaUnknownCoreAttribute,
@@ -458,7 +450,8 @@ static const omexErrorTableEntry omexErrorTable[] =
     "Application-specific codes should begin at 100000.", 
     {""
     }
-   }
+   },
+
 };
 
 LIBCOMBINE_CPP_NAMESPACE_END
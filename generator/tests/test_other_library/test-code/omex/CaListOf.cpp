@@ -40,6 +40,7 @@
 #include <functional>
 
 #include <omex/CaVisitor.h>
+#include <omex/CaElementIndex.h>
 #include <omex/CaListOf.h>
 #include <omex/common/common.h>
 
@@ -57,6 +58,12 @@ LIBCOMBINE_CPP_NAMESPACE_BEGIN
  */
 CaListOf::CaListOf (unsigned int level, unsigned int version)
 : CaBase(level,version)
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw CaConstructorException();
@@ -68,6 +75,12 @@ CaListOf::CaListOf (unsigned int level, unsigned int version)
  */
 CaListOf::CaListOf (CaNamespaces* omexns)
 : CaBase(omexns)
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw CaConstructorException();
@@ -83,11 +96,48 @@ struct Delete : public unary_function<CaBase*, void>
 };
 
 
+/**
+ * Used by CaListOf::setCaOmexManifest().
+ */
+struct SetCaOmexManifest : public unary_function<CaBase*, void>
+{
+  CaOmexManifest* d;
+
+  SetCaOmexManifest (CaOmexManifest* d) : d(d) { }
+  void operator() (CaBase* sbase) { sbase->setCaOmexManifest(d); }
+};
+
+
+/**
+ * Used by CaListOf::connectToChild().
+ */
+struct SetParentCaObject : public unary_function<CaBase*, void>
+{
+  CaBase* sb;
+
+  SetParentCaObject (CaBase *sb) : sb(sb) { }
+  void operator() (CaBase* sbase) { sbase->connectToParent(sb); }
+};
+
+
+/**
+ * Used by CaListOf::clear() when the items are handed over to the caller.
+ */
+struct ReleaseFromParent : public unary_function<CaBase*, void>
+{
+  void operator() (CaBase* sbase) { sbase->releaseFromParent(); }
+};
+
+
 /*
  * Destroys the given CaListOf and its constituent items.
  */
 CaListOf::~CaListOf ()
 {
+  // rather than have the CaListOf objects sharing the items copy them, give
+  // the items to one of them
+  stopSharing();
+  handOverItems();
   for_each( mItems.begin(), mItems.end(), Delete() );
 }
 
@@ -105,9 +155,30 @@ struct Clone : public unary_function<CaBase*, CaBase*>
  * Copy constructor. Creates a copy of this CaListOf items.
  */
 CaListOf::CaListOf (const CaListOf& orig) : CaBase(orig), mItems()
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
-  mItems.resize( orig.size() );
-  transform( orig.mItems.begin(), orig.mItems.end(), mItems.begin(), Clone() );
+  // a CaListOf still sharing the items of another is copied from that one
+  const CaListOf& source =
+    (orig.mSharedSource != NULL) ? *orig.mSharedSource : orig;
+
+  if (isCopyingOnWrite() && !source.mItems.empty())
+  {
+    // see cloneCopyOnWrite(); the items are only copied when needed
+    mSharedSource = &source;
+    source.mSharers.push_back(this);
+    ++mNumSharingLists;
+  }
+  else
+  {
+    mItems.resize( source.mItems.size() );
+    transform( source.mItems.begin(), source.mItems.end(), mItems.begin(),
+               Clone() );
+  }
   connectToChild();
 }
 
@@ -121,19 +192,74 @@ CaListOf& CaListOf::operator=(const CaListOf& rhs)
   {
     this->CaBase::operator =(rhs);
     // Deletes existing items
+    stopSharing();
     for_each( mItems.begin(), mItems.end(), Delete() );
-    mItems.resize( rhs.size() );
-    transform( rhs.mItems.begin(), rhs.mItems.end(), mItems.begin(), Clone() );
+    clearIdIndex();
+    clearReferenceIndices();
+    const CaListOf& source =
+      (rhs.mSharedSource != NULL) ? *rhs.mSharedSource : rhs;
+    mItems.resize( source.mItems.size() );
+    transform( source.mItems.begin(), source.mItems.end(), mItems.begin(),
+               Clone() );
     connectToChild();
   }
 
   return *this;
 }
 
+
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor. Takes over the items of the given CaListOf.
+ */
+CaListOf::CaListOf (CaListOf&& orig) : CaBase(std::move(orig))
+, mItems(std::move(orig.mItems))
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
+{
+  orig.mItems.clear();
+  orig.clearIdIndex();
+  orig.clearReferenceIndices();
+  takeOverSharing(orig);
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator
+ */
+CaListOf& CaListOf::operator=(CaListOf&& rhs)
+{
+  if(&rhs!=this)
+  {
+    this->CaBase::operator =(std::move(rhs));
+    // Deletes existing items, unless other CaListOf objects share them
+    stopSharing();
+    handOverItems();
+    for_each( mItems.begin(), mItems.end(), Delete() );
+    clearIdIndex();
+    clearReferenceIndices();
+    mItems = std::move(rhs.mItems);
+    rhs.mItems.clear();
+    rhs.clearIdIndex();
+    rhs.clearReferenceIndices();
+    takeOverSharing(rhs);
+    connectToChild();
+  }
+
+  return *this;
+}
+#endif
+
 /** @cond doxygenLibomexInternal */
 bool
 CaListOf::accept (CaVisitor& v) const
 {
+  copySharedItems();
   v.visit(*this, getItemTypeCode() );
   for (unsigned int n = 0 ; n < mItems.size() && mItems[n]->accept(v); ++n) ;
   v.leave(*this, getItemTypeCode() );
@@ -171,11 +297,17 @@ CaListOf::insert(int location, const CaBase* item)
 int 
 CaListOf::insertAndOwn(int location, CaBase* item)
 {
+  copySharedItems();
+  detachSharedCopies();
+
   /* no list elements yet */
   if (this->getItemTypeCode() == OMEX_UNKNOWN )
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    addToReferenceIndices(item, false);
+    prepareForChange();
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -186,6 +318,9 @@ CaListOf::insertAndOwn(int location, CaBase* item)
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    addToReferenceIndices(item, false);
+    prepareForChange();
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
 }
@@ -215,11 +350,17 @@ CaListOf::append (const CaBase* item)
 int
 CaListOf::appendAndOwn (CaBase* item)
 {
+  copySharedItems();
+  detachSharedCopies();
+
   /* no list elements yet */
   if (this->getItemTypeCode() == OMEX_UNKNOWN )
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    addToReferenceIndices(item, true);
+    prepareForChange();
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -230,6 +371,9 @@ CaListOf::appendAndOwn (CaBase* item)
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    addToReferenceIndices(item, true);
+    prepareForChange();
     return LIBCOMBINE_OPERATION_SUCCESS;
   }
 }
@@ -259,6 +403,9 @@ int CaListOf::appendFrom(const CaListOf* list)
 const CaBase*
 CaListOf::get (unsigned int n) const
 {
+  // the item returned must belong to this CaListOf and its document
+  copySharedItems();
+
   return (n < mItems.size()) ? mItems[n] : NULL;
 }
 
@@ -269,6 +416,7 @@ CaListOf::get (unsigned int n) const
 CaBase*
 CaListOf::get (unsigned int n)
 {
+  copySharedItems();
   return const_cast<CaBase*>( static_cast<const CaListOf&>(*this).get(n) );
 }
 
@@ -348,10 +496,19 @@ CaListOf::getAllElements()
 void
 CaListOf::clear (bool doDelete)
 {
+  // the items still shared are simply no longer shared
+  detachSharedCopies();
+  stopSharing();
+
   if (doDelete)
     for_each( mItems.begin(), mItems.end(), Delete() );
+  else
+    for_each( mItems.begin(), mItems.end(), ReleaseFromParent() );
   
   mItems.clear();
+  clearIdIndex();
+  clearReferenceIndices();
+  prepareForChange();
 }
 
 
@@ -374,46 +531,428 @@ CaListOf::remove (unsigned int n)
 {
   CaBase* item = get(n);
   
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    detachSharedCopies();
+    mItems.erase( mItems.begin() + n );
+    removeFromIdIndex(item, item->getId());
+    removeFromReferenceIndices(item);
+    prepareForChange();
+    // the caller now owns the item, so it leaves the document; it keeps its
+    // parent pointer
+    item->releaseFromParent();
+  }
   
   return item;
 }
 
 
+/*
+ * Returns the first item with the given identifier, using (and if
+ * necessary building) the identifier index.
+ */
+const CaBase*
+CaListOf::getItemById (const std::string& sid) const
+{
+  copySharedItems();
+
+  if (sid.empty())
+  {
+    // items without an identifier are not indexed
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getId().empty()) return *it;
+    }
+    return NULL;
+  }
+
+  if (!mIdIndexBuilt)
+  {
+    buildIdIndex();
+  }
+
+  IdIndex::const_iterator found = mIdIndex.find(sid);
+
+  return (found == mIdIndex.end()) ? NULL : found->second;
+}
+
+
+/*
+ * Returns the first item with the given identifier, after taking copies
+ * of shared items.
+ */
+CaBase*
+CaListOf::getItemById (const std::string& sid)
+{
+  copySharedItems();
+  return const_cast<CaBase*>( static_cast<const CaListOf&>(*this).getItemById(sid) );
+}
+
+
+/*
+ * Removes the first item with the given identifier and returns it.
+ */
+CaBase*
+CaListOf::removeItemById (const std::string& sid)
+{
+  CaBase* item = getItemById(sid);
+
+  if (item != NULL)
+  {
+    detachSharedCopies();
+    mItems.erase( find(mItems.begin(), mItems.end(), item) );
+    removeFromIdIndex(item, sid);
+    removeFromReferenceIndices(item);
+    prepareForChange();
+    item->releaseFromParent();
+  }
+
+  return item;
+}
+
+
+/*
+ * Returns the first item whose attribute refers to the identifier, using
+ * (and if necessary building) the index of that attribute.
+ */
+const CaBase*
+CaListOf::getItemByReference (const std::string& attributeName,
+                            const std::string& sid) const
+{
+  copySharedItems();
+
+  if (sid.empty())
+  {
+    // items without a reference are not indexed
+    std::string ref;
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getAttribute(attributeName, ref) == LIBCOMBINE_OPERATION_SUCCESS
+        && ref.empty())
+      {
+        return *it;
+      }
+    }
+    return NULL;
+  }
+
+  const ReferenceIndex& index = getReferenceIndex(attributeName);
+  ReferenceIndex::const_iterator found = index.find(sid);
+
+  return (found == index.end()) ? NULL : found->second.front();
+}
+
+
+/*
+ * Returns the first item whose attribute refers to the identifier, after
+ * taking copies of shared items.
+ */
+CaBase*
+CaListOf::getItemByReference (const std::string& attributeName,
+                            const std::string& sid)
+{
+  copySharedItems();
+  return const_cast<CaBase*>( static_cast<const CaListOf&>(*this)
+                               .getItemByReference(attributeName, sid) );
+}
+
+
+/*
+ * Returns all the items whose attribute refers to the identifier, after
+ * taking copies of shared items (the List hands them out for change).
+ */
+List*
+CaListOf::getItemsByReference (const std::string& attributeName,
+                             const std::string& sid)
+{
+  copySharedItems();
+
+  List* ret = new List();
+
+  if (sid.empty())
+  {
+    std::string ref;
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getAttribute(attributeName, ref) == LIBCOMBINE_OPERATION_SUCCESS
+        && ref.empty())
+      {
+        ret->add(*it);
+      }
+    }
+    return ret;
+  }
+
+  const ReferenceIndex& index = getReferenceIndex(attributeName);
+  ReferenceIndex::const_iterator found = index.find(sid);
+
+  if (found != index.end())
+  {
+    for (std::vector<CaBase*>::const_iterator it = found->second.begin();
+         it != found->second.end(); ++it)
+    {
+      ret->add(*it);
+    }
+  }
+
+  return ret;
+}
+
+
 /*
  * @return the number of items in this CaListOf items.
  */
 unsigned int
 CaListOf::size () const
 {
-  return (unsigned int)mItems.size();
+  const ListItem& items =
+    (mSharedSource != NULL) ? mSharedSource->mItems : mItems;
+  return (unsigned int)items.size();
 }
 
 
-/**
- * Used by CaListOf::setCaOmexManifest().
+/** @cond doxygenLibomexInternal */
+
+/*
+ * Updates the identifier index when the "id" of an item changes.
  */
-struct SetCaOmexManifest : public unary_function<CaBase*, void>
+void
+CaListOf::updateIdIndex (CaBase* item, const std::string& oldId,
+                       const std::string& newId)
 {
-  CaOmexManifest* d;
+  if (!mIdIndexBuilt || oldId == newId) return;
 
-  SetCaOmexManifest (CaOmexManifest* d) : d(d) { }
-  void operator() (CaBase* sbase) { sbase->setCaOmexManifest(d); }
-};
+  removeFromIdIndex(item, oldId);
 
+  if (mIdIndexBuilt && !newId.empty())
+  {
+    // another item may already use the id; which one comes first then
+    // depends on the positions, so leave that to a rebuild
+    if (!mIdIndex.insert(IdIndex::value_type(newId, item)).second)
+    {
+      clearIdIndex();
+    }
+  }
+}
 
-/**
- * Used by CaListOf::setParentCaObject().
+
+/*
+ * Rebuilds the identifier index from scratch.
  */
-struct SetParentCaObject : public unary_function<CaBase*, void>
+void
+CaListOf::buildIdIndex () const
 {
-  CaBase* sb;
+  clearIdIndex();
+  mIdIndexBuilt = true;
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    addToIdIndex(*it, true);
+  }
+}
 
-  SetParentCaObject (CaBase *sb) : sb(sb) { }
-  void operator() (CaBase* sbase) { sbase->connectToParent(sb); }
-};
 
-/** @cond doxygenLibomexInternal */
+/*
+ * Adds an item that has just been placed in mItems to the identifier index.
+ * Items appended at the end never shadow an existing entry; items inserted
+ * elsewhere that share an identifier invalidate the index.
+ */
+void
+CaListOf::addToIdIndex (CaBase* item, bool atEnd) const
+{
+  if (!mIdIndexBuilt) return;
+
+  const std::string& id = item->getId();
+  if (id.empty()) return;
+
+  if (!mIdIndex.insert(IdIndex::value_type(id, item)).second)
+  {
+    if (atEnd)
+    {
+      mNumDuplicateIds++;
+    }
+    else
+    {
+      clearIdIndex();
+    }
+  }
+}
+
+
+/*
+ * Removes the entry of an item that is no longer in mItems.
+ */
+void
+CaListOf::removeFromIdIndex (CaBase* item, const std::string& id) const
+{
+  if (!mIdIndexBuilt || id.empty()) return;
+
+  if (mNumDuplicateIds > 0)
+  {
+    // a shadowed duplicate may need to take the place of this item
+    clearIdIndex();
+    return;
+  }
+
+  IdIndex::iterator found = mIdIndex.find(id);
+  if (found != mIdIndex.end() && found->second == item)
+  {
+    mIdIndex.erase(found);
+  }
+}
+
+
+/*
+ * Drops the identifier index; it is rebuilt on the next lookup.
+ */
+void
+CaListOf::clearIdIndex () const
+{
+  mIdIndex.clear();
+  mIdIndexBuilt = false;
+  mNumDuplicateIds = 0;
+}
+
+
+/*
+ * Updates the index of an attribute when its value changes for an item.
+ */
+void
+CaListOf::updateReferenceIndex (CaBase* item, const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef)
+{
+  if (oldRef == newRef) return;
+
+  ReferenceIndices::iterator index = mReferenceIndices.find(attributeName);
+  if (index == mReferenceIndices.end()) return;
+
+  eraseReference(index->second, oldRef, item);
+
+  if (newRef.empty()) return;
+
+  std::vector<CaBase*>& referrers = index->second[newRef];
+  if (referrers.empty() || item == mItems.back())
+  {
+    referrers.push_back(item);
+  }
+  else
+  {
+    // the item has to take its place among the others in list order;
+    // leave that to a rebuild
+    mReferenceIndices.erase(index);
+  }
+}
+
+
+/*
+ * Returns the index of the attribute, building it if necessary.
+ */
+const CaListOf::ReferenceIndex&
+CaListOf::getReferenceIndex (const std::string& attributeName) const
+{
+  ReferenceIndices::iterator index = mReferenceIndices.find(attributeName);
+  if (index != mReferenceIndices.end())
+  {
+    return index->second;
+  }
+
+  ReferenceIndex& built = mReferenceIndices[attributeName];
+  std::string ref;
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if ((*it)->getAttribute(attributeName, ref) == LIBCOMBINE_OPERATION_SUCCESS
+      && !ref.empty())
+    {
+      built[ref].push_back(*it);
+    }
+  }
+
+  return built;
+}
+
+
+/*
+ * Adds an item that has just been placed in mItems to the indices that
+ * have been built.  Only an item appended at the end is known to come
+ * after all the others; any other insertion drops the indices.
+ */
+void
+CaListOf::addToReferenceIndices (CaBase* item, bool atEnd) const
+{
+  if (mReferenceIndices.empty()) return;
+
+  if (!atEnd)
+  {
+    clearReferenceIndices();
+    return;
+  }
+
+  std::string ref;
+  for (ReferenceIndices::iterator index = mReferenceIndices.begin();
+       index != mReferenceIndices.end(); ++index)
+  {
+    if (item->getAttribute(index->first, ref) == LIBCOMBINE_OPERATION_SUCCESS
+      && !ref.empty())
+    {
+      index->second[ref].push_back(item);
+    }
+  }
+}
+
+
+/*
+ * Removes an item that is no longer in mItems from the indices.
+ */
+void
+CaListOf::removeFromReferenceIndices (CaBase* item) const
+{
+  std::string ref;
+  for (ReferenceIndices::iterator index = mReferenceIndices.begin();
+       index != mReferenceIndices.end(); ++index)
+  {
+    if (item->getAttribute(index->first, ref) == LIBCOMBINE_OPERATION_SUCCESS)
+    {
+      eraseReference(index->second, ref, item);
+    }
+  }
+}
+
+
+/*
+ * Removes the item from the referrers of the identifier in the index.
+ */
+void
+CaListOf::eraseReference (ReferenceIndex& index, const std::string& ref,
+                        CaBase* item)
+{
+  if (ref.empty()) return;
+
+  ReferenceIndex::iterator found = index.find(ref);
+  if (found == index.end()) return;
+
+  std::vector<CaBase*>& referrers = found->second;
+  std::vector<CaBase*>::iterator pos =
+    std::find(referrers.begin(), referrers.end(), item);
+  if (pos != referrers.end())
+  {
+    referrers.erase(pos);
+  }
+  if (referrers.empty())
+  {
+    index.erase(found);
+  }
+}
+
+
+/*
+ * Drops the indices of the attributes; they are rebuilt on the next lookup.
+ */
+void
+CaListOf::clearReferenceIndices () const
+{
+  mReferenceIndices.clear();
+}
+
 
 /*
  * Sets the parent CaOmexManifest of this OMEX object.
@@ -422,6 +961,17 @@ void
 CaListOf::setCaOmexManifest (CaOmexManifest* d)
 {
   CaBase::setCaOmexManifest(d);
+
+  // the items still shared are left until they are needed, unless the
+  // index of the document is being built and needs to reach them; the
+  // copies are then added to the index as they are connected to this CaListOf
+  CaElementIndex* index = getDocumentElementIndex();
+  if (mSharedSource != NULL && index != NULL && index->isBuilding())
+  {
+    copySharedItems();
+    return;
+  }
+
   for_each( mItems.begin(), mItems.end(), SetCaOmexManifest(d) );
 }
 
@@ -437,6 +987,122 @@ CaListOf::connectToChild()
   for_each( mItems.begin(), mItems.end(), SetParentCaObject(this) );
 }
 
+
+/*
+ * Makes the CaListOf objects sharing the items of this one take copies.
+ */
+void
+CaListOf::unshareChildren()
+{
+  while (!mSharers.empty())
+  {
+    mSharers.back()->copySharedItems();
+  }
+}
+
+
+/*
+ * Replaces the items this CaListOf shares with copies of its own.  The
+ * copies share their own children in turn, so that only the branches
+ * actually used end up being copied.
+ */
+void
+CaListOf::copySharedItems () const
+{
+  if (mSharedSource == NULL) return;
+
+  CaListOf* self = const_cast<CaListOf*>(this);
+  const CaListOf* source = mSharedSource;
+  self->stopSharing();
+
+  beginCopyingOnWrite();
+  try
+  {
+    self->mItems.resize( source->mItems.size() );
+    transform( source->mItems.begin(), source->mItems.end(),
+               self->mItems.begin(), Clone() );
+    self->connectToChild();
+  }
+  catch (...)
+  {
+    endCopyingOnWrite();
+    throw;
+  }
+  endCopyingOnWrite();
+}
+
+
+/*
+ * Stops sharing the items of another CaListOf, without copying them.
+ */
+void
+CaListOf::stopSharing ()
+{
+  if (mSharedSource == NULL) return;
+
+  std::vector<CaListOf*>& sharers = mSharedSource->mSharers;
+  sharers.erase( find(sharers.begin(), sharers.end(), this) );
+  mSharedSource = NULL;
+  --mNumSharingLists;
+}
+
+
+/*
+ * Gives the items of this CaListOf to the first of the CaListOf objects sharing
+ * them; the others then share the items of that one.
+ */
+void
+CaListOf::handOverItems ()
+{
+  if (mSharers.empty()) return;
+
+  CaListOf* heir = mSharers.front();
+  heir->mSharedSource = NULL;
+  --mNumSharingLists;
+
+  heir->mItems.swap(mItems);
+  heir->mSharers.swap(mSharers);
+  heir->mSharers.erase(heir->mSharers.begin());
+  for (std::vector<CaListOf*>::iterator it = heir->mSharers.begin();
+       it != heir->mSharers.end(); ++it)
+  {
+    (*it)->mSharedSource = heir;
+  }
+
+  clearIdIndex();
+  clearReferenceIndices();
+
+  // the items only change hands; nothing shared changes
+  beginCopyingOnWrite();
+  heir->connectToChild();
+  endCopyingOnWrite();
+}
+
+
+/*
+ * Takes over the part orig plays in sharing items, when orig is moved
+ * into this CaListOf.
+ */
+void
+CaListOf::takeOverSharing (CaListOf& orig)
+{
+  mSharedSource = orig.mSharedSource;
+  if (mSharedSource != NULL)
+  {
+    std::vector<CaListOf*>& sharers = mSharedSource->mSharers;
+    *find(sharers.begin(), sharers.end(), &orig) = this;
+  }
+
+  mSharers.swap(orig.mSharers);
+  for (std::vector<CaListOf*>::iterator it = mSharers.begin();
+       it != mSharers.end(); ++it)
+  {
+    (*it)->mSharedSource = this;
+  }
+
+  orig.mSharedSource = NULL;
+}
+
 /** @endcond */
 
 
@@ -495,6 +1161,7 @@ struct Write : public unary_function<CaBase*, void>
 void
 CaListOf::writeElements (XMLOutputStream& stream) const
 {
+  copySharedItems();
   CaBase::writeElements(stream);
   for_each( mItems.begin(), mItems.end(), Write(stream) );
 }
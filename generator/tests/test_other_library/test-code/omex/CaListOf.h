@@ -126,6 +126,24 @@ public:
   CaListOf& operator=(const CaListOf& rhs);
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor; the new CaListOf takes over the items of @p orig,
+   * which is left empty.
+   *
+   * @param orig the CaListOf instance to move.
+   */
+  CaListOf (CaListOf&& orig);
+
+
+  /**
+   * Move assignment operator for CaListOf; the items of this CaListOf are
+   * deleted and replaced by those of @p rhs, which is left empty.
+   */
+  CaListOf& operator=(CaListOf&& rhs);
+#endif
+
+
 
   /** @cond doxygenLibomexInternal */
   /**
@@ -189,6 +207,35 @@ public:
   int appendAndOwn (CaBase* disownedItem);
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+  /**
+   * Adds the item held by @p disownedItem to the end of this CaListOf's list
+   * of items, transferring its ownership to this CaListOf.
+   *
+   * The item is only released by @p disownedItem if it is added; otherwise
+   * @p disownedItem still owns it.
+   *
+   * @param disownedItem the item to be added to the list.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @omexconstant{LIBCOMBINE_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_INVALID_OBJECT, OperationReturnValues_t}
+   *
+   * @see appendAndOwn(CaBase* disownedItem)
+   */
+  template <class T>
+  int appendAndOwn (std::unique_ptr<T>&& disownedItem)
+  {
+    int success = appendAndOwn(static_cast<CaBase*>(disownedItem.get()));
+    if (success == LIBCOMBINE_OPERATION_SUCCESS)
+    {
+      disownedItem.release();
+    }
+    return success;
+  }
+#endif
+
+
   /**
    * Adds a clone of a list of items to this CaListOf's list.
    *
@@ -252,6 +299,9 @@ public:
    *
    * @return the <em>n</em>th item in this CaListOf items, or a null pointer if
    * the index number @p n refers to a nonexistent position in this list.
+   * A CaListOf that shares its items with another one (see
+   * CaBase::cloneCopyOnWrite()) first takes its own copies of them, so that
+   * the item returned belongs to this CaListOf and its document.
    *
    * @see size()
    */
@@ -314,7 +364,9 @@ public:
    * delete those items.  Otherwise, all items are cleared only from this
    * CaListOf object; the caller is still responsible for deleting the actual
    * items.  (In the latter case, callers are advised to store pointers to
-   * all items elsewhere before calling this function.)
+   * all items elsewhere before calling this function.)  Items that are not
+   * deleted keep this CaListOf as their parent but no longer belong to its
+   * document (see CaBase::releaseFromParent()).
    *
    * @param doDelete if @c true (default), all items are deleted and cleared.
    * Otherwise, all items are just cleared and not deleted.
@@ -346,6 +398,8 @@ public:
    * it.
    *
    * The caller owns the returned item and is responsible for deleting it.
+   * The item keeps this CaListOf as its parent but no longer belongs to its
+   * document (see CaBase::releaseFromParent()).
    *
    * @param n the index of the item to remove
    *
@@ -373,6 +427,53 @@ public:
   /** @endcond */
 
 
+  /** @cond doxygenLibomexInternal */
+  /**
+   * Updates the identifier index of this CaListOf when the "id" of one of
+   * its items changes.
+   *
+   * This is called by the item itself (see CaBase::updateIdIndices()) before
+   * the new identifier is stored.
+   *
+   * @param item the item whose identifier is changing.
+   * @param oldId the identifier @p item currently has.
+   * @param newId the identifier @p item is about to be given.
+   */
+  void updateIdIndex (CaBase* item, const std::string& oldId,
+                      const std::string& newId);
+  /** @endcond */
+
+
+  /** @cond doxygenLibomexInternal */
+  /**
+   * Updates the index of the given SIdRef attribute of the items of this
+   * CaListOf when the value of that attribute changes for one of them.
+   *
+   * This is called by the item itself (see CaBase::updateReferenceIndices())
+   * before the new value is stored.
+   *
+   * @param item the item whose attribute is changing.
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param oldRef the value the attribute currently has.
+   * @param newRef the value the attribute is about to be given.
+   */
+  void updateReferenceIndex (CaBase* item, const std::string& attributeName,
+                             const std::string& oldRef,
+                             const std::string& newRef);
+  /** @endcond */
+
+
+  /** @cond doxygenLibomexInternal */
+  /**
+   * Drops the indices of the SIdRef attributes of the items of this CaListOf;
+   * they are rebuilt on the next lookup.  Used when the attributes of an
+   * item have been changed without going through its setters, as happens
+   * when it is read.
+   */
+  void clearReferenceIndices () const;
+  /** @endcond */
+
+
   /** @cond doxygenLibomexInternal */
   /**
    * Sets this OMEX object to child OMEX objects (if any).
@@ -483,8 +584,176 @@ protected:
 
   virtual bool isValidTypeForList(CaBase * item);
 
+  /**
+   * Returns the first item in this CaListOf with the given identifier.
+   *
+   * The lookup goes through a hash index of the item identifiers that is
+   * built on first use and then kept up to date by appendAndOwn(),
+   * insertAndOwn(), remove(), clear() and the setId() functions of the
+   * items, so repeated lookups are O(1) amortized.
+   *
+   * As for get(), a CaListOf that shares its items with another one first
+   * takes its own copies of them.
+   *
+   * @param sid the identifier of the item to find.
+   *
+   * @return the first item with the given @p sid or @c NULL if no such
+   * item exists.
+   */
+  const CaBase* getItemById (const std::string& sid) const;
+
+
+  /**
+   * Returns the first item in this CaListOf with the given identifier.
+   *
+   * As the item may be changed through the pointer returned, a CaListOf
+   * that shares its items first takes its own copies of them.
+   *
+   * @param sid the identifier of the item to find.
+   *
+   * @return the first item with the given @p sid or @c NULL if no such
+   * item exists.
+   */
+  CaBase* getItemById (const std::string& sid);
+
+
+  /**
+   * Removes the first item in this CaListOf with the given identifier and
+   * returns it.  The caller owns the returned item, which is released as
+   * by remove().
+   *
+   * @param sid the identifier of the item to remove.
+   *
+   * @return the item removed or @c NULL if no such item exists.
+   */
+  CaBase* removeItemById (const std::string& sid);
+
+
+  /**
+   * Returns the first item in this CaListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier.
+   *
+   * As for getItemById(), the lookup goes through an index, one per
+   * attribute, that is built on first use and then kept up to date by the
+   * list functions and the setters of the items; a CaListOf that shares its
+   * items first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return the first item referring to @p sid or @c NULL if no such
+   * item exists.
+   */
+  const CaBase* getItemByReference (const std::string& attributeName,
+                                   const std::string& sid) const;
+
+
+  /**
+   * Returns the first item in this CaListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier.
+   *
+   * As for the non-const getItemById(), a CaListOf that shares its items
+   * first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return the first item referring to @p sid or @c NULL if no such
+   * item exists.
+   */
+  CaBase* getItemByReference (const std::string& attributeName,
+                             const std::string& sid);
+
+
+  /**
+   * Returns all the items in this CaListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier, in list order.
+   *
+   * The items may be changed through the List returned, so a CaListOf that
+   * shares its items first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return a List of the items referring to @p sid.  The caller owns the
+   * List (but not the items in it) and is responsible for deleting it.
+   */
+  List* getItemsByReference (const std::string& attributeName,
+                             const std::string& sid);
+
+
+  /**
+   * Makes the CaListOf objects that share the items of this one (see
+   * CaBase::cloneCopyOnWrite()) take their own copies of them.
+   */
+  virtual void unshareChildren ();
+
+#ifdef LIBCOMBINE_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, CaBase*> IdIndex;
+  typedef std::unordered_map<std::string, std::vector<CaBase*> > ReferenceIndex;
+#else
+  typedef std::map<std::string, CaBase*> IdIndex;
+  typedef std::map<std::string, std::vector<CaBase*> > ReferenceIndex;
+#endif
+  typedef std::map<std::string, ReferenceIndex> ReferenceIndices;
+
   ListItem mItems;
 
+  /*
+   * Index of the identifiers of mItems; only valid when mIdIndexBuilt is
+   * true.  Where several items share an identifier the index refers to the
+   * first of them and mNumDuplicateIds records how many are shadowed.
+   */
+  mutable IdIndex      mIdIndex;
+  mutable bool         mIdIndexBuilt;
+  mutable unsigned int mNumDuplicateIds;
+
+  /*
+   * Indices of the SIdRef attributes of mItems, keyed by attribute name;
+   * an attribute only has an index once it has been looked up.  Each
+   * index lists, in list order, the items referring to an identifier.
+   */
+  mutable ReferenceIndices mReferenceIndices;
+
+  /*
+   * A CaListOf copied by CaBase::cloneCopyOnWrite() shares the items of the
+   * CaListOf it was copied from, mSharedSource, until it first needs them;
+   * mItems is empty meanwhile.  mSharers lists the CaListOf objects sharing
+   * the items of this one.
+   */
+  mutable const CaListOf*        mSharedSource;
+  mutable std::vector<CaListOf*> mSharers;
+
+  /** @endcond */
+
+private:
+  /** @cond doxygenLibomexInternal */
+
+  void buildIdIndex () const;
+
+  void addToIdIndex (CaBase* item, bool atEnd) const;
+
+  void removeFromIdIndex (CaBase* item, const std::string& id) const;
+
+  void clearIdIndex () const;
+
+  const ReferenceIndex& getReferenceIndex (const std::string& attributeName) const;
+
+  void addToReferenceIndices (CaBase* item, bool atEnd) const;
+
+  void removeFromReferenceIndices (CaBase* item) const;
+
+  static void eraseReference (ReferenceIndex& index, const std::string& ref,
+                              CaBase* item);
+
+  void copySharedItems () const;
+
+  void stopSharing ();
+
+  void handOverItems ();
+
+  void takeOverSharing (CaListOf& orig);
+
   /** @endcond */
 };
 
@@ -96,6 +96,34 @@ CaListOfContents::operator=(const CaListOfContents& rhs)
 }
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for CaListOfContents.
+ */
+CaListOfContents::CaListOfContents(CaListOfContents&& orig)
+  : CaListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for CaListOfContents.
+ */
+CaListOfContents&
+CaListOfContents::operator=(CaListOfContents&& rhs)
+{
+  if (&rhs != this)
+  {
+    CaListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBCOMBINE_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this CaListOfContents object.
  */
@@ -140,8 +168,7 @@ CaListOfContents::get(unsigned int n) const
 CaContent*
 CaListOfContents::get(const std::string& sid)
 {
-  return const_cast<CaContent*>(static_cast<const
-    CaListOfContents&>(*this).get(sid));
+  return static_cast<CaContent*>(getItemById(sid));
 }
 
 
@@ -151,10 +178,7 @@ CaListOfContents::get(const std::string& sid)
 const CaContent*
 CaListOfContents::get(const std::string& sid) const
 {
-  vector<CaBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), CaIdEq<CaContent>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const CaContent*>
-    (*result);
+  return static_cast<const CaContent*>(getItemById(sid));
 }
 
 
@@ -176,18 +200,7 @@ CaListOfContents::remove(unsigned int n)
 CaContent*
 CaListOfContents::remove(const std::string& sid)
 {
-  CaBase* item = NULL;
-  vector<CaBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), CaIdEq<CaContent>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <CaContent*> (item);
+  return static_cast<CaContent*>(removeItemById(sid));
 }
 
 
@@ -246,7 +259,7 @@ CaListOfContents::createContent()
 
   try
   {
-    cc = new CaContent(getCaNamespaces());
+    cc = new (getDocumentArena()) CaContent(getSharedCaNamespaces());
   }
   catch (...)
   {
@@ -308,7 +321,7 @@ CaListOfContents::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "content")
   {
-    object = new CaContent(getCaNamespaces());
+    object = new (getDocumentArena()) CaContent(getSharedCaNamespaces());
     appendAndOwn(object);
   }
 
@@ -110,6 +110,28 @@ public:
   CaListOfContents& operator=(const CaListOfContents& rhs);
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for CaListOfContents.
+   *
+   * @param orig the CaListOfContents instance to move; it is left as an empty
+   * CaListOfContents in the place it had.
+   */
+  CaListOfContents(CaListOfContents&& orig);
+
+
+  /**
+   * Move assignment operator for CaListOfContents.
+   *
+   * @param rhs the CaListOfContents object whose values are to be moved into
+   * this one; it is left as an empty CaListOfContents in the place it had.
+   */
+  CaListOfContents& operator=(CaListOfContents&& rhs);
+
+
+#endif  /* LIBCOMBINE_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this CaListOfContents object.
    *
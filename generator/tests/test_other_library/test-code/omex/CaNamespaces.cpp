@@ -86,6 +86,7 @@ CaNamespaces::initCaNamespace()
 CaNamespaces::CaNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
+  ,mNumReferences(0)
 {
   initCaNamespace();
 }
@@ -105,6 +106,7 @@ CaNamespaces::CaNamespaces(const CaNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mNumReferences(0)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
@@ -165,6 +167,82 @@ CaNamespaces::clone () const
 }
 
 
+/** @cond doxygenLibomexInternal */
+
+/*
+ * There is no registry: an object is shared by the elements created from
+ * it, which in practice are the elements of the document it belongs to.
+ * Without atomic reference counts nothing is shared and every element
+ * keeps a copy of its own, as the elements of two documents may be used
+ * from different threads.
+ */
+CaNamespaces*
+CaNamespaces::intern(const CaNamespaces* omexns)
+{
+  if (omexns == NULL) return NULL;
+
+#ifdef LIBCOMBINE_HAS_SHARED_NAMESPACES
+  if (omexns->mNumReferences > 0)
+  {
+    ++omexns->mNumReferences;
+    return const_cast<CaNamespaces*>(omexns);
+  }
+
+  CaNamespaces* shared = omexns->clone();
+  shared->mNumReferences = 1;
+  return shared;
+#else
+  return omexns->clone();
+#endif
+}
+
+
+CaNamespaces*
+CaNamespaces::internAndOwn(CaNamespaces* omexns)
+{
+  if (omexns == NULL) return NULL;
+
+#ifdef LIBCOMBINE_HAS_SHARED_NAMESPACES
+  if (omexns->mNumReferences == 0)
+  {
+    omexns->mNumReferences = 1;
+  }
+#endif
+
+  return omexns;
+}
+
+
+void
+CaNamespaces::release(CaNamespaces* omexns)
+{
+  if (omexns == NULL) return;
+
+  if (omexns->mNumReferences == 0 || --omexns->mNumReferences == 0)
+  {
+    delete omexns;
+  }
+}
+
+
+CaNamespaces*
+CaNamespaces::unshare(CaNamespaces* omexns)
+{
+  if (omexns == NULL || omexns->mNumReferences <= 1)
+  {
+    return omexns;
+  }
+
+  // the copy can be shared in turn by the elements created from it
+  CaNamespaces* copy = omexns->clone();
+  copy->mNumReferences = 1;
+  --omexns->mNumReferences;
+  return copy;
+}
+
+/** @endcond */
+
+
 std::string 
 CaNamespaces::getCaNamespaceURI(unsigned int level,
                                  unsigned int version)
@@ -66,6 +66,11 @@ static const char* const OMEX_XMLNS_L1V1   = "http://identifiers.org/combine.spe
 #include <string>
 #include <stdexcept>
 
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#  include <atomic>
+#  define LIBCOMBINE_HAS_SHARED_NAMESPACES 1
+#endif
+
 LIBCOMBINE_CPP_NAMESPACE_BEGIN
 
 class LIBCOMBINE_EXTERN CaNamespaces
@@ -276,6 +281,52 @@ public:
   void setNamespaces(XMLNamespaces * xmlns);
   /** @endcond */
 
+
+  /** @cond doxygenLibomexInternal */
+  /**
+   * Returns a shared CaNamespaces object equal to @p omexns.
+   *
+   * If @p omexns is itself shared (as the namespaces of a document are)
+   * one more reference is taken on it, so that the elements created from
+   * the namespaces of a document share them rather than each owning a
+   * copy; otherwise a shared copy of @p omexns is made.  The caller holds
+   * one reference, which must be given back with release().  A shared
+   * object must not be modified; use unshare() first.
+   *
+   * Sharing needs atomic reference counts (C++11 or MSVC 2012 and later);
+   * without them every caller is simply given a copy of its own.
+   *
+   * @param omexns the CaNamespaces object to share or copy.
+   *
+   * @return the shared CaNamespaces object, or @c NULL if @p omexns
+   * is @c NULL.
+   */
+  static CaNamespaces* intern(const CaNamespaces* omexns);
+
+
+  /**
+   * Makes @p omexns, which the caller owns, shareable, and returns it with
+   * the caller holding the one reference to it.
+   */
+  static CaNamespaces* internAndOwn(CaNamespaces* omexns);
+
+
+  /**
+   * Gives back a reference obtained from intern(), internAndOwn() or
+   * unshare(); the object is deleted once no reference is left.
+   */
+  static void release(CaNamespaces* omexns);
+
+
+  /**
+   * Returns an CaNamespaces object equal to @p omexns that the caller
+   * holds the only reference to and may modify, copying it if it is
+   * shared (copy-on-write).  The reference held on @p omexns is passed on
+   * to the result.
+   */
+  static CaNamespaces* unshare(CaNamespaces* omexns);
+  /** @endcond */
+
 protected:  
   /** @cond doxygenLibomexInternal */
   void initCaNamespace();
@@ -284,6 +335,13 @@ protected:
   unsigned int    mVersion;
   XMLNamespaces * mNamespaces;
 
+  /* the number of holders of a shared object, or 0 if it is not shared */
+#ifdef LIBCOMBINE_HAS_SHARED_NAMESPACES
+  mutable std::atomic<unsigned int> mNumReferences;
+#else
+  mutable unsigned int mNumReferences;
+#endif
+
   /** @endcond */
 };
 
@@ -108,6 +108,41 @@ CaOmexManifest::operator=(const CaOmexManifest& rhs)
 }
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for CaOmexManifest.
+ */
+CaOmexManifest::CaOmexManifest(CaOmexManifest&& orig)
+  : CaBase( std::move(orig) )
+  , mContents ( std::move(orig.mContents) )
+{
+  CaBase::setCaOmexManifest(this);
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for CaOmexManifest.
+ */
+CaOmexManifest&
+CaOmexManifest::operator=(CaOmexManifest&& rhs)
+{
+  if (&rhs != this)
+  {
+    CaBase::operator=(std::move(rhs));
+    mContents = std::move(rhs.mContents);
+    connectToChild();
+    CaBase::setCaOmexManifest(this);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBCOMBINE_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this CaOmexManifest object.
  */
@@ -123,6 +158,7 @@ CaOmexManifest::clone() const
  */
 CaOmexManifest::~CaOmexManifest()
 {
+  mHasBeenDeleted = true;
 }
 
 
@@ -221,7 +257,7 @@ CaOmexManifest::createContent()
 
   try
   {
-    cc = new CaContent(getCaNamespaces());
+    cc = new (getDocumentArena()) CaContent(getSharedCaNamespaces());
   }
   catch (...)
   {
@@ -678,19 +714,117 @@ CaOmexManifest::getElementBySId(const std::string& id)
     return NULL;
   }
 
-  CaBase* obj = NULL;
+  if (!mElementIndex.isBuilt())
+  {
+    mElementIndex.build(this);
+  }
+
+  return mElementIndex.getElementBySId(id);
+}
 
-  obj = mContents.getElementBySId(id);
 
-  if (obj != NULL)
+/*
+ * Returns the first child element that has the given @p metaid, or @c NULL if
+ * no such object is found.
+ */
+CaBase*
+CaOmexManifest::getElementByMetaId(const std::string& metaid)
+{
+  if (metaid.empty())
   {
-    return obj;
+    return NULL;
   }
 
-  return obj;
+  if (!mElementIndex.isBuilt())
+  {
+    mElementIndex.build(this);
+  }
+
+  return mElementIndex.getElementByMetaId(metaid);
 }
 
 
+/*
+ * Returns the elements of this CaOmexManifest that refer to the given @p id
+ * through one of their SIdRef attributes.
+ */
+List*
+CaOmexManifest::getReferrers(const std::string& id)
+{
+  if (!mElementIndex.isBuilt())
+  {
+    mElementIndex.build(this);
+  }
+
+  return mElementIndex.getReferrers(id);
+}
+
+
+/*
+ * Changes the identifier of the element of this CaOmexManifest with the
+ * identifier @p oldId to @p newId, and redirects every SIdRef attribute
+ * referring to @p oldId to @p newId.
+ */
+int
+CaOmexManifest::renameSId(const std::string& oldId, const std::string& newId)
+{
+  if (!mElementIndex.isBuilt())
+  {
+    mElementIndex.build(this);
+  }
+
+  return mElementIndex.renameSId(oldId, newId);
+}
+
+
+/*
+ * Removes the element of this CaOmexManifest with the given @p id and deletes
+ * it, together with every element that refers to it and, in turn, every
+ * element that refers to one of those.
+ */
+int
+CaOmexManifest::removeWithReferrers(const std::string& id)
+{
+  if (!mElementIndex.isBuilt())
+  {
+    mElementIndex.build(this);
+  }
+
+  return mElementIndex.removeWithReferrers(id);
+}
+
+
+
+/** @cond doxygenlibCombineInternal */
+
+/*
+ * Returns the index of the identifiers and metaids of the elements of this
+ * CaOmexManifest.
+ */
+CaElementIndex*
+CaOmexManifest::getElementIndex()
+{
+  return &mElementIndex;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibCombineInternal */
+
+/*
+ * Returns the arena the elements of this CaOmexManifest are allocated from.
+ */
+CaArena*
+CaOmexManifest::getArena()
+{
+  return &mArena;
+}
+
+/** @endcond */
+
+
 /*
  * Returns the value of the "Namespaces" element of this CaOmexManifest.
  */
@@ -707,6 +841,7 @@ CaOmexManifest::getNamespaces() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 CaOmexManifest::getNamespaces()
 {
+  mCaNamespaces = CaNamespaces::unshare(mCaNamespaces);
   return mCaNamespaces->getNamespaces();
 }
 
@@ -56,6 +56,8 @@
 #include <omex/CaBase.h>
 #include <omex/CaListOfContents.h>
 #include <omex/CaErrorLog.h>
+#include <omex/CaElementIndex.h>
+#include <omex/CaArena.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -70,6 +72,8 @@ protected:
 
   CaListOfContents mContents;
   CaErrorLog mErrorLog;
+  CaElementIndex mElementIndex;
+  CaArena mArena;
 
   /** @endcond */
 
@@ -119,6 +123,28 @@ public:
   CaOmexManifest& operator=(const CaOmexManifest& rhs);
 
 
+#ifdef LIBCOMBINE_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for CaOmexManifest.
+   *
+   * @param orig the CaOmexManifest instance to move; it is left as an empty
+   * CaOmexManifest in the place it had.
+   */
+  CaOmexManifest(CaOmexManifest&& orig);
+
+
+  /**
+   * Move assignment operator for CaOmexManifest.
+   *
+   * @param rhs the CaOmexManifest object whose values are to be moved into
+   * this one; it is left as an empty CaOmexManifest in the place it had.
+   */
+  CaOmexManifest& operator=(CaOmexManifest&& rhs);
+
+
+#endif  /* LIBCOMBINE_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this CaOmexManifest object.
    *
@@ -702,6 +728,104 @@ public:
   virtual CaBase* getElementBySId(const std::string& id);
 
 
+  /**
+   * Returns the first child element that has the given @p metaid, or @c NULL
+   * if no such object is found.
+   *
+   * @param metaid a string representing the metaid attribute of the object to
+   * retrieve.
+   *
+   * @return a pointer to the CaBase element with the given @p metaid. If no
+   * such object is found this method returns @c NULL.
+   */
+  virtual CaBase* getElementByMetaId(const std::string& metaid);
+
+
+  /**
+   * Returns the elements of this CaOmexManifest that refer to the given @p id
+   * through one of their SIdRef attributes.
+   *
+   * @param id a string representing the identifier referred to.
+   *
+   * @return a List of the CaBase elements referring to @p id, each listed
+   * once.
+   *
+   * The references are looked up in an index of the document, so the cost
+   * depends on the number of referrers rather than on the size of the
+   * document.
+   *
+   * The caller owns the returned List (but not the elements in it) and is
+   * responsible for deleting it.
+   */
+  List* getReferrers(const std::string& id);
+
+
+  /**
+   * Changes the identifier of the element of this CaOmexManifest with the
+   * identifier @p oldId to @p newId, and redirects every SIdRef attribute
+   * referring to @p oldId to @p newId.
+   *
+   * @param oldId a string representing the current identifier.
+   *
+   * @param newId a string representing the new identifier.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @omexconstant{LIBCOMBINE_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * Nothing is changed if another element already has the identifier @p newId.
+   */
+  int renameSId(const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Removes the element of this CaOmexManifest with the given @p id and
+   * deletes it, together with every element that refers to it and, in turn,
+   * every element that refers to one of those.
+   *
+   * @param id a string representing the identifier of the element to remove.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @omexconstant{LIBCOMBINE_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @omexconstant{LIBCOMBINE_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * Only the identifiers of the removed elements themselves are followed;
+   * elements referring to an element nested inside a removed one are left in
+   * place.
+   */
+  int removeWithReferrers(const std::string& id);
+
+
+
+  /** @cond doxygenlibCombineInternal */
+
+  /**
+   * Returns the index of the identifiers and metaids of the elements of this
+   * CaOmexManifest.
+   *
+   * @return a pointer to the CaElementIndex of this CaOmexManifest.
+   */
+  CaElementIndex* getElementIndex();
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibCombineInternal */
+
+  /**
+   * Returns the arena the elements of this CaOmexManifest are allocated from.
+   *
+   * @return a pointer to the CaArena of this CaOmexManifest.
+   */
+  CaArena* getArena();
+
+  /** @endcond */
+
+
   /**
    * Returns the value of the "Namespaces" element of this CaOmexManifest.
    *
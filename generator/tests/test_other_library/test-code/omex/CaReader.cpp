@@ -36,6 +36,15 @@
  */
 
 
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include <sbml/xml/XMLError.h>
 #include <sbml/xml/XMLErrorLog.h>
 #include <sbml/xml/XMLInputStream.h>
@@ -63,6 +72,8 @@ LIBCOMBINE_CPP_NAMESPACE_BEGIN
  * Creates a new CaReader and returns it. 
  */
 CaReader::CaReader ()
+  : mUseArena (false)
+  , mUseMemoryMap (false)
 {
 }
 
@@ -114,6 +125,18 @@ CaReader::readOMEXFromFile (const std::string& filename)
 }
 
 
+/** @cond doxygenLibomexInternal */
+/*
+ * @return true if the content begins with an XML declaration.
+ */
+static bool
+hasXMLDeclaration (const char* content, size_t length)
+{
+  return length >= 14 && !strncmp(content, "<?xml version=", 14);
+}
+/** @endcond */
+
+
 /*
  * Reads an Ca document from the given XML string.
  *
@@ -121,7 +144,7 @@ CaReader::readOMEXFromFile (const std::string& filename)
  *
  *   <?xml version='1.0' encoding='UTF-8'?>
  *
- * it will be prepended.
+ * it is read as if it did.
  *
  * This method will log a fatal error if the XML string is not Ca.  See
  * the method documentation for readOMEX(filename) for example error
@@ -132,16 +155,36 @@ CaReader::readOMEXFromFile (const std::string& filename)
 CaOmexManifest*
 CaReader::readOMEXFromString (const std::string& xml)
 {
-  const static string dummy_xml ("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");  
-  
-  if (!strncmp(xml.c_str(), dummy_xml.c_str(), 14))
+  return readInternal(xml.c_str(), false,
+                      hasXMLDeclaration(xml.c_str(), xml.size()));
+}
+
+
+/*
+ * Reads an Ca document from the given buffer.  XMLInputStream (and the
+ * parsers behind it) take no length and read up to a null character, so
+ * the buffer is copied unless its last byte is one.
+ */
+CaOmexManifest*
+CaReader::readOMEXFromBuffer (const char* data, size_t length)
+{
+  if (data == NULL)
+  {
+    return readOMEXFromString("");
+  }
+
+  bool hasDeclaration = hasXMLDeclaration(data, length);
+
+  // content with a null character before its last byte is read up to it
+  // whether or not it is copied, so there is no need to look for one
+  if (length > 0 && data[length - 1] == '\0')
   {
-    return readInternal(xml.c_str(), false);
+    return readInternal(data, false, hasDeclaration);
   }
   else
   {
-    const std::string temp = (dummy_xml + xml);
-    return readInternal(temp.c_str(), false);
+    const std::string temp(data, length);
+    return readInternal(temp.c_str(), false, hasDeclaration);
   }
 }
 
@@ -172,6 +215,144 @@ CaReader::hasBzip2()
 }
 
 
+/*
+ * Sets whether the documents read allocate their elements from an arena.
+ */
+void
+CaReader::setUseArena (bool useArena)
+{
+  mUseArena = useArena;
+}
+
+
+/*
+ * @return true if the documents read allocate their elements from an arena.
+ */
+bool
+CaReader::getUseArena () const
+{
+  return mUseArena;
+}
+
+
+/*
+ * Sets whether files are read through a memory mapping.
+ */
+void
+CaReader::setUseMemoryMap (bool useMemoryMap)
+{
+  mUseMemoryMap = useMemoryMap;
+}
+
+
+/*
+ * @return true if files are read through a memory mapping.
+ */
+bool
+CaReader::getUseMemoryMap () const
+{
+  return mUseMemoryMap;
+}
+
+
+/** @cond doxygenLibomexInternal */
+/*
+ * @return true if the file will be read through a decompressor.
+ */
+static bool
+isCompressedFile (const std::string& filename)
+{
+  static const char* suffixes[] = { ".gz", ".bz2", ".zip" };
+
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    size_t length = strlen(suffixes[i]);
+
+    if (filename.size() >= length &&
+        strcmp_insensitive(filename.c_str() + filename.size() - length,
+                           suffixes[i]) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * The content of a file mapped into memory so that it can be parsed
+ * without being read through stdio.  The parsers need the content to be
+ * followed by a null character; the bytes between the end of a file and
+ * the end of its last page read as zero, so only files that do not fill
+ * their last page are mapped.  Other files, and all files on platforms
+ * without mmap, are left to be read as before.
+ */
+class MappedFile
+{
+public:
+
+  MappedFile (const char* filename)
+    : mContent (NULL)
+    , mLength (0)
+  {
+#if !defined(_WIN32)
+    if (filename == NULL) return;
+
+    int fd = open(filename, O_RDONLY);
+
+    if (fd < 0) return;
+
+    struct stat info;
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) &&
+        info.st_size > 0 && pageSize > 0 && info.st_size % pageSize != 0)
+    {
+      void* content = mmap(NULL, (size_t)info.st_size, PROT_READ,
+                           MAP_PRIVATE, fd, 0);
+
+      if (content != MAP_FAILED)
+      {
+        madvise(content, (size_t)info.st_size, MADV_SEQUENTIAL);
+        mContent = static_cast<const char*>(content);
+        mLength = (size_t)info.st_size;
+      }
+    }
+
+    close(fd);
+#endif
+  }
+
+
+  ~MappedFile ()
+  {
+#if !defined(_WIN32)
+    if (mContent != NULL)
+    {
+      munmap(const_cast<char*>(mContent), mLength);
+    }
+#endif
+  }
+
+
+  const char* getContent () const
+  {
+    return mContent;
+  }
+
+
+private:
+
+  MappedFile (const MappedFile&);
+  MappedFile& operator= (const MappedFile&);
+
+  const char* mContent;
+  size_t      mLength;
+};
+/** @endcond */
+
+
 /** @cond doxygenLibomexInternal */
 static bool
 isCriticalError(const unsigned int errorId)
@@ -207,25 +388,56 @@ isCriticalError(const unsigned int errorId)
 
 /** @cond doxygenLibomexInternal */
 /*
- * Used by readOMEX() and readOMEXFromString().
+ * Predicate used to keep only the critical errors in the log.
+ */
+struct IsCriticalError
+{
+  bool operator() (const XMLError* error) const
+  {
+    return isCriticalError(error->getErrorId());
+  }
+};
+/** @endcond */
+
+
+/** @cond doxygenLibomexInternal */
+/*
+ * Used by readOMEX(), readOMEXFromString() and readOMEXFromBuffer().
  */
 CaOmexManifest*
-CaReader::readInternal (const char* content, bool isFile)
+CaReader::readInternal (const char* content, bool isFile, bool hasDeclaration)
 {
   CaOmexManifest* d = new CaOmexManifest();
 
+  if (mUseArena)
+  {
+    d->getArena()->setEnabled(true);
+  }
+
   if (isFile && content != NULL && (util_file_exists(content) == false))
   {
     d->getErrorLog()->logError(XMLFileUnreadable);
   }
   else 
   {
+    // uncompressed files may be parsed straight from the page cache
+    bool mapFile = isFile && content != NULL && mUseMemoryMap &&
+                   !isCompressedFile(content);
+    MappedFile mapped(mapFile ? content : NULL);
+
+    if (mapped.getContent() != NULL)
+    {
+      content = mapped.getContent();
+      isFile = false;
+    }
+
     XMLInputStream stream(content, isFile, "", d->getErrorLog());
 
     if (stream.peek().isStart() && stream.peek().getName() != "omex")
     {
       // the root element ought to be an omex element. 
       d->getErrorLog()->logError(CaNotSchemaConformant);
+      d->getArena()->setEnabled(false);
 	  return d;
     }
 	
@@ -246,17 +458,13 @@ CaReader::readInternal (const char* content, bool isFile)
           // If we find even one critical error, all other errors are
           // suspect and may be bogus.  Remove them.
 
-          for (int n = (int)d->getNumErrors()-1; n >= 0; --n)
-            if (!isCriticalError(d->getError((unsigned int)n)->getErrorId()))
-            {
-              d->getErrorLog()->remove(d->getError((unsigned int)n)->getErrorId());
-            }
+          d->getErrorLog()->retainIf(IsCriticalError());
 
           break;
         }
       }
     }
-    else
+    else if (hasDeclaration)
     {
       // Low-level XML errors will have been caught in the first read,
       // before we even attempt to interpret the content as Ca.  Here
@@ -281,6 +489,10 @@ CaReader::readInternal (const char* content, bool isFile)
       }
     }
   }
+
+  // only the elements read are allocated from the arena; those created
+  // afterwards come from the heap as usual
+  d->getArena()->setEnabled(false);
   return d;
 }
 /** @endcond */
@@ -338,6 +550,17 @@ CaReader_readOMEXFromString (CaReader_t *sr, const char *xml)
 }
 
 
+LIBCOMBINE_EXTERN
+CaOmexManifest_t *
+CaReader_readOMEXFromBuffer (CaReader_t *sr, const char *data, size_t length)
+{
+  if (sr != NULL)
+    return sr->readOMEXFromBuffer(data, length);
+  else
+    return NULL;
+}
+
+
 LIBCOMBINE_EXTERN
 int
 CaReader_hasZlib (void)
@@ -380,6 +603,15 @@ readOMEXFromString (const char *xml)
   return (xml != NULL) ? sr.readOMEXFromString(xml) : sr.readOMEXFromString("");
 }
 
+
+LIBCOMBINE_EXTERN
+CaOmexManifest_t *
+readOMEXFromBuffer (const char *data, size_t length)
+{
+  CaReader sr;
+  return sr.readOMEXFromBuffer(data, length);
+}
+
 LIBCOMBINE_CPP_NAMESPACE_END
 /** @endcond */
 
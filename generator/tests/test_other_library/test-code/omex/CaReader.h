@@ -119,6 +119,28 @@ public:
   CaOmexManifest* readOMEXFromString (const std::string& xml);
 
 
+  /**
+   * Reads a document from the @p length bytes of OMEX content held
+   * in @p data.
+   *
+   * Content that does not begin with an XML declaration is read as if it
+   * began with <code>&lt;?xml version='1.0' encoding='UTF-8'?&gt;</code>,
+   * as for readOMEXFromString(), but without a copy being made to prepend
+   * one.  The XML parsers take no length and read up to a null character,
+   * so content is read in place only if its last byte (<code>data[length -
+   * 1]</code>) is a null character; any other content is copied once.
+   *
+   * @param data the buffer holding the OMEX content.
+   * @param length the number of bytes of content in @p data.
+   *
+   * @return a pointer to the CaOmexManifest created from the OMEX
+   * content.
+   *
+   * @see readOMEXFromString(@if java String@endif)
+   */
+  CaOmexManifest* readOMEXFromBuffer (const char* data, size_t length);
+
+
   /**
    * Static method; returns @c true if this copy of libCombine supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -143,12 +165,66 @@ public:
   static bool hasBzip2();
 
 
+  /**
+   * Sets whether the documents read by this CaReader allocate their
+   * elements from an arena.
+   *
+   * Allocating from an arena makes reading and destroying large documents
+   * faster, at the cost of not reusing the memory of elements deleted
+   * while the document is alive.  It is off by default.
+   *
+   * @param useArena @c true to allocate the elements from an arena.
+   */
+  void setUseArena (bool useArena);
+
+
+  /**
+   * Predicate returning @c true if the documents read by this CaReader
+   * allocate their elements from an arena.
+   *
+   * @see setUseArena(bool useArena)
+   */
+  bool getUseArena () const;
+
+
+  /**
+   * Sets whether this CaReader reads uncompressed files through a
+   * memory mapping rather than through stdio.
+   *
+   * Parsing a large file straight from the page cache saves copying it
+   * through stdio buffers.  The file must not be truncated while it is
+   * being read.  Compressed files, and all files on platforms without
+   * mmap, are read as usual.  It is off by default.
+   *
+   * @param useMemoryMap @c true to read files through a memory mapping.
+   */
+  void setUseMemoryMap (bool useMemoryMap);
+
+
+  /**
+   * Predicate returning @c true if this CaReader reads uncompressed
+   * files through a memory mapping.
+   *
+   * @see setUseMemoryMap(bool useMemoryMap)
+   */
+  bool getUseMemoryMap () const;
+
+
 protected:
   /** @cond doxygenLibomexInternal */
   /**
-   * Used by readOMEX() and readOMEXFromString().
+   * Used by readOMEX(), readOMEXFromString() and readOMEXFromBuffer().
+   *
+   * The declaration of content read with @p hasDeclaration @c false is
+   * not checked.
    */
-  CaOmexManifest* readInternal (const char* content, bool isFile = true);
+  CaOmexManifest* readInternal (const char* content, bool isFile = true,
+                              bool hasDeclaration = true);
+
+
+  bool mUseArena;
+
+  bool mUseMemoryMap;
 
   /** @endcond */
 };
@@ -247,6 +323,24 @@ CaOmexManifest_t *
 CaReader_readOMEXFromString (CaReader_t *sr, const char *xml);
 
 
+/**
+ * @param sr the CaReader_t structure to use
+ *
+ * @param data the buffer holding the input xml.
+ *
+ * @param length the number of bytes of input xml in @p data.
+ *
+ * @return a pointer to the CaOmexManifest read.
+ *
+ * @if conly
+ * @memberof CaReader_t
+ * @endif
+ */
+LIBCOMBINE_EXTERN
+CaOmexManifest_t *
+CaReader_readOMEXFromBuffer (CaReader_t *sr, const char *data, size_t length);
+
+
 /**
  * Returns @c true if the underlying libCombine supports @em gzip and @em zlib
  * format compression.
@@ -327,6 +421,23 @@ CaOmexManifest_t *
 readOMEXFromString (const char *xml);
 
 
+/**
+ * @param data the buffer holding a full Ca model
+ *
+ * @param length the number of bytes of content in @p data.
+ *
+ * @return a pointer to the CaOmexManifest structure created from the Ca
+ * content in @p data.
+ *
+ * @if conly
+ * @memberof CaReader_t
+ * @endif
+ */
+LIBCOMBINE_EXTERN
+CaOmexManifest_t *
+readOMEXFromBuffer (const char *data, size_t length);
+
+
 END_C_DECLS
 LIBCOMBINE_CPP_NAMESPACE_END
 
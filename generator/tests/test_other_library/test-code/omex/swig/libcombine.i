@@ -222,6 +222,14 @@ LIBCOMBINE_CPP_NAMESPACE_USE
 %ignore XMLOutputStream::writeAttribute(const std::string&, const unsigned int&);
 %ignore XMLOutputStream::writeAttribute(const XMLTriple&,   const unsigned int&);
 
+/**
+ * Let CaReader::readOMEXFromBuffer take a string (Python) or a byte
+ * array (Java) in place of its data and length arguments.
+ */
+#if defined(SWIGPYTHON) || defined(SWIGJAVA)
+%apply (char *STRING, size_t LENGTH) { (const char *data, size_t length) };
+#endif
+
 /**
  * The following methods will create new objects.  To prevent memory
  * leaks we must inform SWIG of this.
@@ -232,10 +240,12 @@ LIBCOMBINE_CPP_NAMESPACE_USE
 %newobject *::clone;
 %newobject CaBase::toCa;
 %newobject CaReader::readOMEXFromString;
+%newobject CaReader::readOMEXFromBuffer;
 %newobject CaReader::readOMEXFromFile;
 %newobject CaReader::readOMEX;
 %newobject readOMEX(const char *);
 %newobject readOMEXFromString(const char *);
+%newobject readOMEXFromBuffer(const char *, size_t);
 %newobject readOMEXFromFile(const char *);
 %newobject CaWriter::writeToString;
 %newobject writeOMEXToString;
@@ -107,6 +107,38 @@ SedAbstractTask::operator=(const SedAbstractTask& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedAbstractTask.
+ */
+SedAbstractTask::SedAbstractTask(SedAbstractTask&& orig)
+  : SedBase( std::move(orig) )
+  , mName ( std::move(orig.mName) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedAbstractTask.
+ */
+SedAbstractTask&
+SedAbstractTask::operator=(SedAbstractTask&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mName = std::move(rhs.mName);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedAbstractTask object.
  */
@@ -172,6 +204,8 @@ SedAbstractTask::isSetName() const
 int
 SedAbstractTask::setId(const std::string& id)
 {
+  prepareForChange();
+  updateIdIndices(mId, id);
   mId = id;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -183,6 +217,7 @@ SedAbstractTask::setId(const std::string& id)
 int
 SedAbstractTask::setName(const std::string& name)
 {
+  prepareForChange();
   mName = name;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -194,6 +229,8 @@ SedAbstractTask::setName(const std::string& name)
 int
 SedAbstractTask::unsetId()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -213,6 +250,7 @@ SedAbstractTask::unsetId()
 int
 SedAbstractTask::unsetName()
 {
+  prepareForChange();
   mName.erase();
 
   if (mName.empty() == true)
@@ -672,25 +710,24 @@ SedAbstractTask::readAttributes(
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlDocumentLOTasksAllowedCoreAttributes, level,
           version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlAbstractTaskAllowedAttributes, level, version,
           details, getLine(), getColumn());
       }
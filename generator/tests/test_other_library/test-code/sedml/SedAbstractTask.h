@@ -119,6 +119,28 @@ public:
   SedAbstractTask& operator=(const SedAbstractTask& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedAbstractTask.
+   *
+   * @param orig the SedAbstractTask instance to move; it is left as an empty
+   * SedAbstractTask in the place it had.
+   */
+  SedAbstractTask(SedAbstractTask&& orig);
+
+
+  /**
+   * Move assignment operator for SedAbstractTask.
+   *
+   * @param rhs the SedAbstractTask object whose values are to be moved into
+   * this one; it is left as an empty SedAbstractTask in the place it had.
+   */
+  SedAbstractTask& operator=(SedAbstractTask&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedAbstractTask object.
    *
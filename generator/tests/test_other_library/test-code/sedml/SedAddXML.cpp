@@ -113,6 +113,42 @@ SedAddXML::operator=(const SedAddXML& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedAddXML.
+ */
+SedAddXML::SedAddXML(SedAddXML&& orig)
+  : SedChange( std::move(orig) )
+  , mNewXML ( orig.mNewXML )
+{
+  orig.mNewXML = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedAddXML.
+ */
+SedAddXML&
+SedAddXML::operator=(SedAddXML&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    delete mNewXML;
+    mNewXML = rhs.mNewXML;
+    rhs.mNewXML = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedAddXML object.
  */
@@ -169,6 +205,8 @@ SedAddXML::isSetNewXML() const
 int
 SedAddXML::setNewXML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* newXML)
 {
+  prepareForChange();
+
   if (mNewXML == newXML)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -194,6 +232,7 @@ SedAddXML::setNewXML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* newXML)
 int
 SedAddXML::unsetNewXML()
 {
+  prepareForChange();
   delete mNewXML;
   mNewXML = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -582,18 +621,17 @@ SedAddXML::readAttributes(
   bool assigned = false;
   SedErrorLog* log = getErrorLog();
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedChange::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlAddXMLAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -112,6 +112,28 @@ public:
   SedAddXML& operator=(const SedAddXML& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedAddXML.
+   *
+   * @param orig the SedAddXML instance to move; it is left as an empty
+   * SedAddXML in the place it had.
+   */
+  SedAddXML(SedAddXML&& orig);
+
+
+  /**
+   * Move assignment operator for SedAddXML.
+   *
+   * @param rhs the SedAddXML object whose values are to be moved into this
+   * one; it is left as an empty SedAddXML in the place it had.
+   */
+  SedAddXML& operator=(SedAddXML&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedAddXML object.
    *
@@ -0,0 +1,241 @@
+/**
+ * @file SedArena.cpp
+ * @brief Implementation of the SedArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedArena.h>
+
+#include <new>
+#include <vector>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#  include <atomic>
+#  define LIBSEDML_HAS_ARENA 1
+#endif
+
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Every allocation is preceded by a header recording the pool it came
+ * from (NULL for the heap), so that deallocate() knows where it belongs
+ * without searching for it.  The header is a whole number of alignment
+ * units long so that the object following it stays aligned.
+ */
+union SedArenaHeader
+{
+  SedArenaPool* pool;
+  void*          pointer;
+  double         number;
+  long           integer;
+};
+
+
+#ifdef LIBSEDML_HAS_ARENA
+
+/*
+ * The blocks of an arena.  The arena holds one reference to its pool and
+ * every live allocation another, so the pool outlives the SedArena that
+ * created it for as long as any allocation made from it is live, and the
+ * last of them to go frees all the blocks at once.
+ */
+struct SedArenaPool
+{
+  static const size_t BLOCK_SIZE = 64 * 1024;
+
+  std::vector<char*>  mBlocks;
+  char*               mNext;
+  char*               mEnd;
+  std::atomic<size_t> mNumReferences;
+
+  SedArenaPool ()
+    : mBlocks()
+    , mNext (NULL)
+    , mEnd (NULL)
+    , mNumReferences (1)
+  {
+  }
+
+  ~SedArenaPool ()
+  {
+    for (std::vector<char*>::iterator it = mBlocks.begin();
+         it != mBlocks.end(); ++it)
+    {
+      ::operator delete(*it);
+    }
+  }
+
+  char* allocate (size_t size)
+  {
+    char* memory;
+
+    if (size > BLOCK_SIZE / 4)
+    {
+      // large allocations get a block of their own so that the space left
+      // in the current block is not wasted
+      memory = static_cast<char*>(::operator new(size));
+      mBlocks.push_back(memory);
+    }
+    else
+    {
+      if (mNext == NULL || (size_t)(mEnd - mNext) < size)
+      {
+        mNext = static_cast<char*>(::operator new(BLOCK_SIZE));
+        mEnd = mNext + BLOCK_SIZE;
+        mBlocks.push_back(mNext);
+      }
+
+      memory = mNext;
+      mNext += size;
+    }
+
+    ++mNumReferences;
+    return memory;
+  }
+
+  // gives up one reference; the pool goes once none is left
+  void release ()
+  {
+    if (--mNumReferences == 0)
+    {
+      delete this;
+    }
+  }
+};
+
+#endif  /* LIBSEDML_HAS_ARENA */
+
+
+SedArena::SedArena ()
+  : mPool (NULL)
+{
+}
+
+
+SedArena::SedArena (const SedArena&)
+  : mPool (NULL)
+{
+}
+
+
+SedArena&
+SedArena::operator=(const SedArena&)
+{
+  return *this;
+}
+
+
+SedArena::~SedArena ()
+{
+  setEnabled(false);
+}
+
+
+void
+SedArena::setEnabled (bool enabled)
+{
+#ifdef LIBSEDML_HAS_ARENA
+  if (enabled && mPool == NULL)
+  {
+    mPool = new SedArenaPool();
+  }
+  else if (!enabled && mPool != NULL)
+  {
+    mPool->release();
+    mPool = NULL;
+  }
+#endif
+}
+
+
+bool
+SedArena::isEnabled () const
+{
+  return mPool != NULL;
+}
+
+
+void*
+SedArena::allocate (SedArena* arena, size_t size)
+{
+  const size_t headerSize = sizeof(SedArenaHeader);
+  size_t total = headerSize + ((size + headerSize - 1) / headerSize) * headerSize;
+  SedArenaHeader* header;
+
+#ifdef LIBSEDML_HAS_ARENA
+  if (arena != NULL && arena->mPool != NULL)
+  {
+    header = reinterpret_cast<SedArenaHeader*>(arena->mPool->allocate(total));
+    header->pool = arena->mPool;
+    return header + 1;
+  }
+#endif
+
+  header = static_cast<SedArenaHeader*>(::operator new(total));
+  header->pool = NULL;
+  return header + 1;
+}
+
+
+void
+SedArena::deallocate (void* p)
+{
+  if (p == NULL) return;
+
+  SedArenaHeader* header = static_cast<SedArenaHeader*>(p) - 1;
+
+#ifdef LIBSEDML_HAS_ARENA
+  if (header->pool != NULL)
+  {
+    // the memory itself goes back with the rest of the blocks
+    header->pool->release();
+    return;
+  }
+#endif
+
+  ::operator delete(header);
+}
+
+/** @endcond */
+
+#endif  /* __cplusplus */
+
+LIBSEDML_CPP_NAMESPACE_END
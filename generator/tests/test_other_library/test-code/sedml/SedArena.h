@@ -0,0 +1,149 @@
+/**
+ * @file SedArena.h
+ * @brief Definition of the SedArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedArena
+ * @sbmlbrief{} TODO:Definition of the SedArena class.
+ */
+
+
+#ifndef SedArena_h
+#define SedArena_h
+
+
+#include <sedml/common/extern.h>
+
+
+#ifdef __cplusplus
+
+#include <cstddef>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+struct SedArenaPool;
+
+/** @cond doxygenLibsedmlInternal */
+
+/**
+ * Arena from which the elements of an SedDocument can be allocated.
+ *
+ * When enabled, elements created for the document (most notably while it
+ * is being read) are carved out of a few large blocks instead of being
+ * allocated one by one.  Deleting such an element only records that it has
+ * gone; the blocks themselves are handed back in one go once the document
+ * has been destroyed and no element allocated from them is left, so an
+ * element removed from the document may safely outlive it.
+ *
+ * Every element, from an arena or from the heap, is preceded by a
+ * one-word header naming the pool it came from, so deleting it needs no
+ * lookup and no lock.  Deleting an element of an arena only drops a
+ * reference to its blocks, which are all freed together when the last
+ * element goes; normally that is while the document is destroyed.
+ *
+ * An arena must not be used from several threads at once, like the
+ * document it belongs to, but elements of different documents may be
+ * created and deleted concurrently.  Arenas need C++11 (or MSVC 2012 and
+ * later); without it setEnabled() has no effect and every element is
+ * allocated from the heap.
+ */
+class LIBSEDML_EXTERN SedArena
+{
+public:
+
+  /**
+   * Creates a new, disabled, SedArena.
+   */
+  SedArena ();
+
+
+  /**
+   * Copy constructor; the copy starts out disabled and shares nothing
+   * with the original.
+   */
+  SedArena (const SedArena& orig);
+
+
+  /**
+   * Assignment operator; the arena is left unchanged.
+   */
+  SedArena& operator=(const SedArena& rhs);
+
+
+  /**
+   * Destroys this SedArena.  Its blocks are freed as soon as the last
+   * element allocated from them has been deleted.
+   */
+  ~SedArena ();
+
+
+  /**
+   * Enables or disables allocation from this arena.  Disabling it does not
+   * affect the elements already allocated.
+   *
+   * @param enabled @c true to allocate new elements from the arena.
+   */
+  void setEnabled (bool enabled);
+
+
+  /**
+   * Predicate returning @c true if new elements are allocated from this
+   * arena.
+   */
+  bool isEnabled () const;
+
+
+  /**
+   * Allocates @p size bytes from the given arena, or from the heap if
+   * @p arena is @c NULL or disabled.
+   *
+   * @return the allocated memory; throws std::bad_alloc on failure.
+   */
+  static void* allocate (SedArena* arena, size_t size);
+
+
+  /**
+   * Frees memory obtained from allocate().
+   */
+  static void deallocate (void* p);
+
+
+protected:
+
+  SedArenaPool* mPool;
+};
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* SedArena_h */
@@ -48,6 +48,8 @@
 #include <sedml/SedError.h>
 #include <sedml/SedErrorLog.h>
 #include <sedml/SedDocument.h>
+#include <sedml/SedElementIndex.h>
+#include <sedml/SedArena.h>
 #include <sedml/SedListOf.h>
 #include <sedml/SedBase.h>
 
@@ -60,6 +62,74 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 
 #ifdef __cplusplus
 
+SedCounter SedBase::mNumSharingLists(0);
+
+/* non-zero while this thread is in cloneCopyOnWrite(); kept out of the
+ * class as exported classes cannot have thread-local members */
+#ifdef LIBSEDML_HAS_THREAD_SAFE_COUNTERS
+static thread_local unsigned int copyingOnWrite = 0;
+#else
+static unsigned int copyingOnWrite = 0;
+#endif
+
+
+/*
+ * The notes and annotation of a copy made by cloneCopyOnWrite() are shared
+ * with the original.  A shared node comes with the count of the objects
+ * sharing it, and whichever of them is about to change the node first
+ * takes a copy of its own.
+ */
+static void
+shareNode(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*& node, SedCounter*& shares,
+          LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* origNode, SedCounter*& origShares)
+{
+  if (origShares == NULL)
+  {
+    origShares = new SedCounter(1);
+  }
+
+  ++(*origShares);
+  node = origNode;
+  shares = origShares;
+}
+
+
+static void
+releaseNode(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*& node, SedCounter*& shares)
+{
+  if (shares == NULL || --(*shares) == 0)
+  {
+    delete node;
+    delete shares;
+  }
+
+  node = NULL;
+  shares = NULL;
+}
+
+
+static void
+unshareNode(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*& node, SedCounter*& shares)
+{
+  if (shares == NULL) return;
+
+  if (*shares == 1)
+  {
+    // the others have gone, so the node is ours alone
+    delete shares;
+    shares = NULL;
+  }
+  else
+  {
+    // the copy is taken before letting go of the node, which the last of
+    // the others (possibly in another thread) then deletes
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* copy = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*node);
+    releaseNode(node, shares);
+    node = copy;
+  }
+}
+
+
 SedBase*
 SedBase::getElementBySId(const std::string& id)
 {
@@ -101,6 +171,81 @@ SedBase::getAllElements()
   return NULL;
 }
 
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * SedBase itself has no SIdRef attributes.
+ */
+void
+SedBase::addReferenceAttributes(std::vector<std::string>& attributes) const
+{
+}
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+void*
+SedBase::operator new (size_t size)
+{
+  return SedArena::allocate(NULL, size);
+}
+
+
+void*
+SedBase::operator new (size_t size, SedArena* arena)
+{
+  return SedArena::allocate(arena, size);
+}
+
+
+void*
+SedBase::operator new (size_t size, const std::nothrow_t&) throw()
+{
+  try
+  {
+    return SedArena::allocate(NULL, size);
+  }
+  catch (...)
+  {
+    return NULL;
+  }
+}
+
+
+void*
+SedBase::operator new (size_t, void* place) throw()
+{
+  return place;
+}
+
+
+void
+SedBase::operator delete (void* p)
+{
+  SedArena::deallocate(p);
+}
+
+
+void
+SedBase::operator delete (void* p, SedArena*)
+{
+  SedArena::deallocate(p);
+}
+
+
+void
+SedBase::operator delete (void* p, const std::nothrow_t&) throw()
+{
+  SedArena::deallocate(p);
+}
+
+
+void
+SedBase::operator delete (void*, void*) throw()
+{
+}
+/** @endcond */
+
 /** @cond doxygenLibsedmlInternal */
 /*
  * Creates a new SedBase object with the given level and version.
@@ -118,10 +263,16 @@ SedBase::SedBase (unsigned int level, unsigned int version)
  , mColumn    ( 0 )
  , mParentSedObject (NULL)
   , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
   , mEmptyString("")
  , mURI("")
 {
-  mSedNamespaces = new SedNamespaces(level, version);
+  SedNamespaces sedmlns(level, version);
+  mSedNamespaces = SedNamespaces::intern(&sedmlns);
 
   //
   // Sets the XMLNS URI of corresponding SEDML Level/Version to
@@ -149,6 +300,11 @@ SedBase::SedBase (SedNamespaces *sedmlns)
  , mColumn    ( 0 )
  , mParentSedObject (NULL)
   , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
   , mEmptyString("")
  , mURI("")
 {
@@ -157,9 +313,9 @@ SedBase::SedBase (SedNamespaces *sedmlns)
     std::string err("SedBase::SedBase(SedNamespaces*) : SedNamespaces is null");
     throw SedConstructorException(err);
   }
-  mSedNamespaces = sedmlns->clone();
+  mSedNamespaces = SedNamespaces::intern(sedmlns);
 
-  setElementNamespace(static_cast<SedNamespaces>(*mSedNamespaces).getURI());
+  setElementNamespace(mSedNamespaces->SedNamespaces::getURI());
 }
 /** @endcond */
 
@@ -179,26 +335,84 @@ SedBase::SedBase(const SedBase& orig)
   , mLine(orig.mLine)
   , mColumn(orig.mColumn)
   , mParentSedObject(NULL)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
   , mURI(orig.mURI)
 {
-  if(orig.mNotes != NULL)
-    this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(orig).getNotes());
+  if(orig.mNotes != NULL && isCopyingOnWrite())
+    shareNode(mNotes, mNotesShares, orig.mNotes, orig.mNotesShares);
+  else if(orig.mNotes != NULL)
+    this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*orig.mNotes);
   else
     this->mNotes = NULL;
 
-  if(orig.mAnnotation != NULL)
-    this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(orig).mAnnotation);
+  if(orig.mAnnotation != NULL && isCopyingOnWrite())
+    shareNode(mAnnotation, mAnnotationShares, orig.mAnnotation,
+              orig.mAnnotationShares);
+  else if(orig.mAnnotation != NULL)
+    this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*orig.mAnnotation);
   else
     this->mAnnotation = NULL;
 
-  if(orig.getSedNamespaces() != NULL)
-    this->mSedNamespaces =
-    new SedNamespaces(*const_cast<SedBase&>(orig).getSedNamespaces());
+  // share the namespaces rather than copying them; orig.getSedNamespaces()
+  // is not used as it would give orig a copy of its own
+  SedDocument* origDoc = orig.deriveSedDocument();
+  if (origDoc != NULL)
+    this->mSedNamespaces = SedNamespaces::intern(origDoc->mSedNamespaces);
   else
-    this->mSedNamespaces = NULL;
+    this->mSedNamespaces = SedNamespaces::intern(orig.mSedNamespaces);
 
   this->mHasBeenDeleted = false;
 }
+
+
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor. Takes over the contents of the given SedBase object.
+ */
+SedBase::SedBase(SedBase&& orig)
+  : mMetaId ()
+  , mId ()
+  , mNotes (NULL)
+  , mAnnotation (NULL)
+  , mSed (NULL)
+  , mSedNamespaces(NULL)
+  , mUserData(orig.mUserData)
+  , mLine(orig.mLine)
+  , mColumn(orig.mColumn)
+  , mParentSedObject(NULL)
+  , mHasBeenDeleted(false)
+  , mReleasedByParent(false)
+  , mDocumentEpoch(0)
+  , mNumDestroyedDocuments(0)
+  , mNotesShares(NULL)
+  , mAnnotationShares(NULL)
+  , mURI(orig.mURI)
+{
+  // the copies sharing the branch orig is in take their own copies before
+  // it is emptied; this may throw, so nothing is taken from orig until then.
+  // The children of orig move along with it (a SedListOf takes the SedListOf
+  // objects sharing its items with it).
+  if (orig.getHoldingParent() != NULL)
+  {
+    orig.getHoldingParent()->detachSharedCopies();
+  }
+
+  // orig stays a valid element of its namespaces
+  mSedNamespaces = SedNamespaces::intern(orig.mSedNamespaces);
+
+  orig.releaseIndexEntries(orig.mId);
+  mMetaId.swap(orig.mMetaId);
+  mId.swap(orig.mId);
+  std::swap(mNotes, orig.mNotes);
+  std::swap(mNotesShares, orig.mNotesShares);
+  std::swap(mAnnotation, orig.mAnnotation);
+  std::swap(mAnnotationShares, orig.mAnnotationShares);
+}
+#endif
 /** @endcond */
 
 
@@ -207,9 +421,15 @@ SedBase::SedBase(const SedBase& orig)
  */
 SedBase::~SedBase ()
 {
-  if (mNotes != NULL)       delete mNotes;
-  if (mAnnotation != NULL)  delete mAnnotation;
-  if (mSedNamespaces != NULL)  delete mSedNamespaces;
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->remove(this);
+  }
+
+  releaseNode(mNotes, mNotesShares);
+  releaseNode(mAnnotation, mAnnotationShares);
+  SedNamespaces::release(mSedNamespaces);
 }
 
 /*
@@ -219,43 +439,127 @@ SedBase& SedBase::operator=(const SedBase& rhs)
 {
   if(&rhs!=this)
   {
+    prepareForChange();
+
+    // rather than moving this object and its children between the entries
+    // of the index, let the document rebuild it
+    SedElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->clear();
+    }
+    updateIdIndices(mId, rhs.mId);
+
     this->mMetaId = rhs.mMetaId;
     this->mId = rhs.mId;
 
-    delete this->mNotes;
+    releaseNode(this->mNotes, this->mNotesShares);
 
     if(rhs.mNotes != NULL)
-      this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(rhs).getNotes());
-    else
-      this->mNotes = NULL;
+      this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*rhs.mNotes);
 
-    delete this->mAnnotation;
+    releaseNode(this->mAnnotation, this->mAnnotationShares);
 
     if(rhs.mAnnotation != NULL)
-      this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(rhs).mAnnotation);
-    else
-      this->mAnnotation = NULL;
+      this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*rhs.mAnnotation);
 
-    this->mSed       = rhs.mSed;
+    // this object keeps its place, so its parent and document are its own
     this->mLine       = rhs.mLine;
     this->mColumn     = rhs.mColumn;
-    this->mParentSedObject = rhs.mParentSedObject;
     this->mUserData   = rhs.mUserData;
 
-    delete this->mSedNamespaces;
+    SedNamespaces* sedmlns = SedNamespaces::intern(rhs.mSedNamespaces);
+    SedNamespaces::release(this->mSedNamespaces);
+    this->mSedNamespaces = sedmlns;
 
-    if(rhs.mSedNamespaces != NULL)
-      this->mSedNamespaces =
-      new SedNamespaces(*const_cast<SedBase&>(rhs).mSedNamespaces);
-    else
-      this->mSedNamespaces = NULL;
 
+    this->mURI = rhs.mURI;
+  }
+
+  return *this;
+}
+
+
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move assignment operator
+ */
+SedBase& SedBase::operator=(SedBase&& rhs)
+{
+  if(&rhs!=this)
+  {
+    // as in the move constructor, the steps that may throw come first; the
+    // children of both objects are moved by the subclasses
+    if (getHoldingParent() != NULL)
+    {
+      getHoldingParent()->detachSharedCopies();
+    }
+    if (rhs.getHoldingParent() != NULL)
+    {
+      rhs.getHoldingParent()->detachSharedCopies();
+    }
 
+    SedNamespaces* sedmlns = SedNamespaces::intern(rhs.mSedNamespaces);
+    SedNamespaces::release(this->mSedNamespaces);
+    this->mSedNamespaces = sedmlns;
     this->mURI = rhs.mURI;
+
+    // as for a copy, let the document rebuild its index
+    SedElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->clear();
+    }
+    updateIdIndices(mId, rhs.mId);
+    rhs.releaseIndexEntries(rhs.mId);
+
+    this->mMetaId = std::move(rhs.mMetaId);
+    this->mId = std::move(rhs.mId);
+
+    releaseNode(this->mNotes, this->mNotesShares);
+    std::swap(this->mNotes, rhs.mNotes);
+    std::swap(this->mNotesShares, rhs.mNotesShares);
+
+    releaseNode(this->mAnnotation, this->mAnnotationShares);
+    std::swap(this->mAnnotation, rhs.mAnnotation);
+    std::swap(this->mAnnotationShares, rhs.mAnnotationShares);
+
+    // this object keeps its place, so its parent and document are its own
+    this->mLine       = rhs.mLine;
+    this->mColumn     = rhs.mColumn;
+    this->mUserData   = rhs.mUserData;
+
+    rhs.mMetaId.clear();
+    rhs.mId.clear();
   }
 
   return *this;
 }
+#endif
+
+
+/*
+ * @return a copy of this object sharing its unchanged parts with it.
+ */
+SedBase*
+SedBase::cloneCopyOnWrite () const
+{
+  SedBase* copy = NULL;
+
+  beginCopyingOnWrite();
+  try
+  {
+    copy = clone();
+  }
+  catch (...)
+  {
+    endCopyingOnWrite();
+    throw;
+  }
+  endCopyingOnWrite();
+
+  return copy;
+}
 
 
 /*
@@ -291,6 +595,8 @@ SedBase::getId() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getNotes()
 {
+  // the caller may change the notes through the pointer
+  unshareNode(mNotes, mNotesShares);
   return mNotes;
 }
 
@@ -325,6 +631,8 @@ SedBase::getNotesString() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getAnnotation ()
 {
+  // the caller may change the annotation through the pointer
+  unshareNode(mAnnotation, mAnnotationShares);
   return mAnnotation;
 }
 
@@ -332,7 +640,7 @@ SedBase::getAnnotation ()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getAnnotation () const
 {
-  return const_cast<SedBase *>(this)->getAnnotation();
+  return mAnnotation;
 }
 
 
@@ -342,14 +650,14 @@ SedBase::getAnnotation () const
 std::string
 SedBase::getAnnotationString ()
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(getAnnotation());
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mAnnotation);
 }
 
 
 std::string
 SedBase::getAnnotationString () const
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(getAnnotation());
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mAnnotation);
 }
 
 
@@ -362,7 +670,7 @@ SedBase::getURI() const
   if (doc == NULL)
     return getElementNamespace();
 
-  SedNamespaces* sedmlns = doc->getSedNamespaces();
+  const SedNamespaces* sedmlns = doc->getSedNamespaces();
 
   if (sedmlns == NULL)
     return getElementNamespace();
@@ -424,24 +732,39 @@ SedBase::unsetUserData()
   }
 }
 
+
+/*
+ * Makes the copies sharing the branch holding this object take their own
+ * copies of it before it changes.
+ */
+void
+SedBase::prepareForChange()
+{
+  detachSharedCopies();
+}
+
 /*
  * @return the Namespaces associated with this SEDML object
  */
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 SedBase::getNamespaces()
 {
-  if (mSed != NULL)
-    return mSed->getSedNamespaces()->getNamespaces();
-  else
-    return mSedNamespaces->getNamespaces();
+  SedDocument* d = deriveSedDocument();
+  if (d != NULL)
+    return d->getSedNamespaces()->getNamespaces();
+
+  // the caller may change the namespaces, so stop sharing them
+  mSedNamespaces = SedNamespaces::unshare(mSedNamespaces);
+  return mSedNamespaces->getNamespaces();
 }
 
 
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 SedBase::getNamespaces() const
 {
-  if (mSed != NULL)
-    return mSed->getSedNamespaces()->getNamespaces();
+  const SedDocument* d = deriveSedDocument();
+  if (d != NULL)
+    return d->getSedNamespaces()->getNamespaces();
   else
     return mSedNamespaces->getNamespaces();
 }
@@ -453,19 +776,21 @@ SedBase::getNamespaces() const
 const SedDocument*
 SedBase::getSedDocument () const
 {
-  if (mSed != NULL)
+  SedDocument* d = deriveSedDocument();
+
+  if (d != NULL)
   {
     // if the doc object has been deleted the pointer is
     // still valid but points to nothing
     try
     {
-      if (mSed->getHasBeenDeleted())
+      if (d->getHasBeenDeleted())
       {
         return NULL;
       }
       else
       {
-        return mSed;
+        return d;
       }
     }
     catch ( ... )
@@ -474,7 +799,7 @@ SedBase::getSedDocument () const
     }
   }
 
-  return mSed;
+  return d;
 }
 
 /*
@@ -483,19 +808,21 @@ SedBase::getSedDocument () const
 SedDocument*
 SedBase::getSedDocument ()
 {
-  if (mSed != NULL)
+  SedDocument* d = deriveSedDocument();
+
+  if (d != NULL)
   {
     // if the doc object has been deleted the pointer is
     // still valid but points to nothing
     try
     {
-      if (mSed->getHasBeenDeleted())
+      if (d->getHasBeenDeleted())
       {
         return NULL;
       }
       else
       {
-        return mSed;
+        return d;
       }
     }
     catch ( ... )
@@ -503,7 +830,7 @@ SedBase::getSedDocument ()
       return NULL;
     }
   }
-  return mSed;
+  return d;
 }
 SedBase*
 SedBase::getParentSedObject ()
@@ -628,6 +955,8 @@ SedBase::setMetaId (const std::string& metaid)
 {
   if (metaid.empty())
   {
+    prepareForChange();
+    updateMetaIdIndex(mMetaId, metaid);
     mMetaId.erase();
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -637,6 +966,8 @@ SedBase::setMetaId (const std::string& metaid)
   }
   else
   {
+    prepareForChange();
+    updateMetaIdIndex(mMetaId, metaid);
     mMetaId = metaid;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -650,6 +981,8 @@ SedBase::setId (const std::string& sid)
 {
   if (sid.empty())
   {
+    prepareForChange();
+    updateIdIndices(mId, sid);
     mId.erase();
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -659,6 +992,8 @@ SedBase::setId (const std::string& sid)
   }
   else
   {
+    prepareForChange();
+    updateIdIndices(mId, sid);
     mId = sid;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -671,6 +1006,9 @@ SedBase::setId (const std::string& sid)
 int
 SedBase::setAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotation)
 {
+  prepareForChange();
+  unshareNode(mAnnotation, mAnnotationShares);
+
   if (annotation == NULL)
   {
     delete mAnnotation;
@@ -756,6 +1094,9 @@ SedBase::appendAnnotation (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annota
 
   if (mAnnotation != NULL)
   {
+    prepareForChange();
+    unshareNode(mAnnotation, mAnnotationShares);
+
     // if mAnnotation is just <annotation/> need to tell
     // it to no longer be an end
     if (mAnnotation->isEnd())
@@ -897,6 +1238,8 @@ SedBase::removeTopLevelAnnotationElement(const std::string elementName,
     }
 
     // remove the annotation at the index corresponding to the name
+    prepareForChange();
+    unshareNode(mAnnotation, mAnnotationShares);
     delete mAnnotation->removeChild(index);
 
       if (mAnnotation->getNumChildren() == 0)
@@ -986,7 +1329,11 @@ SedBase::setNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
   {
     return LIBSEDML_OPERATION_SUCCESS;
   }
-  else if (notes == NULL)
+
+  prepareForChange();
+  unshareNode(mNotes, mNotesShares);
+
+  if (notes == NULL)
   {
     delete mNotes;
     mNotes = NULL;
@@ -1275,6 +1622,9 @@ SedBase::appendNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
 
   if ( mNotes != NULL )
   {
+    prepareForChange();
+    unshareNode(mNotes, mNotesShares);
+
     //------------------------------------------------------------
     //
     //  STEP2: identifies the type of the existing notes
@@ -1492,7 +1842,17 @@ SedBase::appendNotes(const std::string& notes)
 void
 SedBase::setSedDocument (SedDocument* d)
 {
+  mNumDestroyedDocuments =
+    static_cast<unsigned long>(SedElementIndex::getNumDestroyed());
+  mDocumentEpoch = (d != NULL) ? d->getElementIndex()->getEpoch() : 0;
   mSed = d;
+
+  // the document may be walking its elements to update its index
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->visit(this);
+  }
 }
 
 
@@ -1504,19 +1864,284 @@ SedBase::setSedDocument (SedDocument* d)
 void
 SedBase::connectToParent (SedBase* parent)
 {
-  mParentSedObject = parent;
+  if (parent != mParentSedObject || mReleasedByParent)
+  {
+    leaveSedDocument();
+    mParentSedObject = parent;
+    mReleasedByParent = false;
+
+    SedElementIndex* index = getDocumentElementIndex();
+    if (index != NULL)
+    {
+      index->addSubtree(this);
+    }
+  }
+
   if (mParentSedObject)
   {
+    prepareForChange();
 #if 0
     cout << "[DEBUG] connectToParent " << this << " (parent) " << SedTypeCode_toString(parent->getTypeCode(),"core")
          << " " << parent->getSedDocument() << endl;
 #endif
-    setSedDocument(mParentSedObject->getSedDocument());
   }
-  else
+}
+
+
+/*
+ * Takes this object and the objects below it out of the document they
+ * belong to; the parent pointer is left alone.
+ */
+void
+SedBase::releaseFromParent ()
+{
+  leaveSedDocument();
+  mReleasedByParent = true;
+}
+
+
+/*
+ * Takes this object and the objects below it out of the document they
+ * belong to, before this object leaves its parent.
+ */
+void
+SedBase::leaveSedDocument()
+{
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->removeSubtree(this);
+
+    // rather than pushing the new document down the subtree, advance the
+    // epoch of the document left, so that the elements below this one
+    // derive their document again when next needed.  The documents cached
+    // by the elements of other documents stay valid, and no element below
+    // one that belonged to no document can have cached one (a missing one
+    // is never trusted).
+    index->advanceEpoch();
+  }
+  mSed = NULL;
+}
+
+
+/*
+ * Informs the indices that refer to this object by its identifier
+ * that the identifier is about to change.
+ */
+void
+SedBase::updateIdIndices(const std::string& oldId, const std::string& newId)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SEDML_LIST_OF)
+  {
+    static_cast<SedListOf*>(getHoldingParent())->updateIdIndex(this, oldId, newId);
+  }
+
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateId(this, oldId, newId);
+  }
+}
+
+
+/*
+ * Drops the entries the indices hold for this object, whose identifiers
+ * and references have been moved elsewhere.
+ */
+void
+SedBase::releaseIndexEntries(const std::string& movedId)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SEDML_LIST_OF)
+  {
+    SedListOf* parent = static_cast<SedListOf*>(getHoldingParent());
+    parent->updateIdIndex(this, movedId, "");
+    parent->clearReferenceIndices();
+  }
+
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->clear();
+  }
+}
+
+
+/*
+ * Informs the indices of the parent SedListOf and of the document that a
+ * reference is about to change.
+ */
+void
+SedBase::updateReferenceIndices(const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef)
+{
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SEDML_LIST_OF)
+  {
+    static_cast<SedListOf*>(getHoldingParent())->updateReferenceIndex(this,
+      attributeName, oldRef, newRef);
+  }
+
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateReference(this, attributeName, oldRef, newRef);
+  }
+}
+
+
+/*
+ * Informs the index of the document that the metaid is about to change.
+ */
+void
+SedBase::updateMetaIdIndex(const std::string& oldMetaId,
+                         const std::string& newMetaId)
+{
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->updateMetaId(this, oldMetaId, newMetaId);
+  }
+}
+
+
+/*
+ * @return the element index of the document this object belongs to.
+ */
+SedElementIndex*
+SedBase::getDocumentElementIndex() const
+{
+  SedDocument* d = deriveSedDocument();
+  if (d == NULL || d == this || d->getHasBeenDeleted())
+  {
+    return NULL;
+  }
+
+  return d->getElementIndex();
+}
+
+
+/*
+ * @return the arena of the document this object belongs to.
+ */
+SedArena*
+SedBase::getDocumentArena() const
+{
+  SedDocument* d = deriveSedDocument();
+  if (d == NULL || d->getHasBeenDeleted())
+  {
+    return NULL;
+  }
+
+  return d->getArena();
+}
+
+
+/*
+ * @return the namespaces to construct a child of this object with.
+ */
+SedNamespaces*
+SedBase::getSharedSedNamespaces() const
+{
+  // the constructor only takes a reference to them
+  return const_cast<SedNamespaces*>(getSedNamespaces());
+}
+
+
+/*
+ * @return the document this object belongs to; an object with a parent
+ * takes it from the parent unless the tree is unchanged since it last did.
+ */
+SedDocument*
+SedBase::deriveSedDocument() const
+{
+  SedDocument* d = mSed;
+  SedBase* parent = getHoldingParent();
+  if (parent == NULL)
+  {
+    return d;
+  }
+
+  // the cached document can only be read while no document has been
+  // destroyed since it was cached.  The count is read first, so that a
+  // document destroyed while this one is derived only makes the cache stale
+  unsigned long numDestroyed = SedElementIndex::getNumDestroyed();
+  if (d == NULL || mNumDestroyedDocuments != numDestroyed
+    || mDocumentEpoch != d->getElementIndex()->getEpoch())
+  {
+    // a document being destroyed may already have lost its index
+    d = parent->deriveSedDocument();
+    mDocumentEpoch = (d != NULL && !d->getHasBeenDeleted())
+      ? d->getElementIndex()->getEpoch() : 0;
+    mNumDestroyedDocuments = numDestroyed;
+    mSed = d;
+  }
+
+  return d;
+}
+
+
+/*
+ * @return the parent this object takes its document from.
+ */
+SedBase*
+SedBase::getHoldingParent() const
+{
+  return mReleasedByParent ? NULL : mParentSedObject;
+}
+
+
+/*
+ * Makes the copies sharing the branch holding this object take their own
+ * copies of it.  The ancestors go first: the copies they make share the
+ * children below them, which the next object down then detaches in turn.
+ */
+void
+SedBase::detachSharedCopies()
+{
+  if (mNumSharingLists == 0 || isCopyingOnWrite()) return;
+
+  if (getHoldingParent() != NULL)
   {
-    setSedDocument(NULL);
+    getHoldingParent()->detachSharedCopies();
   }
+
+  unshareChildren();
+}
+
+
+/*
+ * Only SedListOf objects share their children.
+ */
+void
+SedBase::unshareChildren()
+{
+}
+
+
+/*
+ * @return true while this thread is making a copy with cloneCopyOnWrite().
+ */
+bool
+SedBase::isCopyingOnWrite()
+{
+  return copyingOnWrite > 0;
+}
+
+
+void
+SedBase::beginCopyingOnWrite()
+{
+  ++copyingOnWrite;
+}
+
+
+void
+SedBase::endCopyingOnWrite()
+{
+  --copyingOnWrite;
 }
 
 
@@ -1599,6 +2224,8 @@ SedBase::getAncestorOfType(int type) const
 int
 SedBase::setNamespaces(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns)
 {
+  mSedNamespaces = SedNamespaces::unshare(mSedNamespaces);
+
   if (xmlns == NULL)
   {
     mSedNamespaces->setNamespaces(NULL);
@@ -1619,6 +2246,8 @@ SedBase::setNamespaces(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns)
 int
 SedBase::unsetMetaId ()
 {
+  prepareForChange();
+  updateMetaIdIndex(mMetaId, "");
   mMetaId.erase();
 
   if (mMetaId.empty())
@@ -1638,6 +2267,8 @@ SedBase::unsetMetaId ()
 int
 SedBase::unsetId ()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty())
@@ -1657,8 +2288,8 @@ SedBase::unsetId ()
 int
 SedBase::unsetNotes ()
 {
-  delete mNotes;
-  mNotes = NULL;
+  prepareForChange();
+  releaseNode(mNotes, mNotesShares);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -1680,8 +2311,9 @@ SedBase::unsetAnnotation ()
 unsigned int
 SedBase::getLevel () const
 {
-  if (mSed != NULL)
-    return mSed->getLevel();
+  SedDocument* d = deriveSedDocument();
+  if (d != NULL)
+    return d->getLevel();
   else if (mSedNamespaces != NULL)
     return mSedNamespaces->getLevel();
   else
@@ -1695,8 +2327,9 @@ SedBase::getLevel () const
 unsigned int
 SedBase::getVersion () const
 {
-  if (mSed != NULL)
-    return mSed->getVersion();
+  SedDocument* d = deriveSedDocument();
+  if (d != NULL)
+    return d->getVersion();
   else if (mSedNamespaces != NULL)
     return mSedNamespaces->getVersion();
   else
@@ -1775,8 +2408,8 @@ SedBase::matchesCoreSedNamespace(const SedBase * sb)
 {
   bool match = false;
 
-  SedNamespaces *sedmlns = getSedNamespaces();
-  SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
+  const SedNamespaces *sedmlns = static_cast<const SedBase*>(this)->getSedNamespaces();
+  const SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
 
   if (sedmlns->getLevel() != sedmlns_rhs->getLevel())
     return match;
@@ -1802,8 +2435,8 @@ SedBase::matchesCoreSedNamespace(const SedBase * sb) const
 {
   bool match = false;
 
-  SedNamespaces *sedmlns = getSedNamespaces();
-  SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
+  const SedNamespaces *sedmlns = static_cast<const SedBase*>(this)->getSedNamespaces();
+  const SedNamespaces *sedmlns_rhs = sb->getSedNamespaces();
 
   if (sedmlns->getLevel() != sedmlns_rhs->getLevel())
     return match;
@@ -1888,26 +2521,45 @@ SedBase::setSedNamespaces(SedNamespaces * sedmlns)
 void
 SedBase::setSedNamespacesAndOwn(SedNamespaces * sedmlns)
 {
-  delete mSedNamespaces;
-  mSedNamespaces = sedmlns;
+  SedNamespaces::release(mSedNamespaces);
+  mSedNamespaces = SedNamespaces::internAndOwn(sedmlns);
 
-  if(sedmlns != NULL)
-    setElementNamespace(sedmlns->getURI());
+  if(mSedNamespaces != NULL)
+    setElementNamespace(mSedNamespaces->getURI());
 }
 
 
 /* gets the Sednamespaces - internal use only*/
-SedNamespaces *
+const SedNamespaces *
 SedBase::getSedNamespaces() const
 {
-  if (mSed != NULL)
-    return mSed->mSedNamespaces;
+  const SedDocument* d = deriveSedDocument();
+  if (d != NULL && d != this)
+    return d->getSedNamespaces();
   
   // initialize SEDML namespace if need be
   if (mSedNamespaces == NULL)
     const_cast<SedBase*>(this)->mSedNamespaces = new SedNamespaces(getLevel(), getVersion());
+
   return mSedNamespaces;  
 }
+
+
+/* gets the Sednamespaces for modification - internal use only*/
+SedNamespaces *
+SedBase::getSedNamespaces()
+{
+  SedDocument* d = deriveSedDocument();
+  if (d != NULL && d != this)
+    return d->getSedNamespaces();
+
+  if (mSedNamespaces == NULL)
+    mSedNamespaces = new SedNamespaces(getLevel(), getVersion());
+
+  // the caller may change the namespaces, so stop sharing them
+  mSedNamespaces = SedNamespaces::unshare(mSedNamespaces);
+  return mSedNamespaces;
+}
 /** @endcond */
 
 
@@ -2136,6 +2788,27 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
   addExpectedAttributes(expectedAttributes);
   readAttributes( element.getAttributes(), expectedAttributes );
 
+  // the attributes are read straight into the members, so let any
+  // index of the parent or the document know about the identifiers
+  if (!getId().empty())
+  {
+    updateIdIndices("", getId());
+  }
+  if (!getMetaId().empty())
+  {
+    updateMetaIdIndex("", getMetaId());
+  }
+  if (getHoldingParent() != NULL
+    && getHoldingParent()->getTypeCode() == SEDML_LIST_OF)
+  {
+    static_cast<SedListOf*>(getHoldingParent())->clearReferenceIndices();
+  }
+  SedElementIndex* index = getDocumentElementIndex();
+  if (index != NULL)
+  {
+    index->addReferences(this);
+  }
+
   /* if we are reading a document pass the
    * SEDML Namespace information to the input stream object
    * thus the MathML reader can find out what level/version
@@ -2147,7 +2820,9 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     // need to check that any prefix on the sedmlns also occurs on element
     // remembering the horrible situation where the sedmlns might be declared
     // with more than one prefix
-    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * xmlns = this->getSedNamespaces()->getNamespaces();
+    const SedNamespaces * sedmlns =
+      static_cast<const SedBase*>(this)->getSedNamespaces();
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * xmlns = sedmlns->getNamespaces();
     if (xmlns != NULL)
     {
       int i = xmlns->getIndexByPrefix(element.getPrefix());
@@ -2157,7 +2832,7 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
         bool error = false;
         if (i > -1)
         {
-          if (xmlns->getURI(i) != this->getSedNamespaces()->getURI())
+          if (xmlns->getURI(i) != sedmlns->getURI())
           {
             error = true;
           }
@@ -2368,7 +3043,7 @@ SedBase::readAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
       logError(SedMultipleAnnotations, getLevel(), getVersion(), msg);
     }
 
-    delete mAnnotation;
+    releaseNode(mAnnotation, mAnnotationShares);
     mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
     checkAnnotation();
     return true;
@@ -2399,7 +3074,7 @@ SedBase::readNotes (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
       logError(SedOnlyOneNotesElementAllowed, getLevel(), getVersion());
     }
 
-    delete mNotes;
+    releaseNode(mNotes, mNotesShares);
     mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
 
     //
@@ -2440,7 +3115,8 @@ SedBase::getElementPosition () const
 SedErrorLog*
 SedBase::getErrorLog ()
 {
-  return (mSed != NULL) ? mSed->getErrorLog() : NULL;
+  SedDocument* d = deriveSedDocument();
+  return (d != NULL) ? d->getErrorLog() : NULL;
 }
 /** @endcond */
 
@@ -2462,7 +3138,7 @@ SedBase::logUnknownAttribute( const string& attribute,
         << "definition of an SEDML Level " << level
         << " Version " << version << " <" << element << "> element.";
 
-  if (mSed)
+  if (deriveSedDocument())
   {
   //
   // (TODO) Needs to be fixed so that error can be added when
@@ -2491,7 +3167,7 @@ SedBase::logUnknownElement( const string& element,
     msg << "Element '" << element << "' is not part of the definition of "
         << "SEDML Level " << level << " Version " << version << ".";
 
-    if (mSed != NULL)
+    if (deriveSedDocument() != NULL)
     {
       getErrorLog()->logError(SedUnrecognizedElement,
             level, version, msg.str(), getLine(), getColumn());
@@ -2522,7 +3198,7 @@ SedBase::logEmptyString( const string& attribute,
   // (TODO) Needs to be fixed so that error can be added when
   // no SedDocument attached.
   //
-  if (mSed != NULL)
+  if (deriveSedDocument() != NULL)
     getErrorLog()->logError(SedNotSchemaConformant,
                             level, version, msg.str(), getLine(), getColumn());
 }
@@ -2546,7 +3222,7 @@ SedBase::logError (  unsigned int       id
   // (TODO) Needs to be fixed so that error can be added when
   // no SedDocument attached.
   //
-  if ( SedBase::getErrorLog() != NULL && mSed != NULL)
+  if ( SedBase::getErrorLog() != NULL && deriveSedDocument() != NULL)
     getErrorLog()->logError(id, getLevel(), getVersion(), details, getLine(), getColumn());
 }
 /** @endcond */
@@ -2653,7 +3329,7 @@ SedBase::getPrefix() const
 
   const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns = getNamespaces();
   string uri = getURI();
-  if(xmlns && mSed)
+  if(xmlns && deriveSedDocument())
   {
     prefix = xmlns->getPrefix(uri);
   }
@@ -2694,9 +3370,10 @@ SedBase::getSedPrefix() const
 SedBase*
 SedBase::getRootElement()
 {
-  if (mSed)
+  SedDocument* d = deriveSedDocument();
+  if (d)
   {
-    return mSed;
+    return d;
   }
   else if (mParentSedObject)
   {
@@ -2772,11 +3449,20 @@ int SedBase::removeFromParentAndDelete()
   SedBase* parent = getParentSedObject();
 
   if (parent==NULL) return LIBSEDML_OPERATION_FAILED;
+
+  // a single child is detached by its parent, which gives it back
+  if (parent->getTypeCode() != SEDML_LIST_OF)
+  {
+    parent->prepareForChange();
+    if (parent->removeChildObject(getElementName(), getId()) != this)
+      return LIBSEDML_OPERATION_FAILED;
+
+    delete this;
+    return LIBSEDML_OPERATION_SUCCESS;
+  }
   
   SedListOf* parentList = static_cast<SedListOf*>(parent);
   
-  if (parentList == NULL) return LIBSEDML_OPERATION_FAILED;
-  
   for (unsigned int i=0; i<parentList->size(); i++) 
   {
     SedBase* sibling = parentList->get(i);
@@ -2811,16 +3497,17 @@ SedBase::checkMathMLNamespace(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken ele
   }
   if (match == 0)
   {
-    if( mSed->getNamespaces() != NULL)
+    SedDocument* d = deriveSedDocument();
+    if( d->getNamespaces() != NULL)
     /* check for implicit declaration */
     {
-      for (n = 0; n < mSed->getNamespaces()->getLength(); n++)
+      for (n = 0; n < d->getNamespaces()->getLength(); n++)
       {
-        if (!strcmp(mSed->getNamespaces()->getURI(n).c_str(),
+        if (!strcmp(d->getNamespaces()->getURI(n).c_str(),
                     "http://www.w3.org/1998/Math/MathML"))
         {
           match = 1;
-          prefix = mSed->getNamespaces()->getPrefix(n);
+          prefix = d->getNamespaces()->getPrefix(n);
           break;
         }
       }
@@ -2936,12 +3623,13 @@ SedBase::checkAnnotation()
     if (topLevel.getNamespaces().getLength() == 0)
     {
       // not on actual element - is it explicit ??
-      if(mSed != NULL && mSed->getNamespaces() != NULL)
+      SedDocument* d = deriveSedDocument();
+      if(d != NULL && d->getNamespaces() != NULL)
       /* check for implicit declaration */
       {
-        for (n = 0; n < mSed->getNamespaces()->getLength(); n++)
+        for (n = 0; n < d->getNamespaces()->getLength(); n++)
         {
-          if (!strcmp(mSed->getNamespaces()->getPrefix(n).c_str(),
+          if (!strcmp(d->getNamespaces()->getPrefix(n).c_str(),
                         prefix.c_str()))
           {
             implicitNSdecl = true;
@@ -3028,7 +3716,8 @@ SedBase::checkXHTML(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode * xhtml)
     }
   }
 
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* toplevelNS = (mSed) ? mSed->getNamespaces() : NULL;
+  SedDocument* d = deriveSedDocument();
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* toplevelNS = (d) ? d->getNamespaces() : NULL;
 
   /*
   * namespace declaration is variable
@@ -56,8 +56,28 @@
 
 
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <new>
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#  include <unordered_map>
+#  define LIBSEDML_HAS_UNORDERED_MAP 1
+#else
+#  include <map>
+#endif
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#  include <memory>
+#  include <utility>
+#  define LIBSEDML_HAS_MOVE_SEMANTICS 1
+#endif
+
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#  include <atomic>
+#  define LIBSEDML_HAS_THREAD_SAFE_COUNTERS 1
+#endif
 
 #include <sedml/SedErrorLog.h>
 #include <sedml/SedVisitor.h>
@@ -79,6 +99,21 @@ LIBSBML_CPP_NAMESPACE_END
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
 class SedDocument;
+class SedElementIndex;
+class SedArena;
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * The counters SedBase keeps across documents, and the counts of the objects
+ * sharing a node, are atomic so that different documents can be used from
+ * different threads (see SedBase::cloneCopyOnWrite()).
+ */
+#ifdef LIBSEDML_HAS_THREAD_SAFE_COUNTERS
+typedef std::atomic<unsigned long> SedCounter;
+#else
+typedef unsigned long SedCounter;
+#endif
+/** @endcond */
 
 
 class LIBSEDML_EXTERN SedBase
@@ -91,6 +126,42 @@ public:
   virtual ~SedBase ();
 
 
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Allocates an SedBase object from the heap.
+   */
+  static void* operator new (size_t size);
+
+
+  /**
+   * Allocates an SedBase object from the given SedArena, or from the heap
+   * if @p arena is @c NULL or not enabled.
+   */
+  static void* operator new (size_t size, SedArena* arena);
+
+
+  static void* operator new (size_t size, const std::nothrow_t&) throw();
+
+
+  static void* operator new (size_t size, void* place) throw();
+
+
+  /**
+   * Frees an SedBase object allocated by any of the forms of operator new.
+   */
+  static void operator delete (void* p);
+
+
+  static void operator delete (void* p, SedArena* arena);
+
+
+  static void operator delete (void* p, const std::nothrow_t&) throw();
+
+
+  static void operator delete (void* p, void* place) throw();
+  /** @endcond */
+
+
   /**
    * Assignment operator for SedBase.
    *
@@ -100,6 +171,22 @@ public:
   SedBase& operator=(const SedBase& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move assignment operator for SedBase.
+   *
+   * The identifiers, notes and annotation of @p rhs are taken over rather
+   * than copied.  This object keeps its own parent, and @p rhs is left as
+   * a valid element without them, in the place it had.  The copies made
+   * with cloneCopyOnWrite() that share either object take their own
+   * copies first, which may throw @c std::bad_alloc.
+   *
+   * @param rhs The object whose values are moved into this one.
+   */
+  SedBase& operator=(SedBase&& rhs);
+#endif
+
+
   /** @cond doxygenLibsedmlInternal */
   /**
    * Accepts the given SedVisitor for this SedBase object.
@@ -120,6 +207,39 @@ public:
   virtual SedBase* clone () const = 0;
 
 
+  /**
+   * Creates and returns a copy of this SedBase object that shares its
+   * unchanged parts with the original.
+   *
+   * The items of the SedListOf objects in the copy, and the notes and
+   * annotations of its elements, are not copied straight away but shared
+   * with the original.  A SedListOf only takes copies of the items it shares
+   * when it or the items are first used, and those copies share their own
+   * children in turn; conversely a SedListOf whose items are shared makes the
+   * SedListOf objects sharing them take their copies before it or anything
+   * below it changes.  Only the branches actually used or changed are thus
+   * ever copied, which makes it cheap to derive many variants of a large
+   * document that each differ in a few places.
+   *
+   * The sharing relies on changes being made through the setters and the
+   * create, add and remove functions, which all call prepareForChange()
+   * first.  An element, math or XML node of the original changed by other
+   * means (for instance through a pointer to a node obtained from a getter)
+   * may also change the copies that still share it.
+   *
+   * Different documents can be used from different threads at the same
+   * time.  The original and the copies made here, however, count as one
+   * document for as long as a SedListOf of one shares the items of another,
+   * and must then be used from one thread at a time; shared notes and
+   * annotations do not tie them together.  This needs atomic counters and
+   * thread-local storage (C++11 or MSVC 2015 and later); without them the
+   * library must only be used from one thread at a time.
+   *
+   * @return the copy of this SedBase object.
+   */
+  SedBase* cloneCopyOnWrite () const;
+
+
   /**
    * Returns the first child element it can find with a specific "id"
    * attribute value, or @c NULL if no such object is found.
@@ -175,6 +295,21 @@ public:
   virtual List* getAllElements();
 
 
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Adds the XML names of the SIdRef attributes of this object to the
+   * given list, so that the references it makes can be found through
+   * getAttribute().
+   *
+   * Subclasses with SIdRef attributes override this, calling the
+   * implementation of their parent class first.
+   *
+   * @param attributes the list to add the names to.
+   */
+  virtual void addReferenceAttributes(std::vector<std::string>& attributes) const;
+  /** @endcond */
+
+
   /**
    * Returns the value of the "metaid" attribute of this object.
    *
@@ -1204,6 +1339,11 @@ public:
   /**
    * Sets the parent SedDocument of this SEDML object.
    *
+   * The document of an object with a parent is derived from that parent
+   * when it is needed, so this only has a lasting effect on an object
+   * without one; subclasses pass it on to their children so that a
+   * document can visit all of its elements to update its element index.
+   *
    * @param d the SedDocument object to use
    *
    * @see connectToChild()
@@ -1224,11 +1364,27 @@ public:
    * addXXX, createXXX, and connectToChild functions of the
    * parent element).
    *
+   * Only the parent pointer is changed, so this takes constant time unless
+   * the document this object leaves or joins has built its element index,
+   * in which case each element of the subtree is removed from or added to
+   * that index.
+   *
    * @param parent the SEDML object to use
    */
   virtual void connectToParent (SedBase* parent);
 
 
+  /**
+   * Takes this SEDML object and the objects below it out of the
+   * document they belong to, as its parent hands it over to the caller
+   * (see SedListOf::remove()).  The parent pointer is left alone, but the
+   * object no longer takes its document from its parent, so
+   * getSedDocument() returns @c NULL until it is connected to a parent
+   * again.
+   */
+  void releaseFromParent ();
+
+
   /**
    * Sets this SEDML object to child SEDML objects (if any).
    * (Creates a child-parent relationship by the parent)
@@ -1625,8 +1781,13 @@ public:
 
 
   /** @cond doxygenLibsedmlInternal */
-  /* gets the Sednamespaces - internal use only*/
-  virtual SedNamespaces * getSedNamespaces() const;
+  /* gets the Sednamespaces - internal use only; the object may be shared
+   * with other elements and documents */
+  virtual const SedNamespaces * getSedNamespaces() const;
+
+  /* gets the Sednamespaces for modification - internal use only; they are
+   * copied first if they are shared (copy-on-write) */
+  virtual SedNamespaces * getSedNamespaces();
   /** @endcond */
 
 
@@ -1638,8 +1799,9 @@ public:
    * virtual method, as every SedBase element has different parents, and
    * therefore different methods of removing itself.  Will fail (and not
    * delete itself) if it has no parent object.  This function is designed to
-   * be overridden, but for all objects whose parent is of the class SedListOf,
-   * the default implementation will work.
+   * be overridden, but the default implementation will work for all objects
+   * whose parent is of the class SedListOf, and for the other objects whose
+   * parent gives them up through removeChildObject().
    *
    * @copydetails doc_returns_success_code
    * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
@@ -1747,6 +1909,18 @@ public:
   int unsetUserData();
 
 
+  /**
+   * Makes the copies made with cloneCopyOnWrite() that still share the
+   * branch holding this element take their own copy of it.  Does nothing
+   * unless such copies exist.
+   *
+   * The generated setters and the create, add and remove functions call
+   * this before making their change; it only needs to be called directly
+   * by code that changes an element by other means.
+   */
+  void prepareForChange();
+
+
   /**
    * Returns the SedErrorLog used to log errors while reading and
    * validating SEDML.
@@ -1796,6 +1970,21 @@ protected:
   SedBase(const SedBase& orig);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor.  The new object takes over the identifiers, notes
+   * and annotation of @p orig but, like a copy, has no parent.  @p orig is
+   * left as a valid element without them, in the place it had; it can be
+   * taken out with removeFromParentAndDelete().  The copies made with
+   * cloneCopyOnWrite() that share @p orig take their own copies first,
+   * which may throw @c std::bad_alloc.
+   *
+   * @param orig the object to move.
+   */
+  SedBase(SedBase&& orig);
+#endif
+
+
   /**
    * Subclasses should override this method to create, store, and then
    * return an SEDML object corresponding to the next XMLToken in the
@@ -2011,6 +2200,139 @@ protected:
   SedBase* getRootElement();
 
 
+  /**
+   * Informs the indices that refer to this object by its identifier (the
+   * one kept by a parent SedListOf and the one kept by the SedDocument) that
+   * the "id" is about to change.
+   *
+   * Subclasses that store the identifier themselves must call this before
+   * storing the new value.
+   *
+   * @param oldId the identifier this object currently has.
+   * @param newId the identifier this object is about to be given.
+   */
+  void updateIdIndices(const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Informs the indices that refer to this object that its identifiers and
+   * references have been moved to another object.  The parent SedListOf drops
+   * the identifier @p movedId and its reference indices, and the
+   * SedDocument drops its element index, to rebuild them when next used.
+   *
+   * @param movedId the identifier this object had before the move.
+   */
+  void releaseIndexEntries(const std::string& movedId);
+
+
+  /**
+   * Makes the copies made with cloneCopyOnWrite() that share the branch
+   * holding this object take their own copies, starting from the root so
+   * that the copies taken on the way share nothing below this object.
+   * Called before anything in the branch changes.
+   */
+  void detachSharedCopies();
+
+
+  /**
+   * Makes the copies that share the children of this object take their own
+   * copies of them.  Does nothing here; overridden by SedListOf.
+   */
+  virtual void unshareChildren();
+
+
+  /**
+   * Predicate returning @c true while the calling thread is making a copy
+   * with cloneCopyOnWrite(), during which copies share rather than copy
+   * and nothing shared changes.
+   */
+  static bool isCopyingOnWrite();
+
+
+  /**
+   * Starts and ends a stretch of copying on write in the calling thread
+   * (see isCopyingOnWrite()).  The calls nest.
+   */
+  static void beginCopyingOnWrite();
+
+  static void endCopyingOnWrite();
+
+
+  /**
+   * Informs the index that the parent SedListOf keeps of the given SIdRef
+   * attribute, and the index of the references of the SedDocument, that
+   * its value is about to change for this object.
+   *
+   * Subclasses must call this from the setters of their SIdRef attributes
+   * before storing the new value.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param oldRef the value the attribute currently has.
+   * @param newRef the value the attribute is about to be given.
+   */
+  void updateReferenceIndices(const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef);
+
+
+  /**
+   * Informs the index of the SedDocument that the "metaid" of this object
+   * is about to change.
+   *
+   * @param oldMetaId the metaid this object currently has.
+   * @param newMetaId the metaid this object is about to be given.
+   */
+  void updateMetaIdIndex(const std::string& oldMetaId,
+                         const std::string& newMetaId);
+
+
+  /**
+   * Returns the element index of the SedDocument this object belongs to,
+   * or @c NULL if there is no such document (or this object is the
+   * document itself).
+   */
+  SedElementIndex* getDocumentElementIndex() const;
+
+
+  /**
+   * Returns the arena new elements of the SedDocument this object belongs
+   * to are allocated from, or @c NULL if there is no such document.
+   */
+  SedArena* getDocumentArena() const;
+
+
+  /**
+   * Returns the namespaces to pass to the constructor of a new child of
+   * this object.  They are shared rather than copied, so they must not be
+   * modified; the constructor takes its own reference to them.
+   */
+  SedNamespaces* getSharedSedNamespaces() const;
+
+
+  /**
+   * Returns the SedDocument this object belongs to without checking
+   * whether it has been deleted.  The document is taken from the parent
+   * and cached until an element leaves that document or a document is
+   * destroyed.
+   */
+  SedDocument* deriveSedDocument() const;
+
+
+  /**
+   * Returns the parent this object takes its document from: its parent,
+   * unless the parent has handed it over to the caller.
+   */
+  SedBase* getHoldingParent() const;
+
+
+  /**
+   * Takes this object and the objects below it out of the index of the
+   * document they belong to, and makes the objects below it derive their
+   * document again, before this object leaves its parent.
+   */
+  void leaveSedDocument();
+
+
   // ------------------------------------------------------------------
 
 
@@ -2018,7 +2340,11 @@ protected:
   std::string     mId;
   LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mNotes;
   LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mAnnotation;
-  SedDocument*   mSed;
+#ifdef LIBSEDML_HAS_THREAD_SAFE_COUNTERS
+  mutable std::atomic<SedDocument*> mSed;
+#else
+  mutable SedDocument* mSed;
+#endif
   SedNamespaces* mSedNamespaces;
   void*           mUserData;
 
@@ -2028,6 +2354,22 @@ protected:
   /* store the parent SEDML object */
   SedBase* mParentSedObject;
   bool mHasBeenDeleted;
+  /* set once the parent has handed this object over to the caller */
+  bool mReleasedByParent;
+
+  /* mSed is valid for an object with a parent while these match the
+   * epoch of that document and the number of documents destroyed (see
+   * SedElementIndex) */
+  mutable SedCounter mDocumentEpoch;
+  mutable SedCounter mNumDestroyedDocuments;
+
+  /* the number of SedListOf objects still sharing the items of another */
+  static SedCounter mNumSharingLists;
+
+  /* counts the objects sharing mNotes / mAnnotation, or NULL if the
+   * node is not shared */
+  mutable SedCounter* mNotesShares;
+  mutable SedCounter* mAnnotationShares;
 
   std::string mEmptyString;
 
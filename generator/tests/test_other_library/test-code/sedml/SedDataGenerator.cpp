@@ -129,6 +129,48 @@ SedDataGenerator::operator=(const SedDataGenerator& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedDataGenerator.
+ */
+SedDataGenerator::SedDataGenerator(SedDataGenerator&& orig)
+  : SedBase( std::move(orig) )
+  , mName ( std::move(orig.mName) )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+  , mMath ( orig.mMath )
+{
+  orig.mMath = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedDataGenerator.
+ */
+SedDataGenerator&
+SedDataGenerator::operator=(SedDataGenerator&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mName = std::move(rhs.mName);
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    delete mMath;
+    mMath = rhs.mMath;
+    rhs.mMath = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedDataGenerator object.
  */
@@ -197,6 +239,8 @@ SedDataGenerator::isSetName() const
 int
 SedDataGenerator::setId(const std::string& id)
 {
+  prepareForChange();
+  updateIdIndices(mId, id);
   mId = id;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -208,6 +252,7 @@ SedDataGenerator::setId(const std::string& id)
 int
 SedDataGenerator::setName(const std::string& name)
 {
+  prepareForChange();
   mName = name;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -219,6 +264,8 @@ SedDataGenerator::setName(const std::string& name)
 int
 SedDataGenerator::unsetId()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -238,6 +285,7 @@ SedDataGenerator::unsetId()
 int
 SedDataGenerator::unsetName()
 {
+  prepareForChange();
   mName.erase();
 
   if (mName.empty() == true)
@@ -288,6 +336,8 @@ SedDataGenerator::isSetMath() const
 int
 SedDataGenerator::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 {
+  prepareForChange();
+
   if (mMath == math)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -317,6 +367,7 @@ SedDataGenerator::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 int
 SedDataGenerator::unsetMath()
 {
+  prepareForChange();
   delete mMath;
   mMath = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -486,7 +537,7 @@ SedDataGenerator::createVariable()
 
   try
   {
-    sv = new SedVariable(getSedNamespaces());
+    sv = new (getDocumentArena()) SedVariable(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -642,7 +693,7 @@ SedDataGenerator::createParameter()
 
   try
   {
-    sp = new SedParameter(getSedNamespaces());
+    sp = new (getDocumentArena()) SedParameter(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1325,25 +1376,24 @@ SedDataGenerator::readAttributes(
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlDocumentLODataGeneratorsAllowedCoreAttributes,
           level, version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlDataGeneratorAllowedAttributes, level, version,
           details, getLine(), getColumn());
       }
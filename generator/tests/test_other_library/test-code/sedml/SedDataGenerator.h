@@ -119,6 +119,28 @@ public:
   SedDataGenerator& operator=(const SedDataGenerator& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedDataGenerator.
+   *
+   * @param orig the SedDataGenerator instance to move; it is left as an empty
+   * SedDataGenerator in the place it had.
+   */
+  SedDataGenerator(SedDataGenerator&& orig);
+
+
+  /**
+   * Move assignment operator for SedDataGenerator.
+   *
+   * @param rhs the SedDataGenerator object whose values are to be moved into
+   * this one; it is left as an empty SedDataGenerator in the place it had.
+   */
+  SedDataGenerator& operator=(SedDataGenerator&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedDataGenerator object.
    *
@@ -163,6 +163,61 @@ SedDocument::operator=(const SedDocument& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedDocument.
+ */
+SedDocument::SedDocument(SedDocument&& orig)
+  : SedBase( std::move(orig) )
+  , mLevel ( orig.mLevel )
+  , mIsSetLevel ( orig.mIsSetLevel )
+  , mVersion ( orig.mVersion )
+  , mIsSetVersion ( orig.mIsSetVersion )
+  , mDataDescriptions ( std::move(orig.mDataDescriptions) )
+  , mModels ( std::move(orig.mModels) )
+  , mSimulations ( std::move(orig.mSimulations) )
+  , mAbstractTasks ( std::move(orig.mAbstractTasks) )
+  , mDataGenerators ( std::move(orig.mDataGenerators) )
+  , mOutputs ( std::move(orig.mOutputs) )
+  , mStyles ( std::move(orig.mStyles) )
+{
+  SedBase::setSedDocument(this);
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedDocument.
+ */
+SedDocument&
+SedDocument::operator=(SedDocument&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLevel = rhs.mLevel;
+    mIsSetLevel = rhs.mIsSetLevel;
+    mVersion = rhs.mVersion;
+    mIsSetVersion = rhs.mIsSetVersion;
+    mDataDescriptions = std::move(rhs.mDataDescriptions);
+    mModels = std::move(rhs.mModels);
+    mSimulations = std::move(rhs.mSimulations);
+    mAbstractTasks = std::move(rhs.mAbstractTasks);
+    mDataGenerators = std::move(rhs.mDataGenerators);
+    mOutputs = std::move(rhs.mOutputs);
+    mStyles = std::move(rhs.mStyles);
+    connectToChild();
+    SedBase::setSedDocument(this);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedDocument object.
  */
@@ -178,6 +233,7 @@ SedDocument::clone() const
  */
 SedDocument::~SedDocument()
 {
+  mHasBeenDeleted = true;
 }
 
 
@@ -228,6 +284,7 @@ SedDocument::isSetVersion() const
 int
 SedDocument::setLevel(unsigned int level)
 {
+  prepareForChange();
   mLevel = level;
   mIsSetLevel = true;
 
@@ -246,6 +303,7 @@ SedDocument::setLevel(unsigned int level)
 int
 SedDocument::setVersion(unsigned int version)
 {
+  prepareForChange();
   mVersion = version;
   mIsSetVersion = true;
 
@@ -264,6 +322,7 @@ SedDocument::setVersion(unsigned int version)
 int
 SedDocument::unsetLevel()
 {
+  prepareForChange();
   mLevel = SEDML_INT_MAX;
   mIsSetLevel = false;
 
@@ -284,6 +343,7 @@ SedDocument::unsetLevel()
 int
 SedDocument::unsetVersion()
 {
+  prepareForChange();
   mVersion = SEDML_INT_MAX;
   mIsSetVersion = false;
 
@@ -417,7 +477,8 @@ SedDocument::createDataDescription()
 
   try
   {
-    sdd = new SedDataDescription(getSedNamespaces());
+    sdd = new (getDocumentArena())
+      SedDataDescription(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -573,7 +634,7 @@ SedDocument::createModel()
 
   try
   {
-    sm = new SedModel(getSedNamespaces());
+    sm = new (getDocumentArena()) SedModel(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -732,7 +793,8 @@ SedDocument::createUniformTimeCourse()
 
   try
   {
-    sutc = new SedUniformTimeCourse(getSedNamespaces());
+    sutc = new (getDocumentArena())
+      SedUniformTimeCourse(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -758,7 +820,7 @@ SedDocument::createOneStep()
 
   try
   {
-    sos = new SedOneStep(getSedNamespaces());
+    sos = new (getDocumentArena()) SedOneStep(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -784,7 +846,7 @@ SedDocument::createSteadyState()
 
   try
   {
-    sss = new SedSteadyState(getSedNamespaces());
+    sss = new (getDocumentArena()) SedSteadyState(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -940,7 +1002,7 @@ SedDocument::createTask()
 
   try
   {
-    st = new SedTask(getSedNamespaces());
+    st = new (getDocumentArena()) SedTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -966,7 +1028,7 @@ SedDocument::createRepeatedTask()
 
   try
   {
-    srt = new SedRepeatedTask(getSedNamespaces());
+    srt = new (getDocumentArena()) SedRepeatedTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -992,7 +1054,8 @@ SedDocument::createParameterEstimationTask()
 
   try
   {
-    spet = new SedParameterEstimationTask(getSedNamespaces());
+    spet = new (getDocumentArena())
+      SedParameterEstimationTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1018,7 +1081,8 @@ SedDocument::createSimpleRepeatedTask()
 
   try
   {
-    ssrt = new SedSimpleRepeatedTask(getSedNamespaces());
+    ssrt = new (getDocumentArena())
+      SedSimpleRepeatedTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1178,7 +1242,7 @@ SedDocument::createDataGenerator()
 
   try
   {
-    sdg = new SedDataGenerator(getSedNamespaces());
+    sdg = new (getDocumentArena()) SedDataGenerator(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1334,7 +1398,7 @@ SedDocument::createReport()
 
   try
   {
-    sr = new SedReport(getSedNamespaces());
+    sr = new (getDocumentArena()) SedReport(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1360,7 +1424,7 @@ SedDocument::createPlot2D()
 
   try
   {
-    spd = new SedPlot2D(getSedNamespaces());
+    spd = new (getDocumentArena()) SedPlot2D(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1386,7 +1450,7 @@ SedDocument::createPlot3D()
 
   try
   {
-    spd = new SedPlot3D(getSedNamespaces());
+    spd = new (getDocumentArena()) SedPlot3D(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1412,7 +1476,7 @@ SedDocument::createFigure()
 
   try
   {
-    sf = new SedFigure(getSedNamespaces());
+    sf = new (getDocumentArena()) SedFigure(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1589,7 +1653,7 @@ SedDocument::createStyle()
 
   try
   {
-    ss = new SedStyle(getSedNamespaces());
+    ss = new (getDocumentArena()) SedStyle(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -2394,60 +2458,116 @@ SedDocument::getElementBySId(const std::string& id)
     return NULL;
   }
 
-  SedBase* obj = NULL;
-
-  obj = mDataDescriptions.getElementBySId(id);
-
-  if (obj != NULL)
+  if (!mElementIndex.isBuilt())
   {
-    return obj;
+    mElementIndex.build(this);
   }
 
-  obj = mModels.getElementBySId(id);
+  return mElementIndex.getElementBySId(id);
+}
+
 
-  if (obj != NULL)
+/*
+ * Returns the first child element that has the given @p metaid, or @c NULL if
+ * no such object is found.
+ */
+SedBase*
+SedDocument::getElementByMetaId(const std::string& metaid)
+{
+  if (metaid.empty())
   {
-    return obj;
+    return NULL;
   }
 
-  obj = mSimulations.getElementBySId(id);
-
-  if (obj != NULL)
+  if (!mElementIndex.isBuilt())
   {
-    return obj;
+    mElementIndex.build(this);
   }
 
-  obj = mAbstractTasks.getElementBySId(id);
+  return mElementIndex.getElementByMetaId(metaid);
+}
 
-  if (obj != NULL)
+
+/*
+ * Returns the elements of this SedDocument that refer to the given @p id
+ * through one of their SIdRef attributes.
+ */
+List*
+SedDocument::getReferrers(const std::string& id)
+{
+  if (!mElementIndex.isBuilt())
   {
-    return obj;
+    mElementIndex.build(this);
   }
 
-  obj = mDataGenerators.getElementBySId(id);
+  return mElementIndex.getReferrers(id);
+}
+
 
-  if (obj != NULL)
+/*
+ * Changes the identifier of the element of this SedDocument with the
+ * identifier @p oldId to @p newId, and redirects every SIdRef attribute
+ * referring to @p oldId to @p newId.
+ */
+int
+SedDocument::renameSId(const std::string& oldId, const std::string& newId)
+{
+  if (!mElementIndex.isBuilt())
   {
-    return obj;
+    mElementIndex.build(this);
   }
 
-  obj = mOutputs.getElementBySId(id);
+  return mElementIndex.renameSId(oldId, newId);
+}
 
-  if (obj != NULL)
+
+/*
+ * Removes the element of this SedDocument with the given @p id and deletes it,
+ * together with every element that refers to it and, in turn, every element
+ * that refers to one of those.
+ */
+int
+SedDocument::removeWithReferrers(const std::string& id)
+{
+  if (!mElementIndex.isBuilt())
   {
-    return obj;
+    mElementIndex.build(this);
   }
 
-  obj = mStyles.getElementBySId(id);
+  return mElementIndex.removeWithReferrers(id);
+}
 
-  if (obj != NULL)
-  {
-    return obj;
-  }
 
-  return obj;
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the index of the identifiers and metaids of the elements of this
+ * SedDocument.
+ */
+SedElementIndex*
+SedDocument::getElementIndex()
+{
+  return &mElementIndex;
 }
 
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the arena the elements of this SedDocument are allocated from.
+ */
+SedArena*
+SedDocument::getArena()
+{
+  return &mArena;
+}
+
+/** @endcond */
+
 
 /*
  * Returns the value of the "Namespaces" element of this SedDocument.
@@ -2465,6 +2585,7 @@ SedDocument::getNamespaces() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 SedDocument::getNamespaces()
 {
+  mSedNamespaces = SedNamespaces::unshare(mSedNamespaces);
   return mSedNamespaces->getNamespaces();
 }
 
@@ -2662,18 +2783,17 @@ SedDocument::readAttributes(
   bool assigned = false;
   SedErrorLog* log = getErrorLog();
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlDocumentAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -2690,9 +2810,9 @@ SedDocument::readAttributes(
   if ( mIsSetLevel == false && log)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       std::string message = "Sedml attribute 'level' from the <SedDocument> "
         "element must be an integer.";
       log->logError(SedmlDocumentLevelMustBeNonNegativeInteger, level, version,
@@ -2717,9 +2837,9 @@ SedDocument::readAttributes(
   if ( mIsSetVersion == false && log)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       std::string message = "Sedml attribute 'version' from the <SedDocument> "
         "element must be an integer.";
       log->logError(SedmlDocumentVersionMustBeNonNegativeInteger, level,
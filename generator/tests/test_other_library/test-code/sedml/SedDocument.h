@@ -59,6 +59,8 @@
 #include <sedml/SedListOfOutputs.h>
 #include <sedml/SedListOfStyles.h>
 #include <sedml/SedErrorLog.h>
+#include <sedml/SedElementIndex.h>
+#include <sedml/SedArena.h>
 #include <sbml/common/libsbml-namespace.h>
 
 
@@ -83,6 +85,8 @@ protected:
   SedListOfOutputs mOutputs;
   SedListOfStyles mStyles;
   SedErrorLog mErrorLog;
+  SedElementIndex mElementIndex;
+  SedArena mArena;
 
   /** @endcond */
 
@@ -131,6 +135,28 @@ public:
   SedDocument& operator=(const SedDocument& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedDocument.
+   *
+   * @param orig the SedDocument instance to move; it is left as an empty
+   * SedDocument in the place it had.
+   */
+  SedDocument(SedDocument&& orig);
+
+
+  /**
+   * Move assignment operator for SedDocument.
+   *
+   * @param rhs the SedDocument object whose values are to be moved into this
+   * one; it is left as an empty SedDocument in the place it had.
+   */
+  SedDocument& operator=(SedDocument&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedDocument object.
    *
@@ -2385,6 +2411,104 @@ public:
   virtual SedBase* getElementBySId(const std::string& id);
 
 
+  /**
+   * Returns the first child element that has the given @p metaid, or @c NULL
+   * if no such object is found.
+   *
+   * @param metaid a string representing the metaid attribute of the object to
+   * retrieve.
+   *
+   * @return a pointer to the SedBase element with the given @p metaid. If no
+   * such object is found this method returns @c NULL.
+   */
+  virtual SedBase* getElementByMetaId(const std::string& metaid);
+
+
+  /**
+   * Returns the elements of this SedDocument that refer to the given @p id
+   * through one of their SIdRef attributes.
+   *
+   * @param id a string representing the identifier referred to.
+   *
+   * @return a List of the SedBase elements referring to @p id, each listed
+   * once.
+   *
+   * The references are looked up in an index of the document, so the cost
+   * depends on the number of referrers rather than on the size of the
+   * document.
+   *
+   * The caller owns the returned List (but not the elements in it) and is
+   * responsible for deleting it.
+   */
+  List* getReferrers(const std::string& id);
+
+
+  /**
+   * Changes the identifier of the element of this SedDocument with the
+   * identifier @p oldId to @p newId, and redirects every SIdRef attribute
+   * referring to @p oldId to @p newId.
+   *
+   * @param oldId a string representing the current identifier.
+   *
+   * @param newId a string representing the new identifier.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * Nothing is changed if another element already has the identifier @p newId.
+   */
+  int renameSId(const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Removes the element of this SedDocument with the given @p id and deletes
+   * it, together with every element that refers to it and, in turn, every
+   * element that refers to one of those.
+   *
+   * @param id a string representing the identifier of the element to remove.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * Only the identifiers of the removed elements themselves are followed;
+   * elements referring to an element nested inside a removed one are left in
+   * place.
+   */
+  int removeWithReferrers(const std::string& id);
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Returns the index of the identifiers and metaids of the elements of this
+   * SedDocument.
+   *
+   * @return a pointer to the SedElementIndex of this SedDocument.
+   */
+  SedElementIndex* getElementIndex();
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Returns the arena the elements of this SedDocument are allocated from.
+   *
+   * @return a pointer to the SedArena of this SedDocument.
+   */
+  SedArena* getArena();
+
+  /** @endcond */
+
+
   /**
    * Returns the value of the "Namespaces" element of this SedDocument.
    *
@@ -0,0 +1,657 @@
+/**
+ * @file SedElementIndex.cpp
+ * @brief Implementation of the SedElementIndex class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedElementIndex.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedBase.h>
+
+#include <algorithm>
+#include <set>
+
+
+/** @cond doxygenIgnored */
+using namespace std;
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+#ifdef __cplusplus
+
+/** @cond doxygenLibsedmlInternal */
+
+SedCounter SedElementIndex::mNumDestroyed(0);
+
+/*
+ * Creates a new, not yet built, SedElementIndex.
+ */
+SedElementIndex::SedElementIndex ()
+  : mIds()
+  , mMetaIds()
+  , mReferrers()
+  , mReferences()
+  , mBuilt (false)
+  , mBuilding (false)
+  , mAdding (false)
+  , mRemoving (false)
+  , mNumDuplicates (0)
+  , mEpoch (0)
+{
+}
+
+
+/*
+ * Copy constructor; the index refers to the elements of the original
+ * document so it is left to be rebuilt.
+ */
+SedElementIndex::SedElementIndex (const SedElementIndex& orig)
+  : mIds()
+  , mMetaIds()
+  , mReferrers()
+  , mReferences()
+  , mBuilt (false)
+  , mBuilding (false)
+  , mAdding (false)
+  , mRemoving (false)
+  , mNumDuplicates (0)
+  , mEpoch (0)
+{
+}
+
+
+/*
+ * Assignment operator
+ */
+SedElementIndex&
+SedElementIndex::operator=(const SedElementIndex& rhs)
+{
+  if (&rhs != this)
+  {
+    clear();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Destroys this SedElementIndex.
+ */
+SedElementIndex::~SedElementIndex ()
+{
+  ++mNumDestroyed;
+}
+
+
+/*
+ * @return true if the index can be used for lookups.
+ */
+bool
+SedElementIndex::isBuilt () const
+{
+  return mBuilt;
+}
+
+
+/*
+ * @return true while build() is populating the index.
+ */
+bool
+SedElementIndex::isBuilding () const
+{
+  return mBuilding;
+}
+
+
+/*
+ * Populates the index by walking the document once; every element
+ * reached by setSedDocument visits the index.
+ */
+void
+SedElementIndex::build (SedDocument* d)
+{
+  clear();
+
+  if (d == NULL) return;
+
+  mBuilt = true;
+  mBuilding = true;
+  d->setSedDocument(d);
+  mBuilding = false;
+}
+
+
+/*
+ * Empties the index and marks it as needing to be rebuilt.
+ */
+void
+SedElementIndex::clear ()
+{
+  mIds.clear();
+  mMetaIds.clear();
+  mReferrers.clear();
+  mReferences.clear();
+  mBuilt = false;
+  mBuilding = false;
+  mAdding = false;
+  mRemoving = false;
+  mNumDuplicates = 0;
+}
+
+
+/*
+ * Adds the identifier and metaid of the element.
+ */
+void
+SedElementIndex::add (SedBase* element)
+{
+  if (element == NULL) return;
+
+  insertEntry(mIds, element->getId(), element);
+  insertEntry(mMetaIds, element->getMetaId(), element);
+  addReferences(element);
+}
+
+
+/*
+ * Removes the identifier and metaid of the element.
+ */
+void
+SedElementIndex::remove (SedBase* element)
+{
+  if (element == NULL) return;
+
+  eraseEntry(mIds, element->getId(), element);
+  eraseEntry(mMetaIds, element->getMetaId(), element);
+  removeReferences(element);
+}
+
+
+/*
+ * Walks the subtree with setSedDocument so that each element adds itself.
+ * Unlike build() a clash with an element already indexed invalidates the
+ * index, as the order of the two in the document is not known.
+ */
+void
+SedElementIndex::addSubtree (SedBase* element)
+{
+  if (!mBuilt || element == NULL) return;
+
+  mAdding = true;
+  element->setSedDocument(element->getSedDocument());
+  mAdding = false;
+}
+
+
+/*
+ * Walks the subtree with setSedDocument so that each element removes
+ * itself.
+ */
+void
+SedElementIndex::removeSubtree (SedBase* element)
+{
+  if (!mBuilt || element == NULL) return;
+
+  mRemoving = true;
+  element->setSedDocument(element->getSedDocument());
+  mRemoving = false;
+}
+
+
+/*
+ * Adds or removes the element reached by the current walk, if any.
+ */
+void
+SedElementIndex::visit (SedBase* element)
+{
+  if (mBuilding || mAdding)
+  {
+    add(element);
+  }
+  else if (mRemoving)
+  {
+    remove(element);
+  }
+}
+
+
+/*
+ * Returns the epoch of the document.
+ */
+unsigned long
+SedElementIndex::getEpoch () const
+{
+  return mEpoch;
+}
+
+
+/*
+ * Advances the epoch of the document.
+ */
+void
+SedElementIndex::advanceEpoch ()
+{
+  ++mEpoch;
+}
+
+
+/*
+ * Returns the number of indices destroyed so far.
+ */
+unsigned long
+SedElementIndex::getNumDestroyed ()
+{
+  return mNumDestroyed;
+}
+
+
+/*
+ * Moves the element from its old identifier to the new one.
+ */
+void
+SedElementIndex::updateId (SedBase* element, const std::string& oldId,
+                            const std::string& newId)
+{
+  if (oldId == newId) return;
+
+  eraseEntry(mIds, oldId, element);
+  insertEntry(mIds, newId, element);
+}
+
+
+/*
+ * Moves the element from its old metaid to the new one.
+ */
+void
+SedElementIndex::updateMetaId (SedBase* element, const std::string& oldMetaId,
+                                const std::string& newMetaId)
+{
+  if (oldMetaId == newMetaId) return;
+
+  eraseEntry(mMetaIds, oldMetaId, element);
+  insertEntry(mMetaIds, newMetaId, element);
+}
+
+
+/*
+ * Moves the element from the referrers of its old reference to those of
+ * the new one.
+ */
+void
+SedElementIndex::updateReference (SedBase* element,
+                                   const std::string& attributeName,
+                                   const std::string& oldRef,
+                                   const std::string& newRef)
+{
+  if (oldRef == newRef) return;
+
+  eraseReference(element, attributeName, oldRef);
+  addReference(element, attributeName, newRef);
+}
+
+
+/*
+ * Records the references made by the SIdRef attributes of the element.
+ */
+void
+SedElementIndex::addReferences (SedBase* element)
+{
+  if (!mBuilt || element == NULL) return;
+
+  std::vector<std::string> attributes;
+  element->addReferenceAttributes(attributes);
+
+  std::string ref;
+  for (std::vector<std::string>::const_iterator it = attributes.begin();
+       it != attributes.end(); ++it)
+  {
+    if (element->getAttribute(*it, ref) == LIBSEDML_OPERATION_SUCCESS)
+    {
+      addReference(element, *it, ref);
+    }
+  }
+}
+
+
+/*
+ * @return the element with the given identifier or NULL.
+ */
+SedBase*
+SedElementIndex::getElementBySId (const std::string& id) const
+{
+  if (!mBuilt || id.empty()) return NULL;
+
+  ElementMap::const_iterator found = mIds.find(id);
+
+  return (found == mIds.end()) ? NULL : found->second;
+}
+
+
+/*
+ * @return the element with the given metaid or NULL.
+ */
+SedBase*
+SedElementIndex::getElementByMetaId (const std::string& metaid) const
+{
+  if (!mBuilt || metaid.empty()) return NULL;
+
+  ElementMap::const_iterator found = mMetaIds.find(metaid);
+
+  return (found == mMetaIds.end()) ? NULL : found->second;
+}
+
+
+/*
+ * @return the elements referring to the identifier; the caller owns the
+ * List.
+ */
+List*
+SedElementIndex::getReferrers (const std::string& id) const
+{
+  List* ret = new List();
+  if (!mBuilt || id.empty()) return ret;
+
+  ReferrerMap::const_iterator found = mReferrers.find(id);
+  if (found == mReferrers.end()) return ret;
+
+  // an element referring to the identifier through several attributes is
+  // only listed once
+  std::set<const SedBase*> listed;
+  for (std::vector<Referrer>::const_iterator it = found->second.begin();
+       it != found->second.end(); ++it)
+  {
+    if (listed.insert(it->first).second)
+    {
+      ret->add(it->first);
+    }
+  }
+
+  return ret;
+}
+
+
+/*
+ * Renames the element and redirects the references to it.  The referrers
+ * are copied first: setting the identifier may invalidate the index, and
+ * setting their attributes updates it.
+ */
+int
+SedElementIndex::renameSId (const std::string& oldId,
+                             const std::string& newId)
+{
+  if (oldId.empty() || newId.empty())
+  {
+    return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
+  }
+  else if (oldId == newId)
+  {
+    return LIBSEDML_OPERATION_SUCCESS;
+  }
+  else if (getElementBySId(newId) != NULL)
+  {
+    return LIBSEDML_DUPLICATE_OBJECT_ID;
+  }
+
+  std::vector<Referrer> referrers;
+  ReferrerMap::const_iterator found = mReferrers.find(oldId);
+  if (found != mReferrers.end())
+  {
+    referrers = found->second;
+  }
+
+  SedBase* element = getElementBySId(oldId);
+  if (element != NULL)
+  {
+    int success = element->setId(newId);
+    if (success != LIBSEDML_OPERATION_SUCCESS) return success;
+  }
+
+  int success = LIBSEDML_OPERATION_SUCCESS;
+  for (std::vector<Referrer>::const_iterator it = referrers.begin();
+       it != referrers.end(); ++it)
+  {
+    if (it->first->setAttribute(it->second, newId) != LIBSEDML_OPERATION_SUCCESS)
+    {
+      success = LIBSEDML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return success;
+}
+
+
+/*
+ * Removes the element and, transitively, the elements referring to it.
+ */
+int
+SedElementIndex::removeWithReferrers (const std::string& id)
+{
+  SedBase* element = getElementBySId(id);
+  if (element == NULL) return LIBSEDML_INVALID_OBJECT;
+
+  std::vector<SedBase*> doomed(1, element);
+  std::set<SedBase*> seen;
+  seen.insert(element);
+
+  for (size_t i = 0; i < doomed.size(); ++i)
+  {
+    const std::string& doomedId = doomed[i]->getId();
+    if (doomedId.empty()) continue;
+
+    ReferrerMap::const_iterator found = mReferrers.find(doomedId);
+    if (found == mReferrers.end()) continue;
+
+    for (std::vector<Referrer>::const_iterator it = found->second.begin();
+         it != found->second.end(); ++it)
+    {
+      if (seen.insert(it->first).second)
+      {
+        doomed.push_back(it->first);
+      }
+    }
+  }
+
+  // an element inside another one that is removed goes along with it
+  std::vector<SedBase*> removed;
+  for (std::vector<SedBase*>::const_iterator it = doomed.begin();
+       it != doomed.end(); ++it)
+  {
+    bool nested = false;
+    for (SedBase* parent = (*it)->getParentSedObject();
+         parent != NULL && !nested; parent = parent->getParentSedObject())
+    {
+      nested = (seen.find(parent) != seen.end());
+    }
+
+    if (!nested)
+    {
+      removed.push_back(*it);
+    }
+  }
+
+  int success = LIBSEDML_OPERATION_SUCCESS;
+  for (std::vector<SedBase*>::const_iterator it = removed.begin();
+       it != removed.end(); ++it)
+  {
+    if ((*it)->removeFromParentAndDelete() != LIBSEDML_OPERATION_SUCCESS)
+    {
+      success = LIBSEDML_OPERATION_FAILED;
+    }
+  }
+
+  return success;
+}
+
+
+/*
+ * Records the element against the key.  While building, the first element
+ * in document order keeps the key; afterwards a clash means the order can
+ * no longer be relied upon and the index is invalidated.
+ */
+void
+SedElementIndex::insertEntry (ElementMap& map, const std::string& key,
+                               SedBase* element)
+{
+  if (!mBuilt || key.empty()) return;
+
+  ElementMap::iterator found = map.find(key);
+
+  if (found == map.end())
+  {
+    map[key] = element;
+  }
+  else if (found->second != element)
+  {
+    if (mBuilding)
+    {
+      ++mNumDuplicates;
+    }
+    else
+    {
+      clear();
+    }
+  }
+}
+
+
+/*
+ * Removes the key if it refers to the element.  If duplicates were seen
+ * another element may be entitled to the key, so the index is invalidated.
+ */
+void
+SedElementIndex::eraseEntry (ElementMap& map, const std::string& key,
+                              SedBase* element)
+{
+  if (!mBuilt || key.empty()) return;
+
+  ElementMap::iterator found = map.find(key);
+
+  if (found == map.end() || found->second != element) return;
+
+  if (mNumDuplicates > 0)
+  {
+    clear();
+  }
+  else
+  {
+    map.erase(found);
+  }
+}
+
+
+/*
+ * Records that the attribute of the element refers to the identifier.
+ */
+void
+SedElementIndex::addReference (SedBase* element,
+                                const std::string& attributeName,
+                                const std::string& ref)
+{
+  if (!mBuilt || ref.empty()) return;
+
+  mReferrers[ref].push_back(Referrer(element, attributeName));
+  mReferences[element].push_back(Reference(attributeName, ref));
+}
+
+
+/*
+ * Forgets that the attribute of the element refers to the identifier.
+ */
+void
+SedElementIndex::eraseReference (SedBase* element,
+                                  const std::string& attributeName,
+                                  const std::string& ref)
+{
+  if (!mBuilt || ref.empty()) return;
+
+  ReferrerMap::iterator referrers = mReferrers.find(ref);
+  if (referrers != mReferrers.end())
+  {
+    std::vector<Referrer>::iterator found =
+      std::find(referrers->second.begin(), referrers->second.end(),
+                Referrer(element, attributeName));
+    if (found != referrers->second.end())
+    {
+      referrers->second.erase(found);
+    }
+    if (referrers->second.empty())
+    {
+      mReferrers.erase(referrers);
+    }
+  }
+
+  ReferenceMap::iterator references = mReferences.find(element);
+  if (references != mReferences.end())
+  {
+    std::vector<Reference>::iterator found =
+      std::find(references->second.begin(), references->second.end(),
+                Reference(attributeName, ref));
+    if (found != references->second.end())
+    {
+      references->second.erase(found);
+    }
+    if (references->second.empty())
+    {
+      mReferences.erase(references);
+    }
+  }
+}
+
+
+/*
+ * Forgets all the references made by the element.  They are taken from
+ * the index rather than from the element as this is also called while the
+ * element is being destroyed.
+ */
+void
+SedElementIndex::removeReferences (SedBase* element)
+{
+  if (!mBuilt) return;
+
+  ReferenceMap::iterator references = mReferences.find(element);
+  if (references == mReferences.end()) return;
+
+  std::vector<Reference> made = references->second;
+  for (std::vector<Reference>::const_iterator it = made.begin();
+       it != made.end(); ++it)
+  {
+    eraseReference(element, it->first, it->second);
+  }
+}
+
+/** @endcond */
+
+#endif  /* __cplusplus */
+
+LIBSEDML_CPP_NAMESPACE_END
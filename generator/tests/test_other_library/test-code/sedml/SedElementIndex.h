@@ -0,0 +1,349 @@
+/**
+ * @file SedElementIndex.h
+ * @brief Definition of the SedElementIndex class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedElementIndex
+ * @sbmlbrief{} TODO:Definition of the SedElementIndex class.
+ */
+
+
+#ifndef SedElementIndex_h
+#define SedElementIndex_h
+
+
+#include <sedml/common/extern.h>
+#include <sedml/SedBase.h>
+
+
+#ifdef __cplusplus
+
+#include <string>
+#include <utility>
+#include <vector>
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+class SedDocument;
+
+/** @cond doxygenLibsedmlInternal */
+
+/**
+ * Index of the identifiers and metaids of all the elements of a
+ * SedDocument, and of the references made to identifiers by their SIdRef
+ * attributes.
+ *
+ * The index is built lazily on the first lookup by walking the document
+ * once, and is then kept up to date by the elements themselves as their
+ * identifiers and references change and as they are attached to or
+ * detached from the document.  Until it is built, attaching or detaching
+ * an element does not need to visit the elements below it.  Where two elements share an identifier the
+ * first one in document order is returned; any change that could alter
+ * which element comes first simply invalidates the index so that the next
+ * lookup rebuilds it.
+ *
+ * The references form a reverse graph from each identifier to the
+ * elements referring to it, so that renaming or deleting an element only
+ * touches the elements that actually refer to it.
+ */
+class LIBSEDML_EXTERN SedElementIndex
+{
+public:
+
+  /**
+   * Creates a new, not yet built, SedElementIndex.
+   */
+  SedElementIndex ();
+
+
+  /**
+   * Copy constructor; the index is not copied as it refers to the
+   * elements of another document.
+   */
+  SedElementIndex (const SedElementIndex& orig);
+
+
+  /**
+   * Assignment operator; the index is invalidated rather than copied.
+   */
+  SedElementIndex& operator=(const SedElementIndex& rhs);
+
+
+  /**
+   * Destroys this SedElementIndex.
+   */
+  virtual ~SedElementIndex ();
+
+
+  /**
+   * Predicate returning @c true if the index has been built and can be
+   * used for lookups.
+   */
+  bool isBuilt () const;
+
+
+  /**
+   * Predicate returning @c true while the index is being populated
+   * by build().
+   */
+  bool isBuilding () const;
+
+
+  /**
+   * Populates the index with all the elements of the given document.
+   *
+   * @param d the SedDocument whose elements are to be indexed.
+   */
+  void build (SedDocument* d);
+
+
+  /**
+   * Empties the index and marks it as needing to be rebuilt.
+   */
+  void clear ();
+
+
+  /**
+   * Adds the identifier and metaid of the given element to the index.
+   *
+   * @param element the SedBase object to add.
+   */
+  void add (SedBase* element);
+
+
+  /**
+   * Removes the identifier and metaid of the given element from the index.
+   *
+   * @param element the SedBase object to remove.
+   */
+  void remove (SedBase* element);
+
+
+  /**
+   * Adds the given element and all the elements below it to the index,
+   * when the element has just been attached to the document.  Does nothing
+   * if the index has not been built.
+   *
+   * @param element the SedBase object at the root of the subtree to add.
+   */
+  void addSubtree (SedBase* element);
+
+
+  /**
+   * Removes the given element and all the elements below it from the
+   * index, when the element is about to be detached from the document.
+   * Does nothing if the index has not been built.
+   *
+   * @param element the SedBase object at the root of the subtree to remove.
+   */
+  void removeSubtree (SedBase* element);
+
+
+  /**
+   * Called by each element reached while the document walks its elements
+   * (see build(), addSubtree() and removeSubtree()) to add or remove it as
+   * the walk requires; does nothing outside such a walk.
+   *
+   * @param element the SedBase object reached.
+   */
+  void visit (SedBase* element);
+
+
+  /**
+   * Returns the epoch of the document.  It is advanced whenever an element
+   * that may have passed the document on to the elements below it leaves
+   * the document, so that those elements derive their document again.
+   */
+  unsigned long getEpoch () const;
+
+
+  /**
+   * Advances the epoch of the document (see getEpoch()).
+   */
+  void advanceEpoch ();
+
+
+  /**
+   * Returns the number of indices, and so of documents, destroyed so far.
+   * A document cached by an element can still be read while this is
+   * unchanged.
+   */
+  static unsigned long getNumDestroyed ();
+
+
+  /**
+   * Informs the index that the identifier of the given element is
+   * changing from @p oldId to @p newId.
+   */
+  void updateId (SedBase* element, const std::string& oldId,
+                 const std::string& newId);
+
+
+  /**
+   * Informs the index that the metaid of the given element is
+   * changing from @p oldMetaId to @p newMetaId.
+   */
+  void updateMetaId (SedBase* element, const std::string& oldMetaId,
+                     const std::string& newMetaId);
+
+
+  /**
+   * Informs the index that the SIdRef attribute @p attributeName of the
+   * given element is changing from @p oldRef to @p newRef.
+   */
+  void updateReference (SedBase* element, const std::string& attributeName,
+                        const std::string& oldRef,
+                        const std::string& newRef);
+
+
+  /**
+   * Adds the references made by the SIdRef attributes of the given
+   * element to the index.  Used when the attributes of an element have
+   * been read without going through its setters.
+   *
+   * @param element the SedBase object whose references are to be added.
+   */
+  void addReferences (SedBase* element);
+
+
+  /**
+   * Returns the element with the given identifier, or @c NULL if
+   * there is none.
+   */
+  SedBase* getElementBySId (const std::string& id) const;
+
+
+  /**
+   * Returns the elements that refer to the given identifier through one
+   * of their SIdRef attributes.
+   *
+   * @return a List of the referring elements, each listed once.  The
+   * caller owns the List (but not the elements in it) and is responsible
+   * for deleting it.
+   */
+  List* getReferrers (const std::string& id) const;
+
+
+  /**
+   * Changes the identifier of the element with the identifier @p oldId to
+   * @p newId, and updates every SIdRef attribute that referred to @p oldId
+   * to refer to @p newId instead.  Nothing is changed if another element
+   * already has the identifier @p newId.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   */
+  int renameSId (const std::string& oldId, const std::string& newId);
+
+
+  /**
+   * Removes the element with the given identifier from the document and
+   * deletes it, together with every element that refers to it and, in
+   * turn, every element that refers to one of those.
+   *
+   * Only the identifiers of the removed elements themselves are followed;
+   * elements that refer to an element nested inside a removed one are
+   * left in place.  Each element is removed with
+   * SedBase::removeFromParentAndDelete(), so an element that its parent
+   * requires (and will not give up) stays and the removal fails.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int removeWithReferrers (const std::string& id);
+
+
+  /**
+   * Returns the element with the given metaid, or @c NULL if
+   * there is none.
+   */
+  SedBase* getElementByMetaId (const std::string& metaid) const;
+
+
+protected:
+
+#ifdef LIBSEDML_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, SedBase*> ElementMap;
+#else
+  typedef std::map<std::string, SedBase*> ElementMap;
+#endif
+
+  // an element referring to an identifier, and the attribute it uses
+  typedef std::pair<SedBase*, std::string> Referrer;
+  // an attribute of an element, and the identifier it refers to
+  typedef std::pair<std::string, std::string> Reference;
+
+#ifdef LIBSEDML_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, std::vector<Referrer> > ReferrerMap;
+  typedef std::unordered_map<const SedBase*, std::vector<Reference> > ReferenceMap;
+#else
+  typedef std::map<std::string, std::vector<Referrer> > ReferrerMap;
+  typedef std::map<const SedBase*, std::vector<Reference> > ReferenceMap;
+#endif
+
+  void insertEntry (ElementMap& map, const std::string& key,
+                    SedBase* element);
+
+  void eraseEntry (ElementMap& map, const std::string& key,
+                   SedBase* element);
+
+  void addReference (SedBase* element, const std::string& attributeName,
+                     const std::string& ref);
+
+  void eraseReference (SedBase* element, const std::string& attributeName,
+                       const std::string& ref);
+
+  void removeReferences (SedBase* element);
+
+
+  ElementMap mIds;
+  ElementMap mMetaIds;
+  ReferrerMap mReferrers;
+  ReferenceMap mReferences;
+  bool mBuilt;
+  bool mBuilding;
+  bool mAdding;
+  bool mRemoving;
+  unsigned int mNumDuplicates;
+  SedCounter mEpoch;
+  static SedCounter mNumDestroyed;
+};
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_END
+
+#endif  /* __cplusplus */
+#endif  /* SedElementIndex_h */
@@ -37,6 +37,7 @@
 #include <functional>
 #include <string>
 #include <list>
+#include <map>
 
 #include <sbml/xml/XMLToken.h>
 #include <sbml/xml/XMLParser.h>
@@ -60,6 +61,11 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  * Creates a new empty SedErrorLog.
  */
 SedErrorLog::SedErrorLog ()
+  : mSeverityIndex ()
+  , mIdCounts ()
+  , mNumIndexed (0)
+  , mGeneration (0)
+  , mIndexedGeneration (0)
 {
 }
 
@@ -68,6 +74,11 @@ SedErrorLog::SedErrorLog ()
 */
 SedErrorLog::SedErrorLog (const SedErrorLog& other)
   : XMLErrorLog(other)
+  , mSeverityIndex ()
+  , mIdCounts ()
+  , mNumIndexed (0)
+  , mGeneration (0)
+  , mIndexedGeneration (0)
 {
 }
 
@@ -77,6 +88,7 @@ SedErrorLog::SedErrorLog (const SedErrorLog& other)
 SedErrorLog& SedErrorLog::operator=(const SedErrorLog& other)
 {
   XMLErrorLog::operator=(other);
+  ++mGeneration;
   return *this;
 }
 
@@ -192,6 +204,8 @@ private:
 void
 SedErrorLog::remove (const unsigned int errorId)
 {
+  if (!contains(errorId)) return;
+
   vector<XMLError*>::iterator delIter;
 
   // finds an item with the given errorId (the first item will be found if
@@ -200,71 +214,65 @@ SedErrorLog::remove (const unsigned int errorId)
 
   if ( delIter != mErrors.end() )
   {
-    // deletes (invoke delete operator for the matched item) and erases (removes
-    // the pointer from mErrors) the matched item (if any)
-    delete *delIter;
-    mErrors.erase(delIter);
+    removeError(delIter);
   }
 }
 
 void
 SedErrorLog::removeAll (const unsigned int errorId)
 {
-  vector<XMLError*>::iterator delIter;
+  if (!contains(errorId)) return;
 
-  // finds an item with the given errorId (the first item will be found if
-  // there are two or more items with the same Id)
-  delIter = find_if(mErrors.begin(), mErrors.end(), MatchErrorId(errorId));
-
-  while ( delIter != mErrors.end() )
-  {
-    // deletes (invoke delete operator for the matched item) and erases (removes
-    // the pointer from mErrors) the matched item (if any)
-    delete *delIter;
-    mErrors.erase(delIter);
-
-    delIter = find_if(mErrors.begin(), mErrors.end(), MatchErrorId(errorId));
-  }
+  removeIf(MatchErrorId(errorId));
 }
 
 
 bool
 SedErrorLog::contains (const unsigned int errorId) const
 {
-  vector<XMLError*>::const_iterator iter;
+  updateIndex();
 
-  // finds an item with the given errorId (the first item will be found if
-  // there are two or more items with the same Id)
-  iter = find_if(mErrors.begin(), mErrors.end(), MatchErrorId(errorId));
+  map<unsigned int, unsigned int>::const_iterator found;
+  found = mIdCounts.find(errorId);
 
-  if ( iter != mErrors.end() )
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
+  return found != mIdCounts.end() && found->second > 0;
 }
 
 
 /*
- * Helper class used by
- * SedErrorLog::getNumFailsWithSeverity(SedErrorSeverity_t).
+ * Removes the first error having errorId logged at or after position
+ * start, so that only the errors logged since then are searched.
  */
-class MatchSeverity
+void
+SedErrorLog::remove (const unsigned int errorId, unsigned int start)
 {
-public:
-  MatchSeverity(const unsigned int s) : severity(s) {};
+  if (start >= mErrors.size()) return;
 
-  bool operator() (XMLError* e) const
+  vector<XMLError*>::iterator delIter;
+
+  delIter = find_if(mErrors.begin() + start, mErrors.end(),
+                    MatchErrorId(errorId));
+
+  if ( delIter != mErrors.end() )
   {
-    return e->getSeverity() == severity;
-  };
+    removeError(delIter);
+  }
+}
+
+
+bool
+SedErrorLog::contains (const unsigned int errorId, unsigned int start) const
+{
+  if (start >= mErrors.size()) return false;
+
+  vector<XMLError*>::const_iterator iter;
+
+  iter = find_if(mErrors.begin() + start, mErrors.end(),
+                 MatchErrorId(errorId));
+
+  return iter != mErrors.end();
+}
 
-private:
-  unsigned int severity;
-};
 
 /** @endcond */
 
@@ -272,16 +280,12 @@ private:
 unsigned int 
 SedErrorLog::getNumFailsWithSeverity(unsigned int severity) const
 {
-  unsigned int n = 0;
+  updateIndex();
 
-#if defined(__SUNPRO_CC)
-  // Workaround for Sun cc which is missing:
-  count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity), n);
-#else
-  n = (unsigned int)count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity));
-#endif
+  map<unsigned int, vector<unsigned int> >::const_iterator found;
+  found = mSeverityIndex.find(severity);
 
-  return n;
+  return (found == mSeverityIndex.end()) ? 0 : (unsigned int)found->second.size();
 }
 
 
@@ -291,16 +295,7 @@ SedErrorLog::getNumFailsWithSeverity(unsigned int severity) const
 unsigned int
 SedErrorLog::getNumFailsWithSeverity(unsigned int severity)
 {
-  unsigned int n = 0;
-
-#if defined(__SUNPRO_CC)
-  // Workaround for Sun cc which is missing:
-  count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity), n);
-#else
-  n = (unsigned int)count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity));
-#endif
-
-  return n;
+  return static_cast<const SedErrorLog*>(this)->getNumFailsWithSeverity(severity);
 }
 
 
@@ -329,19 +324,128 @@ SedErrorLog::getError (unsigned int n) const
 const SedError*
 SedErrorLog::getErrorWithSeverity(unsigned int n, unsigned int severity) const
 {
-  unsigned int count = 0;
-  MatchSeverity matcher(severity);
-  std::vector<XMLError*>::const_iterator it = mErrors.begin();
-  for (; it != mErrors.end(); ++it)
+  updateIndex();
+
+  map<unsigned int, vector<unsigned int> >::const_iterator found;
+  found = mSeverityIndex.find(severity);
+
+  if (found == mSeverityIndex.end() || n >= found->second.size())
   {
-    if (matcher(*it))
+    return NULL;
+  }
+
+  return dynamic_cast<const SedError*>(mErrors[found->second[n]]);
+}
+
+
+/*
+ * Deletes all errors from this log.
+ */
+void
+SedErrorLog::clearLog ()
+{
+  XMLErrorLog::clearLog();
+  ++mGeneration;
+}
+
+
+/*
+ * Changes the severity of all errors of originalSeverity to
+ * targetSeverity.
+ */
+void
+SedErrorLog::changeErrorSeverity (XMLErrorSeverity_t originalSeverity,
+                                   XMLErrorSeverity_t targetSeverity,
+                                   const std::string& package)
+{
+  XMLErrorLog::changeErrorSeverity(originalSeverity, targetSeverity, package);
+  ++mGeneration;
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Brings the index up to date with mErrors.  Errors may also have been
+ * added through XMLErrorLog, for example by the XML parser, so rather than
+ * being maintained by every addition the index is extended to cover any
+ * new errors whenever it is used.
+ *
+ * Every other change made through this class advances mGeneration, which
+ * discards the index.  The other mutators of XMLErrorLog are not virtual
+ * and cannot be seen from here: a log shortened through them is caught by
+ * its size, but one cleared and refilled, or whose severities were
+ * changed, through an XMLErrorLog pointer is not.  Such changes must be
+ * made through this class.
+ */
+void
+SedErrorLog::updateIndex () const
+{
+  if (mIndexedGeneration != mGeneration || mNumIndexed > mErrors.size())
+  {
+    clearIndex();
+  }
+
+  for (; mNumIndexed < mErrors.size(); ++mNumIndexed)
+  {
+    const XMLError* error = mErrors[mNumIndexed];
+
+    mSeverityIndex[error->getSeverity()].push_back(mNumIndexed);
+    ++mIdCounts[error->getErrorId()];
+  }
+}
+
+
+/*
+ * Empties the index; it is rebuilt on its next use.
+ */
+void
+SedErrorLog::clearIndex () const
+{
+  mSeverityIndex.clear();
+  mIdCounts.clear();
+  mNumIndexed = 0;
+  mIndexedGeneration = mGeneration;
+}
+
+
+/*
+ * Deletes the given error and removes it from the log, taking it out of
+ * the index rather than discarding the index.
+ */
+void
+SedErrorLog::removeError (std::vector<XMLError*>::iterator error)
+{
+  updateIndex();
+
+  unsigned int position = (unsigned int)(error - mErrors.begin());
+
+  --mIdCounts[(*error)->getErrorId()];
+
+  // the errors after the one removed each move down one place
+  map<unsigned int, vector<unsigned int> >::iterator it;
+  for (it = mSeverityIndex.begin(); it != mSeverityIndex.end(); ++it)
+  {
+    vector<unsigned int>& positions = it->second;
+    vector<unsigned int>::iterator pos =
+      lower_bound(positions.begin(), positions.end(), position);
+
+    if (pos != positions.end() && *pos == position)
     {
-      if (count == n) return dynamic_cast<const SedError*>(*it);
-      ++count;
+      pos = positions.erase(pos);
+    }
+
+    for (; pos != positions.end(); ++pos)
+    {
+      --*pos;
     }
   }
-  return NULL;
+
+  delete *error;
+  mErrors.erase(error);
+
+  --mNumIndexed;
 }
+/** @endcond */
 
 #endif /* __cplusplus */
 
@@ -112,6 +112,32 @@ static const sedmlErrorTableEntry sedmlErrorTable[] =
     }
   },
 
+  // 10101
+  { SedmlNSUndeclared,
+    "The Sedml namespace is not correctly declared.",
+    LIBSEDML_CAT_GENERAL_CONSISTENCY,
+    LIBSEDML_SEV_ERROR,
+    "To conform to the Package specification for SBML Level 1 Version 1, an "
+    "SBML document must declare "
+    "'http://www.sbml.org/sbml/level1/version1/sedml/version1' as the "
+    "XMLNamespace to use for elements of this package.",
+    { "L3V1 Sedml V1 Section 3.1"
+    }
+  },
+
+  // 10102
+  { SedmlElementNotInNs,
+    "Element not in Sedml namespace",
+    LIBSEDML_CAT_GENERAL_CONSISTENCY,
+    LIBSEDML_SEV_ERROR,
+    "Wherever they appear in an SBML document, elements and attributes from the "
+    "Package must use the "
+    "'http://www.sbml.org/sbml/level1/version1/sedml/version1' namespace, "
+    "declaring so either explicitly or implicitly.",
+    { "L3V1 Sedml V1 Section 3.1"
+    }
+  },
+
   //10201
   {
     SedInvalidMathElement,
@@ -125,6 +151,39 @@ static const sedmlErrorTableEntry sedmlErrorTable[] =
     }
   },
 
+  // 10301
+  { SedmlDuplicateComponentId,
+    "Duplicate 'id' attribute value",
+    LIBSEDML_CAT_GENERAL_CONSISTENCY,
+    LIBSEDML_SEV_ERROR,
+    "(Extends validation rule #10301 in the SBML Level 3 Core specification. TO "
+    "DO list scope of ids)",
+    { "L3V1 Sedml V1 Section"
+    }
+  },
+
+  // 10302
+  { SedmlIdSyntaxRule,
+    "Invalid SId syntax",
+    LIBSEDML_CAT_GENERAL_CONSISTENCY,
+    LIBSEDML_SEV_ERROR,
+    "The value of a 'sedml:id' must conform to the syntax of the <sbml> data "
+    "type 'SId'",
+    { "L3V1 Sedml V1 Section"
+    }
+  },
+
+  // 10303
+  { SedInvalidMetaidSyntax,
+    "Invalid SId syntax",
+    LIBSEDML_CAT_GENERAL_CONSISTENCY,
+    LIBSEDML_SEV_ERROR,
+    "The value of a 'sedml:metaid' must conform to the syntax of the XML Type "
+    "ID",
+    { "L3V1 Sedml V1 Section"
+    }
+  },
+
   //10401
   {
     SedMissingAnnotationNamespace,
@@ -232,69 +291,6 @@ static const sedmlErrorTableEntry sedmlErrorTable[] =
     }
   },
 
-  /* --------------------------------------------------------------------------
-   * Boundary marker.  SEDML specific errors.
-   * ----------------------------------------------------------------------- */
-
-  // 10101
-  { SedmlNSUndeclared,
-    "The Sedml namespace is not correctly declared.",
-    LIBSEDML_CAT_GENERAL_CONSISTENCY,
-    LIBSEDML_SEV_ERROR,
-    "To conform to the Package specification for SBML Level 1 Version 1, an "
-    "SBML document must declare "
-    "'http://www.sbml.org/sbml/level1/version1/sedml/version1' as the "
-    "XMLNamespace to use for elements of this package.",
-    { "L3V1 Sedml V1 Section 3.1"
-    }
-  },
-
-  // 10102
-  { SedmlElementNotInNs,
-    "Element not in Sedml namespace",
-    LIBSEDML_CAT_GENERAL_CONSISTENCY,
-    LIBSEDML_SEV_ERROR,
-    "Wherever they appear in an SBML document, elements and attributes from the "
-    "Package must use the "
-    "'http://www.sbml.org/sbml/level1/version1/sedml/version1' namespace, "
-    "declaring so either explicitly or implicitly.",
-    { "L3V1 Sedml V1 Section 3.1"
-    }
-  },
-
-  // 10301
-  { SedmlDuplicateComponentId,
-    "Duplicate 'id' attribute value",
-    LIBSEDML_CAT_GENERAL_CONSISTENCY,
-    LIBSEDML_SEV_ERROR,
-    "(Extends validation rule #10301 in the SBML Level 3 Core specification. TO "
-    "DO list scope of ids)",
-    { "L3V1 Sedml V1 Section"
-    }
-  },
-
-  // 10302
-  { SedmlIdSyntaxRule,
-    "Invalid SId syntax",
-    LIBSEDML_CAT_GENERAL_CONSISTENCY,
-    LIBSEDML_SEV_ERROR,
-    "The value of a 'sedml:id' must conform to the syntax of the <sbml> data "
-    "type 'SId'",
-    { "L3V1 Sedml V1 Section"
-    }
-  },
-
-  // 10303
-  { SedInvalidMetaidSyntax,
-    "Invalid SId syntax",
-    LIBSEDML_CAT_GENERAL_CONSISTENCY,
-    LIBSEDML_SEV_ERROR,
-    "The value of a 'sedml:metaid' must conform to the syntax of the XML Type "
-    "ID",
-    { "L3V1 Sedml V1 Section"
-    }
-  },
-
   // 20101
   { InvalidNamespaceOnSed,
     "Invalid namespace",
@@ -4773,10 +4769,6 @@ static const sedmlErrorTableEntry sedmlErrorTable[] =
     }
   },
 
-  /* --------------------------------------------------------------------------
-   * Boundary marker.  Application-specific codes should begin at 100000.
-   * ----------------------------------------------------------------------- */
-
   //99994
   {
     SedUnknownCoreAttribute,
@@ -4797,7 +4789,8 @@ static const sedmlErrorTableEntry sedmlErrorTable[] =
     "Application-specific codes should begin at 100000.", 
     {""
     }
-   }
+   },
+
 };
 
 LIBSEDML_CPP_NAMESPACE_END
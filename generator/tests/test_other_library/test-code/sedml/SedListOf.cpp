@@ -37,6 +37,7 @@
 #include <functional>
 
 #include <sedml/SedVisitor.h>
+#include <sedml/SedElementIndex.h>
 #include <sedml/SedListOf.h>
 #include <sedml/common/common.h>
 
@@ -54,6 +55,12 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  */
 SedListOf::SedListOf (unsigned int level, unsigned int version)
 : SedBase(level,version)
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SedConstructorException();
@@ -65,6 +72,12 @@ SedListOf::SedListOf (unsigned int level, unsigned int version)
  */
 SedListOf::SedListOf (SedNamespaces* sedmlns)
 : SedBase(sedmlns)
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SedConstructorException();
@@ -80,11 +93,48 @@ struct Delete : public unary_function<SedBase*, void>
 };
 
 
+/**
+ * Used by SedListOf::setSedDocument().
+ */
+struct SetSedDocument : public unary_function<SedBase*, void>
+{
+  SedDocument* d;
+
+  SetSedDocument (SedDocument* d) : d(d) { }
+  void operator() (SedBase* sbase) { sbase->setSedDocument(d); }
+};
+
+
+/**
+ * Used by SedListOf::connectToChild().
+ */
+struct SetParentSedObject : public unary_function<SedBase*, void>
+{
+  SedBase* sb;
+
+  SetParentSedObject (SedBase *sb) : sb(sb) { }
+  void operator() (SedBase* sbase) { sbase->connectToParent(sb); }
+};
+
+
+/**
+ * Used by SedListOf::clear() when the items are handed over to the caller.
+ */
+struct ReleaseFromParent : public unary_function<SedBase*, void>
+{
+  void operator() (SedBase* sbase) { sbase->releaseFromParent(); }
+};
+
+
 /*
  * Destroys the given SedListOf and its constituent items.
  */
 SedListOf::~SedListOf ()
 {
+  // rather than have the SedListOf objects sharing the items copy them, give
+  // the items to one of them
+  stopSharing();
+  handOverItems();
   for_each( mItems.begin(), mItems.end(), Delete() );
 }
 
@@ -102,9 +152,30 @@ struct Clone : public unary_function<SedBase*, SedBase*>
  * Copy constructor. Creates a copy of this SedListOf items.
  */
 SedListOf::SedListOf (const SedListOf& orig) : SedBase(orig), mItems()
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
 {
-  mItems.resize( orig.size() );
-  transform( orig.mItems.begin(), orig.mItems.end(), mItems.begin(), Clone() );
+  // a SedListOf still sharing the items of another is copied from that one
+  const SedListOf& source =
+    (orig.mSharedSource != NULL) ? *orig.mSharedSource : orig;
+
+  if (isCopyingOnWrite() && !source.mItems.empty())
+  {
+    // see cloneCopyOnWrite(); the items are only copied when needed
+    mSharedSource = &source;
+    source.mSharers.push_back(this);
+    ++mNumSharingLists;
+  }
+  else
+  {
+    mItems.resize( source.mItems.size() );
+    transform( source.mItems.begin(), source.mItems.end(), mItems.begin(),
+               Clone() );
+  }
   connectToChild();
 }
 
@@ -118,19 +189,74 @@ SedListOf& SedListOf::operator=(const SedListOf& rhs)
   {
     this->SedBase::operator =(rhs);
     // Deletes existing items
+    stopSharing();
     for_each( mItems.begin(), mItems.end(), Delete() );
-    mItems.resize( rhs.size() );
-    transform( rhs.mItems.begin(), rhs.mItems.end(), mItems.begin(), Clone() );
+    clearIdIndex();
+    clearReferenceIndices();
+    const SedListOf& source =
+      (rhs.mSharedSource != NULL) ? *rhs.mSharedSource : rhs;
+    mItems.resize( source.mItems.size() );
+    transform( source.mItems.begin(), source.mItems.end(), mItems.begin(),
+               Clone() );
     connectToChild();
   }
 
   return *this;
 }
 
+
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor. Takes over the items of the given SedListOf.
+ */
+SedListOf::SedListOf (SedListOf&& orig) : SedBase(std::move(orig))
+, mItems(std::move(orig.mItems))
+, mIdIndex()
+, mIdIndexBuilt(false)
+, mNumDuplicateIds(0)
+, mReferenceIndices()
+, mSharedSource(NULL)
+, mSharers()
+{
+  orig.mItems.clear();
+  orig.clearIdIndex();
+  orig.clearReferenceIndices();
+  takeOverSharing(orig);
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator
+ */
+SedListOf& SedListOf::operator=(SedListOf&& rhs)
+{
+  if(&rhs!=this)
+  {
+    this->SedBase::operator =(std::move(rhs));
+    // Deletes existing items, unless other SedListOf objects share them
+    stopSharing();
+    handOverItems();
+    for_each( mItems.begin(), mItems.end(), Delete() );
+    clearIdIndex();
+    clearReferenceIndices();
+    mItems = std::move(rhs.mItems);
+    rhs.mItems.clear();
+    rhs.clearIdIndex();
+    rhs.clearReferenceIndices();
+    takeOverSharing(rhs);
+    connectToChild();
+  }
+
+  return *this;
+}
+#endif
+
 /** @cond doxygenLibsedmlInternal */
 bool
 SedListOf::accept (SedVisitor& v) const
 {
+  copySharedItems();
   v.visit(*this, getItemTypeCode() );
   for (unsigned int n = 0 ; n < mItems.size() && mItems[n]->accept(v); ++n) ;
   v.leave(*this, getItemTypeCode() );
@@ -168,11 +294,17 @@ SedListOf::insert(int location, const SedBase* item)
 int 
 SedListOf::insertAndOwn(int location, SedBase* item)
 {
+  copySharedItems();
+  detachSharedCopies();
+
   /* no list elements yet */
   if (this->getItemTypeCode() == SEDML_UNKNOWN )
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    addToReferenceIndices(item, false);
+    prepareForChange();
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -183,6 +315,9 @@ SedListOf::insertAndOwn(int location, SedBase* item)
   {
     mItems.insert( mItems.begin() + location, item );
     item->connectToParent(this);
+    addToIdIndex(item, false);
+    addToReferenceIndices(item, false);
+    prepareForChange();
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -212,11 +347,17 @@ SedListOf::append (const SedBase* item)
 int
 SedListOf::appendAndOwn (SedBase* item)
 {
+  copySharedItems();
+  detachSharedCopies();
+
   /* no list elements yet */
   if (this->getItemTypeCode() == SEDML_UNKNOWN )
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    addToReferenceIndices(item, true);
+    prepareForChange();
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!isValidTypeForList(item))
@@ -227,6 +368,9 @@ SedListOf::appendAndOwn (SedBase* item)
   {
     mItems.push_back( item );
     item->connectToParent(this);
+    addToIdIndex(item, true);
+    addToReferenceIndices(item, true);
+    prepareForChange();
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -256,6 +400,9 @@ int SedListOf::appendFrom(const SedListOf* list)
 const SedBase*
 SedListOf::get (unsigned int n) const
 {
+  // the item returned must belong to this SedListOf and its document
+  copySharedItems();
+
   return (n < mItems.size()) ? mItems[n] : NULL;
 }
 
@@ -266,6 +413,7 @@ SedListOf::get (unsigned int n) const
 SedBase*
 SedListOf::get (unsigned int n)
 {
+  copySharedItems();
   return const_cast<SedBase*>( static_cast<const SedListOf&>(*this).get(n) );
 }
 
@@ -345,10 +493,19 @@ SedListOf::getAllElements()
 void
 SedListOf::clear (bool doDelete)
 {
+  // the items still shared are simply no longer shared
+  detachSharedCopies();
+  stopSharing();
+
   if (doDelete)
     for_each( mItems.begin(), mItems.end(), Delete() );
+  else
+    for_each( mItems.begin(), mItems.end(), ReleaseFromParent() );
   
   mItems.clear();
+  clearIdIndex();
+  clearReferenceIndices();
+  prepareForChange();
 }
 
 
@@ -371,46 +528,428 @@ SedListOf::remove (unsigned int n)
 {
   SedBase* item = get(n);
   
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    detachSharedCopies();
+    mItems.erase( mItems.begin() + n );
+    removeFromIdIndex(item, item->getId());
+    removeFromReferenceIndices(item);
+    prepareForChange();
+    // the caller now owns the item, so it leaves the document; it keeps its
+    // parent pointer
+    item->releaseFromParent();
+  }
   
   return item;
 }
 
 
+/*
+ * Returns the first item with the given identifier, using (and if
+ * necessary building) the identifier index.
+ */
+const SedBase*
+SedListOf::getItemById (const std::string& sid) const
+{
+  copySharedItems();
+
+  if (sid.empty())
+  {
+    // items without an identifier are not indexed
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getId().empty()) return *it;
+    }
+    return NULL;
+  }
+
+  if (!mIdIndexBuilt)
+  {
+    buildIdIndex();
+  }
+
+  IdIndex::const_iterator found = mIdIndex.find(sid);
+
+  return (found == mIdIndex.end()) ? NULL : found->second;
+}
+
+
+/*
+ * Returns the first item with the given identifier, after taking copies
+ * of shared items.
+ */
+SedBase*
+SedListOf::getItemById (const std::string& sid)
+{
+  copySharedItems();
+  return const_cast<SedBase*>( static_cast<const SedListOf&>(*this).getItemById(sid) );
+}
+
+
+/*
+ * Removes the first item with the given identifier and returns it.
+ */
+SedBase*
+SedListOf::removeItemById (const std::string& sid)
+{
+  SedBase* item = getItemById(sid);
+
+  if (item != NULL)
+  {
+    detachSharedCopies();
+    mItems.erase( find(mItems.begin(), mItems.end(), item) );
+    removeFromIdIndex(item, sid);
+    removeFromReferenceIndices(item);
+    prepareForChange();
+    item->releaseFromParent();
+  }
+
+  return item;
+}
+
+
+/*
+ * Returns the first item whose attribute refers to the identifier, using
+ * (and if necessary building) the index of that attribute.
+ */
+const SedBase*
+SedListOf::getItemByReference (const std::string& attributeName,
+                            const std::string& sid) const
+{
+  copySharedItems();
+
+  if (sid.empty())
+  {
+    // items without a reference are not indexed
+    std::string ref;
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getAttribute(attributeName, ref) == LIBSEDML_OPERATION_SUCCESS
+        && ref.empty())
+      {
+        return *it;
+      }
+    }
+    return NULL;
+  }
+
+  const ReferenceIndex& index = getReferenceIndex(attributeName);
+  ReferenceIndex::const_iterator found = index.find(sid);
+
+  return (found == index.end()) ? NULL : found->second.front();
+}
+
+
+/*
+ * Returns the first item whose attribute refers to the identifier, after
+ * taking copies of shared items.
+ */
+SedBase*
+SedListOf::getItemByReference (const std::string& attributeName,
+                            const std::string& sid)
+{
+  copySharedItems();
+  return const_cast<SedBase*>( static_cast<const SedListOf&>(*this)
+                               .getItemByReference(attributeName, sid) );
+}
+
+
+/*
+ * Returns all the items whose attribute refers to the identifier, after
+ * taking copies of shared items (the List hands them out for change).
+ */
+List*
+SedListOf::getItemsByReference (const std::string& attributeName,
+                             const std::string& sid)
+{
+  copySharedItems();
+
+  List* ret = new List();
+
+  if (sid.empty())
+  {
+    std::string ref;
+    for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+      if ((*it)->getAttribute(attributeName, ref) == LIBSEDML_OPERATION_SUCCESS
+        && ref.empty())
+      {
+        ret->add(*it);
+      }
+    }
+    return ret;
+  }
+
+  const ReferenceIndex& index = getReferenceIndex(attributeName);
+  ReferenceIndex::const_iterator found = index.find(sid);
+
+  if (found != index.end())
+  {
+    for (std::vector<SedBase*>::const_iterator it = found->second.begin();
+         it != found->second.end(); ++it)
+    {
+      ret->add(*it);
+    }
+  }
+
+  return ret;
+}
+
+
 /*
  * @return the number of items in this SedListOf items.
  */
 unsigned int
 SedListOf::size () const
 {
-  return (unsigned int)mItems.size();
+  const ListItem& items =
+    (mSharedSource != NULL) ? mSharedSource->mItems : mItems;
+  return (unsigned int)items.size();
 }
 
 
-/**
- * Used by SedListOf::setSedDocument().
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Updates the identifier index when the "id" of an item changes.
  */
-struct SetSedDocument : public unary_function<SedBase*, void>
+void
+SedListOf::updateIdIndex (SedBase* item, const std::string& oldId,
+                       const std::string& newId)
 {
-  SedDocument* d;
+  if (!mIdIndexBuilt || oldId == newId) return;
 
-  SetSedDocument (SedDocument* d) : d(d) { }
-  void operator() (SedBase* sbase) { sbase->setSedDocument(d); }
-};
+  removeFromIdIndex(item, oldId);
 
+  if (mIdIndexBuilt && !newId.empty())
+  {
+    // another item may already use the id; which one comes first then
+    // depends on the positions, so leave that to a rebuild
+    if (!mIdIndex.insert(IdIndex::value_type(newId, item)).second)
+    {
+      clearIdIndex();
+    }
+  }
+}
 
-/**
- * Used by SedListOf::setParentSedObject().
+
+/*
+ * Rebuilds the identifier index from scratch.
  */
-struct SetParentSedObject : public unary_function<SedBase*, void>
+void
+SedListOf::buildIdIndex () const
 {
-  SedBase* sb;
+  clearIdIndex();
+  mIdIndexBuilt = true;
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    addToIdIndex(*it, true);
+  }
+}
 
-  SetParentSedObject (SedBase *sb) : sb(sb) { }
-  void operator() (SedBase* sbase) { sbase->connectToParent(sb); }
-};
 
-/** @cond doxygenLibsedmlInternal */
+/*
+ * Adds an item that has just been placed in mItems to the identifier index.
+ * Items appended at the end never shadow an existing entry; items inserted
+ * elsewhere that share an identifier invalidate the index.
+ */
+void
+SedListOf::addToIdIndex (SedBase* item, bool atEnd) const
+{
+  if (!mIdIndexBuilt) return;
+
+  const std::string& id = item->getId();
+  if (id.empty()) return;
+
+  if (!mIdIndex.insert(IdIndex::value_type(id, item)).second)
+  {
+    if (atEnd)
+    {
+      mNumDuplicateIds++;
+    }
+    else
+    {
+      clearIdIndex();
+    }
+  }
+}
+
+
+/*
+ * Removes the entry of an item that is no longer in mItems.
+ */
+void
+SedListOf::removeFromIdIndex (SedBase* item, const std::string& id) const
+{
+  if (!mIdIndexBuilt || id.empty()) return;
+
+  if (mNumDuplicateIds > 0)
+  {
+    // a shadowed duplicate may need to take the place of this item
+    clearIdIndex();
+    return;
+  }
+
+  IdIndex::iterator found = mIdIndex.find(id);
+  if (found != mIdIndex.end() && found->second == item)
+  {
+    mIdIndex.erase(found);
+  }
+}
+
+
+/*
+ * Drops the identifier index; it is rebuilt on the next lookup.
+ */
+void
+SedListOf::clearIdIndex () const
+{
+  mIdIndex.clear();
+  mIdIndexBuilt = false;
+  mNumDuplicateIds = 0;
+}
+
+
+/*
+ * Updates the index of an attribute when its value changes for an item.
+ */
+void
+SedListOf::updateReferenceIndex (SedBase* item, const std::string& attributeName,
+                              const std::string& oldRef,
+                              const std::string& newRef)
+{
+  if (oldRef == newRef) return;
+
+  ReferenceIndices::iterator index = mReferenceIndices.find(attributeName);
+  if (index == mReferenceIndices.end()) return;
+
+  eraseReference(index->second, oldRef, item);
+
+  if (newRef.empty()) return;
+
+  std::vector<SedBase*>& referrers = index->second[newRef];
+  if (referrers.empty() || item == mItems.back())
+  {
+    referrers.push_back(item);
+  }
+  else
+  {
+    // the item has to take its place among the others in list order;
+    // leave that to a rebuild
+    mReferenceIndices.erase(index);
+  }
+}
+
+
+/*
+ * Returns the index of the attribute, building it if necessary.
+ */
+const SedListOf::ReferenceIndex&
+SedListOf::getReferenceIndex (const std::string& attributeName) const
+{
+  ReferenceIndices::iterator index = mReferenceIndices.find(attributeName);
+  if (index != mReferenceIndices.end())
+  {
+    return index->second;
+  }
+
+  ReferenceIndex& built = mReferenceIndices[attributeName];
+  std::string ref;
+  for (ListItem::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+  {
+    if ((*it)->getAttribute(attributeName, ref) == LIBSEDML_OPERATION_SUCCESS
+      && !ref.empty())
+    {
+      built[ref].push_back(*it);
+    }
+  }
+
+  return built;
+}
+
+
+/*
+ * Adds an item that has just been placed in mItems to the indices that
+ * have been built.  Only an item appended at the end is known to come
+ * after all the others; any other insertion drops the indices.
+ */
+void
+SedListOf::addToReferenceIndices (SedBase* item, bool atEnd) const
+{
+  if (mReferenceIndices.empty()) return;
+
+  if (!atEnd)
+  {
+    clearReferenceIndices();
+    return;
+  }
+
+  std::string ref;
+  for (ReferenceIndices::iterator index = mReferenceIndices.begin();
+       index != mReferenceIndices.end(); ++index)
+  {
+    if (item->getAttribute(index->first, ref) == LIBSEDML_OPERATION_SUCCESS
+      && !ref.empty())
+    {
+      index->second[ref].push_back(item);
+    }
+  }
+}
+
+
+/*
+ * Removes an item that is no longer in mItems from the indices.
+ */
+void
+SedListOf::removeFromReferenceIndices (SedBase* item) const
+{
+  std::string ref;
+  for (ReferenceIndices::iterator index = mReferenceIndices.begin();
+       index != mReferenceIndices.end(); ++index)
+  {
+    if (item->getAttribute(index->first, ref) == LIBSEDML_OPERATION_SUCCESS)
+    {
+      eraseReference(index->second, ref, item);
+    }
+  }
+}
+
+
+/*
+ * Removes the item from the referrers of the identifier in the index.
+ */
+void
+SedListOf::eraseReference (ReferenceIndex& index, const std::string& ref,
+                        SedBase* item)
+{
+  if (ref.empty()) return;
+
+  ReferenceIndex::iterator found = index.find(ref);
+  if (found == index.end()) return;
+
+  std::vector<SedBase*>& referrers = found->second;
+  std::vector<SedBase*>::iterator pos =
+    std::find(referrers.begin(), referrers.end(), item);
+  if (pos != referrers.end())
+  {
+    referrers.erase(pos);
+  }
+  if (referrers.empty())
+  {
+    index.erase(found);
+  }
+}
+
+
+/*
+ * Drops the indices of the attributes; they are rebuilt on the next lookup.
+ */
+void
+SedListOf::clearReferenceIndices () const
+{
+  mReferenceIndices.clear();
+}
+
 
 /*
  * Sets the parent SedDocument of this SEDML object.
@@ -419,6 +958,17 @@ void
 SedListOf::setSedDocument (SedDocument* d)
 {
   SedBase::setSedDocument(d);
+
+  // the items still shared are left until they are needed, unless the
+  // index of the document is being built and needs to reach them; the
+  // copies are then added to the index as they are connected to this SedListOf
+  SedElementIndex* index = getDocumentElementIndex();
+  if (mSharedSource != NULL && index != NULL && index->isBuilding())
+  {
+    copySharedItems();
+    return;
+  }
+
   for_each( mItems.begin(), mItems.end(), SetSedDocument(d) );
 }
 
@@ -434,6 +984,122 @@ SedListOf::connectToChild()
   for_each( mItems.begin(), mItems.end(), SetParentSedObject(this) );
 }
 
+
+/*
+ * Makes the SedListOf objects sharing the items of this one take copies.
+ */
+void
+SedListOf::unshareChildren()
+{
+  while (!mSharers.empty())
+  {
+    mSharers.back()->copySharedItems();
+  }
+}
+
+
+/*
+ * Replaces the items this SedListOf shares with copies of its own.  The
+ * copies share their own children in turn, so that only the branches
+ * actually used end up being copied.
+ */
+void
+SedListOf::copySharedItems () const
+{
+  if (mSharedSource == NULL) return;
+
+  SedListOf* self = const_cast<SedListOf*>(this);
+  const SedListOf* source = mSharedSource;
+  self->stopSharing();
+
+  beginCopyingOnWrite();
+  try
+  {
+    self->mItems.resize( source->mItems.size() );
+    transform( source->mItems.begin(), source->mItems.end(),
+               self->mItems.begin(), Clone() );
+    self->connectToChild();
+  }
+  catch (...)
+  {
+    endCopyingOnWrite();
+    throw;
+  }
+  endCopyingOnWrite();
+}
+
+
+/*
+ * Stops sharing the items of another SedListOf, without copying them.
+ */
+void
+SedListOf::stopSharing ()
+{
+  if (mSharedSource == NULL) return;
+
+  std::vector<SedListOf*>& sharers = mSharedSource->mSharers;
+  sharers.erase( find(sharers.begin(), sharers.end(), this) );
+  mSharedSource = NULL;
+  --mNumSharingLists;
+}
+
+
+/*
+ * Gives the items of this SedListOf to the first of the SedListOf objects sharing
+ * them; the others then share the items of that one.
+ */
+void
+SedListOf::handOverItems ()
+{
+  if (mSharers.empty()) return;
+
+  SedListOf* heir = mSharers.front();
+  heir->mSharedSource = NULL;
+  --mNumSharingLists;
+
+  heir->mItems.swap(mItems);
+  heir->mSharers.swap(mSharers);
+  heir->mSharers.erase(heir->mSharers.begin());
+  for (std::vector<SedListOf*>::iterator it = heir->mSharers.begin();
+       it != heir->mSharers.end(); ++it)
+  {
+    (*it)->mSharedSource = heir;
+  }
+
+  clearIdIndex();
+  clearReferenceIndices();
+
+  // the items only change hands; nothing shared changes
+  beginCopyingOnWrite();
+  heir->connectToChild();
+  endCopyingOnWrite();
+}
+
+
+/*
+ * Takes over the part orig plays in sharing items, when orig is moved
+ * into this SedListOf.
+ */
+void
+SedListOf::takeOverSharing (SedListOf& orig)
+{
+  mSharedSource = orig.mSharedSource;
+  if (mSharedSource != NULL)
+  {
+    std::vector<SedListOf*>& sharers = mSharedSource->mSharers;
+    *find(sharers.begin(), sharers.end(), &orig) = this;
+  }
+
+  mSharers.swap(orig.mSharers);
+  for (std::vector<SedListOf*>::iterator it = mSharers.begin();
+       it != mSharers.end(); ++it)
+  {
+    (*it)->mSharedSource = this;
+  }
+
+  orig.mSharedSource = NULL;
+}
+
 /** @endcond */
 
 
@@ -492,6 +1158,7 @@ struct Write : public unary_function<SedBase*, void>
 void
 SedListOf::writeElements (XMLOutputStream& stream) const
 {
+  copySharedItems();
   SedBase::writeElements(stream);
   for_each( mItems.begin(), mItems.end(), Write(stream) );
 }
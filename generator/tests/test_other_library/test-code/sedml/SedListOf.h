@@ -123,6 +123,24 @@ public:
   SedListOf& operator=(const SedListOf& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor; the new SedListOf takes over the items of @p orig,
+   * which is left empty.
+   *
+   * @param orig the SedListOf instance to move.
+   */
+  SedListOf (SedListOf&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOf; the items of this SedListOf are
+   * deleted and replaced by those of @p rhs, which is left empty.
+   */
+  SedListOf& operator=(SedListOf&& rhs);
+#endif
+
+
 
   /** @cond doxygenLibsedmlInternal */
   /**
@@ -186,6 +204,35 @@ public:
   int appendAndOwn (SedBase* disownedItem);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Adds the item held by @p disownedItem to the end of this SedListOf's list
+   * of items, transferring its ownership to this SedListOf.
+   *
+   * The item is only released by @p disownedItem if it is added; otherwise
+   * @p disownedItem still owns it.
+   *
+   * @param disownedItem the item to be added to the list.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   *
+   * @see appendAndOwn(SedBase* disownedItem)
+   */
+  template <class T>
+  int appendAndOwn (std::unique_ptr<T>&& disownedItem)
+  {
+    int success = appendAndOwn(static_cast<SedBase*>(disownedItem.get()));
+    if (success == LIBSEDML_OPERATION_SUCCESS)
+    {
+      disownedItem.release();
+    }
+    return success;
+  }
+#endif
+
+
   /**
    * Adds a clone of a list of items to this SedListOf's list.
    *
@@ -249,6 +296,9 @@ public:
    *
    * @return the <em>n</em>th item in this SedListOf items, or a null pointer if
    * the index number @p n refers to a nonexistent position in this list.
+   * A SedListOf that shares its items with another one (see
+   * SedBase::cloneCopyOnWrite()) first takes its own copies of them, so that
+   * the item returned belongs to this SedListOf and its document.
    *
    * @see size()
    */
@@ -311,7 +361,9 @@ public:
    * delete those items.  Otherwise, all items are cleared only from this
    * SedListOf object; the caller is still responsible for deleting the actual
    * items.  (In the latter case, callers are advised to store pointers to
-   * all items elsewhere before calling this function.)
+   * all items elsewhere before calling this function.)  Items that are not
+   * deleted keep this SedListOf as their parent but no longer belong to its
+   * document (see SedBase::releaseFromParent()).
    *
    * @param doDelete if @c true (default), all items are deleted and cleared.
    * Otherwise, all items are just cleared and not deleted.
@@ -343,6 +395,8 @@ public:
    * it.
    *
    * The caller owns the returned item and is responsible for deleting it.
+   * The item keeps this SedListOf as its parent but no longer belongs to its
+   * document (see SedBase::releaseFromParent()).
    *
    * @param n the index of the item to remove
    *
@@ -370,6 +424,53 @@ public:
   /** @endcond */
 
 
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Updates the identifier index of this SedListOf when the "id" of one of
+   * its items changes.
+   *
+   * This is called by the item itself (see SedBase::updateIdIndices()) before
+   * the new identifier is stored.
+   *
+   * @param item the item whose identifier is changing.
+   * @param oldId the identifier @p item currently has.
+   * @param newId the identifier @p item is about to be given.
+   */
+  void updateIdIndex (SedBase* item, const std::string& oldId,
+                      const std::string& newId);
+  /** @endcond */
+
+
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Updates the index of the given SIdRef attribute of the items of this
+   * SedListOf when the value of that attribute changes for one of them.
+   *
+   * This is called by the item itself (see SedBase::updateReferenceIndices())
+   * before the new value is stored.
+   *
+   * @param item the item whose attribute is changing.
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param oldRef the value the attribute currently has.
+   * @param newRef the value the attribute is about to be given.
+   */
+  void updateReferenceIndex (SedBase* item, const std::string& attributeName,
+                             const std::string& oldRef,
+                             const std::string& newRef);
+  /** @endcond */
+
+
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Drops the indices of the SIdRef attributes of the items of this SedListOf;
+   * they are rebuilt on the next lookup.  Used when the attributes of an
+   * item have been changed without going through its setters, as happens
+   * when it is read.
+   */
+  void clearReferenceIndices () const;
+  /** @endcond */
+
+
   /** @cond doxygenLibsedmlInternal */
   /**
    * Sets this SEDML object to child SEDML objects (if any).
@@ -480,8 +581,176 @@ protected:
 
   virtual bool isValidTypeForList(SedBase * item);
 
+  /**
+   * Returns the first item in this SedListOf with the given identifier.
+   *
+   * The lookup goes through a hash index of the item identifiers that is
+   * built on first use and then kept up to date by appendAndOwn(),
+   * insertAndOwn(), remove(), clear() and the setId() functions of the
+   * items, so repeated lookups are O(1) amortized.
+   *
+   * As for get(), a SedListOf that shares its items with another one first
+   * takes its own copies of them.
+   *
+   * @param sid the identifier of the item to find.
+   *
+   * @return the first item with the given @p sid or @c NULL if no such
+   * item exists.
+   */
+  const SedBase* getItemById (const std::string& sid) const;
+
+
+  /**
+   * Returns the first item in this SedListOf with the given identifier.
+   *
+   * As the item may be changed through the pointer returned, a SedListOf
+   * that shares its items first takes its own copies of them.
+   *
+   * @param sid the identifier of the item to find.
+   *
+   * @return the first item with the given @p sid or @c NULL if no such
+   * item exists.
+   */
+  SedBase* getItemById (const std::string& sid);
+
+
+  /**
+   * Removes the first item in this SedListOf with the given identifier and
+   * returns it.  The caller owns the returned item, which is released as
+   * by remove().
+   *
+   * @param sid the identifier of the item to remove.
+   *
+   * @return the item removed or @c NULL if no such item exists.
+   */
+  SedBase* removeItemById (const std::string& sid);
+
+
+  /**
+   * Returns the first item in this SedListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier.
+   *
+   * As for getItemById(), the lookup goes through an index, one per
+   * attribute, that is built on first use and then kept up to date by the
+   * list functions and the setters of the items; a SedListOf that shares its
+   * items first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return the first item referring to @p sid or @c NULL if no such
+   * item exists.
+   */
+  const SedBase* getItemByReference (const std::string& attributeName,
+                                   const std::string& sid) const;
+
+
+  /**
+   * Returns the first item in this SedListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier.
+   *
+   * As for the non-const getItemById(), a SedListOf that shares its items
+   * first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return the first item referring to @p sid or @c NULL if no such
+   * item exists.
+   */
+  SedBase* getItemByReference (const std::string& attributeName,
+                             const std::string& sid);
+
+
+  /**
+   * Returns all the items in this SedListOf whose SIdRef attribute
+   * @p attributeName refers to the given identifier, in list order.
+   *
+   * The items may be changed through the List returned, so a SedListOf that
+   * shares its items first takes its own copies of them.
+   *
+   * @param attributeName the XML name of the SIdRef attribute.
+   * @param sid the identifier referred to.
+   *
+   * @return a List of the items referring to @p sid.  The caller owns the
+   * List (but not the items in it) and is responsible for deleting it.
+   */
+  List* getItemsByReference (const std::string& attributeName,
+                             const std::string& sid);
+
+
+  /**
+   * Makes the SedListOf objects that share the items of this one (see
+   * SedBase::cloneCopyOnWrite()) take their own copies of them.
+   */
+  virtual void unshareChildren ();
+
+#ifdef LIBSEDML_HAS_UNORDERED_MAP
+  typedef std::unordered_map<std::string, SedBase*> IdIndex;
+  typedef std::unordered_map<std::string, std::vector<SedBase*> > ReferenceIndex;
+#else
+  typedef std::map<std::string, SedBase*> IdIndex;
+  typedef std::map<std::string, std::vector<SedBase*> > ReferenceIndex;
+#endif
+  typedef std::map<std::string, ReferenceIndex> ReferenceIndices;
+
   ListItem mItems;
 
+  /*
+   * Index of the identifiers of mItems; only valid when mIdIndexBuilt is
+   * true.  Where several items share an identifier the index refers to the
+   * first of them and mNumDuplicateIds records how many are shadowed.
+   */
+  mutable IdIndex      mIdIndex;
+  mutable bool         mIdIndexBuilt;
+  mutable unsigned int mNumDuplicateIds;
+
+  /*
+   * Indices of the SIdRef attributes of mItems, keyed by attribute name;
+   * an attribute only has an index once it has been looked up.  Each
+   * index lists, in list order, the items referring to an identifier.
+   */
+  mutable ReferenceIndices mReferenceIndices;
+
+  /*
+   * A SedListOf copied by SedBase::cloneCopyOnWrite() shares the items of the
+   * SedListOf it was copied from, mSharedSource, until it first needs them;
+   * mItems is empty meanwhile.  mSharers lists the SedListOf objects sharing
+   * the items of this one.
+   */
+  mutable const SedListOf*        mSharedSource;
+  mutable std::vector<SedListOf*> mSharers;
+
+  /** @endcond */
+
+private:
+  /** @cond doxygenLibsedmlInternal */
+
+  void buildIdIndex () const;
+
+  void addToIdIndex (SedBase* item, bool atEnd) const;
+
+  void removeFromIdIndex (SedBase* item, const std::string& id) const;
+
+  void clearIdIndex () const;
+
+  const ReferenceIndex& getReferenceIndex (const std::string& attributeName) const;
+
+  void addToReferenceIndices (SedBase* item, bool atEnd) const;
+
+  void removeFromReferenceIndices (SedBase* item) const;
+
+  static void eraseReference (ReferenceIndex& index, const std::string& ref,
+                              SedBase* item);
+
+  void copySharedItems () const;
+
+  void stopSharing ();
+
+  void handOverItems ();
+
+  void takeOverSharing (SedListOf& orig);
+
   /** @endcond */
 };
 
@@ -93,6 +93,34 @@ SedListOfModels::operator=(const SedListOfModels& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedListOfModels.
+ */
+SedListOfModels::SedListOfModels(SedListOfModels&& orig)
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfModels.
+ */
+SedListOfModels&
+SedListOfModels::operator=(SedListOfModels&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedListOfModels object.
  */
@@ -137,8 +165,7 @@ SedListOfModels::get(unsigned int n) const
 SedModel*
 SedListOfModels::get(const std::string& sid)
 {
-  return const_cast<SedModel*>(static_cast<const
-    SedListOfModels&>(*this).get(sid));
+  return static_cast<SedModel*>(getItemById(sid));
 }
 
 
@@ -148,10 +175,7 @@ SedListOfModels::get(const std::string& sid)
 const SedModel*
 SedListOfModels::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedModel>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedModel*>
-    (*result);
+  return static_cast<const SedModel*>(getItemById(sid));
 }
 
 
@@ -173,18 +197,7 @@ SedListOfModels::remove(unsigned int n)
 SedModel*
 SedListOfModels::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedModel>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedModel*> (item);
+  return static_cast<SedModel*>(removeItemById(sid));
 }
 
 
@@ -243,7 +256,7 @@ SedListOfModels::createModel()
 
   try
   {
-    sm = new SedModel(getSedNamespaces());
+    sm = new (getDocumentArena()) SedModel(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -305,7 +318,7 @@ SedListOfModels::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "model")
   {
-    object = new SedModel(getSedNamespaces());
+    object = new (getDocumentArena()) SedModel(getSharedSedNamespaces());
     appendAndOwn(object);
   }
 
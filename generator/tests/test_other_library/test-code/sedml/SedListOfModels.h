@@ -107,6 +107,28 @@ public:
   SedListOfModels& operator=(const SedListOfModels& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedListOfModels.
+   *
+   * @param orig the SedListOfModels instance to move; it is left as an empty
+   * SedListOfModels in the place it had.
+   */
+  SedListOfModels(SedListOfModels&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfModels.
+   *
+   * @param rhs the SedListOfModels object whose values are to be moved into
+   * this one; it is left as an empty SedListOfModels in the place it had.
+   */
+  SedListOfModels& operator=(SedListOfModels&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfModels object.
    *
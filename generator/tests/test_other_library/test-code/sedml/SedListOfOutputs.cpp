@@ -102,6 +102,36 @@ SedListOfOutputs::operator=(const SedListOfOutputs& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedListOfOutputs.
+ */
+SedListOfOutputs::SedListOfOutputs(SedListOfOutputs&& orig)
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfOutputs.
+ */
+SedListOfOutputs&
+SedListOfOutputs::operator=(SedListOfOutputs&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedListOfOutputs object.
  */
@@ -146,8 +176,7 @@ SedListOfOutputs::get(unsigned int n) const
 SedOutput*
 SedListOfOutputs::get(const std::string& sid)
 {
-  return const_cast<SedOutput*>(static_cast<const
-    SedListOfOutputs&>(*this).get(sid));
+  return static_cast<SedOutput*>(getItemById(sid));
 }
 
 
@@ -157,10 +186,7 @@ SedListOfOutputs::get(const std::string& sid)
 const SedOutput*
 SedListOfOutputs::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedOutput>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedOutput*>
-    (*result);
+  return static_cast<const SedOutput*>(getItemById(sid));
 }
 
 
@@ -182,18 +208,7 @@ SedListOfOutputs::remove(unsigned int n)
 SedOutput*
 SedListOfOutputs::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedOutput>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedOutput*> (item);
+  return static_cast<SedOutput*>(removeItemById(sid));
 }
 
 
@@ -252,7 +267,7 @@ SedListOfOutputs::createReport()
 
   try
   {
-    sr = new SedReport(getSedNamespaces());
+    sr = new (getDocumentArena()) SedReport(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -278,7 +293,7 @@ SedListOfOutputs::createPlot2D()
 
   try
   {
-    spd = new SedPlot2D(getSedNamespaces());
+    spd = new (getDocumentArena()) SedPlot2D(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -304,7 +319,7 @@ SedListOfOutputs::createPlot3D()
 
   try
   {
-    spd = new SedPlot3D(getSedNamespaces());
+    spd = new (getDocumentArena()) SedPlot3D(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -330,7 +345,7 @@ SedListOfOutputs::createFigure()
 
   try
   {
-    sf = new SedFigure(getSedNamespaces());
+    sf = new (getDocumentArena()) SedFigure(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -406,31 +421,27 @@ SedListOfOutputs::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   if (name == "output")
   {
-    object = new SedOutput(getSedNamespaces());
+    object = new (getDocumentArena()) SedOutput(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == "report")
+  else if (name == "report")
   {
-    object = new SedReport(getSedNamespaces());
+    object = new (getDocumentArena()) SedReport(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == "plot2D")
+  else if (name == "plot2D")
   {
-    object = new SedPlot2D(getSedNamespaces());
+    object = new (getDocumentArena()) SedPlot2D(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == "plot3D")
+  else if (name == "plot3D")
   {
-    object = new SedPlot3D(getSedNamespaces());
+    object = new (getDocumentArena()) SedPlot3D(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == "figure")
+  else if (name == "figure")
   {
-    object = new SedFigure(getSedNamespaces());
+    object = new (getDocumentArena()) SedFigure(getSharedSedNamespaces());
     appendAndOwn(object);
   }
 
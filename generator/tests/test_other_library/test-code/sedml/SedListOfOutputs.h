@@ -119,6 +119,28 @@ public:
   SedListOfOutputs& operator=(const SedListOfOutputs& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedListOfOutputs.
+   *
+   * @param orig the SedListOfOutputs instance to move; it is left as an empty
+   * SedListOfOutputs in the place it had.
+   */
+  SedListOfOutputs(SedListOfOutputs&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfOutputs.
+   *
+   * @param rhs the SedListOfOutputs object whose values are to be moved into
+   * this one; it is left as an empty SedListOfOutputs in the place it had.
+   */
+  SedListOfOutputs& operator=(SedListOfOutputs&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfOutputs object.
    *
@@ -102,6 +102,36 @@ SedListOfTasks::operator=(const SedListOfTasks& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedListOfTasks.
+ */
+SedListOfTasks::SedListOfTasks(SedListOfTasks&& orig)
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfTasks.
+ */
+SedListOfTasks&
+SedListOfTasks::operator=(SedListOfTasks&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedListOfTasks object.
  */
@@ -146,8 +176,7 @@ SedListOfTasks::get(unsigned int n) const
 SedAbstractTask*
 SedListOfTasks::get(const std::string& sid)
 {
-  return const_cast<SedAbstractTask*>(static_cast<const
-    SedListOfTasks&>(*this).get(sid));
+  return static_cast<SedAbstractTask*>(getItemById(sid));
 }
 
 
@@ -157,11 +186,7 @@ SedListOfTasks::get(const std::string& sid)
 const SedAbstractTask*
 SedListOfTasks::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractTask>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedAbstractTask*>
-    (*result);
+  return static_cast<const SedAbstractTask*>(getItemById(sid));
 }
 
 
@@ -183,19 +208,7 @@ SedListOfTasks::remove(unsigned int n)
 SedAbstractTask*
 SedListOfTasks::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractTask>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAbstractTask*> (item);
+  return static_cast<SedAbstractTask*>(removeItemById(sid));
 }
 
 
@@ -254,7 +267,7 @@ SedListOfTasks::createTask()
 
   try
   {
-    st = new SedTask(getSedNamespaces());
+    st = new (getDocumentArena()) SedTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -280,7 +293,7 @@ SedListOfTasks::createRepeatedTask()
 
   try
   {
-    srt = new SedRepeatedTask(getSedNamespaces());
+    srt = new (getDocumentArena()) SedRepeatedTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -307,7 +320,8 @@ SedListOfTasks::createParameterEstimationTask()
 
   try
   {
-    spet = new SedParameterEstimationTask(getSedNamespaces());
+    spet = new (getDocumentArena())
+      SedParameterEstimationTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -333,7 +347,8 @@ SedListOfTasks::createSimpleRepeatedTask()
 
   try
   {
-    ssrt = new SedSimpleRepeatedTask(getSedNamespaces());
+    ssrt = new (getDocumentArena())
+      SedSimpleRepeatedTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -407,53 +422,33 @@ SedListOfTasks::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
   const std::string& name = stream.peek().getName();
   SedBase* object = NULL;
 
-  if (name == mElementName)
+  if (name == "task")
   {
-    object = new SedAbstractTask(getSedNamespaces());
-    if (object)
-    {
-      dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
-    }
-
+    object = new (getDocumentArena()) SedTask(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == mElementName)
+  else if (name == "repeatedTask")
   {
-    object = new SedTask(getSedNamespaces());
-    if (object)
-    {
-      dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
-    }
-
+    object = new (getDocumentArena())
+      SedRepeatedTask(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == mElementName)
+  else if (name == "parameterEstimationTask")
   {
-    object = new SedRepeatedTask(getSedNamespaces());
-    if (object)
-    {
-      dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
-    }
-
+    object = new (getDocumentArena())
+      SedParameterEstimationTask(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == mElementName)
+  else if (name == "simpleRepeatedTask")
   {
-    object = new SedParameterEstimationTask(getSedNamespaces());
-    if (object)
-    {
-      dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
-    }
-
+    object = new (getDocumentArena())
+      SedSimpleRepeatedTask(getSharedSedNamespaces());
     appendAndOwn(object);
   }
-
-  if (name == mElementName)
+  else if (name == mElementName)
   {
-    object = new SedSimpleRepeatedTask(getSedNamespaces());
+    object = new (getDocumentArena())
+      SedAbstractTask(getSharedSedNamespaces());
     if (object)
     {
       dynamic_cast<SedAbstractTask*>(object)->setElementName(name);
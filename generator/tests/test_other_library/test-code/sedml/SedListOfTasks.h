@@ -119,6 +119,28 @@ public:
   SedListOfTasks& operator=(const SedListOfTasks& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedListOfTasks.
+   *
+   * @param orig the SedListOfTasks instance to move; it is left as an empty
+   * SedListOfTasks in the place it had.
+   */
+  SedListOfTasks(SedListOfTasks&& orig);
+
+
+  /**
+   * Move assignment operator for SedListOfTasks.
+   *
+   * @param rhs the SedListOfTasks object whose values are to be moved into
+   * this one; it is left as an empty SedListOfTasks in the place it had.
+   */
+  SedListOfTasks& operator=(SedListOfTasks&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfTasks object.
    *
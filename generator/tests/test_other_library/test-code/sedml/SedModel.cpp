@@ -118,6 +118,44 @@ SedModel::operator=(const SedModel& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedModel.
+ */
+SedModel::SedModel(SedModel&& orig)
+  : SedBase( std::move(orig) )
+  , mName ( std::move(orig.mName) )
+  , mLanguage ( std::move(orig.mLanguage) )
+  , mSource ( std::move(orig.mSource) )
+  , mChanges ( std::move(orig.mChanges) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedModel.
+ */
+SedModel&
+SedModel::operator=(SedModel&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mName = std::move(rhs.mName);
+    mLanguage = std::move(rhs.mLanguage);
+    mSource = std::move(rhs.mSource);
+    mChanges = std::move(rhs.mChanges);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedModel object.
  */
@@ -222,6 +260,8 @@ SedModel::isSetSource() const
 int
 SedModel::setId(const std::string& id)
 {
+  prepareForChange();
+  updateIdIndices(mId, id);
   mId = id;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -233,6 +273,7 @@ SedModel::setId(const std::string& id)
 int
 SedModel::setName(const std::string& name)
 {
+  prepareForChange();
   mName = name;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -244,6 +285,7 @@ SedModel::setName(const std::string& name)
 int
 SedModel::setLanguage(const std::string& language)
 {
+  prepareForChange();
   mLanguage = language;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -255,6 +297,7 @@ SedModel::setLanguage(const std::string& language)
 int
 SedModel::setSource(const std::string& source)
 {
+  prepareForChange();
   mSource = source;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -266,6 +309,8 @@ SedModel::setSource(const std::string& source)
 int
 SedModel::unsetId()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -285,6 +330,7 @@ SedModel::unsetId()
 int
 SedModel::unsetName()
 {
+  prepareForChange();
   mName.erase();
 
   if (mName.empty() == true)
@@ -304,6 +350,7 @@ SedModel::unsetName()
 int
 SedModel::unsetLanguage()
 {
+  prepareForChange();
   mLanguage.erase();
 
   if (mLanguage.empty() == true)
@@ -323,6 +370,7 @@ SedModel::unsetLanguage()
 int
 SedModel::unsetSource()
 {
+  prepareForChange();
   mSource.erase();
 
   if (mSource.empty() == true)
@@ -431,7 +479,7 @@ SedModel::createAddXML()
 
   try
   {
-    saxml = new SedAddXML(getSedNamespaces());
+    saxml = new (getDocumentArena()) SedAddXML(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -457,7 +505,7 @@ SedModel::createChangeXML()
 
   try
   {
-    scxml = new SedChangeXML(getSedNamespaces());
+    scxml = new (getDocumentArena()) SedChangeXML(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -483,7 +531,7 @@ SedModel::createRemoveXML()
 
   try
   {
-    srxml = new SedRemoveXML(getSedNamespaces());
+    srxml = new (getDocumentArena()) SedRemoveXML(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -509,7 +557,8 @@ SedModel::createChangeAttribute()
 
   try
   {
-    sca = new SedChangeAttribute(getSedNamespaces());
+    sca = new (getDocumentArena())
+      SedChangeAttribute(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -535,7 +584,7 @@ SedModel::createComputeChange()
 
   try
   {
-    scc = new SedComputeChange(getSedNamespaces());
+    scc = new (getDocumentArena()) SedComputeChange(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -760,25 +809,42 @@ SedModel::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  switch (attributeName.size())
   {
-    value = getId();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "language")
-  {
-    value = getLanguage();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "source")
-  {
-    value = getSource();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
+  case 2:
+    if (attributeName == "id")
+    {
+      value = getId();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = getName();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      value = getSource();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 8:
+    if (attributeName == "language")
+    {
+      value = getLanguage();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -799,21 +865,38 @@ SedModel::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SedBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "language")
-  {
-    value = isSetLanguage();
-  }
-  else if (attributeName == "source")
+  switch (attributeName.size())
   {
-    value = isSetSource();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = isSetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = isSetName();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      value = isSetSource();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "language")
+    {
+      value = isSetLanguage();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -902,21 +985,38 @@ SedModel::setAttribute(const std::string& attributeName,
 {
   int return_value = SedBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "language")
-  {
-    return_value = setLanguage(value);
-  }
-  else if (attributeName == "source")
+  switch (attributeName.size())
   {
-    return_value = setSource(value);
+  case 2:
+    if (attributeName == "id")
+    {
+      return_value = setId(value);
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      return_value = setName(value);
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      return_value = setSource(value);
+    }
+
+    break;
+  case 8:
+    if (attributeName == "language")
+    {
+      return_value = setLanguage(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -936,21 +1036,38 @@ SedModel::unsetAttribute(const std::string& attributeName)
 {
   int value = SedBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "language")
-  {
-    value = unsetLanguage();
-  }
-  else if (attributeName == "source")
+  switch (attributeName.size())
   {
-    value = unsetSource();
+  case 2:
+    if (attributeName == "id")
+    {
+      value = unsetId();
+    }
+
+    break;
+  case 4:
+    if (attributeName == "name")
+    {
+      value = unsetName();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "source")
+    {
+      value = unsetSource();
+    }
+
+    break;
+  case 8:
+    if (attributeName == "language")
+    {
+      value = unsetLanguage();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -1259,25 +1376,24 @@ SedModel::readAttributes(
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlDocumentLOModelsAllowedCoreAttributes, level,
           version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlModelAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
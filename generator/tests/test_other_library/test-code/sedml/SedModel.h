@@ -114,6 +114,28 @@ public:
   SedModel& operator=(const SedModel& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedModel.
+   *
+   * @param orig the SedModel instance to move; it is left as an empty SedModel
+   * in the place it had.
+   */
+  SedModel(SedModel&& orig);
+
+
+  /**
+   * Move assignment operator for SedModel.
+   *
+   * @param rhs the SedModel object whose values are to be moved into this one;
+   * it is left as an empty SedModel in the place it had.
+   */
+  SedModel& operator=(SedModel&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedModel object.
    *
@@ -83,6 +83,7 @@ SedNamespaces::initSedNamespace()
 SedNamespaces::SedNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
+  ,mNumReferences(0)
 {
   initSedNamespace();
 }
@@ -102,6 +103,7 @@ SedNamespaces::SedNamespaces(const SedNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mNumReferences(0)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
@@ -162,6 +164,82 @@ SedNamespaces::clone () const
 }
 
 
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * There is no registry: an object is shared by the elements created from
+ * it, which in practice are the elements of the document it belongs to.
+ * Without atomic reference counts nothing is shared and every element
+ * keeps a copy of its own, as the elements of two documents may be used
+ * from different threads.
+ */
+SedNamespaces*
+SedNamespaces::intern(const SedNamespaces* sedmlns)
+{
+  if (sedmlns == NULL) return NULL;
+
+#ifdef LIBSEDML_HAS_SHARED_NAMESPACES
+  if (sedmlns->mNumReferences > 0)
+  {
+    ++sedmlns->mNumReferences;
+    return const_cast<SedNamespaces*>(sedmlns);
+  }
+
+  SedNamespaces* shared = sedmlns->clone();
+  shared->mNumReferences = 1;
+  return shared;
+#else
+  return sedmlns->clone();
+#endif
+}
+
+
+SedNamespaces*
+SedNamespaces::internAndOwn(SedNamespaces* sedmlns)
+{
+  if (sedmlns == NULL) return NULL;
+
+#ifdef LIBSEDML_HAS_SHARED_NAMESPACES
+  if (sedmlns->mNumReferences == 0)
+  {
+    sedmlns->mNumReferences = 1;
+  }
+#endif
+
+  return sedmlns;
+}
+
+
+void
+SedNamespaces::release(SedNamespaces* sedmlns)
+{
+  if (sedmlns == NULL) return;
+
+  if (sedmlns->mNumReferences == 0 || --sedmlns->mNumReferences == 0)
+  {
+    delete sedmlns;
+  }
+}
+
+
+SedNamespaces*
+SedNamespaces::unshare(SedNamespaces* sedmlns)
+{
+  if (sedmlns == NULL || sedmlns->mNumReferences <= 1)
+  {
+    return sedmlns;
+  }
+
+  // the copy can be shared in turn by the elements created from it
+  SedNamespaces* copy = sedmlns->clone();
+  copy->mNumReferences = 1;
+  --sedmlns->mNumReferences;
+  return copy;
+}
+
+/** @endcond */
+
+
 std::string 
 SedNamespaces::getSedNamespaceURI(unsigned int level,
                                  unsigned int version)
@@ -63,6 +63,11 @@ static const char* const SEDML_XMLNS_L1V1   = "http://sed-ml.org/";
 #include <string>
 #include <stdexcept>
 
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#  include <atomic>
+#  define LIBSEDML_HAS_SHARED_NAMESPACES 1
+#endif
+
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
 class LIBSEDML_EXTERN SedNamespaces
@@ -273,6 +278,52 @@ public:
   void setNamespaces(XMLNamespaces * xmlns);
   /** @endcond */
 
+
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Returns a shared SedNamespaces object equal to @p sedmlns.
+   *
+   * If @p sedmlns is itself shared (as the namespaces of a document are)
+   * one more reference is taken on it, so that the elements created from
+   * the namespaces of a document share them rather than each owning a
+   * copy; otherwise a shared copy of @p sedmlns is made.  The caller holds
+   * one reference, which must be given back with release().  A shared
+   * object must not be modified; use unshare() first.
+   *
+   * Sharing needs atomic reference counts (C++11 or MSVC 2012 and later);
+   * without them every caller is simply given a copy of its own.
+   *
+   * @param sedmlns the SedNamespaces object to share or copy.
+   *
+   * @return the shared SedNamespaces object, or @c NULL if @p sedmlns
+   * is @c NULL.
+   */
+  static SedNamespaces* intern(const SedNamespaces* sedmlns);
+
+
+  /**
+   * Makes @p sedmlns, which the caller owns, shareable, and returns it with
+   * the caller holding the one reference to it.
+   */
+  static SedNamespaces* internAndOwn(SedNamespaces* sedmlns);
+
+
+  /**
+   * Gives back a reference obtained from intern(), internAndOwn() or
+   * unshare(); the object is deleted once no reference is left.
+   */
+  static void release(SedNamespaces* sedmlns);
+
+
+  /**
+   * Returns an SedNamespaces object equal to @p sedmlns that the caller
+   * holds the only reference to and may modify, copying it if it is
+   * shared (copy-on-write).  The reference held on @p sedmlns is passed on
+   * to the result.
+   */
+  static SedNamespaces* unshare(SedNamespaces* sedmlns);
+  /** @endcond */
+
 protected:  
   /** @cond doxygenLibsedmlInternal */
   void initSedNamespace();
@@ -281,6 +332,13 @@ protected:
   unsigned int    mVersion;
   XMLNamespaces * mNamespaces;
 
+  /* the number of holders of a shared object, or 0 if it is not shared */
+#ifdef LIBSEDML_HAS_SHARED_NAMESPACES
+  mutable std::atomic<unsigned int> mNumReferences;
+#else
+  mutable unsigned int mNumReferences;
+#endif
+
   /** @endcond */
 };
 
@@ -105,6 +105,38 @@ SedOutput::operator=(const SedOutput& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedOutput.
+ */
+SedOutput::SedOutput(SedOutput&& orig)
+  : SedBase( std::move(orig) )
+  , mName ( std::move(orig.mName) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedOutput.
+ */
+SedOutput&
+SedOutput::operator=(SedOutput&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mName = std::move(rhs.mName);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedOutput object.
  */
@@ -169,6 +201,8 @@ SedOutput::isSetName() const
 int
 SedOutput::setId(const std::string& id)
 {
+  prepareForChange();
+  updateIdIndices(mId, id);
   mId = id;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -180,6 +214,7 @@ SedOutput::setId(const std::string& id)
 int
 SedOutput::setName(const std::string& name)
 {
+  prepareForChange();
   mName = name;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -191,6 +226,8 @@ SedOutput::setName(const std::string& name)
 int
 SedOutput::unsetId()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -210,6 +247,7 @@ SedOutput::unsetId()
 int
 SedOutput::unsetName()
 {
+  prepareForChange();
   mName.erase();
 
   if (mName.empty() == true)
@@ -665,25 +703,24 @@ SedOutput::readAttributes(
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlDocumentLOOutputsAllowedCoreAttributes, level,
           version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlOutputAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
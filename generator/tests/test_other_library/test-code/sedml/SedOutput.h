@@ -117,6 +117,28 @@ public:
   SedOutput& operator=(const SedOutput& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedOutput.
+   *
+   * @param orig the SedOutput instance to move; it is left as an empty
+   * SedOutput in the place it had.
+   */
+  SedOutput(SedOutput&& orig);
+
+
+  /**
+   * Move assignment operator for SedOutput.
+   *
+   * @param rhs the SedOutput object whose values are to be moved into this
+   * one; it is left as an empty SedOutput in the place it had.
+   */
+  SedOutput& operator=(SedOutput&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedOutput object.
    *
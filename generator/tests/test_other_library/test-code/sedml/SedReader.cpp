@@ -33,6 +33,15 @@
  */
 
 
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include <sbml/xml/XMLError.h>
 #include <sbml/xml/XMLErrorLog.h>
 #include <sbml/xml/XMLInputStream.h>
@@ -60,6 +69,8 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  * Creates a new SedReader and returns it. 
  */
 SedReader::SedReader ()
+  : mUseArena (false)
+  , mUseMemoryMap (false)
 {
 }
 
@@ -111,6 +122,18 @@ SedReader::readSedMLFromFile (const std::string& filename)
 }
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return true if the content begins with an XML declaration.
+ */
+static bool
+hasXMLDeclaration (const char* content, size_t length)
+{
+  return length >= 14 && !strncmp(content, "<?xml version=", 14);
+}
+/** @endcond */
+
+
 /*
  * Reads an Sed document from the given XML string.
  *
@@ -118,7 +141,7 @@ SedReader::readSedMLFromFile (const std::string& filename)
  *
  *   <?xml version='1.0' encoding='UTF-8'?>
  *
- * it will be prepended.
+ * it is read as if it did.
  *
  * This method will log a fatal error if the XML string is not Sed.  See
  * the method documentation for readSedML(filename) for example error
@@ -129,16 +152,36 @@ SedReader::readSedMLFromFile (const std::string& filename)
 SedDocument*
 SedReader::readSedMLFromString (const std::string& xml)
 {
-  const static string dummy_xml ("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");  
-  
-  if (!strncmp(xml.c_str(), dummy_xml.c_str(), 14))
+  return readInternal(xml.c_str(), false,
+                      hasXMLDeclaration(xml.c_str(), xml.size()));
+}
+
+
+/*
+ * Reads an Sed document from the given buffer.  XMLInputStream (and the
+ * parsers behind it) take no length and read up to a null character, so
+ * the buffer is copied unless its last byte is one.
+ */
+SedDocument*
+SedReader::readSedMLFromBuffer (const char* data, size_t length)
+{
+  if (data == NULL)
+  {
+    return readSedMLFromString("");
+  }
+
+  bool hasDeclaration = hasXMLDeclaration(data, length);
+
+  // content with a null character before its last byte is read up to it
+  // whether or not it is copied, so there is no need to look for one
+  if (length > 0 && data[length - 1] == '\0')
   {
-    return readInternal(xml.c_str(), false);
+    return readInternal(data, false, hasDeclaration);
   }
   else
   {
-    const std::string temp = (dummy_xml + xml);
-    return readInternal(temp.c_str(), false);
+    const std::string temp(data, length);
+    return readInternal(temp.c_str(), false, hasDeclaration);
   }
 }
 
@@ -169,6 +212,144 @@ SedReader::hasBzip2()
 }
 
 
+/*
+ * Sets whether the documents read allocate their elements from an arena.
+ */
+void
+SedReader::setUseArena (bool useArena)
+{
+  mUseArena = useArena;
+}
+
+
+/*
+ * @return true if the documents read allocate their elements from an arena.
+ */
+bool
+SedReader::getUseArena () const
+{
+  return mUseArena;
+}
+
+
+/*
+ * Sets whether files are read through a memory mapping.
+ */
+void
+SedReader::setUseMemoryMap (bool useMemoryMap)
+{
+  mUseMemoryMap = useMemoryMap;
+}
+
+
+/*
+ * @return true if files are read through a memory mapping.
+ */
+bool
+SedReader::getUseMemoryMap () const
+{
+  return mUseMemoryMap;
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * @return true if the file will be read through a decompressor.
+ */
+static bool
+isCompressedFile (const std::string& filename)
+{
+  static const char* suffixes[] = { ".gz", ".bz2", ".zip" };
+
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    size_t length = strlen(suffixes[i]);
+
+    if (filename.size() >= length &&
+        strcmp_insensitive(filename.c_str() + filename.size() - length,
+                           suffixes[i]) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * The content of a file mapped into memory so that it can be parsed
+ * without being read through stdio.  The parsers need the content to be
+ * followed by a null character; the bytes between the end of a file and
+ * the end of its last page read as zero, so only files that do not fill
+ * their last page are mapped.  Other files, and all files on platforms
+ * without mmap, are left to be read as before.
+ */
+class MappedFile
+{
+public:
+
+  MappedFile (const char* filename)
+    : mContent (NULL)
+    , mLength (0)
+  {
+#if !defined(_WIN32)
+    if (filename == NULL) return;
+
+    int fd = open(filename, O_RDONLY);
+
+    if (fd < 0) return;
+
+    struct stat info;
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) &&
+        info.st_size > 0 && pageSize > 0 && info.st_size % pageSize != 0)
+    {
+      void* content = mmap(NULL, (size_t)info.st_size, PROT_READ,
+                           MAP_PRIVATE, fd, 0);
+
+      if (content != MAP_FAILED)
+      {
+        madvise(content, (size_t)info.st_size, MADV_SEQUENTIAL);
+        mContent = static_cast<const char*>(content);
+        mLength = (size_t)info.st_size;
+      }
+    }
+
+    close(fd);
+#endif
+  }
+
+
+  ~MappedFile ()
+  {
+#if !defined(_WIN32)
+    if (mContent != NULL)
+    {
+      munmap(const_cast<char*>(mContent), mLength);
+    }
+#endif
+  }
+
+
+  const char* getContent () const
+  {
+    return mContent;
+  }
+
+
+private:
+
+  MappedFile (const MappedFile&);
+  MappedFile& operator= (const MappedFile&);
+
+  const char* mContent;
+  size_t      mLength;
+};
+/** @endcond */
+
+
 /** @cond doxygenLibsedmlInternal */
 static bool
 isCriticalError(const unsigned int errorId)
@@ -204,25 +385,56 @@ isCriticalError(const unsigned int errorId)
 
 /** @cond doxygenLibsedmlInternal */
 /*
- * Used by readSedML() and readSedMLFromString().
+ * Predicate used to keep only the critical errors in the log.
+ */
+struct IsCriticalError
+{
+  bool operator() (const XMLError* error) const
+  {
+    return isCriticalError(error->getErrorId());
+  }
+};
+/** @endcond */
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Used by readSedML(), readSedMLFromString() and readSedMLFromBuffer().
  */
 SedDocument*
-SedReader::readInternal (const char* content, bool isFile)
+SedReader::readInternal (const char* content, bool isFile, bool hasDeclaration)
 {
   SedDocument* d = new SedDocument();
 
+  if (mUseArena)
+  {
+    d->getArena()->setEnabled(true);
+  }
+
   if (isFile && content != NULL && (util_file_exists(content) == false))
   {
     d->getErrorLog()->logError(XMLFileUnreadable);
   }
   else 
   {
+    // uncompressed files may be parsed straight from the page cache
+    bool mapFile = isFile && content != NULL && mUseMemoryMap &&
+                   !isCompressedFile(content);
+    MappedFile mapped(mapFile ? content : NULL);
+
+    if (mapped.getContent() != NULL)
+    {
+      content = mapped.getContent();
+      isFile = false;
+    }
+
     XMLInputStream stream(content, isFile, "", d->getErrorLog());
 
     if (stream.peek().isStart() && stream.peek().getName() != "sedML")
     {
       // the root element ought to be an sedml element. 
       d->getErrorLog()->logError(SedNotSchemaConformant);
+      d->getArena()->setEnabled(false);
 	  return d;
     }
 	
@@ -243,17 +455,13 @@ SedReader::readInternal (const char* content, bool isFile)
           // If we find even one critical error, all other errors are
           // suspect and may be bogus.  Remove them.
 
-          for (int n = (int)d->getNumErrors()-1; n >= 0; --n)
-            if (!isCriticalError(d->getError((unsigned int)n)->getErrorId()))
-            {
-              d->getErrorLog()->remove(d->getError((unsigned int)n)->getErrorId());
-            }
+          d->getErrorLog()->retainIf(IsCriticalError());
 
           break;
         }
       }
     }
-    else
+    else if (hasDeclaration)
     {
       // Low-level XML errors will have been caught in the first read,
       // before we even attempt to interpret the content as Sed.  Here
@@ -278,6 +486,10 @@ SedReader::readInternal (const char* content, bool isFile)
       }
     }
   }
+
+  // only the elements read are allocated from the arena; those created
+  // afterwards come from the heap as usual
+  d->getArena()->setEnabled(false);
   return d;
 }
 /** @endcond */
@@ -335,6 +547,17 @@ SedReader_readSedMLFromString (SedReader_t *sr, const char *xml)
 }
 
 
+LIBSEDML_EXTERN
+SedDocument_t *
+SedReader_readSedMLFromBuffer (SedReader_t *sr, const char *data, size_t length)
+{
+  if (sr != NULL)
+    return sr->readSedMLFromBuffer(data, length);
+  else
+    return NULL;
+}
+
+
 LIBSEDML_EXTERN
 int
 SedReader_hasZlib (void)
@@ -377,6 +600,15 @@ readSedMLFromString (const char *xml)
   return (xml != NULL) ? sr.readSedMLFromString(xml) : sr.readSedMLFromString("");
 }
 
+
+LIBSEDML_EXTERN
+SedDocument_t *
+readSedMLFromBuffer (const char *data, size_t length)
+{
+  SedReader sr;
+  return sr.readSedMLFromBuffer(data, length);
+}
+
 LIBSEDML_CPP_NAMESPACE_END
 /** @endcond */
 
@@ -116,6 +116,28 @@ public:
   SedDocument* readSedMLFromString (const std::string& xml);
 
 
+  /**
+   * Reads a document from the @p length bytes of SEDML content held
+   * in @p data.
+   *
+   * Content that does not begin with an XML declaration is read as if it
+   * began with <code>&lt;?xml version='1.0' encoding='UTF-8'?&gt;</code>,
+   * as for readSedMLFromString(), but without a copy being made to prepend
+   * one.  The XML parsers take no length and read up to a null character,
+   * so content is read in place only if its last byte (<code>data[length -
+   * 1]</code>) is a null character; any other content is copied once.
+   *
+   * @param data the buffer holding the SEDML content.
+   * @param length the number of bytes of content in @p data.
+   *
+   * @return a pointer to the SedDocument created from the SEDML
+   * content.
+   *
+   * @see readSedMLFromString(@if java String@endif)
+   */
+  SedDocument* readSedMLFromBuffer (const char* data, size_t length);
+
+
   /**
    * Static method; returns @c true if this copy of libSEDML supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -140,12 +162,66 @@ public:
   static bool hasBzip2();
 
 
+  /**
+   * Sets whether the documents read by this SedReader allocate their
+   * elements from an arena.
+   *
+   * Allocating from an arena makes reading and destroying large documents
+   * faster, at the cost of not reusing the memory of elements deleted
+   * while the document is alive.  It is off by default.
+   *
+   * @param useArena @c true to allocate the elements from an arena.
+   */
+  void setUseArena (bool useArena);
+
+
+  /**
+   * Predicate returning @c true if the documents read by this SedReader
+   * allocate their elements from an arena.
+   *
+   * @see setUseArena(bool useArena)
+   */
+  bool getUseArena () const;
+
+
+  /**
+   * Sets whether this SedReader reads uncompressed files through a
+   * memory mapping rather than through stdio.
+   *
+   * Parsing a large file straight from the page cache saves copying it
+   * through stdio buffers.  The file must not be truncated while it is
+   * being read.  Compressed files, and all files on platforms without
+   * mmap, are read as usual.  It is off by default.
+   *
+   * @param useMemoryMap @c true to read files through a memory mapping.
+   */
+  void setUseMemoryMap (bool useMemoryMap);
+
+
+  /**
+   * Predicate returning @c true if this SedReader reads uncompressed
+   * files through a memory mapping.
+   *
+   * @see setUseMemoryMap(bool useMemoryMap)
+   */
+  bool getUseMemoryMap () const;
+
+
 protected:
   /** @cond doxygenLibsedmlInternal */
   /**
-   * Used by readSedML() and readSedMLFromString().
+   * Used by readSedML(), readSedMLFromString() and readSedMLFromBuffer().
+   *
+   * The declaration of content read with @p hasDeclaration @c false is
+   * not checked.
    */
-  SedDocument* readInternal (const char* content, bool isFile = true);
+  SedDocument* readInternal (const char* content, bool isFile = true,
+                              bool hasDeclaration = true);
+
+
+  bool mUseArena;
+
+  bool mUseMemoryMap;
 
   /** @endcond */
 };
@@ -244,6 +320,24 @@ SedDocument_t *
 SedReader_readSedMLFromString (SedReader_t *sr, const char *xml);
 
 
+/**
+ * @param sr the SedReader_t structure to use
+ *
+ * @param data the buffer holding the input xml.
+ *
+ * @param length the number of bytes of input xml in @p data.
+ *
+ * @return a pointer to the SedDocument read.
+ *
+ * @if conly
+ * @memberof SedReader_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+SedDocument_t *
+SedReader_readSedMLFromBuffer (SedReader_t *sr, const char *data, size_t length);
+
+
 /**
  * Returns @c true if the underlying libSEDML supports @em gzip and @em zlib
  * format compression.
@@ -324,6 +418,23 @@ SedDocument_t *
 readSedMLFromString (const char *xml);
 
 
+/**
+ * @param data the buffer holding a full Sed model
+ *
+ * @param length the number of bytes of content in @p data.
+ *
+ * @return a pointer to the SedDocument structure created from the Sed
+ * content in @p data.
+ *
+ * @if conly
+ * @memberof SedReader_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+SedDocument_t *
+readSedMLFromBuffer (const char *data, size_t length);
+
+
 END_C_DECLS
 LIBSEDML_CPP_NAMESPACE_END
 
@@ -128,6 +128,48 @@ SedRepeatedTask::operator=(const SedRepeatedTask& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedRepeatedTask.
+ */
+SedRepeatedTask::SedRepeatedTask(SedRepeatedTask&& orig)
+  : SedAbstractTask( std::move(orig) )
+  , mRangeId ( std::move(orig.mRangeId) )
+  , mResetModel ( orig.mResetModel )
+  , mIsSetResetModel ( orig.mIsSetResetModel )
+  , mRanges ( std::move(orig.mRanges) )
+  , mSetValues ( std::move(orig.mSetValues) )
+  , mSubTasks ( std::move(orig.mSubTasks) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedRepeatedTask.
+ */
+SedRepeatedTask&
+SedRepeatedTask::operator=(SedRepeatedTask&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedAbstractTask::operator=(std::move(rhs));
+    mRangeId = std::move(rhs.mRangeId);
+    mResetModel = rhs.mResetModel;
+    mIsSetResetModel = rhs.mIsSetResetModel;
+    mRanges = std::move(rhs.mRanges);
+    mSetValues = std::move(rhs.mSetValues);
+    mSubTasks = std::move(rhs.mSubTasks);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedRepeatedTask object.
  */
@@ -194,12 +236,15 @@ SedRepeatedTask::isSetResetModel() const
 int
 SedRepeatedTask::setRangeId(const std::string& rangeId)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidInternalSId(range)))
   {
     return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    updateReferenceIndices("range", mRangeId, rangeId);
     mRangeId = rangeId;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -212,6 +257,7 @@ SedRepeatedTask::setRangeId(const std::string& rangeId)
 int
 SedRepeatedTask::setResetModel(bool resetModel)
 {
+  prepareForChange();
   mResetModel = resetModel;
   mIsSetResetModel = true;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -224,6 +270,8 @@ SedRepeatedTask::setResetModel(bool resetModel)
 int
 SedRepeatedTask::unsetRangeId()
 {
+  prepareForChange();
+  updateReferenceIndices("range", mRangeId, "");
   mRangeId.erase();
 
   if (mRangeId.empty() == true)
@@ -243,6 +291,7 @@ SedRepeatedTask::unsetRangeId()
 int
 SedRepeatedTask::unsetResetModel()
 {
+  prepareForChange();
   mResetModel = false;
   mIsSetResetModel = false;
 
@@ -376,7 +425,7 @@ SedRepeatedTask::createUniformRange()
 
   try
   {
-    sur = new SedUniformRange(getSedNamespaces());
+    sur = new (getDocumentArena()) SedUniformRange(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -402,7 +451,7 @@ SedRepeatedTask::createVectorRange()
 
   try
   {
-    svr = new SedVectorRange(getSedNamespaces());
+    svr = new (getDocumentArena()) SedVectorRange(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -428,7 +477,8 @@ SedRepeatedTask::createFunctionalRange()
 
   try
   {
-    sfr = new SedFunctionalRange(getSedNamespaces());
+    sfr = new (getDocumentArena())
+      SedFunctionalRange(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -454,7 +504,7 @@ SedRepeatedTask::createDataRange()
 
   try
   {
-    sdr = new SedDataRange(getSedNamespaces());
+    sdr = new (getDocumentArena()) SedDataRange(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -634,7 +684,7 @@ SedRepeatedTask::createTaskChange()
 
   try
   {
-    ssv = new SedSetValue(getSedNamespaces());
+    ssv = new (getDocumentArena()) SedSetValue(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -778,7 +828,7 @@ SedRepeatedTask::createSubTask()
 
   try
   {
-    sst = new SedSubTask(getSedNamespaces());
+    sst = new (getDocumentArena()) SedSubTask(getSharedSedNamespaces());
   }
   catch (...)
   {
@@ -1531,6 +1581,24 @@ SedRepeatedTask::addExpectedAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Adds the names of the SIdRef attributes of this element
+ */
+void
+SedRepeatedTask::addReferenceAttributes(std::vector<std::string>& attributes)
+  const
+{
+  SedAbstractTask::addReferenceAttributes(attributes);
+
+  attributes.push_back("range");
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
@@ -1549,18 +1617,17 @@ SedRepeatedTask::readAttributes(
   bool assigned = false;
   SedErrorLog* log = getErrorLog();
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedAbstractTask::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlRepeatedTaskAllowedAttributes, level, version,
           details, getLine(), getColumn());
       }
@@ -1604,9 +1671,9 @@ SedRepeatedTask::readAttributes(
   if (mIsSetResetModel == false)
   {
     if (log && log->getNumErrors() == numErrs + 1 &&
-      log->contains(XMLAttributeTypeMismatch))
+      log->contains(XMLAttributeTypeMismatch, numErrs))
     {
-      log->remove(XMLAttributeTypeMismatch);
+      log->remove(XMLAttributeTypeMismatch, numErrs);
       log->logError(SedmlRepeatedTaskResetModelMustBeBoolean, level, version);
     }
   }
@@ -121,6 +121,28 @@ public:
   SedRepeatedTask& operator=(const SedRepeatedTask& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedRepeatedTask.
+   *
+   * @param orig the SedRepeatedTask instance to move; it is left as an empty
+   * SedRepeatedTask in the place it had.
+   */
+  SedRepeatedTask(SedRepeatedTask&& orig);
+
+
+  /**
+   * Move assignment operator for SedRepeatedTask.
+   *
+   * @param rhs the SedRepeatedTask object whose values are to be moved into
+   * this one; it is left as an empty SedRepeatedTask in the place it had.
+   */
+  SedRepeatedTask& operator=(SedRepeatedTask&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedRepeatedTask object.
    *
@@ -1367,6 +1389,18 @@ protected:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Adds the names of the SIdRef attributes of this element
+   */
+  virtual void addReferenceAttributes(std::vector<std::string>& attributes)
+    const;
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
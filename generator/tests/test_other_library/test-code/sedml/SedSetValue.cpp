@@ -132,6 +132,50 @@ SedSetValue::operator=(const SedSetValue& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedSetValue.
+ */
+SedSetValue::SedSetValue(SedSetValue&& orig)
+  : SedBase( std::move(orig) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mSymbol ( std::move(orig.mSymbol) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mRange ( std::move(orig.mRange) )
+  , mMath ( orig.mMath )
+{
+  orig.mMath = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedSetValue.
+ */
+SedSetValue&
+SedSetValue::operator=(SedSetValue&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mModelReference = std::move(rhs.mModelReference);
+    mSymbol = std::move(rhs.mSymbol);
+    mTarget = std::move(rhs.mTarget);
+    mRange = std::move(rhs.mRange);
+    delete mMath;
+    mMath = rhs.mMath;
+    rhs.mMath = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedSetValue object.
  */
@@ -239,12 +283,15 @@ SedSetValue::isSetRange() const
 int
 SedSetValue::setModelReference(const std::string& modelReference)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidInternalSId(modelReference)))
   {
     return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    updateReferenceIndices("modelReference", mModelReference, modelReference);
     mModelReference = modelReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -257,6 +304,7 @@ SedSetValue::setModelReference(const std::string& modelReference)
 int
 SedSetValue::setSymbol(const std::string& symbol)
 {
+  prepareForChange();
   mSymbol = symbol;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -268,6 +316,7 @@ SedSetValue::setSymbol(const std::string& symbol)
 int
 SedSetValue::setTarget(const std::string& target)
 {
+  prepareForChange();
   mTarget = target;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -279,12 +328,15 @@ SedSetValue::setTarget(const std::string& target)
 int
 SedSetValue::setRange(const std::string& range)
 {
+  prepareForChange();
+
   if (!(SyntaxChecker::isValidInternalSId(range)))
   {
     return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    updateReferenceIndices("range", mRange, range);
     mRange = range;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -297,6 +349,8 @@ SedSetValue::setRange(const std::string& range)
 int
 SedSetValue::unsetModelReference()
 {
+  prepareForChange();
+  updateReferenceIndices("modelReference", mModelReference, "");
   mModelReference.erase();
 
   if (mModelReference.empty() == true)
@@ -316,6 +370,7 @@ SedSetValue::unsetModelReference()
 int
 SedSetValue::unsetSymbol()
 {
+  prepareForChange();
   mSymbol.erase();
 
   if (mSymbol.empty() == true)
@@ -335,6 +390,7 @@ SedSetValue::unsetSymbol()
 int
 SedSetValue::unsetTarget()
 {
+  prepareForChange();
   mTarget.erase();
 
   if (mTarget.empty() == true)
@@ -354,6 +410,8 @@ SedSetValue::unsetTarget()
 int
 SedSetValue::unsetRange()
 {
+  prepareForChange();
+  updateReferenceIndices("range", mRange, "");
   mRange.erase();
 
   if (mRange.empty() == true)
@@ -403,6 +461,8 @@ SedSetValue::isSetMath() const
 int
 SedSetValue::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 {
+  prepareForChange();
+
   if (mMath == math)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -432,6 +492,7 @@ SedSetValue::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 int
 SedSetValue::unsetMath()
 {
+  prepareForChange();
   delete mMath;
   mMath = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -653,25 +714,39 @@ SedSetValue::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "modelReference")
-  {
-    value = getModelReference();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "symbol")
-  {
-    value = getSymbol();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "target")
+  switch (attributeName.size())
   {
-    value = getTarget();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "range")
-  {
-    value = getRange();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
+  case 5:
+    if (attributeName == "range")
+    {
+      value = getRange();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 6:
+    if (attributeName == "symbol")
+    {
+      value = getSymbol();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+    else if (attributeName == "target")
+    {
+      value = getTarget();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    break;
+  case 14:
+    if (attributeName == "modelReference")
+    {
+      value = getModelReference();
+      return_value = LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -692,21 +767,35 @@ SedSetValue::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SedBase::isSetAttribute(attributeName);
 
-  if (attributeName == "modelReference")
-  {
-    value = isSetModelReference();
-  }
-  else if (attributeName == "symbol")
-  {
-    value = isSetSymbol();
-  }
-  else if (attributeName == "target")
-  {
-    value = isSetTarget();
-  }
-  else if (attributeName == "range")
+  switch (attributeName.size())
   {
-    value = isSetRange();
+  case 5:
+    if (attributeName == "range")
+    {
+      value = isSetRange();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "symbol")
+    {
+      value = isSetSymbol();
+    }
+    else if (attributeName == "target")
+    {
+      value = isSetTarget();
+    }
+
+    break;
+  case 14:
+    if (attributeName == "modelReference")
+    {
+      value = isSetModelReference();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -796,21 +885,35 @@ SedSetValue::setAttribute(const std::string& attributeName,
 {
   int return_value = SedBase::setAttribute(attributeName, value);
 
-  if (attributeName == "modelReference")
-  {
-    return_value = setModelReference(value);
-  }
-  else if (attributeName == "symbol")
+  switch (attributeName.size())
   {
-    return_value = setSymbol(value);
-  }
-  else if (attributeName == "target")
-  {
-    return_value = setTarget(value);
-  }
-  else if (attributeName == "range")
-  {
-    return_value = setRange(value);
+  case 5:
+    if (attributeName == "range")
+    {
+      return_value = setRange(value);
+    }
+
+    break;
+  case 6:
+    if (attributeName == "symbol")
+    {
+      return_value = setSymbol(value);
+    }
+    else if (attributeName == "target")
+    {
+      return_value = setTarget(value);
+    }
+
+    break;
+  case 14:
+    if (attributeName == "modelReference")
+    {
+      return_value = setModelReference(value);
+    }
+
+    break;
+  default:
+    break;
   }
 
   return return_value;
@@ -830,21 +933,35 @@ SedSetValue::unsetAttribute(const std::string& attributeName)
 {
   int value = SedBase::unsetAttribute(attributeName);
 
-  if (attributeName == "modelReference")
-  {
-    value = unsetModelReference();
-  }
-  else if (attributeName == "symbol")
-  {
-    value = unsetSymbol();
-  }
-  else if (attributeName == "target")
-  {
-    value = unsetTarget();
-  }
-  else if (attributeName == "range")
+  switch (attributeName.size())
   {
-    value = unsetRange();
+  case 5:
+    if (attributeName == "range")
+    {
+      value = unsetRange();
+    }
+
+    break;
+  case 6:
+    if (attributeName == "symbol")
+    {
+      value = unsetSymbol();
+    }
+    else if (attributeName == "target")
+    {
+      value = unsetTarget();
+    }
+
+    break;
+  case 14:
+    if (attributeName == "modelReference")
+    {
+      value = unsetModelReference();
+    }
+
+    break;
+  default:
+    break;
   }
 
   return value;
@@ -878,6 +995,25 @@ SedSetValue::addExpectedAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Adds the names of the SIdRef attributes of this element
+ */
+void
+SedSetValue::addReferenceAttributes(std::vector<std::string>& attributes) const
+{
+  SedBase::addReferenceAttributes(attributes);
+
+  attributes.push_back("modelReference");
+
+  attributes.push_back("range");
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
@@ -905,25 +1041,24 @@ SedSetValue::readAttributes(
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlRepeatedTaskLOSetValuesAllowedCoreAttributes, level,
           version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlSetValueAllowedAttributes, level, version, details,
           getLine(), getColumn());
       }
@@ -117,6 +117,28 @@ public:
   SedSetValue& operator=(const SedSetValue& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedSetValue.
+   *
+   * @param orig the SedSetValue instance to move; it is left as an empty
+   * SedSetValue in the place it had.
+   */
+  SedSetValue(SedSetValue&& orig);
+
+
+  /**
+   * Move assignment operator for SedSetValue.
+   *
+   * @param rhs the SedSetValue object whose values are to be moved into this
+   * one; it is left as an empty SedSetValue in the place it had.
+   */
+  SedSetValue& operator=(SedSetValue&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedSetValue object.
    *
@@ -699,6 +721,18 @@ protected:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Adds the names of the SIdRef attributes of this element
+   */
+  virtual void addReferenceAttributes(std::vector<std::string>& attributes)
+    const;
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -127,6 +127,46 @@ SedSimulation::operator=(const SedSimulation& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedSimulation.
+ */
+SedSimulation::SedSimulation(SedSimulation&& orig)
+  : SedBase( std::move(orig) )
+  , mName ( std::move(orig.mName) )
+  , mAlgorithm ( orig.mAlgorithm )
+  , mElementName ( std::move(orig.mElementName) )
+{
+  orig.mAlgorithm = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedSimulation.
+ */
+SedSimulation&
+SedSimulation::operator=(SedSimulation&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mName = std::move(rhs.mName);
+    mElementName = std::move(rhs.mElementName);
+    delete mAlgorithm;
+    mAlgorithm = rhs.mAlgorithm;
+    rhs.mAlgorithm = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedSimulation object.
  */
@@ -193,6 +233,8 @@ SedSimulation::isSetName() const
 int
 SedSimulation::setId(const std::string& id)
 {
+  prepareForChange();
+  updateIdIndices(mId, id);
   mId = id;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -204,6 +246,7 @@ SedSimulation::setId(const std::string& id)
 int
 SedSimulation::setName(const std::string& name)
 {
+  prepareForChange();
   mName = name;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -215,6 +258,8 @@ SedSimulation::setName(const std::string& name)
 int
 SedSimulation::unsetId()
 {
+  prepareForChange();
+  updateIdIndices(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -234,6 +279,7 @@ SedSimulation::unsetId()
 int
 SedSimulation::unsetName()
 {
+  prepareForChange();
   mName.erase();
 
   if (mName.empty() == true)
@@ -284,6 +330,8 @@ SedSimulation::isSetAlgorithm() const
 int
 SedSimulation::setAlgorithm(const SedAlgorithm* algorithm)
 {
+  prepareForChange();
+
   if (mAlgorithm == algorithm)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -315,12 +363,14 @@ SedSimulation::setAlgorithm(const SedAlgorithm* algorithm)
 SedAlgorithm*
 SedSimulation::createAlgorithm()
 {
+  prepareForChange();
+
   if (mAlgorithm != NULL)
   {
     delete mAlgorithm;
   }
 
-  mAlgorithm = new SedAlgorithm(getSedNamespaces());
+  mAlgorithm = new (getDocumentArena()) SedAlgorithm(getSharedSedNamespaces());
 
   connectToChild();
 
@@ -334,6 +384,7 @@ SedSimulation::createAlgorithm()
 int
 SedSimulation::unsetAlgorithm()
 {
+  prepareForChange();
   delete mAlgorithm;
   mAlgorithm = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -926,7 +977,8 @@ SedSimulation::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
     }
 
     delete mAlgorithm;
-    mAlgorithm = new SedAlgorithm(getSedNamespaces());
+    mAlgorithm = new (getDocumentArena())
+      SedAlgorithm(getSharedSedNamespaces());
     obj = mAlgorithm;
   }
 
@@ -986,25 +1038,24 @@ SedSimulation::readAttributes(
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlDocumentLOSimulationsAllowedCoreAttributes, level,
           version, details, getLine(), getColumn());
       }
     }
   }
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlSimulationAllowedAttributes, level, version,
           details, getLine(), getColumn());
       }
@@ -120,6 +120,28 @@ public:
   SedSimulation& operator=(const SedSimulation& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedSimulation.
+   *
+   * @param orig the SedSimulation instance to move; it is left as an empty
+   * SedSimulation in the place it had.
+   */
+  SedSimulation(SedSimulation&& orig);
+
+
+  /**
+   * Move assignment operator for SedSimulation.
+   *
+   * @param rhs the SedSimulation object whose values are to be moved into this
+   * one; it is left as an empty SedSimulation in the place it had.
+   */
+  SedSimulation& operator=(SedSimulation&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedSimulation object.
    *
@@ -97,6 +97,36 @@ SedVectorRange::operator=(const SedVectorRange& rhs)
 }
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+/*
+ * Move constructor for SedVectorRange.
+ */
+SedVectorRange::SedVectorRange(SedVectorRange&& orig)
+  : SedRange( std::move(orig) )
+  , mValue ( std::move(orig.mValue) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedVectorRange.
+ */
+SedVectorRange&
+SedVectorRange::operator=(SedVectorRange&& rhs)
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mValue = std::move(rhs.mValue);
+  }
+
+  return *this;
+}
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
 /*
  * Creates and returns a deep copy of this SedVectorRange object.
  */
@@ -152,6 +182,7 @@ SedVectorRange::getNumValues() const
 int
 SedVectorRange::setValues(const std::vector<double>& value)
 {
+  prepareForChange();
   mValue = value;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -163,6 +194,7 @@ SedVectorRange::setValues(const std::vector<double>& value)
 int
 SedVectorRange::addValue(double value)
 {
+  prepareForChange();
   mValue.push_back(value);
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -174,6 +206,7 @@ SedVectorRange::addValue(double value)
 int
 SedVectorRange::clearValues()
 {
+  prepareForChange();
   mValue.clear();
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -551,18 +584,17 @@ SedVectorRange::readAttributes(
   bool assigned = false;
   SedErrorLog* log = getErrorLog();
 
+  numErrs = log ? log->getNumErrors() : 0;
   SedRange::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
-    numErrs = log->getNumErrors();
-
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = log->getNumErrors()-1; n >= (int)numErrs; n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
+        log->remove(SedUnknownCoreAttribute, n);
         log->logError(SedmlVectorRangeAllowedAttributes, level, version,
           details, getLine(), getColumn());
       }
@@ -114,6 +114,28 @@ public:
   SedVectorRange& operator=(const SedVectorRange& rhs);
 
 
+#ifdef LIBSEDML_HAS_MOVE_SEMANTICS
+  /**
+   * Move constructor for SedVectorRange.
+   *
+   * @param orig the SedVectorRange instance to move; it is left as an empty
+   * SedVectorRange in the place it had.
+   */
+  SedVectorRange(SedVectorRange&& orig);
+
+
+  /**
+   * Move assignment operator for SedVectorRange.
+   *
+   * @param rhs the SedVectorRange object whose values are to be moved into
+   * this one; it is left as an empty SedVectorRange in the place it had.
+   */
+  SedVectorRange& operator=(SedVectorRange&& rhs);
+
+
+#endif  /* LIBSEDML_HAS_MOVE_SEMANTICS */
+
+
   /**
    * Creates and returns a deep copy of this SedVectorRange object.
    *
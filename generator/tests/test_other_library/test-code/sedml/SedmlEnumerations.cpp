@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <string>
+#include <cstring>
 #include <sedml/common/SedmlEnumerations.h>
 
 
@@ -75,15 +76,29 @@ LIBSEDML_EXTERN
 MappingType_t
 MappingType_fromString(const char* code)
 {
-  static int size = sizeof(SEDML_MAPPING_TYPE_STRINGS)/sizeof(SEDML_MAPPING_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return SEDML_MAPPINGTYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SEDML_MAPPING_TYPE_STRINGS[i])
+  case 8:
+    if (strcmp(code, SEDML_MAPPING_TYPE_STRINGS[0]) == 0)
+    {
+      return SEDML_MAPPINGTYPE_VARIABLE;
+    }
+
+    break;
+  case 9:
+    if (strcmp(code, SEDML_MAPPING_TYPE_STRINGS[1]) == 0)
     {
-      return (MappingType_t)(i);
+      return SEDML_MAPPINGTYPE_PARAMETER;
     }
+
+    break;
+  default:
+    break;
   }
 
   return SEDML_MAPPINGTYPE_INVALID;
@@ -160,16 +175,29 @@ LIBSEDML_EXTERN
 AxisType_t
 AxisType_fromString(const char* code)
 {
-  static int size =
-    sizeof(SEDML_AXIS_TYPE_STRINGS)/sizeof(SEDML_AXIS_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return SEDML_AXISTYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SEDML_AXIS_TYPE_STRINGS[i])
+  case 5:
+    if (strcmp(code, SEDML_AXIS_TYPE_STRINGS[1]) == 0)
+    {
+      return SEDML_AXISTYPE_LOG10;
+    }
+
+    break;
+  case 6:
+    if (strcmp(code, SEDML_AXIS_TYPE_STRINGS[0]) == 0)
     {
-      return (AxisType_t)(i);
+      return SEDML_AXISTYPE_LINEAR;
     }
+
+    break;
+  default:
+    break;
   }
 
   return SEDML_AXISTYPE_INVALID;
@@ -249,16 +277,47 @@ LIBSEDML_EXTERN
 LineType_t
 LineType_fromString(const char* code)
 {
-  static int size =
-    sizeof(SEDML_LINE_TYPE_STRINGS)/sizeof(SEDML_LINE_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return SEDML_LINETYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SEDML_LINE_TYPE_STRINGS[i])
+  case 3:
+    if (strcmp(code, SEDML_LINE_TYPE_STRINGS[3]) == 0)
+    {
+      return SEDML_LINETYPE_DOT;
+    }
+
+    break;
+  case 4:
+    if (strcmp(code, SEDML_LINE_TYPE_STRINGS[0]) == 0)
+    {
+      return SEDML_LINETYPE_NONE;
+    }
+    else if (strcmp(code, SEDML_LINE_TYPE_STRINGS[2]) == 0)
+    {
+      return SEDML_LINETYPE_DASH;
+    }
+
+    break;
+  case 5:
+    if (strcmp(code, SEDML_LINE_TYPE_STRINGS[1]) == 0)
     {
-      return (LineType_t)(i);
+      return SEDML_LINETYPE_SOLID;
     }
+
+    break;
+  case 7:
+    if (strcmp(code, SEDML_LINE_TYPE_STRINGS[4]) == 0)
+    {
+      return SEDML_LINETYPE_DASHDOT;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return SEDML_LINETYPE_INVALID;
@@ -347,16 +406,88 @@ LIBSEDML_EXTERN
 MarkerType_t
 MarkerType_fromString(const char* code)
 {
-  static int size =
-    sizeof(SEDML_MARKER_TYPE_STRINGS)/sizeof(SEDML_MARKER_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return SEDML_MARKERTYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SEDML_MARKER_TYPE_STRINGS[i])
+  case 4:
+    if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[0]) == 0)
+    {
+      return SEDML_MARKERTYPE_NONE;
+    }
+    else if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[5]) == 0)
+    {
+      return SEDML_MARKERTYPE_PLUS;
+    }
+    else if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[6]) == 0)
+    {
+      return SEDML_MARKERTYPE_STAR;
+    }
+
+    break;
+  case 5:
+    if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[11]) == 0)
+    {
+      return SEDML_MARKERTYPE_HDASH;
+    }
+    else if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[12]) == 0)
+    {
+      return SEDML_MARKERTYPE_VDASH;
+    }
+
+    break;
+  case 6:
+    if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[1]) == 0)
+    {
+      return SEDML_MARKERTYPE_SQUARE;
+    }
+    else if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[2]) == 0)
+    {
+      return SEDML_MARKERTYPE_CIRCLE;
+    }
+    else if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[4]) == 0)
+    {
+      return SEDML_MARKERTYPE_XCROSS;
+    }
+
+    break;
+  case 7:
+    if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[3]) == 0)
     {
-      return (MarkerType_t)(i);
+      return SEDML_MARKERTYPE_DIAMOND;
     }
+
+    break;
+  case 10:
+    if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[7]) == 0)
+    {
+      return SEDML_MARKERTYPE_TRIANGLEUP;
+    }
+
+    break;
+  case 12:
+    if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[8]) == 0)
+    {
+      return SEDML_MARKERTYPE_TRIANGLEDOWN;
+    }
+    else if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[9]) == 0)
+    {
+      return SEDML_MARKERTYPE_TRIANGLELEFT;
+    }
+
+    break;
+  case 13:
+    if (strcmp(code, SEDML_MARKER_TYPE_STRINGS[10]) == 0)
+    {
+      return SEDML_MARKERTYPE_TRIANGLERIGHT;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return SEDML_MARKERTYPE_INVALID;
@@ -435,16 +566,36 @@ LIBSEDML_EXTERN
 CurveType_t
 CurveType_fromString(const char* code)
 {
-  static int size =
-    sizeof(SEDML_CURVE_TYPE_STRINGS)/sizeof(SEDML_CURVE_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return SEDML_CURVETYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SEDML_CURVE_TYPE_STRINGS[i])
+  case 3:
+    if (strcmp(code, SEDML_CURVE_TYPE_STRINGS[1]) == 0)
+    {
+      return SEDML_CURVETYPE_BAR;
+    }
+
+    break;
+  case 6:
+    if (strcmp(code, SEDML_CURVE_TYPE_STRINGS[0]) == 0)
+    {
+      return SEDML_CURVETYPE_POINTS;
+    }
+
+    break;
+  case 10:
+    if (strcmp(code, SEDML_CURVE_TYPE_STRINGS[2]) == 0)
     {
-      return (CurveType_t)(i);
+      return SEDML_CURVETYPE_BARSTACKED;
     }
+
+    break;
+  default:
+    break;
   }
 
   return SEDML_CURVETYPE_INVALID;
@@ -527,15 +678,61 @@ LIBSEDML_EXTERN
 SurfaceType_t
 SurfaceType_fromString(const char* code)
 {
-  static int size = sizeof(SEDML_SURFACE_TYPE_STRINGS)/sizeof(SEDML_SURFACE_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return SEDML_SURFACETYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SEDML_SURFACE_TYPE_STRINGS[i])
+  case 3:
+    if (strcmp(code, SEDML_SURFACE_TYPE_STRINGS[6]) == 0)
     {
-      return (SurfaceType_t)(i);
+      return SEDML_SURFACETYPE_BAR;
     }
+
+    break;
+  case 7:
+    if (strcmp(code, SEDML_SURFACE_TYPE_STRINGS[3]) == 0)
+    {
+      return SEDML_SURFACETYPE_CONTOUR;
+    }
+    else if (strcmp(code, SEDML_SURFACE_TYPE_STRINGS[4]) == 0)
+    {
+      return SEDML_SURFACETYPE_HEATMAP;
+    }
+
+    break;
+  case 11:
+    if (strcmp(code, SEDML_SURFACE_TYPE_STRINGS[1]) == 0)
+    {
+      return SEDML_SURFACETYPE_SURFACEMESH;
+    }
+
+    break;
+  case 13:
+    if (strcmp(code, SEDML_SURFACE_TYPE_STRINGS[5]) == 0)
+    {
+      return SEDML_SURFACETYPE_STACKEDCURVES;
+    }
+
+    break;
+  case 14:
+    if (strcmp(code, SEDML_SURFACE_TYPE_STRINGS[2]) == 0)
+    {
+      return SEDML_SURFACETYPE_SURFACECONTOUR;
+    }
+
+    break;
+  case 15:
+    if (strcmp(code, SEDML_SURFACE_TYPE_STRINGS[0]) == 0)
+    {
+      return SEDML_SURFACETYPE_PARAMETRICCURVE;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return SEDML_SURFACETYPE_INVALID;
@@ -613,15 +810,29 @@ LIBSEDML_EXTERN
 ExperimentType_t
 ExperimentType_fromString(const char* code)
 {
-  static int size = sizeof(SEDML_EXPERIMENT_TYPE_STRINGS)/sizeof(SEDML_EXPERIMENT_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return SEDML_EXPERIMENTTYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (strlen(code))
   {
-    if (type == SEDML_EXPERIMENT_TYPE_STRINGS[i])
+  case 10:
+    if (strcmp(code, SEDML_EXPERIMENT_TYPE_STRINGS[1]) == 0)
     {
-      return (ExperimentType_t)(i);
+      return SEDML_EXPERIMENTTYPE_TIMECOURSE;
     }
+
+    break;
+  case 11:
+    if (strcmp(code, SEDML_EXPERIMENT_TYPE_STRINGS[0]) == 0)
+    {
+      return SEDML_EXPERIMENTTYPE_STEADYSTATE;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return SEDML_EXPERIMENTTYPE_INVALID;
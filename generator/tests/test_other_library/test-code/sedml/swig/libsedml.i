@@ -219,6 +219,14 @@ LIBSEDML_CPP_NAMESPACE_USE
 %ignore XMLOutputStream::writeAttribute(const std::string&, const unsigned int&);
 %ignore XMLOutputStream::writeAttribute(const XMLTriple&,   const unsigned int&);
 
+/**
+ * Let SedReader::readSedMLFromBuffer take a string (Python) or a byte
+ * array (Java) in place of its data and length arguments.
+ */
+#if defined(SWIGPYTHON) || defined(SWIGJAVA)
+%apply (char *STRING, size_t LENGTH) { (const char *data, size_t length) };
+#endif
+
 /**
  * The following methods will create new objects.  To prevent memory
  * leaks we must inform SWIG of this.
@@ -229,10 +237,12 @@ LIBSEDML_CPP_NAMESPACE_USE
 %newobject *::clone;
 %newobject SedBase::toSed;
 %newobject SedReader::readSedMLFromString;
+%newobject SedReader::readSedMLFromBuffer;
 %newobject SedReader::readSedMLFromFile;
 %newobject SedReader::readSedML;
 %newobject readSedML(const char *);
 %newobject readSedMLFromString(const char *);
+%newobject readSedMLFromBuffer(const char *, size_t);
 %newobject readSedMLFromFile(const char *);
 %newobject SedWriter::writeToString;
 %newobject writeSedMLToString;
@@ -569,6 +569,73 @@ def has_array(attributes):
     return False
 
 
+def get_array_text_codec(element):
+    """
+    Get the C library calls used to read and write the values of an
+    array as text.
+
+    Floating point values are read and written with libSBML's C locale
+    functions, as the decimal point of strtod and printf depends on
+    LC_NUMERIC, and infinities and NaN are written as XML Schema spells
+    them (INF, -INF and NaN).  Integers are not affected by the locale.
+
+    :param element: the C type of the values in the array, e.g. 'int'
+    :return: a tuple of the conversion call (to be formatted with the
+        position to read from and the name of the end pointer), the type it
+        returns, the printf function and the format writing a value followed
+        by a space, and whether infinities and NaN must be written out
+        separately; or None if the values are not numbers.
+    """
+    if element in ['int', 'long', 'short']:
+        return ['strtol({0}, &{1}, 10)', 'long', 'snprintf', '%ld ', False]
+    elif element in ['unsigned int', 'unsignedInt', 'uint', 'unsigned long']:
+        return ['strtoul({0}, &{1}, 10)', 'unsigned long', 'snprintf',
+                '%lu ', False]
+    elif element in ['double', 'float']:
+        return ['c_locale_strtod({0}, &{1})', 'double', 'c_locale_snprintf',
+                '%.15g ', True]
+    else:
+        return None
+
+
+def get_array_storage_type(value):
+    """
+    Get the C type in which the values of an array are stored when they are
+    typed by an enumeration value.
+
+    :param value: the value of the enumeration, e.g. 'uint8'
+    :return: the C type holding values of that kind, e.g. 'unsigned char',
+        or None if the value does not name a number type.
+    """
+    storage_types = dict({'int8': 'signed char', 'uint8': 'unsigned char',
+                          'int16': 'short', 'uint16': 'unsigned short',
+                          'int32': 'int', 'uint32': 'unsigned int',
+                          'float': 'float', 'double': 'double'})
+    if value in storage_types:
+        return storage_types[value]
+    return None
+
+
+def get_array_storage_limits(c_type):
+    """
+    Get the limits of the values held by a C type in which the values of an
+    array are stored.
+
+    :param c_type: the C type, e.g. 'unsigned char'
+    :return: the [lowest, highest] values of that type, e.g.
+        ['0', 'UCHAR_MAX'], or None if it holds any double.
+    """
+    storage_limits = dict({'signed char': ['SCHAR_MIN', 'SCHAR_MAX'],
+                           'unsigned char': ['0', 'UCHAR_MAX'],
+                           'short': ['SHRT_MIN', 'SHRT_MAX'],
+                           'unsigned short': ['0', 'USHRT_MAX'],
+                           'int': ['INT_MIN', 'INT_MAX'],
+                           'unsigned int': ['0', 'UINT_MAX'],
+                           'float': ['-FLT_MAX', 'FLT_MAX']})
+    if c_type in storage_limits:
+        return storage_limits[c_type]
+    return None
+
 def has_vector(attributes):
     """
     Check if any of the attributes represented in a list are of type 'vector'.